@@ -405,15 +405,29 @@ createTransformationSequence(rvsdg::DotWriter & dotWriter, const bool dumpRvsdgG
   // Use this transformation to dump HLS dot graphs at specific points in the sequence
   [[maybe_unused]] auto dumpDot = std::make_shared<DumpDotTransformation>();
 
+  // Alternates dead and common node elimination until neither finds anything to remove. If the
+  // iteration limit is reached first, the final dead node elimination removes the nodes that the
+  // last common node elimination made dead.
+  const size_t maxCleanupIterations = 4;
+  auto cleanupIterations = std::make_shared<rvsdg::TransformationSequence>(
+      std::vector<std::shared_ptr<rvsdg::Transformation>>(
+          { deadNodeElimination, commonNodeElimination }),
+      dotWriter,
+      false,
+      1,
+      maxCleanupIterations);
+  auto cleanup = std::make_shared<rvsdg::TransformationSequence>(
+      std::vector<std::shared_ptr<rvsdg::Transformation>>(
+          { cleanupIterations, deadNodeElimination }),
+      dotWriter,
+      false);
+
   std::vector<std::shared_ptr<rvsdg::Transformation>> sequence({
       loopUnswitching,
-      deadNodeElimination,
-      commonNodeElimination,
+      cleanup,
       invariantValueRedirection,
       predicateCorrelation,
-      deadNodeElimination,
-      commonNodeElimination,
-      deadNodeElimination,
+      cleanup,
       ioBarrierRemoval,
       ioStateElimination,
       memoryStateSeparation,
@@ -421,8 +435,7 @@ createTransformationSequence(rvsdg::DotWriter & dotWriter, const bool dumpRvsdgG
       unusedStateRemoval,
       deadNodeElimination,
       loopUnswitching,
-      commonNodeElimination,
-      deadNodeElimination,
+      cleanup,
       gammaMerge,
       deadNodeElimination,
       unusedStateRemoval,
@@ -33,6 +33,12 @@ public:
 
   void
   Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  IsIdempotent() const noexcept override
+  {
+    return true;
+  }
 };
 
 }
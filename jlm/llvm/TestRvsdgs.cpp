@@ -20,6 +20,10 @@
 #include <jlm/rvsdg/bitstring/comparison.hpp>
 #include <jlm/rvsdg/gamma.hpp>
 #include <jlm/rvsdg/theta.hpp>
+#include <jlm/util/strfmt.hpp>
+
+#include <random>
+#include <unordered_map>
 
 namespace jlm::llvm
 {
@@ -4218,4 +4222,311 @@ VariadicFunctionTest2::SetupRvsdg()
   return rvsdgModule;
 }
 
+/**
+ * Combines \p values pairwise with xor nodes until a single value remains. The depth of the
+ * created nodes is logarithmic in the number of values.
+ *
+ * @return The combined value.
+ */
+static rvsdg::Output &
+CombineValues(std::vector<rvsdg::Output *> values)
+{
+  JLM_ASSERT(!values.empty());
+
+  while (values.size() > 1)
+  {
+    std::vector<rvsdg::Output *> combinedValues;
+    for (size_t n = 0; n + 1 < values.size(); n += 2)
+      combinedValues.push_back(rvsdg::bitxor_op::create(32, values[n], values[n + 1]));
+    if (values.size() % 2 != 0)
+      combinedValues.push_back(values.back());
+
+    values = std::move(combinedValues);
+  }
+
+  return *values[0];
+}
+
+/**
+ * Creates about \p numNodes arithmetic nodes in the region of \p value that each depend on
+ * \p value, and combines their results.
+ *
+ * @return The combined result of the nodes.
+ */
+static rvsdg::Output &
+CreateArithmeticNodes(rvsdg::Output & value, size_t numNodes)
+{
+  auto & region = *value.region();
+
+  std::vector<rvsdg::Output *> values({ &value });
+  for (size_t n = 0; n + 3 <= numNodes; n += 3)
+  {
+    const auto constantValue = static_cast<int64_t>(n % 64 + 1);
+    auto constant = IntegerConstantOperation::Create(region, { 32, constantValue }).output(0);
+    values.push_back(rvsdg::bitadd_op::create(32, &value, constant));
+  }
+
+  return CombineValues(std::move(values));
+}
+
+std::unique_ptr<LlvmRvsdgModule>
+ScalableWideRegionTest::SetupRvsdg()
+{
+  using namespace jlm::rvsdg;
+
+  auto bit32Type = BitType::Create(32);
+  auto functionType = FunctionType::Create(
+      { bit32Type, bit32Type, IOStateType::Create(), MemoryStateType::Create() },
+      { bit32Type, IOStateType::Create(), MemoryStateType::Create() });
+
+  auto module = LlvmRvsdgModule::Create(util::FilePath(""), "", "");
+  auto lambda = LambdaNode::Create(
+      module->Rvsdg().GetRootRegion(),
+      LlvmLambdaOperation::Create(functionType, "f", Linkage::externalLinkage));
+  auto & region = *lambda->subregion();
+  auto x = lambda->GetFunctionArguments()[0];
+  auto y = lambda->GetFunctionArguments()[1];
+
+  std::vector<rvsdg::Output *> values({ y });
+  size_t numNodes = 0;
+  for (size_t n = 0; numNodes < NumNodes_; n++)
+  {
+    // Every fourth chain duplicates its predecessor
+    const auto value = static_cast<int64_t>((n % 4 == 3 ? n - 1 : n) % 64);
+    auto constant = IntegerConstantOperation::Create(region, { 32, value }).output(0);
+    auto sum = bitadd_op::create(32, x, constant);
+    auto product = bitmul_op::create(32, sum, y);
+    numNodes += 3;
+
+    // Every eighth chain is dead
+    if (n % 8 == 7)
+      continue;
+
+    values.push_back(product);
+    numNodes++;
+  }
+
+  auto & result = CombineValues(std::move(values));
+
+  lambda->finalize(
+      { &result, lambda->GetFunctionArguments()[2], lambda->GetFunctionArguments()[3] });
+  GraphExport::Create(*lambda->output(), "f");
+
+  return module;
+}
+
+/**
+ * Creates \p depth nested theta and gamma nodes in the region of \p value. The outermost node is
+ * a theta node if \p isTheta is true, and a gamma node otherwise. Each region on the nesting path
+ * contains about \p numNodesPerRegion arithmetic nodes.
+ *
+ * @return The output that represents the value computed by the nest.
+ */
+static rvsdg::Output &
+CreateNest(rvsdg::Output & value, size_t depth, size_t numNodesPerRegion, bool isTheta)
+{
+  using namespace jlm::rvsdg;
+
+  auto & combinedValue = CreateArithmeticNodes(value, numNodesPerRegion);
+  if (depth == 0)
+    return combinedValue;
+
+  auto & region = *combinedValue.region();
+  if (isTheta)
+  {
+    auto zero = IntegerConstantOperation::Create(region, { 32, 0 }).output(0);
+
+    auto theta = ThetaNode::create(&region);
+    auto counter = theta->AddLoopVar(zero);
+    auto loopValue = theta->AddLoopVar(&combinedValue);
+
+    auto & body = CreateNest(*loopValue.pre, depth - 1, numNodesPerRegion, false);
+
+    auto one = IntegerConstantOperation::Create(*theta->subregion(), { 32, 1 }).output(0);
+    auto ten = IntegerConstantOperation::Create(*theta->subregion(), { 32, 10 }).output(0);
+    auto increment = bitadd_op::create(32, counter.pre, one);
+    auto compare = bitult_op::create(32, increment, ten);
+    auto & predicateNode = MatchOperation::CreateNode(*compare, { { 1, 1 } }, 0, 2);
+
+    counter.post->divert_to(increment);
+    loopValue.post->divert_to(&body);
+    theta->set_predicate(predicateNode.output(0));
+
+    return *loopValue.output;
+  }
+
+  auto four = IntegerConstantOperation::Create(region, { 32, 4 }).output(0);
+  auto compare = bitult_op::create(32, &combinedValue, four);
+  auto & predicateNode = MatchOperation::CreateNode(*compare, { { 1, 1 } }, 0, 2);
+
+  auto gamma = GammaNode::create(predicateNode.output(0), 2);
+  auto entryVar = gamma->AddEntryVar(&combinedValue);
+
+  auto & branchValue = CreateNest(*entryVar.branchArgument[0], depth - 1, numNodesPerRegion, true);
+  auto exitVar = gamma->AddExitVar({ &branchValue, entryVar.branchArgument[1] });
+
+  return *exitVar.output;
+}
+
+std::unique_ptr<LlvmRvsdgModule>
+ScalableNestingTest::SetupRvsdg()
+{
+  using namespace jlm::rvsdg;
+
+  auto bit32Type = BitType::Create(32);
+  auto functionType = FunctionType::Create(
+      { bit32Type, IOStateType::Create(), MemoryStateType::Create() },
+      { bit32Type, IOStateType::Create(), MemoryStateType::Create() });
+
+  auto module = LlvmRvsdgModule::Create(util::FilePath(""), "", "");
+  auto lambda = LambdaNode::Create(
+      module->Rvsdg().GetRootRegion(),
+      LlvmLambdaOperation::Create(functionType, "f", Linkage::externalLinkage));
+
+  auto & result =
+      CreateNest(*lambda->GetFunctionArguments()[0], Depth_, NumNodesPerRegion_, true);
+
+  lambda->finalize(
+      { &result, lambda->GetFunctionArguments()[1], lambda->GetFunctionArguments()[2] });
+  GraphExport::Create(*lambda->output(), "f");
+
+  return module;
+}
+
+std::unique_ptr<LlvmRvsdgModule>
+ScalableCallGraphTest::SetupRvsdg()
+{
+  using namespace jlm::rvsdg;
+
+  auto bit32Type = BitType::Create(32);
+  auto functionType = FunctionType::Create(
+      { bit32Type, IOStateType::Create(), MemoryStateType::Create() },
+      { bit32Type, IOStateType::Create(), MemoryStateType::Create() });
+
+  auto module = LlvmRvsdgModule::Create(util::FilePath(""), "", "");
+  auto & rootRegion = module->Rvsdg().GetRootRegion();
+
+  // The callees are chosen randomly, but with a fixed seed such that the RVSDG is deterministic.
+  // This keeps the call graph shallow in contrast to, e.g., always calling the direct predecessor.
+  std::minstd_rand randomNumberGenerator(42);
+
+  std::vector<LambdaNode *> lambdas;
+  for (size_t n = 0; n < NumFunctions_; n++)
+  {
+    const auto linkage =
+        n + 1 == NumFunctions_ ? Linkage::externalLinkage : Linkage::internalLinkage;
+    auto lambda = LambdaNode::Create(
+        rootRegion,
+        LlvmLambdaOperation::Create(functionType, util::strfmt("f", n), linkage));
+
+    auto value = lambda->GetFunctionArguments()[0];
+    auto ioState = lambda->GetFunctionArguments()[1];
+    auto memoryState = lambda->GetFunctionArguments()[2];
+
+    std::unordered_map<LambdaNode *, rvsdg::Output *> contextVars;
+    for (size_t k = 0; k < std::min(n, NumCallsPerFunction_); k++)
+    {
+      auto callee = lambdas[randomNumberGenerator() % n];
+
+      auto & contextVar = contextVars[callee];
+      if (contextVar == nullptr)
+        contextVar = lambda->AddContextVar(*callee->output()).inner;
+
+      auto & callNode =
+          CallOperation::CreateNode(contextVar, functionType, { value, ioState, memoryState });
+      value = bitadd_op::create(32, value, callNode.output(0));
+      ioState = &CallOperation::GetIOStateOutput(callNode);
+      memoryState = &CallOperation::GetMemoryStateOutput(callNode);
+    }
+
+    lambda->finalize({ value, ioState, memoryState });
+    lambdas.push_back(lambda);
+  }
+
+  GraphExport::Create(*lambdas.back()->output(), util::strfmt("f", NumFunctions_ - 1));
+
+  return module;
+}
+
+std::unique_ptr<LlvmRvsdgModule>
+ScalablePointerTest::SetupRvsdg()
+{
+  using namespace jlm::rvsdg;
+
+  auto pointerType = PointerType::Create();
+  auto functionType = FunctionType::Create(
+      { pointerType, IOStateType::Create(), MemoryStateType::Create() },
+      { pointerType, IOStateType::Create(), MemoryStateType::Create() });
+
+  auto module = LlvmRvsdgModule::Create(util::FilePath(""), "", "");
+  auto & rootRegion = module->Rvsdg().GetRootRegion();
+
+  // See ScalableCallGraphTest for the choice of the callees
+  std::minstd_rand randomNumberGenerator(42);
+
+  std::vector<LambdaNode *> lambdas;
+  for (size_t n = 0; n < NumFunctions_; n++)
+  {
+    const auto linkage =
+        n + 1 == NumFunctions_ ? Linkage::externalLinkage : Linkage::internalLinkage;
+    auto lambda = LambdaNode::Create(
+        rootRegion,
+        LlvmLambdaOperation::Create(functionType, util::strfmt("f", n), linkage));
+    auto & region = *lambda->subregion();
+
+    auto pointerArgument = lambda->GetFunctionArguments()[0];
+    auto ioState = lambda->GetFunctionArguments()[1];
+
+    auto one = IntegerConstantOperation::Create(region, { 32, 1 }).output(0);
+
+    std::vector<rvsdg::Output *> addresses;
+    std::vector<rvsdg::Output *> memoryStates({ lambda->GetFunctionArguments()[2] });
+    for (size_t k = 0; k < NumAllocasPerFunction_; k++)
+    {
+      auto allocaResults = AllocaOperation::create(pointerType, one, 8);
+      addresses.push_back(allocaResults[0]);
+      memoryStates.push_back(allocaResults[1]);
+    }
+    auto memoryState = MemoryStateMergeOperation::Create(memoryStates);
+
+    // Store the pointer argument into the first alloca, and the address of each alloca into its
+    // successor
+    for (size_t k = 0; k < addresses.size(); k++)
+    {
+      auto value = k == 0 ? pointerArgument : addresses[k - 1];
+      memoryState = StoreNonVolatileOperation::Create(addresses[k], value, { memoryState }, 8)[0];
+    }
+
+    rvsdg::Output * loadedPointer = nullptr;
+    for (auto address : addresses)
+    {
+      auto loadResults =
+          LoadNonVolatileOperation::Create(address, { memoryState }, pointerType, 8);
+      loadedPointer = loadResults[0];
+      memoryState = loadResults[1];
+    }
+
+    auto result = loadedPointer;
+    if (!lambdas.empty())
+    {
+      auto callee = lambdas[randomNumberGenerator() % n];
+      auto contextVar = lambda->AddContextVar(*callee->output()).inner;
+      auto & callNode = CallOperation::CreateNode(
+          contextVar,
+          functionType,
+          { loadedPointer, ioState, memoryState });
+      result = callNode.output(0);
+      ioState = &CallOperation::GetIOStateOutput(callNode);
+      memoryState = &CallOperation::GetMemoryStateOutput(callNode);
+    }
+
+    lambda->finalize({ result, ioState, memoryState });
+    lambdas.push_back(lambda);
+  }
+
+  GraphExport::Create(*lambdas.back()->output(), util::strfmt("f", NumFunctions_ - 1));
+
+  return module;
+}
+
 }
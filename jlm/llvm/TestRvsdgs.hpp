@@ -2553,6 +2553,101 @@ private:
   rvsdg::Node * AllocaNode_ = {};
 };
 
+/**
+ * This class sets up an RVSDG with a single function whose region contains \p numNodes simple
+ * nodes. The nodes form many short, independent chains of arithmetic operations, whose results
+ * are combined into the return value. Every fourth chain is a duplicate of its predecessor, and
+ * every eighth chain computes a value that is never used. The RVSDG is meant for benchmarking
+ * transformations on wide regions, e.g., dead node and common node elimination.
+ */
+class ScalableWideRegionTest final : public RvsdgTest
+{
+public:
+  explicit ScalableWideRegionTest(size_t numNodes)
+      : NumNodes_(numNodes)
+  {}
+
+private:
+  std::unique_ptr<LlvmRvsdgModule>
+  SetupRvsdg() override;
+
+  size_t NumNodes_;
+};
+
+/**
+ * This class sets up an RVSDG with a single function that contains \p depth nested structural
+ * nodes, alternating between theta and gamma nodes starting with a theta node. Every region on the
+ * nesting path contains \p numNodesPerRegion arithmetic nodes. The second subregion of each gamma
+ * node simply passes its value through. The RVSDG is meant for benchmarking traversals and
+ * transformations on deeply nested regions.
+ */
+class ScalableNestingTest final : public RvsdgTest
+{
+public:
+  ScalableNestingTest(size_t depth, size_t numNodesPerRegion)
+      : Depth_(depth),
+        NumNodesPerRegion_(numNodesPerRegion)
+  {}
+
+private:
+  std::unique_ptr<LlvmRvsdgModule>
+  SetupRvsdg() override;
+
+  size_t Depth_;
+  size_t NumNodesPerRegion_;
+};
+
+/**
+ * This class sets up an RVSDG with \p numFunctions functions. Each function calls up to
+ * \p numCallsPerFunction randomly chosen, previously defined functions and sums up the results.
+ * Only the last function is exported. The random choices are deterministic. The RVSDG is meant for
+ * benchmarking interprocedural analyses and transformations on large call graphs.
+ */
+class ScalableCallGraphTest final : public RvsdgTest
+{
+public:
+  ScalableCallGraphTest(size_t numFunctions, size_t numCallsPerFunction)
+      : NumFunctions_(numFunctions),
+        NumCallsPerFunction_(numCallsPerFunction)
+  {
+    JLM_ASSERT(numFunctions > 0);
+  }
+
+private:
+  std::unique_ptr<LlvmRvsdgModule>
+  SetupRvsdg() override;
+
+  size_t NumFunctions_;
+  size_t NumCallsPerFunction_;
+};
+
+/**
+ * This class sets up an RVSDG with \p numFunctions functions that each allocate
+ * \p numAllocasPerFunction pointers on the stack. Each function stores the addresses of its
+ * allocas into each other, loads them back, passes one of the loaded pointers to a randomly chosen,
+ * previously defined function, and returns the pointer returned by the call. Only the last function
+ * is exported. The RVSDG is meant for benchmarking alias analyses and the memory state encoding on
+ * pointer-heavy code.
+ */
+class ScalablePointerTest final : public RvsdgTest
+{
+public:
+  ScalablePointerTest(size_t numFunctions, size_t numAllocasPerFunction)
+      : NumFunctions_(numFunctions),
+        NumAllocasPerFunction_(numAllocasPerFunction)
+  {
+    JLM_ASSERT(numFunctions > 0);
+    JLM_ASSERT(numAllocasPerFunction > 0);
+  }
+
+private:
+  std::unique_ptr<LlvmRvsdgModule>
+  SetupRvsdg() override;
+
+  size_t NumFunctions_;
+  size_t NumAllocasPerFunction_;
+};
+
 }
 
 #endif
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jlm/llvm/ir/operators/call.hpp>
+#include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
+#include <jlm/llvm/opt/alias-analyses/MemoryStateEncoder.hpp>
+#include <jlm/llvm/opt/alias-analyses/RegionAwareModRefSummarizer.hpp>
+#include <jlm/llvm/opt/CommonNodeElimination.hpp>
+#include <jlm/llvm/opt/DeadNodeElimination.hpp>
+#include <jlm/llvm/TestRvsdgs.hpp>
+#include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/Statistics.hpp>
+
+/**
+ * Counts the nodes of type \p NodeType in \p region and all its subregions.
+ */
+template<class NodeType>
+static size_t
+CountNodes(const jlm::rvsdg::Region & region)
+{
+  size_t numNodes = 0;
+  for (auto & node : region.Nodes())
+  {
+    if (dynamic_cast<const NodeType *>(&node))
+      numNodes++;
+
+    if (auto structuralNode = dynamic_cast<const jlm::rvsdg::StructuralNode *>(&node))
+    {
+      for (auto & subregion : structuralNode->Subregions())
+        numNodes += CountNodes<NodeType>(subregion);
+    }
+  }
+
+  return numNodes;
+}
+
+TEST(TestRvsdgsTests, WideRegion)
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  ScalableWideRegionTest test(1000);
+  auto & rvsdgModule = test.module();
+  const auto numNodes = jlm::rvsdg::nnodes(&rvsdgModule.Rvsdg().GetRootRegion());
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  DeadNodeElimination().Run(rvsdgModule, statisticsCollector);
+  const auto numNodesAfterDne = jlm::rvsdg::nnodes(&rvsdgModule.Rvsdg().GetRootRegion());
+  CommonNodeElimination().Run(rvsdgModule, statisticsCollector);
+  DeadNodeElimination().Run(rvsdgModule, statisticsCollector);
+  const auto numNodesAfterCne = jlm::rvsdg::nnodes(&rvsdgModule.Rvsdg().GetRootRegion());
+
+  // Assert
+  // The lambda node is counted in addition to the requested nodes
+  EXPECT_GE(numNodes, 1001u);
+  EXPECT_LE(numNodes, 1005u);
+  EXPECT_LT(numNodesAfterDne, numNodes);
+  EXPECT_LT(numNodesAfterCne, numNodesAfterDne);
+}
+
+TEST(TestRvsdgsTests, Nesting)
+{
+  using namespace jlm::llvm;
+
+  // Arrange & Act
+  ScalableNestingTest test(5, 10);
+  auto & rootRegion = test.module().Rvsdg().GetRootRegion();
+
+  // Assert
+  EXPECT_EQ(CountNodes<jlm::rvsdg::ThetaNode>(rootRegion), 3u);
+  EXPECT_EQ(CountNodes<jlm::rvsdg::GammaNode>(rootRegion), 2u);
+  EXPECT_GE(jlm::rvsdg::nnodes(&rootRegion), 6u * 10u);
+}
+
+TEST(TestRvsdgsTests, CallGraph)
+{
+  using namespace jlm::llvm;
+
+  // Arrange & Act
+  ScalableCallGraphTest test(10, 3);
+  auto & rootRegion = test.module().Rvsdg().GetRootRegion();
+
+  // Assert
+  // The functions contain 0, 1, 2, 3, ..., 3 calls, and each call is followed by an addition
+  EXPECT_EQ(CountNodes<jlm::rvsdg::LambdaNode>(rootRegion), 10u);
+  EXPECT_EQ(CountNodes<jlm::rvsdg::SimpleNode>(rootRegion), 2u * (1u + 2u + 7u * 3u));
+  EXPECT_EQ(rootRegion.nresults(), 1u);
+}
+
+TEST(TestRvsdgsTests, Pointer)
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  ScalablePointerTest test(10, 4);
+  auto & rvsdgModule = test.module();
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  auto pointsToGraph = aa::Andersen().Analyze(rvsdgModule, statisticsCollector);
+  auto modRefSummary =
+      aa::RegionAwareModRefSummarizer::Create(rvsdgModule, *pointsToGraph, statisticsCollector);
+  aa::MemoryStateEncoder().Encode(rvsdgModule, *modRefSummary, statisticsCollector);
+
+  // Assert
+  EXPECT_EQ(pointsToGraph->numAllocaNodes(), 10u * 4u);
+}
@@ -0,0 +1,2105 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/operators/alloca.hpp>
+#include <jlm/llvm/ir/operators/AggregateOperations.hpp>
+#include <jlm/llvm/ir/operators/call.hpp>
+#include <jlm/llvm/ir/operators/ConversionOperations.hpp>
+#include <jlm/llvm/ir/operators/delta.hpp>
+#include <jlm/llvm/ir/operators/GetElementPtr.hpp>
+#include <jlm/llvm/ir/operators/IntegerOperations.hpp>
+#include <jlm/llvm/ir/operators/IOBarrier.hpp>
+#include <jlm/llvm/ir/operators/lambda.hpp>
+#include <jlm/llvm/ir/operators/Load.hpp>
+#include <jlm/llvm/ir/operators/MemoryStateOperations.hpp>
+#include <jlm/llvm/ir/operators/operators.hpp>
+#include <jlm/llvm/ir/operators/StdLibIntrinsicOperations.hpp>
+#include <jlm/llvm/ir/operators/Store.hpp>
+#include <jlm/llvm/ir/RvsdgBinaryFormat.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/rvsdg/bitstring.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/delta.hpp>
+#include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/lambda.hpp>
+#include <jlm/rvsdg/Phi.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+#include <jlm/rvsdg/UnitType.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace jlm::llvm
+{
+
+namespace
+{
+
+constexpr std::array<uint8_t, 8> Magic = { 'J', 'L', 'M', 'R', 'V', 'S', 'D', 'G' };
+
+/**
+ * The version of the format. It must be incremented on every change of the encoding, including
+ * appending operations to the operation lists below.
+ */
+constexpr uint64_t FormatVersion = 1;
+
+enum class TypeTag : uint64_t
+{
+  Bit,
+  Control,
+  IOState,
+  MemoryState,
+  Pointer,
+  FloatingPoint,
+  Array,
+  FixedVector,
+  ScalableVector,
+  VariableArgument,
+  Unit,
+  Function,
+  Struct,
+  LastTag = Struct
+};
+
+enum class OperationTag : uint64_t
+{
+  // Simple operations
+  BitWidth,
+  Conversion,
+  BitConstant,
+  BitSlice,
+  BitConcat,
+  ControlConstant,
+  Match,
+  IntegerConstant,
+  LoadNonVolatile,
+  LoadVolatile,
+  StoreNonVolatile,
+  StoreVolatile,
+  Call,
+  Alloca,
+  GetElementPtr,
+  MemoryStateMerge,
+  MemoryStateJoin,
+  MemoryStateSplit,
+  LambdaEntryMemoryStateSplit,
+  LambdaExitMemoryStateMerge,
+  CallEntryMemoryStateMerge,
+  CallExitMemoryStateSplit,
+  IOBarrier,
+  UndefValue,
+  PoisonValue,
+  Freeze,
+  ConstantPointerNull,
+  ConstantFP,
+  FBinary,
+  FNeg,
+  FCmp,
+  PtrCmp,
+  Select,
+  Malloc,
+  Free,
+  VariadicArgumentList,
+  ConstantAggregateZero,
+  ConstantDataArray,
+  ConstantArray,
+  ConstantStruct,
+  ExtractValue,
+  InsertValue,
+  FPExt,
+  FPTrunc,
+  FPToUI,
+  FPToSI,
+  ControlToInt,
+  FunctionToPointer,
+  PointerToFunction,
+  MemCpyNonVolatile,
+  MemSetNonVolatile,
+
+  // Structural operations
+  Lambda,
+  Delta,
+  Gamma,
+  Theta,
+  Phi,
+  LastTag = Phi
+};
+
+template<typename... TOperations>
+struct OperationList
+{
+};
+
+template<typename T>
+struct OperationIdentity
+{
+  using Type = T;
+};
+
+/**
+ * Operations that are constructed from the bit width of their first operand. The position of an
+ * operation in the list is part of the format.
+ */
+using BitWidthOperations = OperationList<
+    rvsdg::bitneg_op,
+    rvsdg::bitnot_op,
+    rvsdg::bitadd_op,
+    rvsdg::bitand_op,
+    rvsdg::bitashr_op,
+    rvsdg::bitmul_op,
+    rvsdg::bitor_op,
+    rvsdg::bitsdiv_op,
+    rvsdg::bitshl_op,
+    rvsdg::bitshr_op,
+    rvsdg::bitsmod_op,
+    rvsdg::bitsmulh_op,
+    rvsdg::bitsub_op,
+    rvsdg::bitudiv_op,
+    rvsdg::bitumod_op,
+    rvsdg::bitumulh_op,
+    rvsdg::bitxor_op,
+    rvsdg::biteq_op,
+    rvsdg::bitne_op,
+    rvsdg::bitsge_op,
+    rvsdg::bitsgt_op,
+    rvsdg::bitsle_op,
+    rvsdg::bitslt_op,
+    rvsdg::bituge_op,
+    rvsdg::bitugt_op,
+    rvsdg::bitule_op,
+    rvsdg::bitult_op,
+    IntegerAddOperation,
+    IntegerSubOperation,
+    IntegerMulOperation,
+    IntegerSDivOperation,
+    IntegerUDivOperation,
+    IntegerSRemOperation,
+    IntegerURemOperation,
+    IntegerAShrOperation,
+    IntegerShlOperation,
+    IntegerLShrOperation,
+    IntegerAndOperation,
+    IntegerOrOperation,
+    IntegerXorOperation,
+    IntegerEqOperation,
+    IntegerNeOperation,
+    IntegerSgeOperation,
+    IntegerSgtOperation,
+    IntegerSleOperation,
+    IntegerSltOperation,
+    IntegerUgeOperation,
+    IntegerUgtOperation,
+    IntegerUleOperation,
+    IntegerUltOperation>;
+
+/**
+ * Unary operations that are constructed from their operand and result type. The position of an
+ * operation in the list is part of the format.
+ */
+using ConversionOperations = OperationList<
+    BitCastOperation,
+    SExtOperation,
+    ZExtOperation,
+    TruncOperation,
+    PtrToIntOperation,
+    UIToFPOperation,
+    SIToFPOperation,
+    IntToPtrOperation>;
+
+template<typename... TOperations>
+std::optional<uint64_t>
+findOperation(const rvsdg::Operation & operation, OperationList<TOperations...>)
+{
+  std::optional<uint64_t> position;
+  uint64_t n = 0;
+  ((typeid(operation) == typeid(TOperations) ? (void)(position = n) : (void)0, n++), ...);
+  return position;
+}
+
+template<typename... TOperations, typename TCreate>
+std::unique_ptr<rvsdg::Operation>
+createOperation(uint64_t position, OperationList<TOperations...>, const TCreate & create)
+{
+  std::unique_ptr<rvsdg::Operation> operation;
+  uint64_t n = 0;
+  ((n++ == position ? (void)(operation = create(OperationIdentity<TOperations>())) : (void)0),
+   ...);
+  return operation;
+}
+
+[[noreturn]] void
+throwMalformed()
+{
+  throw util::Error("Malformed binary RVSDG input.");
+}
+
+class Encoder final
+{
+public:
+  void
+  writeVarint(uint64_t value)
+  {
+    while (value >= 0x80)
+    {
+      bytes_.push_back(static_cast<uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    bytes_.push_back(static_cast<uint8_t>(value));
+  }
+
+  void
+  writeBytes(const uint8_t * data, size_t size)
+  {
+    bytes_.insert(bytes_.end(), data, data + size);
+  }
+
+  /**
+   * Appends \p section prefixed with its size in bytes.
+   */
+  void
+  writeSection(const Encoder & section)
+  {
+    writeVarint(section.bytes_.size());
+    writeBytes(section.bytes_.data(), section.bytes_.size());
+  }
+
+  [[nodiscard]] const std::vector<uint8_t> &
+  bytes() const noexcept
+  {
+    return bytes_;
+  }
+
+  [[nodiscard]] std::string
+  toKey() const
+  {
+    return { bytes_.begin(), bytes_.end() };
+  }
+
+private:
+  std::vector<uint8_t> bytes_{};
+};
+
+class Decoder final
+{
+public:
+  Decoder(const uint8_t * begin, const uint8_t * end)
+      : current_(begin),
+        end_(end)
+  {}
+
+  uint64_t
+  readVarint()
+  {
+    uint64_t value = 0;
+    for (size_t shift = 0; shift < 64; shift += 7)
+    {
+      if (current_ == end_)
+        throwMalformed();
+
+      const auto byte = *current_++;
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0)
+        return value;
+    }
+
+    throwMalformed();
+  }
+
+  /**
+   * Reads the number of elements of a sequence. Every element occupies at least one byte, which
+   * bounds the count by the number of remaining bytes.
+   */
+  size_t
+  readCount()
+  {
+    const auto count = readVarint();
+    if (count > remaining())
+      throwMalformed();
+
+    return count;
+  }
+
+  bool
+  readBool()
+  {
+    const auto value = readVarint();
+    if (value > 1)
+      throwMalformed();
+
+    return value == 1;
+  }
+
+  template<typename TEnum>
+  TEnum
+  readEnum(TEnum last)
+  {
+    const auto value = readVarint();
+    if (value > static_cast<uint64_t>(last))
+      throwMalformed();
+
+    return static_cast<TEnum>(value);
+  }
+
+  const uint8_t *
+  readBytes(size_t size)
+  {
+    if (size > remaining())
+      throwMalformed();
+
+    const auto bytes = current_;
+    current_ += size;
+    return bytes;
+  }
+
+  Decoder
+  readSection()
+  {
+    const auto size = readVarint();
+    const auto begin = readBytes(size);
+    return { begin, begin + size };
+  }
+
+  [[nodiscard]] bool
+  isAtEnd() const noexcept
+  {
+    return current_ == end_;
+  }
+
+private:
+  [[nodiscard]] size_t
+  remaining() const noexcept
+  {
+    return static_cast<size_t>(end_ - current_);
+  }
+
+  const uint8_t * current_;
+  const uint8_t * end_;
+};
+
+/**
+ * Encodes the characters '0', '1', 'X', and 'D' of a bit string with two bits each.
+ */
+void
+writeBitValue(const rvsdg::BitValueRepresentation & value, Encoder & encoder)
+{
+  static const std::string symbols = "01XD";
+
+  const auto bits = value.str();
+  encoder.writeVarint(bits.size());
+  for (size_t n = 0; n < bits.size(); n += 4)
+  {
+    uint8_t byte = 0;
+    for (size_t k = n; k < std::min(n + 4, bits.size()); k++)
+      byte |= static_cast<uint8_t>(symbols.find(bits[k]) << (2 * (k - n)));
+    encoder.writeBytes(&byte, 1);
+  }
+}
+
+rvsdg::BitValueRepresentation
+readBitValue(Decoder & decoder)
+{
+  static const std::string symbols = "01XD";
+
+  const auto numBits = decoder.readVarint();
+  if (numBits == 0)
+    throwMalformed();
+
+  const auto bytes = decoder.readBytes((numBits + 3) / 4);
+  std::string bits(numBits, '0');
+  for (size_t n = 0; n < numBits; n++)
+    bits[n] = symbols[(bytes[n / 4] >> (2 * (n % 4))) & 3];
+
+  return rvsdg::BitValueRepresentation(bits.c_str());
+}
+
+const ::llvm::fltSemantics &
+getFloatingPointSemantics(fpsize size)
+{
+  return ConstantFP::getZeroRepresentation(size).getSemantics();
+}
+
+/**
+ * Collects the interned string, type, and operation tables while a module is encoded.
+ */
+class WriterContext final
+{
+public:
+  uint64_t
+  internString(const std::string & string)
+  {
+    auto [it, inserted] = stringIndices_.emplace(string, stringIndices_.size());
+    if (inserted)
+    {
+      stringTable_.writeVarint(string.size());
+      stringTable_.writeBytes(reinterpret_cast<const uint8_t *>(string.data()), string.size());
+    }
+
+    return it->second;
+  }
+
+  uint64_t
+  internType(const rvsdg::Type & type)
+  {
+    if (const auto it = typeCache_.find(&type); it != typeCache_.end())
+      return it->second;
+
+    Encoder encoder;
+    encodeType(type, encoder);
+    const auto index = intern(encoder, typeIndices_, typeTable_);
+    typeCache_[&type] = index;
+    return index;
+  }
+
+  uint64_t
+  internOperation(const rvsdg::Operation & operation)
+  {
+    Encoder encoder;
+    encodeOperation(operation, encoder);
+    return intern(encoder, operationIndices_, operationTable_);
+  }
+
+  void
+  writeTables(Encoder & encoder) const
+  {
+    encoder.writeVarint(stringIndices_.size());
+    encoder.writeBytes(stringTable_.bytes().data(), stringTable_.bytes().size());
+    encoder.writeVarint(typeIndices_.size());
+    encoder.writeBytes(typeTable_.bytes().data(), typeTable_.bytes().size());
+    encoder.writeVarint(operationIndices_.size());
+    encoder.writeBytes(operationTable_.bytes().data(), operationTable_.bytes().size());
+  }
+
+private:
+  static uint64_t
+  intern(
+      const Encoder & entry,
+      std::unordered_map<std::string, uint64_t> & indices,
+      Encoder & table)
+  {
+    auto [it, inserted] = indices.emplace(entry.toKey(), indices.size());
+    if (inserted)
+      table.writeBytes(entry.bytes().data(), entry.bytes().size());
+
+    return it->second;
+  }
+
+  void
+  writeTypes(const std::vector<std::shared_ptr<const rvsdg::Type>> & types, Encoder & encoder)
+  {
+    encoder.writeVarint(types.size());
+    for (auto & type : types)
+      encoder.writeVarint(internType(*type));
+  }
+
+  void
+  encodeType(const rvsdg::Type & type, Encoder & encoder)
+  {
+    auto writeTag = [&](TypeTag tag)
+    {
+      encoder.writeVarint(static_cast<uint64_t>(tag));
+    };
+
+    if (auto bitType = dynamic_cast<const rvsdg::BitType *>(&type))
+    {
+      writeTag(TypeTag::Bit);
+      encoder.writeVarint(bitType->nbits());
+    }
+    else if (auto controlType = dynamic_cast<const rvsdg::ControlType *>(&type))
+    {
+      writeTag(TypeTag::Control);
+      encoder.writeVarint(controlType->nalternatives());
+    }
+    else if (rvsdg::is<IOStateType>(type))
+    {
+      writeTag(TypeTag::IOState);
+    }
+    else if (rvsdg::is<MemoryStateType>(type))
+    {
+      writeTag(TypeTag::MemoryState);
+    }
+    else if (rvsdg::is<PointerType>(type))
+    {
+      writeTag(TypeTag::Pointer);
+    }
+    else if (auto floatingPointType = dynamic_cast<const FloatingPointType *>(&type))
+    {
+      writeTag(TypeTag::FloatingPoint);
+      encoder.writeVarint(static_cast<uint64_t>(floatingPointType->size()));
+    }
+    else if (auto arrayType = dynamic_cast<const ArrayType *>(&type))
+    {
+      const auto elementType = internType(*arrayType->GetElementType());
+      writeTag(TypeTag::Array);
+      encoder.writeVarint(elementType);
+      encoder.writeVarint(arrayType->nelements());
+    }
+    else if (auto vectorType = dynamic_cast<const VectorType *>(&type))
+    {
+      const auto elementType = internType(*vectorType->Type());
+      writeTag(
+          rvsdg::is<FixedVectorType>(type) ? TypeTag::FixedVector : TypeTag::ScalableVector);
+      encoder.writeVarint(elementType);
+      encoder.writeVarint(vectorType->size());
+    }
+    else if (rvsdg::is<VariableArgumentType>(type))
+    {
+      writeTag(TypeTag::VariableArgument);
+    }
+    else if (rvsdg::is<rvsdg::UnitType>(type))
+    {
+      writeTag(TypeTag::Unit);
+    }
+    else if (auto functionType = dynamic_cast<const rvsdg::FunctionType *>(&type))
+    {
+      Encoder signature;
+      writeTypes(functionType->Arguments(), signature);
+      writeTypes(functionType->Results(), signature);
+      writeTag(TypeTag::Function);
+      encoder.writeBytes(signature.bytes().data(), signature.bytes().size());
+    }
+    else if (auto structType = dynamic_cast<const StructType *>(&type))
+    {
+      const auto elementTypes = structType->elementTypes();
+      Encoder elements;
+      writeTypes({ elementTypes.begin(), elementTypes.end() }, elements);
+      const auto name = structType->IsLiteral() ? 0 : internString(structType->GetName());
+      writeTag(TypeTag::Struct);
+      encoder.writeVarint(structType->IsLiteral());
+      encoder.writeVarint(structType->IsPacked());
+      encoder.writeVarint(name);
+      encoder.writeBytes(elements.bytes().data(), elements.bytes().size());
+    }
+    else
+    {
+      throw util::Error("Binary RVSDG format does not support type: " + type.debug_string());
+    }
+  }
+
+  void
+  writeAttributeSet(const AttributeSet & attributes, Encoder & encoder)
+  {
+    std::vector<uint64_t> enumAttributes;
+    for (auto & attribute : attributes.EnumAttributes())
+      enumAttributes.push_back(static_cast<uint64_t>(attribute.kind()));
+
+    std::vector<std::pair<uint64_t, uint64_t>> intAttributes;
+    for (auto & attribute : attributes.IntAttributes())
+      intAttributes.emplace_back(static_cast<uint64_t>(attribute.kind()), attribute.value());
+
+    std::vector<std::pair<uint64_t, uint64_t>> typeAttributes;
+    for (auto & attribute : attributes.TypeAttributes())
+      typeAttributes.emplace_back(
+          static_cast<uint64_t>(attribute.kind()),
+          internType(attribute.type()));
+
+    std::vector<std::pair<std::string, std::string>> stringAttributes;
+    for (auto & attribute : attributes.StringAttributes())
+      stringAttributes.emplace_back(attribute.kind(), attribute.value());
+
+    // Attribute sets are unordered. Sort them to make the encoding deterministic.
+    std::sort(enumAttributes.begin(), enumAttributes.end());
+    std::sort(intAttributes.begin(), intAttributes.end());
+    std::sort(typeAttributes.begin(), typeAttributes.end());
+    std::sort(stringAttributes.begin(), stringAttributes.end());
+
+    encoder.writeVarint(enumAttributes.size());
+    for (auto kind : enumAttributes)
+      encoder.writeVarint(kind);
+
+    encoder.writeVarint(intAttributes.size());
+    for (auto [kind, value] : intAttributes)
+    {
+      encoder.writeVarint(kind);
+      encoder.writeVarint(value);
+    }
+
+    encoder.writeVarint(typeAttributes.size());
+    for (auto [kind, type] : typeAttributes)
+    {
+      encoder.writeVarint(kind);
+      encoder.writeVarint(type);
+    }
+
+    encoder.writeVarint(stringAttributes.size());
+    for (auto & [kind, value] : stringAttributes)
+    {
+      encoder.writeVarint(internString(kind));
+      encoder.writeVarint(internString(value));
+    }
+  }
+
+  void
+  writeMemoryNodeIds(const std::vector<MemoryNodeId> & memoryNodeIds, Encoder & encoder)
+  {
+    encoder.writeVarint(memoryNodeIds.size());
+    for (auto memoryNodeId : memoryNodeIds)
+      encoder.writeVarint(memoryNodeId);
+  }
+
+  void
+  encodeOperation(const rvsdg::Operation & operation, Encoder & encoder)
+  {
+    // The payload is encoded first, such that all types and strings it refers to are interned
+    // before the table entry of the operation is written.
+    Encoder payload;
+    const auto tag = encodeOperationPayload(operation, payload);
+
+    encoder.writeVarint(static_cast<uint64_t>(tag));
+    if (auto simpleOperation = dynamic_cast<const rvsdg::SimpleOperation *>(&operation))
+    {
+      Encoder signature;
+      signature.writeVarint(simpleOperation->narguments());
+      for (size_t n = 0; n < simpleOperation->narguments(); n++)
+        signature.writeVarint(internType(*simpleOperation->argument(n)));
+      signature.writeVarint(simpleOperation->nresults());
+      for (size_t n = 0; n < simpleOperation->nresults(); n++)
+        signature.writeVarint(internType(*simpleOperation->result(n)));
+      encoder.writeBytes(signature.bytes().data(), signature.bytes().size());
+    }
+    encoder.writeBytes(payload.bytes().data(), payload.bytes().size());
+  }
+
+  OperationTag
+  encodeOperationPayload(const rvsdg::Operation & operation, Encoder & encoder)
+  {
+    if (auto position = findOperation(operation, BitWidthOperations()))
+    {
+      encoder.writeVarint(*position);
+      return OperationTag::BitWidth;
+    }
+    if (auto position = findOperation(operation, ConversionOperations()))
+    {
+      encoder.writeVarint(*position);
+      return OperationTag::Conversion;
+    }
+    if (auto constant = dynamic_cast<const rvsdg::BitConstantOperation *>(&operation))
+    {
+      writeBitValue(constant->value(), encoder);
+      return OperationTag::BitConstant;
+    }
+    if (auto slice = dynamic_cast<const rvsdg::BitSliceOperation *>(&operation))
+    {
+      encoder.writeVarint(slice->low());
+      encoder.writeVarint(slice->high());
+      return OperationTag::BitSlice;
+    }
+    if (rvsdg::is<rvsdg::BitConcatOperation>(operation))
+    {
+      return OperationTag::BitConcat;
+    }
+    if (auto constant = dynamic_cast<const rvsdg::ControlConstantOperation *>(&operation))
+    {
+      encoder.writeVarint(constant->value().alternative());
+      return OperationTag::ControlConstant;
+    }
+    if (auto match = dynamic_cast<const rvsdg::MatchOperation *>(&operation))
+    {
+      std::vector<std::pair<uint64_t, uint64_t>> mapping(match->begin(), match->end());
+      std::sort(mapping.begin(), mapping.end());
+      encoder.writeVarint(match->default_alternative());
+      encoder.writeVarint(mapping.size());
+      for (auto [value, alternative] : mapping)
+      {
+        encoder.writeVarint(value);
+        encoder.writeVarint(alternative);
+      }
+      return OperationTag::Match;
+    }
+    if (auto constant = dynamic_cast<const IntegerConstantOperation *>(&operation))
+    {
+      writeBitValue(constant->Representation(), encoder);
+      return OperationTag::IntegerConstant;
+    }
+    if (auto load = dynamic_cast<const LoadOperation *>(&operation))
+    {
+      encoder.writeVarint(load->NumMemoryStates());
+      encoder.writeVarint(load->GetAlignment());
+      return rvsdg::is<LoadVolatileOperation>(operation) ? OperationTag::LoadVolatile
+                                                         : OperationTag::LoadNonVolatile;
+    }
+    if (auto store = dynamic_cast<const StoreOperation *>(&operation))
+    {
+      encoder.writeVarint(store->NumMemoryStates());
+      encoder.writeVarint(store->GetAlignment());
+      return rvsdg::is<StoreVolatileOperation>(operation) ? OperationTag::StoreVolatile
+                                                          : OperationTag::StoreNonVolatile;
+    }
+    if (auto call = dynamic_cast<const CallOperation *>(&operation))
+    {
+      auto & attributes = call->getAttributes();
+      encoder.writeVarint(internType(*call->GetFunctionType()));
+      encoder.writeVarint(static_cast<uint64_t>(call->getCallingConvention()));
+      writeAttributeSet(attributes.getFunctionAttributes(), encoder);
+      writeAttributeSet(attributes.getReturnAttributes(), encoder);
+      encoder.writeVarint(attributes.getParameterAttributes().size());
+      for (auto & parameterAttributes : attributes.getParameterAttributes())
+        writeAttributeSet(parameterAttributes, encoder);
+      return OperationTag::Call;
+    }
+    if (auto alloca = dynamic_cast<const AllocaOperation *>(&operation))
+    {
+      encoder.writeVarint(internType(*alloca->allocatedType()));
+      encoder.writeVarint(alloca->alignment());
+      return OperationTag::Alloca;
+    }
+    if (auto gep = dynamic_cast<const GetElementPtrOperation *>(&operation))
+    {
+      encoder.writeVarint(internType(*gep->getPointeeType()));
+      return OperationTag::GetElementPtr;
+    }
+    if (rvsdg::is<MemoryStateMergeOperation>(operation))
+      return OperationTag::MemoryStateMerge;
+    if (rvsdg::is<MemoryStateJoinOperation>(operation))
+      return OperationTag::MemoryStateJoin;
+    if (rvsdg::is<MemoryStateSplitOperation>(operation))
+      return OperationTag::MemoryStateSplit;
+    if (auto split = dynamic_cast<const LambdaEntryMemoryStateSplitOperation *>(&operation))
+    {
+      writeMemoryNodeIds(split->getMemoryNodeIds(), encoder);
+      return OperationTag::LambdaEntryMemoryStateSplit;
+    }
+    if (auto merge = dynamic_cast<const LambdaExitMemoryStateMergeOperation *>(&operation))
+    {
+      writeMemoryNodeIds(merge->getMemoryNodeIds(), encoder);
+      return OperationTag::LambdaExitMemoryStateMerge;
+    }
+    if (auto merge = dynamic_cast<const CallEntryMemoryStateMergeOperation *>(&operation))
+    {
+      writeMemoryNodeIds(merge->getMemoryNodeIds(), encoder);
+      return OperationTag::CallEntryMemoryStateMerge;
+    }
+    if (auto split = dynamic_cast<const CallExitMemoryStateSplitOperation *>(&operation))
+    {
+      writeMemoryNodeIds(split->getMemoryNodeIds(), encoder);
+      return OperationTag::CallExitMemoryStateSplit;
+    }
+    if (rvsdg::is<IOBarrierOperation>(operation))
+      return OperationTag::IOBarrier;
+    if (rvsdg::is<UndefValueOperation>(operation))
+      return OperationTag::UndefValue;
+    if (rvsdg::is<PoisonValueOperation>(operation))
+      return OperationTag::PoisonValue;
+    if (rvsdg::is<FreezeOperation>(operation))
+      return OperationTag::Freeze;
+    if (rvsdg::is<ConstantPointerNullOperation>(operation))
+      return OperationTag::ConstantPointerNull;
+    if (auto constant = dynamic_cast<const ConstantFP *>(&operation))
+    {
+      const auto bits = constant->constant().bitcastToAPInt();
+      encoder.writeVarint(bits.getNumWords());
+      for (size_t n = 0; n < bits.getNumWords(); n++)
+        encoder.writeVarint(bits.getRawData()[n]);
+      return OperationTag::ConstantFP;
+    }
+    if (auto binary = dynamic_cast<const FBinaryOperation *>(&operation))
+    {
+      encoder.writeVarint(static_cast<uint64_t>(binary->fpop()));
+      return OperationTag::FBinary;
+    }
+    if (rvsdg::is<FNegOperation>(operation))
+      return OperationTag::FNeg;
+    if (auto compare = dynamic_cast<const FCmpOperation *>(&operation))
+    {
+      encoder.writeVarint(static_cast<uint64_t>(compare->cmp()));
+      return OperationTag::FCmp;
+    }
+    if (auto compare = dynamic_cast<const PtrCmpOperation *>(&operation))
+    {
+      encoder.writeVarint(static_cast<uint64_t>(compare->predicate()));
+      return OperationTag::PtrCmp;
+    }
+    if (rvsdg::is<SelectOperation>(operation))
+      return OperationTag::Select;
+    if (rvsdg::is<MallocOperation>(operation))
+      return OperationTag::Malloc;
+    if (rvsdg::is<FreeOperation>(operation))
+      return OperationTag::Free;
+    if (rvsdg::is<VariadicArgumentListOperation>(operation))
+      return OperationTag::VariadicArgumentList;
+    if (rvsdg::is<ConstantAggregateZeroOperation>(operation))
+      return OperationTag::ConstantAggregateZero;
+    if (rvsdg::is<ConstantDataArrayOperation>(operation))
+      return OperationTag::ConstantDataArray;
+    if (rvsdg::is<ConstantArrayOperation>(operation))
+      return OperationTag::ConstantArray;
+    if (rvsdg::is<ConstantStructOperation>(operation))
+      return OperationTag::ConstantStruct;
+    if (auto extract = dynamic_cast<const ExtractValueOperation *>(&operation))
+    {
+      std::vector<unsigned> indices(extract->begin(), extract->end());
+      encoder.writeVarint(indices.size());
+      for (auto index : indices)
+        encoder.writeVarint(index);
+      return OperationTag::ExtractValue;
+    }
+    if (auto insert = dynamic_cast<const InsertValueOperation *>(&operation))
+    {
+      encoder.writeVarint(insert->getIndices().size());
+      for (auto index : insert->getIndices())
+        encoder.writeVarint(index);
+      return OperationTag::InsertValue;
+    }
+    if (rvsdg::is<FPExtOperation>(operation))
+      return OperationTag::FPExt;
+    if (rvsdg::is<FPTruncOperation>(operation))
+      return OperationTag::FPTrunc;
+    if (rvsdg::is<FPToUIOperation>(operation))
+      return OperationTag::FPToUI;
+    if (rvsdg::is<FPToSIOperation>(operation))
+      return OperationTag::FPToSI;
+    if (rvsdg::is<ControlToIntOperation>(operation))
+      return OperationTag::ControlToInt;
+    if (rvsdg::is<FunctionToPointerOperation>(operation))
+      return OperationTag::FunctionToPointer;
+    if (rvsdg::is<PointerToFunctionOperation>(operation))
+      return OperationTag::PointerToFunction;
+    if (auto memCpy = dynamic_cast<const MemCpyNonVolatileOperation *>(&operation))
+    {
+      encoder.writeVarint(memCpy->NumMemoryStates());
+      return OperationTag::MemCpyNonVolatile;
+    }
+    if (auto memSet = dynamic_cast<const MemSetNonVolatileOperation *>(&operation))
+    {
+      encoder.writeVarint(memSet->numMemoryStates());
+      return OperationTag::MemSetNonVolatile;
+    }
+    if (auto lambda = dynamic_cast<const LlvmLambdaOperation *>(&operation))
+    {
+      encoder.writeVarint(internType(*lambda->Type()));
+      encoder.writeVarint(internString(lambda->name()));
+      encoder.writeVarint(static_cast<uint64_t>(lambda->linkage()));
+      encoder.writeVarint(static_cast<uint64_t>(lambda->callingConvention()));
+      writeAttributeSet(lambda->attributes(), encoder);
+      for (size_t n = 0; n < lambda->Type()->NumArguments(); n++)
+        writeAttributeSet(lambda->GetArgumentAttributes(n), encoder);
+      return OperationTag::Lambda;
+    }
+    if (auto delta = dynamic_cast<const LlvmDeltaOperation *>(&operation))
+    {
+      encoder.writeVarint(internType(*delta->Type()));
+      encoder.writeVarint(internString(delta->name()));
+      encoder.writeVarint(static_cast<uint64_t>(delta->linkage()));
+      encoder.writeVarint(internString(delta->Section()));
+      encoder.writeVarint(delta->constant());
+      encoder.writeVarint(delta->getAlignment());
+      return OperationTag::Delta;
+    }
+    if (auto gamma = dynamic_cast<const rvsdg::GammaOperation *>(&operation))
+    {
+      encoder.writeVarint(gamma->nalternatives());
+      for (size_t n = 0; n < gamma->nalternatives(); n++)
+        encoder.writeVarint(internType(*gamma->GetMatchContentType(n)));
+      return OperationTag::Gamma;
+    }
+    if (rvsdg::is<rvsdg::ThetaOperation>(operation))
+      return OperationTag::Theta;
+    if (rvsdg::is<rvsdg::PhiOperation>(operation))
+      return OperationTag::Phi;
+
+    throw util::Error(
+        "Binary RVSDG format does not support operation: " + operation.debug_string());
+  }
+
+  std::unordered_map<std::string, uint64_t> stringIndices_{};
+  Encoder stringTable_{};
+
+  std::unordered_map<const rvsdg::Type *, uint64_t> typeCache_{};
+  std::unordered_map<std::string, uint64_t> typeIndices_{};
+  Encoder typeTable_{};
+
+  std::unordered_map<std::string, uint64_t> operationIndices_{};
+  Encoder operationTable_{};
+};
+
+/**
+ * Assigns region-local indices to the outputs of a region in the order in which they are
+ * defined: the region arguments first, followed by the outputs of the nodes.
+ */
+class OutputIndices final
+{
+public:
+  void
+  define(const rvsdg::Output & output)
+  {
+    indices_[&output] = indices_.size();
+  }
+
+  void
+  writeOrigin(const rvsdg::Input & input, Encoder & encoder) const
+  {
+    const auto index = indices_.at(input.origin());
+    encoder.writeVarint(indices_.size() - 1 - index);
+  }
+
+private:
+  std::unordered_map<const rvsdg::Output *, size_t> indices_{};
+};
+
+void
+writeRegion(
+    const rvsdg::Region & region,
+    const std::vector<const rvsdg::Output *> & arguments,
+    const std::vector<const rvsdg::Input *> & results,
+    WriterContext & context,
+    Encoder & encoder);
+
+void
+writeNode(
+    const rvsdg::Node & node,
+    OutputIndices & outputIndices,
+    WriterContext & context,
+    Encoder & encoder)
+{
+  encoder.writeVarint(context.internOperation(node.GetOperation()));
+
+  if (rvsdg::is<rvsdg::SimpleOperation>(&node))
+  {
+    for (auto & input : node.Inputs())
+      outputIndices.writeOrigin(input, encoder);
+    for (auto & output : node.Outputs())
+      outputIndices.define(output);
+  }
+  else if (auto lambdaNode = dynamic_cast<const rvsdg::LambdaNode *>(&node))
+  {
+    std::vector<const rvsdg::Output *> arguments;
+    for (auto argument : lambdaNode->GetFunctionArguments())
+      arguments.push_back(argument);
+
+    const auto contextVars = lambdaNode->GetContextVars();
+    encoder.writeVarint(contextVars.size());
+    for (auto & contextVar : contextVars)
+    {
+      outputIndices.writeOrigin(*contextVar.input, encoder);
+      arguments.push_back(contextVar.inner);
+    }
+
+    std::vector<const rvsdg::Input *> results;
+    for (auto result : lambdaNode->GetFunctionResults())
+      results.push_back(result);
+
+    writeRegion(*lambdaNode->subregion(), arguments, results, context, encoder);
+    outputIndices.define(*lambdaNode->output());
+  }
+  else if (auto deltaNode = dynamic_cast<const rvsdg::DeltaNode *>(&node))
+  {
+    std::vector<const rvsdg::Output *> arguments;
+    const auto contextVars = deltaNode->GetContextVars();
+    encoder.writeVarint(contextVars.size());
+    for (auto & contextVar : contextVars)
+    {
+      outputIndices.writeOrigin(*contextVar.input, encoder);
+      arguments.push_back(contextVar.inner);
+    }
+
+    writeRegion(
+        *deltaNode->subregion(),
+        arguments,
+        { &deltaNode->result() },
+        context,
+        encoder);
+    outputIndices.define(deltaNode->output());
+  }
+  else if (auto gammaNode = dynamic_cast<const rvsdg::GammaNode *>(&node))
+  {
+    outputIndices.writeOrigin(*gammaNode->predicate(), encoder);
+
+    const auto entryVars = gammaNode->GetEntryVars();
+    encoder.writeVarint(entryVars.size());
+    for (auto & entryVar : entryVars)
+      outputIndices.writeOrigin(*entryVar.input, encoder);
+
+    const auto matchVar = gammaNode->GetMatchVar();
+    const auto exitVars = gammaNode->GetExitVars();
+    encoder.writeVarint(exitVars.size());
+    for (size_t r = 0; r < gammaNode->nsubregions(); r++)
+    {
+      std::vector<const rvsdg::Output *> arguments({ matchVar.matchContent[r] });
+      for (auto & entryVar : entryVars)
+        arguments.push_back(entryVar.branchArgument[r]);
+
+      std::vector<const rvsdg::Input *> results;
+      for (auto & exitVar : exitVars)
+        results.push_back(exitVar.branchResult[r]);
+
+      writeRegion(*gammaNode->subregion(r), arguments, results, context, encoder);
+    }
+
+    for (auto & exitVar : exitVars)
+      outputIndices.define(*exitVar.output);
+  }
+  else if (auto thetaNode = dynamic_cast<const rvsdg::ThetaNode *>(&node))
+  {
+    const auto loopVars = thetaNode->GetLoopVars();
+    encoder.writeVarint(loopVars.size());
+
+    std::vector<const rvsdg::Output *> arguments;
+    std::vector<const rvsdg::Input *> results({ thetaNode->predicate() });
+    for (auto & loopVar : loopVars)
+    {
+      outputIndices.writeOrigin(*loopVar.input, encoder);
+      arguments.push_back(loopVar.pre);
+      results.push_back(loopVar.post);
+    }
+
+    writeRegion(*thetaNode->subregion(), arguments, results, context, encoder);
+
+    for (auto & loopVar : loopVars)
+      outputIndices.define(*loopVar.output);
+  }
+  else if (auto phiNode = dynamic_cast<const rvsdg::PhiNode *>(&node))
+  {
+    std::vector<const rvsdg::Output *> arguments;
+    const auto contextVars = phiNode->GetContextVars();
+    encoder.writeVarint(contextVars.size());
+    for (auto & contextVar : contextVars)
+    {
+      outputIndices.writeOrigin(*contextVar.input, encoder);
+      arguments.push_back(contextVar.inner);
+    }
+
+    std::vector<const rvsdg::Input *> results;
+    const auto fixVars = phiNode->GetFixVars();
+    encoder.writeVarint(fixVars.size());
+    for (auto & fixVar : fixVars)
+    {
+      encoder.writeVarint(context.internType(*fixVar.recref->Type()));
+      arguments.push_back(fixVar.recref);
+      results.push_back(fixVar.result);
+    }
+
+    writeRegion(*phiNode->subregion(), arguments, results, context, encoder);
+
+    for (auto & fixVar : fixVars)
+      outputIndices.define(*fixVar.output);
+  }
+  else
+  {
+    throw util::Error("Binary RVSDG format does not support node: " + node.DebugString());
+  }
+}
+
+void
+writeRegion(
+    const rvsdg::Region & region,
+    const std::vector<const rvsdg::Output *> & arguments,
+    const std::vector<const rvsdg::Input *> & results,
+    WriterContext & context,
+    Encoder & encoder)
+{
+  JLM_ASSERT(arguments.size() == region.narguments());
+  JLM_ASSERT(results.size() == region.nresults());
+
+  OutputIndices outputIndices;
+  for (auto argument : arguments)
+    outputIndices.define(*argument);
+
+  Encoder section;
+  section.writeVarint(region.numNodes());
+  for (const auto node : rvsdg::TopDownConstTraverser(&region))
+    writeNode(*node, outputIndices, context, section);
+
+  section.writeVarint(results.size());
+  for (auto result : results)
+    outputIndices.writeOrigin(*result, section);
+
+  encoder.writeSection(section);
+}
+
+/**
+ * Decodes the interned tables and holds the state needed while a module is decoded.
+ */
+class ReaderContext final
+{
+public:
+  struct OperationEntry
+  {
+    OperationTag tag;
+    std::unique_ptr<rvsdg::Operation> operation;
+  };
+
+  explicit ReaderContext(const RvsdgBinaryReader::LambdaFilter * materializeLambda)
+      : materializeLambda_(materializeLambda)
+  {}
+
+  void
+  readTables(Decoder & decoder)
+  {
+    const auto numStrings = decoder.readCount();
+    for (size_t n = 0; n < numStrings; n++)
+    {
+      const auto size = decoder.readVarint();
+      const auto bytes = decoder.readBytes(size);
+      strings_.emplace_back(reinterpret_cast<const char *>(bytes), size);
+    }
+
+    const auto numTypes = decoder.readCount();
+    for (size_t n = 0; n < numTypes; n++)
+      types_.push_back(readType(decoder));
+
+    const auto numOperations = decoder.readCount();
+    for (size_t n = 0; n < numOperations; n++)
+      operations_.push_back(readOperation(decoder));
+  }
+
+  const std::string &
+  readString(Decoder & decoder) const
+  {
+    const auto index = decoder.readVarint();
+    if (index >= strings_.size())
+      throwMalformed();
+
+    return strings_[index];
+  }
+
+  std::shared_ptr<const rvsdg::Type>
+  readTypeReference(Decoder & decoder) const
+  {
+    const auto index = decoder.readVarint();
+    if (index >= types_.size())
+      throwMalformed();
+
+    return types_[index];
+  }
+
+  template<typename T>
+  std::shared_ptr<const T>
+  readTypeReference(Decoder & decoder) const
+  {
+    auto type = std::dynamic_pointer_cast<const T>(readTypeReference(decoder));
+    if (!type)
+      throwMalformed();
+
+    return type;
+  }
+
+  const OperationEntry &
+  readOperationReference(Decoder & decoder) const
+  {
+    const auto index = decoder.readVarint();
+    if (index >= operations_.size())
+      throwMalformed();
+
+    return operations_[index];
+  }
+
+  [[nodiscard]] bool
+  materializeLambda(const LlvmLambdaOperation & operation) const
+  {
+    return materializeLambda_ == nullptr || (*materializeLambda_)(operation);
+  }
+
+private:
+  std::vector<std::shared_ptr<const rvsdg::Type>>
+  readTypeReferences(Decoder & decoder) const
+  {
+    std::vector<std::shared_ptr<const rvsdg::Type>> types(decoder.readCount());
+    for (auto & type : types)
+      type = readTypeReference(decoder);
+
+    return types;
+  }
+
+  std::shared_ptr<const rvsdg::Type>
+  readType(Decoder & decoder) const
+  {
+    switch (decoder.readEnum(TypeTag::LastTag))
+    {
+    case TypeTag::Bit:
+    {
+      const auto numBits = decoder.readVarint();
+      if (numBits == 0)
+        throwMalformed();
+      return rvsdg::BitType::Create(numBits);
+    }
+    case TypeTag::Control:
+      return rvsdg::ControlType::Create(decoder.readVarint());
+    case TypeTag::IOState:
+      return IOStateType::Create();
+    case TypeTag::MemoryState:
+      return MemoryStateType::Create();
+    case TypeTag::Pointer:
+      return PointerType::Create();
+    case TypeTag::FloatingPoint:
+      return FloatingPointType::Create(decoder.readEnum(fpsize::fp128));
+    case TypeTag::Array:
+    {
+      auto elementType = readTypeReference(decoder);
+      return ArrayType::Create(std::move(elementType), decoder.readVarint());
+    }
+    case TypeTag::FixedVector:
+    {
+      auto elementType = readTypeReference(decoder);
+      return FixedVectorType::Create(std::move(elementType), decoder.readVarint());
+    }
+    case TypeTag::ScalableVector:
+    {
+      auto elementType = readTypeReference(decoder);
+      return ScalableVectorType::Create(std::move(elementType), decoder.readVarint());
+    }
+    case TypeTag::VariableArgument:
+      return VariableArgumentType::Create();
+    case TypeTag::Unit:
+      return rvsdg::UnitType::Create();
+    case TypeTag::Function:
+    {
+      auto argumentTypes = readTypeReferences(decoder);
+      auto resultTypes = readTypeReferences(decoder);
+      return rvsdg::FunctionType::Create(std::move(argumentTypes), std::move(resultTypes));
+    }
+    case TypeTag::Struct:
+    {
+      const auto isLiteral = decoder.readBool();
+      const auto isPacked = decoder.readBool();
+      const auto nameIndex = decoder.readVarint();
+      auto elementTypes = readTypeReferences(decoder);
+      if (isLiteral)
+        return StructType::CreateLiteral(std::move(elementTypes), isPacked);
+
+      if (nameIndex >= strings_.size())
+        throwMalformed();
+      return StructType::CreateIdentified(strings_[nameIndex], std::move(elementTypes), isPacked);
+    }
+    }
+
+    throwMalformed();
+  }
+
+  AttributeSet
+  readAttributeSet(Decoder & decoder) const
+  {
+    constexpr auto lastKind = Attribute::kind::EndAttrKinds;
+
+    AttributeSet attributes;
+    const auto numEnumAttributes = decoder.readCount();
+    for (size_t n = 0; n < numEnumAttributes; n++)
+      attributes.InsertEnumAttribute(EnumAttribute(decoder.readEnum(lastKind)));
+
+    const auto numIntAttributes = decoder.readCount();
+    for (size_t n = 0; n < numIntAttributes; n++)
+    {
+      const auto kind = decoder.readEnum(lastKind);
+      attributes.InsertIntAttribute(IntAttribute(kind, decoder.readVarint()));
+    }
+
+    const auto numTypeAttributes = decoder.readCount();
+    for (size_t n = 0; n < numTypeAttributes; n++)
+    {
+      const auto kind = decoder.readEnum(lastKind);
+      attributes.InsertTypeAttribute(TypeAttribute(kind, readTypeReference(decoder)));
+    }
+
+    const auto numStringAttributes = decoder.readCount();
+    for (size_t n = 0; n < numStringAttributes; n++)
+    {
+      const auto & kind = readString(decoder);
+      attributes.InsertStringAttribute(StringAttribute(kind, readString(decoder)));
+    }
+
+    return attributes;
+  }
+
+  static std::vector<MemoryNodeId>
+  readMemoryNodeIds(Decoder & decoder)
+  {
+    std::vector<MemoryNodeId> memoryNodeIds(decoder.readCount());
+    for (auto & memoryNodeId : memoryNodeIds)
+      memoryNodeId = decoder.readVarint();
+
+    return memoryNodeIds;
+  }
+
+  static std::vector<unsigned>
+  readIndices(Decoder & decoder)
+  {
+    std::vector<unsigned> indices(decoder.readCount());
+    for (auto & index : indices)
+      index = static_cast<unsigned>(decoder.readVarint());
+
+    return indices;
+  }
+
+  OperationEntry
+  readOperation(Decoder & decoder) const
+  {
+    const auto tag = decoder.readEnum(OperationTag::LastTag);
+    if (tag >= OperationTag::Lambda)
+      return { tag, readStructuralOperation(tag, decoder) };
+
+    const auto argumentTypes = readTypeReferences(decoder);
+    const auto resultTypes = readTypeReferences(decoder);
+    auto operation = readSimpleOperation(tag, argumentTypes, resultTypes, decoder);
+
+    // Guard against entries whose signature does not match the reconstructed operation
+    auto & simpleOperation = *util::assertedCast<rvsdg::SimpleOperation>(operation.get());
+    if (simpleOperation.narguments() != argumentTypes.size()
+        || simpleOperation.nresults() != resultTypes.size())
+      throwMalformed();
+    for (size_t n = 0; n < argumentTypes.size(); n++)
+    {
+      if (!rvsdg::areTypesEqual(*simpleOperation.argument(n), *argumentTypes[n]))
+        throwMalformed();
+    }
+    for (size_t n = 0; n < resultTypes.size(); n++)
+    {
+      if (!rvsdg::areTypesEqual(*simpleOperation.result(n), *resultTypes[n]))
+        throwMalformed();
+    }
+
+    return { tag, std::move(operation) };
+  }
+
+  std::unique_ptr<rvsdg::Operation>
+  readSimpleOperation(
+      OperationTag tag,
+      const std::vector<std::shared_ptr<const rvsdg::Type>> & argumentTypes,
+      const std::vector<std::shared_ptr<const rvsdg::Type>> & resultTypes,
+      Decoder & decoder) const
+  {
+    auto argumentType = [&](size_t index) -> const std::shared_ptr<const rvsdg::Type> &
+    {
+      if (index >= argumentTypes.size())
+        throwMalformed();
+      return argumentTypes[index];
+    };
+    auto resultType = [&](size_t index) -> const std::shared_ptr<const rvsdg::Type> &
+    {
+      if (index >= resultTypes.size())
+        throwMalformed();
+      return resultTypes[index];
+    };
+    auto typeAs = [](const std::shared_ptr<const rvsdg::Type> & type)
+    {
+      return [type](auto identity)
+      {
+        using T = typename decltype(identity)::Type;
+        auto castType = std::dynamic_pointer_cast<const T>(type);
+        if (!castType)
+          throwMalformed();
+        return castType;
+      };
+    };
+    auto bitType = [&](const std::shared_ptr<const rvsdg::Type> & type)
+    {
+      return typeAs(type)(OperationIdentity<rvsdg::BitType>());
+    };
+    auto floatingPointType = [&](const std::shared_ptr<const rvsdg::Type> & type)
+    {
+      return typeAs(type)(OperationIdentity<FloatingPointType>());
+    };
+    auto functionType = [&](const std::shared_ptr<const rvsdg::Type> & type)
+    {
+      return typeAs(type)(OperationIdentity<rvsdg::FunctionType>());
+    };
+
+    switch (tag)
+    {
+    case OperationTag::BitWidth:
+    {
+      const auto numBits = bitType(argumentType(0))->nbits();
+      auto operation = createOperation(
+          decoder.readVarint(),
+          BitWidthOperations(),
+          [&](auto identity) -> std::unique_ptr<rvsdg::Operation>
+          {
+            using T = typename decltype(identity)::Type;
+            return std::make_unique<T>(numBits);
+          });
+      if (!operation)
+        throwMalformed();
+      return operation;
+    }
+    case OperationTag::Conversion:
+    {
+      auto operation = createOperation(
+          decoder.readVarint(),
+          ConversionOperations(),
+          [&](auto identity) -> std::unique_ptr<rvsdg::Operation>
+          {
+            using T = typename decltype(identity)::Type;
+            return std::make_unique<T>(argumentType(0), resultType(0));
+          });
+      if (!operation)
+        throwMalformed();
+      return operation;
+    }
+    case OperationTag::BitConstant:
+      return std::make_unique<rvsdg::BitConstantOperation>(readBitValue(decoder));
+    case OperationTag::BitSlice:
+    {
+      const auto low = decoder.readVarint();
+      const auto high = decoder.readVarint();
+      if (low >= high)
+        throwMalformed();
+      return std::make_unique<rvsdg::BitSliceOperation>(bitType(argumentType(0)), low, high);
+    }
+    case OperationTag::BitConcat:
+    {
+      std::vector<std::shared_ptr<const rvsdg::BitType>> types;
+      for (auto & type : argumentTypes)
+        types.push_back(bitType(type));
+      return std::make_unique<rvsdg::BitConcatOperation>(std::move(types));
+    }
+    case OperationTag::ControlConstant:
+    {
+      const auto controlType = typeAs(resultType(0))(OperationIdentity<rvsdg::ControlType>());
+      const auto alternative = decoder.readVarint();
+      if (alternative >= controlType->nalternatives())
+        throwMalformed();
+      return std::make_unique<rvsdg::ControlConstantOperation>(
+          rvsdg::ControlValueRepresentation(alternative, controlType->nalternatives()));
+    }
+    case OperationTag::Match:
+    {
+      const auto controlType = typeAs(resultType(0))(OperationIdentity<rvsdg::ControlType>());
+      const auto defaultAlternative = decoder.readVarint();
+      std::unordered_map<uint64_t, uint64_t> mapping;
+      const auto numMappings = decoder.readCount();
+      for (size_t n = 0; n < numMappings; n++)
+      {
+        const auto value = decoder.readVarint();
+        mapping[value] = decoder.readVarint();
+      }
+      return std::make_unique<rvsdg::MatchOperation>(
+          bitType(argumentType(0))->nbits(),
+          mapping,
+          defaultAlternative,
+          controlType->nalternatives());
+    }
+    case OperationTag::IntegerConstant:
+      return std::make_unique<IntegerConstantOperation>(readBitValue(decoder));
+    case OperationTag::LoadNonVolatile:
+    case OperationTag::LoadVolatile:
+    {
+      const auto numMemoryStates = decoder.readVarint();
+      const auto alignment = decoder.readVarint();
+      if (tag == OperationTag::LoadVolatile)
+        return std::make_unique<LoadVolatileOperation>(
+            resultType(0),
+            numMemoryStates,
+            alignment);
+      return std::make_unique<LoadNonVolatileOperation>(resultType(0), numMemoryStates, alignment);
+    }
+    case OperationTag::StoreNonVolatile:
+    case OperationTag::StoreVolatile:
+    {
+      const auto numMemoryStates = decoder.readVarint();
+      const auto alignment = decoder.readVarint();
+      if (tag == OperationTag::StoreVolatile)
+        return std::make_unique<StoreVolatileOperation>(
+            argumentType(1),
+            numMemoryStates,
+            alignment);
+      return std::make_unique<StoreNonVolatileOperation>(
+          argumentType(1),
+          numMemoryStates,
+          alignment);
+    }
+    case OperationTag::Call:
+    {
+      auto calleeType = functionType(readTypeReference(decoder));
+      const auto callingConvention = decoder.readEnum(CallingConvention::Tail);
+      auto functionAttributes = readAttributeSet(decoder);
+      auto returnAttributes = readAttributeSet(decoder);
+      std::vector<AttributeSet> parameterAttributes(decoder.readCount());
+      for (auto & attributes : parameterAttributes)
+        attributes = readAttributeSet(decoder);
+      return std::make_unique<CallOperation>(
+          std::move(calleeType),
+          callingConvention,
+          AttributeList(
+              std::move(functionAttributes),
+              std::move(returnAttributes),
+              std::move(parameterAttributes)));
+    }
+    case OperationTag::Alloca:
+    {
+      auto allocatedType = readTypeReference(decoder);
+      return std::make_unique<AllocaOperation>(
+          std::move(allocatedType),
+          bitType(argumentType(0)),
+          decoder.readVarint());
+    }
+    case OperationTag::GetElementPtr:
+    {
+      std::vector<std::shared_ptr<const rvsdg::Type>> indexTypes(
+          argumentTypes.begin() + 1,
+          argumentTypes.end());
+      return GetElementPtrOperation::createOperation(
+          argumentType(0),
+          indexTypes,
+          readTypeReference(decoder));
+    }
+    case OperationTag::MemoryStateMerge:
+      return std::make_unique<MemoryStateMergeOperation>(argumentTypes.size());
+    case OperationTag::MemoryStateJoin:
+      return std::make_unique<MemoryStateJoinOperation>(argumentTypes.size());
+    case OperationTag::MemoryStateSplit:
+      return std::make_unique<MemoryStateSplitOperation>(resultTypes.size());
+    case OperationTag::LambdaEntryMemoryStateSplit:
+      return std::make_unique<LambdaEntryMemoryStateSplitOperation>(readMemoryNodeIds(decoder));
+    case OperationTag::LambdaExitMemoryStateMerge:
+      return std::make_unique<LambdaExitMemoryStateMergeOperation>(readMemoryNodeIds(decoder));
+    case OperationTag::CallEntryMemoryStateMerge:
+      return std::make_unique<CallEntryMemoryStateMergeOperation>(readMemoryNodeIds(decoder));
+    case OperationTag::CallExitMemoryStateSplit:
+      return std::make_unique<CallExitMemoryStateSplitOperation>(readMemoryNodeIds(decoder));
+    case OperationTag::IOBarrier:
+      return std::make_unique<IOBarrierOperation>(argumentType(0));
+    case OperationTag::UndefValue:
+      return std::make_unique<UndefValueOperation>(resultType(0));
+    case OperationTag::PoisonValue:
+      return std::make_unique<PoisonValueOperation>(resultType(0));
+    case OperationTag::Freeze:
+      return std::make_unique<FreezeOperation>(argumentType(0));
+    case OperationTag::ConstantPointerNull:
+      return std::make_unique<ConstantPointerNullOperation>();
+    case OperationTag::ConstantFP:
+    {
+      auto type = floatingPointType(resultType(0));
+      auto & semantics = getFloatingPointSemantics(type->size());
+      std::vector<uint64_t> words(decoder.readCount());
+      for (auto & word : words)
+        word = decoder.readVarint();
+
+      const auto numBits = ::llvm::APFloat::getSizeInBits(semantics);
+      if (words.size() != (numBits + 63) / 64)
+        throwMalformed();
+      return std::make_unique<ConstantFP>(
+          std::move(type),
+          ::llvm::APFloat(semantics, ::llvm::APInt(numBits, words)));
+    }
+    case OperationTag::FBinary:
+    {
+      const auto operation = decoder.readEnum(fpop::mod);
+      return std::make_unique<FBinaryOperation>(operation, floatingPointType(resultType(0)));
+    }
+    case OperationTag::FNeg:
+      return std::make_unique<FNegOperation>(floatingPointType(argumentType(0)));
+    case OperationTag::FCmp:
+    {
+      const auto compare = decoder.readEnum(fpcmp::uno);
+      return std::make_unique<FCmpOperation>(compare, floatingPointType(argumentType(0)));
+    }
+    case OperationTag::PtrCmp:
+    {
+      const auto predicate = decoder.readEnum(ICmpPredicate::Sle);
+      return std::make_unique<PtrCmpOperation>(PointerType::Create(), predicate);
+    }
+    case OperationTag::Select:
+      return std::make_unique<SelectOperation>(resultType(0));
+    case OperationTag::Malloc:
+      return std::make_unique<MallocOperation>(bitType(argumentType(0)));
+    case OperationTag::Free:
+      if (resultTypes.empty())
+        throwMalformed();
+      return std::make_unique<FreeOperation>(resultTypes.size() - 1);
+    case OperationTag::VariadicArgumentList:
+      return std::make_unique<VariadicArgumentListOperation>(argumentTypes);
+    case OperationTag::ConstantAggregateZero:
+      return std::make_unique<ConstantAggregateZeroOperation>(resultType(0));
+    case OperationTag::ConstantDataArray:
+      return std::make_unique<ConstantDataArrayOperation>(argumentType(0), argumentTypes.size());
+    case OperationTag::ConstantArray:
+      return std::make_unique<ConstantArrayOperation>(argumentType(0), argumentTypes.size());
+    case OperationTag::ConstantStruct:
+      return std::make_unique<ConstantStructOperation>(
+          typeAs(resultType(0))(OperationIdentity<StructType>()));
+    case OperationTag::ExtractValue:
+      return std::make_unique<ExtractValueOperation>(argumentType(0), readIndices(decoder));
+    case OperationTag::InsertValue:
+      return InsertValueOperation::create(
+          argumentType(0),
+          argumentType(1),
+          readIndices(decoder));
+    case OperationTag::FPExt:
+      return std::make_unique<FPExtOperation>(
+          floatingPointType(argumentType(0)),
+          floatingPointType(resultType(0)));
+    case OperationTag::FPTrunc:
+      return std::make_unique<FPTruncOperation>(
+          floatingPointType(argumentType(0)),
+          floatingPointType(resultType(0)));
+    case OperationTag::FPToUI:
+      return std::make_unique<FPToUIOperation>(
+          floatingPointType(argumentType(0)),
+          bitType(resultType(0)));
+    case OperationTag::FPToSI:
+      return std::make_unique<FPToSIOperation>(
+          floatingPointType(argumentType(0)),
+          bitType(resultType(0)));
+    case OperationTag::ControlToInt:
+      return std::make_unique<ControlToIntOperation>(
+          typeAs(argumentType(0))(OperationIdentity<rvsdg::ControlType>()),
+          bitType(resultType(0)));
+    case OperationTag::FunctionToPointer:
+      return std::make_unique<FunctionToPointerOperation>(functionType(argumentType(0)));
+    case OperationTag::PointerToFunction:
+      return std::make_unique<PointerToFunctionOperation>(functionType(resultType(0)));
+    case OperationTag::MemCpyNonVolatile:
+      return std::make_unique<MemCpyNonVolatileOperation>(argumentType(2), decoder.readVarint());
+    case OperationTag::MemSetNonVolatile:
+      return std::make_unique<MemSetNonVolatileOperation>(argumentType(2), decoder.readVarint());
+    default:
+      throwMalformed();
+    }
+  }
+
+  std::unique_ptr<rvsdg::Operation>
+  readStructuralOperation(OperationTag tag, Decoder & decoder) const
+  {
+    switch (tag)
+    {
+    case OperationTag::Lambda:
+    {
+      auto type = readTypeReference<rvsdg::FunctionType>(decoder);
+      const auto & name = readString(decoder);
+      const auto linkage = decoder.readEnum(Linkage::commonLinkage);
+      const auto callingConvention = decoder.readEnum(CallingConvention::Tail);
+      auto attributes = readAttributeSet(decoder);
+      auto operation = LlvmLambdaOperation::Create(
+          type,
+          name,
+          linkage,
+          callingConvention,
+          std::move(attributes));
+      for (size_t n = 0; n < type->NumArguments(); n++)
+        operation->SetArgumentAttributes(n, readAttributeSet(decoder));
+      return operation;
+    }
+    case OperationTag::Delta:
+    {
+      auto type = readTypeReference(decoder);
+      const auto & name = readString(decoder);
+      const auto linkage = decoder.readEnum(Linkage::commonLinkage);
+      const auto & section = readString(decoder);
+      const auto constant = decoder.readBool();
+      const auto alignment = decoder.readVarint();
+      return LlvmDeltaOperation::Create(type, name, linkage, section, constant, alignment);
+    }
+    case OperationTag::Gamma:
+    {
+      std::vector<std::shared_ptr<const rvsdg::Type>> matchContentTypes(decoder.readCount());
+      if (matchContentTypes.size() < 2)
+        throwMalformed();
+      for (auto & type : matchContentTypes)
+        type = readTypeReference(decoder);
+      return std::make_unique<rvsdg::GammaOperation>(
+          matchContentTypes.size(),
+          std::move(matchContentTypes));
+    }
+    case OperationTag::Theta:
+      return std::make_unique<rvsdg::ThetaOperation>();
+    case OperationTag::Phi:
+      return std::make_unique<rvsdg::PhiOperation>();
+    default:
+      throwMalformed();
+    }
+  }
+
+  const RvsdgBinaryReader::LambdaFilter * materializeLambda_;
+  std::vector<std::string> strings_{};
+  std::vector<std::shared_ptr<const rvsdg::Type>> types_{};
+  std::vector<OperationEntry> operations_{};
+};
+
+template<typename T>
+std::unique_ptr<T>
+copyOperation(const rvsdg::Operation & operation)
+{
+  return std::unique_ptr<T>(util::assertedCast<T>(operation.copy().release()));
+}
+
+rvsdg::Output &
+readOrigin(const std::vector<rvsdg::Output *> & outputs, Decoder & decoder)
+{
+  const auto distance = decoder.readVarint();
+  if (distance >= outputs.size())
+    throwMalformed();
+
+  return *outputs[outputs.size() - 1 - distance];
+}
+
+std::vector<rvsdg::Output *>
+readRegion(
+    rvsdg::Region & region,
+    std::vector<rvsdg::Output *> outputs,
+    Decoder decoder,
+    const ReaderContext & context);
+
+void
+readNode(
+    rvsdg::Region & region,
+    std::vector<rvsdg::Output *> & outputs,
+    Decoder & decoder,
+    const ReaderContext & context)
+{
+  const auto & [tag, operation] = context.readOperationReference(decoder);
+  switch (tag)
+  {
+  case OperationTag::Lambda:
+  {
+    auto & lambdaOperation = *util::assertedCast<const LlvmLambdaOperation>(operation.get());
+
+    std::vector<rvsdg::Output *> contextVarOrigins(decoder.readCount());
+    for (auto & origin : contextVarOrigins)
+      origin = &readOrigin(outputs, decoder);
+    const auto section = decoder.readSection();
+
+    if (region.IsRootRegion() && !context.materializeLambda(lambdaOperation))
+    {
+      auto & import = LlvmGraphImport::createFunctionImport(
+          *region.graph(),
+          lambdaOperation.Type(),
+          lambdaOperation.name(),
+          Linkage::externalLinkage,
+          lambdaOperation.callingConvention());
+      outputs.push_back(&import);
+      return;
+    }
+
+    auto lambdaNode =
+        rvsdg::LambdaNode::Create(region, copyOperation<LlvmLambdaOperation>(lambdaOperation));
+    auto arguments = lambdaNode->GetFunctionArguments();
+    for (auto origin : contextVarOrigins)
+      arguments.push_back(lambdaNode->AddContextVar(*origin).inner);
+
+    const auto results = readRegion(*lambdaNode->subregion(), arguments, section, context);
+    outputs.push_back(lambdaNode->finalize(results));
+    break;
+  }
+  case OperationTag::Delta:
+  {
+    auto deltaNode =
+        rvsdg::DeltaNode::Create(&region, copyOperation<LlvmDeltaOperation>(*operation));
+
+    std::vector<rvsdg::Output *> arguments(decoder.readCount());
+    for (auto & argument : arguments)
+      argument = deltaNode->AddContextVar(readOrigin(outputs, decoder)).inner;
+
+    const auto results =
+        readRegion(*deltaNode->subregion(), arguments, decoder.readSection(), context);
+    if (results.size() != 1)
+      throwMalformed();
+    outputs.push_back(&deltaNode->finalize(results[0]));
+    break;
+  }
+  case OperationTag::Gamma:
+  {
+    auto & predicate = readOrigin(outputs, decoder);
+    auto & gammaNode =
+        rvsdg::GammaNode::Create(predicate, copyOperation<rvsdg::GammaOperation>(*operation));
+
+    std::vector<rvsdg::GammaNode::EntryVar> entryVars(decoder.readCount());
+    for (auto & entryVar : entryVars)
+      entryVar = gammaNode.AddEntryVar(&readOrigin(outputs, decoder));
+
+    const auto matchVar = gammaNode.GetMatchVar();
+    const auto numExitVars = decoder.readVarint();
+    std::vector<std::vector<rvsdg::Output *>> exitVarOrigins(numExitVars);
+    for (size_t r = 0; r < gammaNode.nsubregions(); r++)
+    {
+      std::vector<rvsdg::Output *> arguments({ matchVar.matchContent[r] });
+      for (auto & entryVar : entryVars)
+        arguments.push_back(entryVar.branchArgument[r]);
+
+      const auto results =
+          readRegion(*gammaNode.subregion(r), arguments, decoder.readSection(), context);
+      if (results.size() != numExitVars)
+        throwMalformed();
+      for (size_t n = 0; n < numExitVars; n++)
+        exitVarOrigins[n].push_back(results[n]);
+    }
+
+    for (auto & origins : exitVarOrigins)
+      outputs.push_back(gammaNode.AddExitVar(origins).output);
+    break;
+  }
+  case OperationTag::Theta:
+  {
+    auto thetaNode = rvsdg::ThetaNode::create(&region);
+
+    std::vector<rvsdg::ThetaNode::LoopVar> loopVars(decoder.readCount());
+    std::vector<rvsdg::Output *> arguments;
+    for (auto & loopVar : loopVars)
+    {
+      loopVar = thetaNode->AddLoopVar(&readOrigin(outputs, decoder));
+      arguments.push_back(loopVar.pre);
+    }
+
+    const auto results =
+        readRegion(*thetaNode->subregion(), arguments, decoder.readSection(), context);
+    if (results.size() != loopVars.size() + 1)
+      throwMalformed();
+
+    thetaNode->set_predicate(results[0]);
+    for (size_t n = 0; n < loopVars.size(); n++)
+    {
+      loopVars[n].post->divert_to(results[n + 1]);
+      outputs.push_back(loopVars[n].output);
+    }
+    break;
+  }
+  case OperationTag::Phi:
+  {
+    rvsdg::PhiBuilder phiBuilder;
+    phiBuilder.begin(&region);
+
+    std::vector<rvsdg::Output *> arguments(decoder.readCount());
+    for (auto & argument : arguments)
+      argument = phiBuilder.AddContextVar(readOrigin(outputs, decoder)).inner;
+
+    std::vector<rvsdg::PhiNode::FixVar> fixVars(decoder.readCount());
+    for (auto & fixVar : fixVars)
+    {
+      fixVar = phiBuilder.AddFixVar(context.readTypeReference(decoder));
+      arguments.push_back(fixVar.recref);
+    }
+
+    const auto results =
+        readRegion(*phiBuilder.subregion(), arguments, decoder.readSection(), context);
+    if (results.size() != fixVars.size())
+      throwMalformed();
+
+    for (size_t n = 0; n < fixVars.size(); n++)
+      fixVars[n].result->divert_to(results[n]);
+    phiBuilder.end();
+
+    for (auto & fixVar : fixVars)
+      outputs.push_back(fixVar.output);
+    break;
+  }
+  default:
+  {
+    auto & simpleOperation = *util::assertedCast<const rvsdg::SimpleOperation>(operation.get());
+
+    std::vector<rvsdg::Output *> operands(simpleOperation.narguments());
+    for (size_t n = 0; n < operands.size(); n++)
+    {
+      operands[n] = &readOrigin(outputs, decoder);
+      if (!rvsdg::areTypesEqual(*operands[n]->Type(), *simpleOperation.argument(n)))
+        throwMalformed();
+    }
+
+    auto & node = rvsdg::SimpleNode::Create(region, simpleOperation.copy(), operands);
+    for (auto & output : node.Outputs())
+      outputs.push_back(&output);
+    break;
+  }
+  }
+}
+
+std::vector<rvsdg::Output *>
+readRegion(
+    rvsdg::Region & region,
+    std::vector<rvsdg::Output *> outputs,
+    Decoder decoder,
+    const ReaderContext & context)
+{
+  const auto numNodes = decoder.readCount();
+  for (size_t n = 0; n < numNodes; n++)
+    readNode(region, outputs, decoder, context);
+
+  std::vector<rvsdg::Output *> results(decoder.readCount());
+  for (auto & result : results)
+    result = &readOrigin(outputs, decoder);
+
+  if (!decoder.isAtEnd())
+    throwMalformed();
+
+  return results;
+}
+
+}
+
+std::vector<uint8_t>
+RvsdgBinaryWriter::writeModule(const LlvmRvsdgModule & rvsdgModule)
+{
+  auto & rootRegion = rvsdgModule.Rvsdg().GetRootRegion();
+  WriterContext context;
+
+  Encoder moduleEncoder;
+  moduleEncoder.writeVarint(context.internString(rvsdgModule.SourceFileName().to_str()));
+  moduleEncoder.writeVarint(context.internString(rvsdgModule.TargetTriple()));
+  moduleEncoder.writeVarint(context.internString(rvsdgModule.DataLayout()));
+
+  std::vector<const rvsdg::Output *> imports;
+  moduleEncoder.writeVarint(rootRegion.narguments());
+  for (auto argument : rootRegion.Arguments())
+  {
+    auto import = dynamic_cast<const LlvmGraphImport *>(argument);
+    if (!import)
+      throw util::Error("Binary RVSDG format only supports LLVM graph imports.");
+
+    moduleEncoder.writeVarint(context.internString(import->Name()));
+    moduleEncoder.writeVarint(context.internType(*import->ValueType()));
+    moduleEncoder.writeVarint(context.internType(*import->ImportedType()));
+    moduleEncoder.writeVarint(static_cast<uint64_t>(import->linkage()));
+    moduleEncoder.writeVarint(static_cast<uint64_t>(import->callingConvention()));
+    moduleEncoder.writeVarint(import->isConstant());
+    moduleEncoder.writeVarint(import->getAlignment());
+    imports.push_back(import);
+  }
+
+  std::vector<const rvsdg::Input *> exports;
+  for (auto result : rootRegion.Results())
+  {
+    auto graphExport = util::assertedCast<const rvsdg::GraphExport>(result);
+    exports.push_back(graphExport);
+  }
+
+  writeRegion(rootRegion, imports, exports, context, moduleEncoder);
+
+  for (auto graphExport : exports)
+  {
+    auto & name = util::assertedCast<const rvsdg::GraphExport>(graphExport)->Name();
+    moduleEncoder.writeVarint(context.internString(name));
+  }
+
+  Encoder encoder;
+  encoder.writeBytes(Magic.data(), Magic.size());
+  encoder.writeVarint(FormatVersion);
+  context.writeTables(encoder);
+  encoder.writeBytes(moduleEncoder.bytes().data(), moduleEncoder.bytes().size());
+
+  return encoder.bytes();
+}
+
+void
+RvsdgBinaryWriter::writeModule(
+    const LlvmRvsdgModule & rvsdgModule,
+    const util::FilePath & outputFile)
+{
+  const auto bytes = writeModule(rvsdgModule);
+
+  std::ofstream fileStream(outputFile.to_str(), std::ios::binary);
+  fileStream.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+  if (!fileStream)
+    throw util::Error("Could not write binary RVSDG file: " + outputFile.to_str());
+}
+
+RvsdgBinaryReader::~RvsdgBinaryReader() noexcept
+{
+  if (mapping_)
+    munmap(mapping_, size_);
+}
+
+RvsdgBinaryReader::RvsdgBinaryReader(const util::FilePath & inputFile)
+{
+  const auto fileDescriptor = open(inputFile.to_str().c_str(), O_RDONLY);
+  if (fileDescriptor < 0)
+    throw util::Error("Could not open binary RVSDG file: " + inputFile.to_str());
+
+  struct stat fileStatus = {};
+  if (fstat(fileDescriptor, &fileStatus) != 0)
+  {
+    close(fileDescriptor);
+    throw util::Error("Could not determine size of binary RVSDG file: " + inputFile.to_str());
+  }
+
+  if (fileStatus.st_size > 0)
+  {
+    size_ = static_cast<size_t>(fileStatus.st_size);
+    mapping_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    if (mapping_ == MAP_FAILED)
+    {
+      mapping_ = nullptr;
+      close(fileDescriptor);
+      throw util::Error("Could not map binary RVSDG file: " + inputFile.to_str());
+    }
+    data_ = static_cast<const uint8_t *>(mapping_);
+  }
+
+  close(fileDescriptor);
+}
+
+RvsdgBinaryReader::RvsdgBinaryReader(std::vector<uint8_t> buffer)
+    : buffer_(std::move(buffer)),
+      data_(buffer_.data()),
+      size_(buffer_.size())
+{}
+
+std::unique_ptr<LlvmRvsdgModule>
+RvsdgBinaryReader::readModule() const
+{
+  return readModule(nullptr);
+}
+
+std::unique_ptr<LlvmRvsdgModule>
+RvsdgBinaryReader::readModule(const LambdaFilter & materializeLambda) const
+{
+  Decoder decoder(data_, data_ + size_);
+  if (size_ < Magic.size() || std::memcmp(decoder.readBytes(Magic.size()), Magic.data(), 8) != 0)
+    throw util::Error("Input is not a binary RVSDG file.");
+
+  if (const auto version = decoder.readVarint(); version != FormatVersion)
+    throw util::Error(
+        "Unsupported binary RVSDG format version " + std::to_string(version) + ", expected "
+        + std::to_string(FormatVersion) + ".");
+
+  ReaderContext context(materializeLambda ? &materializeLambda : nullptr);
+  context.readTables(decoder);
+
+  const auto & sourceFileName = context.readString(decoder);
+  const auto & targetTriple = context.readString(decoder);
+  const auto & dataLayout = context.readString(decoder);
+  auto rvsdgModule = LlvmRvsdgModule::Create(
+      util::FilePath(sourceFileName),
+      targetTriple,
+      dataLayout);
+  auto & graph = rvsdgModule->Rvsdg();
+
+  std::vector<rvsdg::Output *> imports(decoder.readCount());
+  for (auto & import : imports)
+  {
+    const auto & name = context.readString(decoder);
+    auto valueType = context.readTypeReference(decoder);
+    auto importedType = context.readTypeReference(decoder);
+    const auto linkage = decoder.readEnum(Linkage::commonLinkage);
+    const auto callingConvention = decoder.readEnum(CallingConvention::Tail);
+    const auto isConstant = decoder.readBool();
+    const auto alignment = decoder.readVarint();
+    import = &LlvmGraphImport::create(
+        graph,
+        std::move(valueType),
+        std::move(importedType),
+        name,
+        linkage,
+        callingConvention,
+        isConstant,
+        alignment);
+  }
+
+  const auto exports = readRegion(graph.GetRootRegion(), imports, decoder.readSection(), context);
+  for (auto origin : exports)
+    rvsdg::GraphExport::Create(*origin, context.readString(decoder));
+
+  if (!decoder.isAtEnd())
+    throwMalformed();
+
+  return rvsdgModule;
+}
+
+bool
+RvsdgBinaryReader::isRvsdgBinaryFile(const util::FilePath & inputFile)
+{
+  std::ifstream fileStream(inputFile.to_str(), std::ios::binary);
+  std::array<uint8_t, Magic.size()> magic{};
+  fileStream.read(reinterpret_cast<char *>(magic.data()), magic.size());
+  return fileStream && magic == Magic;
+}
+
+}
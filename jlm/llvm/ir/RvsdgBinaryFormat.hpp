@@ -0,0 +1,138 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_IR_RVSDGBINARYFORMAT_HPP
+#define JLM_LLVM_IR_RVSDGBINARYFORMAT_HPP
+
+#include <jlm/util/file.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace jlm::llvm
+{
+
+class LlvmLambdaOperation;
+class LlvmRvsdgModule;
+
+/**
+ * \brief Writes an LlvmRvsdgModule in jlm's native binary RVSDG format.
+ *
+ * The format is meant for handing modules between jlm invocations without going through the
+ * LLVM frontend again. A file consists of:
+ *
+ * 1. A header with a magic number and the format version.
+ * 2. Interned string, type, and operation tables. Types and operations are stored only once and
+ *    are referred to by their table index.
+ * 3. The module information, i.e., source file name, target triple, data layout, and imports.
+ * 4. The root region and the exports.
+ *
+ * Each region is a self-contained section prefixed with its size in bytes, such that a reader
+ * can skip over it. Within a region, nodes are stored in topological order. An edge is stored as
+ * the distance from the most recently defined output of the region to the edge's origin. All
+ * integers are LEB128-encoded.
+ *
+ * Not all operations are supported by the format. The writer throws a util::Error for
+ * operations it cannot encode.
+ *
+ * \see RvsdgBinaryReader
+ */
+class RvsdgBinaryWriter final
+{
+public:
+  /**
+   * Encodes \p rvsdgModule in the binary RVSDG format.
+   *
+   * @return The encoded module.
+   */
+  [[nodiscard]] static std::vector<uint8_t>
+  writeModule(const LlvmRvsdgModule & rvsdgModule);
+
+  /**
+   * Encodes \p rvsdgModule in the binary RVSDG format and writes it to \p outputFile.
+   */
+  static void
+  writeModule(const LlvmRvsdgModule & rvsdgModule, const util::FilePath & outputFile);
+};
+
+/**
+ * \brief Reads an LlvmRvsdgModule in jlm's native binary RVSDG format.
+ *
+ * Files are mapped into memory instead of being read into a buffer. The bodies of individual
+ * functions can be skipped when reading a module, such that only the functions of interest are
+ * materialized.
+ *
+ * \see RvsdgBinaryWriter
+ */
+class RvsdgBinaryReader final
+{
+public:
+  /**
+   * Determines whether the body of a lambda in the root region is materialized. Lambdas for
+   * which the predicate returns false are replaced by external function imports of the same
+   * name and type.
+   */
+  using LambdaFilter = std::function<bool(const LlvmLambdaOperation &)>;
+
+  ~RvsdgBinaryReader() noexcept;
+
+  /**
+   * Maps \p inputFile into memory.
+   *
+   * @throws util::Error if the file cannot be opened or mapped.
+   */
+  explicit RvsdgBinaryReader(const util::FilePath & inputFile);
+
+  /**
+   * Reads from the in-memory \p buffer.
+   */
+  explicit RvsdgBinaryReader(std::vector<uint8_t> buffer);
+
+  RvsdgBinaryReader(const RvsdgBinaryReader &) = delete;
+
+  RvsdgBinaryReader(RvsdgBinaryReader &&) = delete;
+
+  RvsdgBinaryReader &
+  operator=(const RvsdgBinaryReader &) = delete;
+
+  RvsdgBinaryReader &
+  operator=(RvsdgBinaryReader &&) = delete;
+
+  /**
+   * Decodes the entire module.
+   *
+   * @throws util::Error if the input is not a valid binary RVSDG of a supported version.
+   */
+  [[nodiscard]] std::unique_ptr<LlvmRvsdgModule>
+  readModule() const;
+
+  /**
+   * Decodes the module, but only materializes the bodies of the lambdas in the root region for
+   * which \p materializeLambda returns true. The bodies of all other root region lambdas are
+   * skipped without being decoded.
+   *
+   * @throws util::Error if the input is not a valid binary RVSDG of a supported version.
+   */
+  [[nodiscard]] std::unique_ptr<LlvmRvsdgModule>
+  readModule(const LambdaFilter & materializeLambda) const;
+
+  /**
+   * Checks whether \p inputFile starts with the magic number of the binary RVSDG format.
+   */
+  [[nodiscard]] static bool
+  isRvsdgBinaryFile(const util::FilePath & inputFile);
+
+private:
+  std::vector<uint8_t> buffer_{};
+  void * mapping_ = nullptr;
+  const uint8_t * data_ = nullptr;
+  size_t size_ = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,201 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jlm/llvm/ir/operators/lambda.hpp>
+#include <jlm/llvm/ir/RvsdgBinaryFormat.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/TestRvsdgs.hpp>
+#include <jlm/rvsdg/bitstring/type.hpp>
+#include <jlm/rvsdg/lambda.hpp>
+#include <jlm/rvsdg/TestOperations.hpp>
+
+#include <cstdio>
+
+namespace
+{
+
+/**
+ * Writes \p rvsdgModule, reads it back, and checks that the reconstructed module has the same
+ * shape and encodes to the same bytes.
+ */
+void
+checkRoundTrip(const jlm::llvm::LlvmRvsdgModule & rvsdgModule)
+{
+  using namespace jlm::llvm;
+
+  // Act
+  const auto bytes = RvsdgBinaryWriter::writeModule(rvsdgModule);
+  const auto readModule = RvsdgBinaryReader(bytes).readModule();
+
+  // Assert
+  auto & rootRegion = rvsdgModule.Rvsdg().GetRootRegion();
+  auto & readRootRegion = readModule->Rvsdg().GetRootRegion();
+  EXPECT_EQ(jlm::rvsdg::nnodes(&readRootRegion), jlm::rvsdg::nnodes(&rootRegion));
+  EXPECT_EQ(readRootRegion.narguments(), rootRegion.narguments());
+  EXPECT_EQ(readRootRegion.nresults(), rootRegion.nresults());
+  EXPECT_EQ(readModule->SourceFileName(), rvsdgModule.SourceFileName());
+  EXPECT_EQ(readModule->TargetTriple(), rvsdgModule.TargetTriple());
+  EXPECT_EQ(readModule->DataLayout(), rvsdgModule.DataLayout());
+
+  EXPECT_EQ(RvsdgBinaryWriter::writeModule(*readModule), bytes);
+}
+
+}
+
+TEST(RvsdgBinaryFormatTests, RoundTripSimpleOperations)
+{
+  jlm::llvm::StoreTest1 storeTest;
+  checkRoundTrip(storeTest.module());
+
+  jlm::llvm::LoadTest2 loadTest;
+  checkRoundTrip(loadTest.module());
+
+  jlm::llvm::GetElementPtrTest getElementPtrTest;
+  checkRoundTrip(getElementPtrTest.module());
+
+  jlm::llvm::MemcpyTest memcpyTest;
+  checkRoundTrip(memcpyTest.module());
+
+  jlm::llvm::VariadicFunctionTest2 variadicFunctionTest;
+  checkRoundTrip(variadicFunctionTest.module());
+}
+
+TEST(RvsdgBinaryFormatTests, RoundTripStructuralNodes)
+{
+  jlm::llvm::GammaTest2 gammaTest;
+  checkRoundTrip(gammaTest.module());
+
+  jlm::llvm::ThetaTest thetaTest;
+  checkRoundTrip(thetaTest.module());
+
+  jlm::llvm::DeltaTest3 deltaTest;
+  checkRoundTrip(deltaTest.module());
+
+  jlm::llvm::PhiTest2 phiTest;
+  checkRoundTrip(phiTest.module());
+
+  jlm::llvm::PhiWithDeltaTest phiWithDeltaTest;
+  checkRoundTrip(phiWithDeltaTest.module());
+}
+
+TEST(RvsdgBinaryFormatTests, RoundTripImports)
+{
+  jlm::llvm::ExternalCallTest2 externalCallTest;
+  checkRoundTrip(externalCallTest.module());
+
+  jlm::llvm::ImportTest importTest;
+  checkRoundTrip(importTest.module());
+}
+
+TEST(RvsdgBinaryFormatTests, RoundTripFile)
+{
+  using namespace jlm::llvm;
+  using namespace jlm::util;
+
+  // Arrange
+  CallTest1 test;
+  const auto filePath =
+      FilePath::createUniqueFileName(FilePath::TempDirectoryPath(), "jlm-test-", ".rvsdg");
+
+  // Act
+  RvsdgBinaryWriter::writeModule(test.module(), filePath);
+  const auto isRvsdgBinaryFile = RvsdgBinaryReader::isRvsdgBinaryFile(filePath);
+  const auto readModule = RvsdgBinaryReader(filePath).readModule();
+  std::remove(filePath.to_str().c_str());
+
+  // Assert
+  EXPECT_TRUE(isRvsdgBinaryFile);
+  EXPECT_EQ(
+      RvsdgBinaryWriter::writeModule(*readModule),
+      RvsdgBinaryWriter::writeModule(test.module()));
+}
+
+TEST(RvsdgBinaryFormatTests, LambdaFilter)
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  CallTest1 test;
+  const auto bytes = RvsdgBinaryWriter::writeModule(test.module());
+  const auto numImports = test.graph().GetRootRegion().narguments();
+
+  // Act
+  std::vector<std::string> visitedLambdas;
+  const auto readModule = RvsdgBinaryReader(bytes).readModule(
+      [&](const LlvmLambdaOperation & operation)
+      {
+        visitedLambdas.push_back(operation.name());
+        return operation.name() == "h";
+      });
+
+  // Assert
+  EXPECT_EQ(visitedLambdas, std::vector<std::string>({ "f", "g", "h" }));
+
+  auto & rootRegion = readModule->Rvsdg().GetRootRegion();
+  EXPECT_EQ(rootRegion.numNodes(), 1u);
+  EXPECT_EQ(rootRegion.narguments(), numImports + 2);
+
+  auto & lambdaNode =
+      *jlm::util::assertedCast<jlm::rvsdg::LambdaNode>(rootRegion.Nodes().begin().ptr());
+  EXPECT_EQ(dynamic_cast<const LlvmLambdaOperation &>(lambdaNode.GetOperation()).name(), "h");
+  for (auto & contextVar : lambdaNode.GetContextVars())
+  {
+    auto import = dynamic_cast<const LlvmGraphImport *>(contextVar.input->origin());
+    ASSERT_NE(import, nullptr);
+    EXPECT_EQ(import->linkage(), Linkage::externalLinkage);
+  }
+}
+
+TEST(RvsdgBinaryFormatTests, MalformedInput)
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  StoreTest1 test;
+  const auto bytes = RvsdgBinaryWriter::writeModule(test.module());
+
+  auto wrongMagic = bytes;
+  wrongMagic[0] = 'X';
+
+  auto wrongVersion = bytes;
+  wrongVersion[8] = 0x7f;
+
+  // Act & Assert
+  EXPECT_THROW(RvsdgBinaryReader(wrongMagic).readModule(), jlm::util::Error);
+  EXPECT_THROW(RvsdgBinaryReader(wrongVersion).readModule(), jlm::util::Error);
+  EXPECT_THROW(RvsdgBinaryReader(std::vector<uint8_t>()).readModule(), jlm::util::Error);
+
+  for (size_t size = 0; size < bytes.size(); size++)
+  {
+    const std::vector<uint8_t> truncated(bytes.begin(), bytes.begin() + size);
+    EXPECT_THROW(RvsdgBinaryReader(truncated).readModule(), jlm::util::Error);
+  }
+}
+
+TEST(RvsdgBinaryFormatTests, UnsupportedOperation)
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto rvsdgModule = LlvmRvsdgModule::Create(jlm::util::FilePath(""), "", "");
+  auto & graph = rvsdgModule->Rvsdg();
+  auto valueType = jlm::rvsdg::BitType::Create(32);
+  auto & import = LlvmGraphImport::createGlobalImport(
+      graph,
+      valueType,
+      PointerType::Create(),
+      "x",
+      Linkage::externalLinkage,
+      false,
+      4);
+  auto node =
+      jlm::rvsdg::TestOperation::createNode(&graph.GetRootRegion(), { &import }, { valueType });
+  jlm::rvsdg::GraphExport::Create(*node->output(0), "y");
+
+  // Act & Assert
+  EXPECT_THROW((void)RvsdgBinaryWriter::writeModule(*rvsdgModule), jlm::util::Error);
+}
@@ -140,3 +140,33 @@ TEST(TypeTests, TestGetTypeSizeAndAlignment)
   EXPECT_EQ(GetTypeAllocSize(*packedStructType), 52u);
   EXPECT_EQ(GetTypeAlignment(*packedStructType), 1u);
 }
+
+TEST(TypeTests, TypeInterning)
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange & Act
+  const auto bit128Type1 = BitType::Create(128);
+  const auto bit128Type2 = BitType::Create(128);
+  const auto arrayType1 = ArrayType::Create(BitType::Create(32), 4);
+  const auto arrayType2 = ArrayType::Create(BitType::Create(32), 4);
+  const auto arrayType3 = ArrayType::Create(BitType::Create(32), 8);
+  const auto literalStructType1 = StructType::CreateLiteral({ arrayType1, bit128Type1 }, false);
+  const auto literalStructType2 = StructType::CreateLiteral({ arrayType2, bit128Type2 }, false);
+  const auto identifiedStructType1 = StructType::CreateIdentified({ arrayType1 }, false);
+  const auto identifiedStructType2 = StructType::CreateIdentified({ arrayType1 }, false);
+  const auto functionType1 = FunctionType::Create({ literalStructType1 }, { arrayType3 });
+  const auto functionType2 = FunctionType::Create({ literalStructType2 }, { arrayType3 });
+
+  // Assert
+  EXPECT_EQ(bit128Type1, bit128Type2);
+  EXPECT_EQ(arrayType1, arrayType2);
+  EXPECT_NE(arrayType1, arrayType3);
+  EXPECT_EQ(literalStructType1, literalStructType2);
+  EXPECT_EQ(functionType1, functionType2);
+
+  // Identified structs are not interned, but are still considered equal
+  EXPECT_NE(identifiedStructType1, identifiedStructType2);
+  EXPECT_TRUE(areTypesEqual(*identifiedStructType1, *identifiedStructType2));
+}
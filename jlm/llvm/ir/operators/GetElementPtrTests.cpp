@@ -111,9 +111,13 @@ TEST(GetElementPtrOperationTests, TestOperationEquality)
   // Assert
   EXPECT_NE(operation1, operation2);
 
-  // Arrange 2: create a new type that is structurally identical to structType1
-  auto copyOfStructType1 =
-      StructType::CreateLiteral({ BitType::Create(64), BitType::Create(64) }, false);
+  // Arrange 2: create a new type that is structurally identical to structType1.
+  // The type is created without interning, as CreateLiteral() would return structType1 itself.
+  std::shared_ptr<const StructType> copyOfStructType1 = std::make_shared<StructType>(
+      "",
+      std::vector<std::shared_ptr<const Type>>{ BitType::Create(64), BitType::Create(64) },
+      false,
+      true);
   auto operation3 = GetElementPtrOperation::createOperation(
       pointerType,
       { BitType::Create(32), BitType::Create(32) },
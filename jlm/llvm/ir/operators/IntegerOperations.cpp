@@ -5,6 +5,7 @@
 
 #include <jlm/llvm/ir/operators/IntegerOperations.hpp>
 #include <jlm/llvm/ir/Trace.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::llvm
 {
@@ -129,6 +130,12 @@ IntegerConstantOperation::operator==(const Operation & other) const noexcept
   return constant && constant->Representation() == Representation();
 }
 
+std::size_t
+IntegerConstantOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(NullaryOperation::ComputeHash(), Representation().ComputeHash());
+}
+
 IntegerBinaryOperation::~IntegerBinaryOperation() noexcept = default;
 
 IntegerAddOperation::~IntegerAddOperation() noexcept = default;
@@ -40,6 +40,9 @@ public:
   bool
   operator==(const Operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
   [[nodiscard]] const IntegerValueRepresentation &
   Representation() const noexcept
   {
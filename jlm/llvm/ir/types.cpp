@@ -60,7 +60,8 @@ bool
 ArrayType::operator==(const Type & other) const noexcept
 {
   const auto type = dynamic_cast<const ArrayType *>(&other);
-  return type && type->element_type() == element_type() && type->nelements() == nelements();
+  return type && type->nelements() == nelements()
+      && rvsdg::areTypesEqual(type->element_type(), element_type());
 }
 
 std::size_t
@@ -195,7 +196,7 @@ StructType::operator==(const Type & other) const noexcept
 
   for (size_t n = 0; n < numElements(); n++)
   {
-    if (*types_[n] != *type->types_[n])
+    if (!rvsdg::areTypesEqual(*types_[n], *type->types_[n]))
       return false;
   }
 
@@ -260,7 +261,7 @@ bool
 VectorType::operator==(const rvsdg::Type & other) const noexcept
 {
   const auto type = dynamic_cast<const VectorType *>(&other);
-  return type && type->size_ == size_ && *type->type_ == *type_;
+  return type && type->size_ == size_ && rvsdg::areTypesEqual(*type->type_, *type_);
 }
 
 rvsdg::TypeKind
@@ -97,7 +97,7 @@ public:
   static std::shared_ptr<const ArrayType>
   Create(std::shared_ptr<const Type> type, size_t nelements)
   {
-    return std::make_shared<ArrayType>(std::move(type), nelements);
+    return rvsdg::internType<ArrayType>(std::make_shared<ArrayType>(std::move(type), nelements));
   }
 
 private:
@@ -334,7 +334,8 @@ public:
   CreateLiteral(std::vector<std::shared_ptr<const Type>> types, bool isPacked)
   {
     // Literal structs don't have names, so always use the empty string
-    return std::make_shared<StructType>("", std::move(types), isPacked, true);
+    return rvsdg::internType<StructType>(
+        std::make_shared<StructType>("", std::move(types), isPacked, true));
   }
 
 private:
@@ -412,7 +413,8 @@ public:
   static std::shared_ptr<const FixedVectorType>
   Create(std::shared_ptr<const rvsdg::Type> type, size_t size)
   {
-    return std::make_shared<FixedVectorType>(std::move(type), size);
+    return rvsdg::internType<FixedVectorType>(
+        std::make_shared<FixedVectorType>(std::move(type), size));
   }
 };
 
@@ -437,7 +439,8 @@ public:
   static std::shared_ptr<const ScalableVectorType>
   Create(std::shared_ptr<const rvsdg::Type> type, size_t size)
   {
-    return std::make_shared<ScalableVectorType>(std::move(type), size);
+    return rvsdg::internType<ScalableVectorType>(
+        std::make_shared<ScalableVectorType>(std::move(type), size));
   }
 };
 
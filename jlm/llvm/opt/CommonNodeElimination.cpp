@@ -10,14 +10,17 @@
 #include <jlm/llvm/opt/CommonNodeElimination.hpp>
 #include <jlm/rvsdg/gamma.hpp>
 #include <jlm/rvsdg/MatchType.hpp>
+#include <jlm/rvsdg/NodeMap.hpp>
 #include <jlm/rvsdg/Phi.hpp>
 #include <jlm/rvsdg/theta.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 #include <jlm/util/common.hpp>
 #include <jlm/util/Hash.hpp>
+#include <jlm/util/Parallel.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
+#include <algorithm>
 #include <map>
 #include <unordered_map>
 
@@ -28,6 +31,9 @@ class CommonNodeElimination::Statistics final : public util::Statistics
 {
   const char * MarkTimerLabel_ = "MarkTime";
   const char * DivertTimerLabel_ = "DivertTime";
+  const char * IncrementalTimerLabel_ = "IncrementalTime";
+  const char * NumReprocessedNodesLabel_ = "#ReprocessedNodes";
+  const char * NumThreadsLabel_ = "#Threads";
 
 public:
   ~Statistics() override = default;
@@ -37,9 +43,10 @@ public:
   {}
 
   void
-  startMarkStatistics(const rvsdg::Graph & graph) noexcept
+  startMarkStatistics(const rvsdg::Graph & graph, size_t numThreads) noexcept
   {
     AddMeasurement(Label::NumRvsdgInputsBefore, rvsdg::ninputs(&graph.GetRootRegion()));
+    AddMeasurement(NumThreadsLabel_, numThreads);
     AddTimer(MarkTimerLabel_).start();
   }
 
@@ -62,6 +69,19 @@ public:
     GetTimer(DivertTimerLabel_).stop();
   }
 
+  void
+  startIncrementalStatistics() noexcept
+  {
+    AddTimer(IncrementalTimerLabel_).start();
+  }
+
+  void
+  endIncrementalStatistics(size_t numReprocessedNodes) noexcept
+  {
+    GetTimer(IncrementalTimerLabel_).stop();
+    AddMeasurement(NumReprocessedNodesLabel_, numReprocessedNodes);
+  }
+
   static std::unique_ptr<Statistics>
   Create(const util::FilePath & sourceFile)
   {
@@ -133,9 +153,9 @@ public:
   [[nodiscard]] CongruenceSetIndex
   tryGetSetFor(const rvsdg::Output & output) const
   {
-    if (const auto it = congruenceSetMapping_.find(&output); it != congruenceSetMapping_.end())
+    if (const auto index = congruenceSetMapping_.tryLookup(output))
     {
-      return it->second;
+      return *index;
     }
     return NoCongruenceSetIndex;
   }
@@ -178,19 +198,19 @@ public:
   {
     // The index of the new set, if this operation actually creates one
     auto nextSet = sets_.size();
-    auto [it, added] = congruenceSetMapping_.try_emplace(&leader, nextSet);
+    auto [index, added] = congruenceSetMapping_.tryEmplace(leader, nextSet);
 
     if (!added)
     {
       // If the leader already has its own set, we are done
-      if (sets_[it->second].leader == &leader)
+      if (sets_[index].leader == &leader)
       {
-        return it->second;
+        return index;
       }
 
       // Remove the output from the congruence set it is following
-      sets_[it->second].followers.Remove(&leader);
-      it->second = nextSet;
+      sets_[index].followers.Remove(&leader);
+      index = nextSet;
     }
 
     // Create the new set, lead by \p leader
@@ -229,20 +249,20 @@ public:
     if (!newFollower)
       return;
 
-    const auto [it, added] = congruenceSetMapping_.try_emplace(&follower, index);
+    const auto [oldIndex, added] = congruenceSetMapping_.tryEmplace(follower, index);
 
     // If the follower already belonged to a congruence set, remove it from the old set
     if (!added)
     {
-      JLM_ASSERT(it->second != index);
+      JLM_ASSERT(oldIndex != index);
 
-      if (sets_[it->second].leader == &follower)
+      if (sets_[oldIndex].leader == &follower)
         throw std::logic_error("Cannot turn a leader into a follower");
 
-      const bool removed = sets_[it->second].followers.Remove(&follower);
+      const bool removed = sets_[oldIndex].followers.Remove(&follower);
       JLM_ASSERT(removed);
 
-      it->second = index;
+      oldIndex = index;
     }
   }
 
@@ -258,11 +278,34 @@ public:
     return sets_[index].followers;
   }
 
+  /**
+   * Makes the marking phase collect the lambda nodes it encounters in \p deferredLambdas, instead
+   * of marking their subregions. The subregions are then marked with their own contexts.
+   * @param deferredLambdas the list the lambda nodes are appended to
+   */
+  void
+  deferLambdaSubregions(std::vector<const rvsdg::LambdaNode *> & deferredLambdas) noexcept
+  {
+    deferredLambdas_ = &deferredLambdas;
+  }
+
+  /**
+   * @return the list of lambda nodes whose subregions are deferred, or nullptr if lambda
+   * subregions are marked with this context.
+   */
+  [[nodiscard]] std::vector<const rvsdg::LambdaNode *> *
+  getDeferredLambdas() const noexcept
+  {
+    return deferredLambdas_;
+  }
+
 private:
   // The list of congruence sets
   std::vector<CongruenceSet> sets_;
   // A mapping from each output to the congruence set it belongs to, either as leader or follower
-  std::unordered_map<const rvsdg::Output *, CongruenceSetIndex> congruenceSetMapping_;
+  rvsdg::OutputMap<CongruenceSetIndex> congruenceSetMapping_;
+  // The lambda nodes whose subregions are marked with their own contexts, if any
+  std::vector<const rvsdg::LambdaNode *> * deferredLambdas_ = nullptr;
 };
 
 /**
@@ -1058,7 +1101,15 @@ markStructuralNode(const rvsdg::StructuralNode & node, CommonNodeElimination::Co
       {
         // Context variables are congruent if their origins are congruent.
         // All other arguments are given distinct congruence sets.
-        markSubregionsFromInputs(lambda, context);
+        if (const auto deferredLambdas = context.getDeferredLambdas())
+        {
+          // The subregion is marked later with its own context, see markLambdaSubregions()
+          deferredLambdas->push_back(&lambda);
+        }
+        else
+        {
+          markSubregionsFromInputs(lambda, context);
+        }
 
         // A lambda output is always unique
         markNodeAsLeader(lambda, context);
@@ -1116,6 +1167,68 @@ markRegion(const rvsdg::Region & region, CommonNodeElimination::Context & contex
   }
 }
 
+/**
+ * The congruence sets of lambda subregions that are marked on their own.
+ * @see markLambdaSubregions()
+ */
+struct LambdaSubregionContexts
+{
+  // One context per thread, which holds the congruence sets of all subregions the thread marked.
+  // The subregions are disjoint, so their congruence sets never interfere.
+  std::vector<CommonNodeElimination::Context> contexts;
+  // The index of the context of each lambda node
+  std::vector<size_t> contextIndices;
+};
+
+/**
+ * Marks the subregions of the given lambda nodes, using up to \p numThreads threads. The
+ * subregions are marked independently, as nodes in distinct lambda nodes can only be congruent
+ * through their context variables. The context variables of a lambda node are partitioned by the
+ * congruence sets of their origins in \p outerContext, which must have marked the regions of all
+ * given lambda nodes.
+ *
+ * @param lambdas the lambda nodes whose subregions are marked
+ * @param outerContext the context of the regions the lambda nodes are in
+ * @param numThreads the maximum number of threads
+ * @return the contexts the subregions were marked in
+ */
+static LambdaSubregionContexts
+markLambdaSubregions(
+    const std::vector<const rvsdg::LambdaNode *> & lambdas,
+    const CommonNodeElimination::Context & outerContext,
+    size_t numThreads)
+{
+  LambdaSubregionContexts result;
+  result.contexts.resize(std::max<size_t>(1, std::min(numThreads, lambdas.size())));
+  result.contextIndices.resize(lambdas.size());
+
+  util::parallelForEach(
+      numThreads,
+      lambdas.size(),
+      [&](size_t workerIndex, size_t index)
+      {
+        const auto & subregion = *lambdas[index]->subregion();
+        auto & context = result.contexts[workerIndex];
+        result.contextIndices[index] = workerIndex;
+
+        // The outer context is only read, and the congruence set of an origin serves as partition
+        // key. Arguments without an input are given keys higher than any congruence set index.
+        std::vector<size_t> partitions(subregion.narguments());
+        size_t nextUniquePartitionKey = outerContext.numCongruenceSets();
+        for (const auto argument : subregion.Arguments())
+        {
+          const auto input = argument->input();
+          partitions[argument->index()] =
+              input ? outerContext.getSetFor(*input->origin()) : nextUniquePartitionKey++;
+        }
+
+        partitionArguments(subregion, partitions, context);
+        markRegion(subregion, context);
+      });
+
+  return result;
+}
+
 /* divert phase */
 
 static void
@@ -1149,7 +1262,8 @@ divertInStructuralNode(rvsdg::StructuralNode & node, CommonNodeElimination::Cont
       },
       [&]([[maybe_unused]] rvsdg::LambdaNode & lambda)
       {
-        divertInSubregions = true;
+        // Deferred lambda subregions are diverted with their own contexts
+        divertInSubregions = context.getDeferredLambdas() == nullptr;
       },
       [&]([[maybe_unused]] rvsdg::PhiNode & phi)
       {
@@ -1198,6 +1312,258 @@ divertInRegion(rvsdg::Region & region, CommonNodeElimination::Context & context)
   }
 }
 
+/* incremental elimination */
+
+/**
+ * @return True if \p region is nested in a delta node, where no common node elimination is
+ * performed.
+ */
+static bool
+isInDeltaNode(const rvsdg::Region & region)
+{
+  for (auto node = region.node(); node != nullptr; node = node->region()->node())
+  {
+    if (dynamic_cast<const rvsdg::DeltaNode *>(node))
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * Searches the region of \p node for a live simple node that has the same operation as \p node
+ * and the same origins for all its inputs.
+ *
+ * @param node The simple node for which to find an identical node.
+ * @return The identical node, or nullptr if there is none.
+ */
+static rvsdg::SimpleNode *
+tryFindIdenticalNode(const rvsdg::SimpleNode & node)
+{
+  const auto isIdentical = [&](rvsdg::Node & other)
+  {
+    const auto otherSimpleNode = dynamic_cast<rvsdg::SimpleNode *>(&other);
+    if (!otherSimpleNode || otherSimpleNode == &node || otherSimpleNode->IsDead())
+      return false;
+
+    if (otherSimpleNode->ninputs() != node.ninputs()
+        || otherSimpleNode->noutputs() != node.noutputs())
+      return false;
+
+    if (otherSimpleNode->GetOperation() != node.GetOperation())
+      return false;
+
+    for (auto & input : node.Inputs())
+    {
+      if (otherSimpleNode->input(input.index())->origin() != input.origin())
+        return false;
+    }
+
+    return true;
+  };
+
+  if (node.ninputs() == 0)
+  {
+    for (auto & topNode : node.region()->TopNodes())
+    {
+      if (isIdentical(topNode))
+        return static_cast<rvsdg::SimpleNode *>(&topNode);
+    }
+
+    return nullptr;
+  }
+
+  // An identical node must be a user of the origin of the first input
+  for (auto & user : node.input(0)->origin()->Users())
+  {
+    if (user.index() != 0)
+      continue;
+
+    const auto otherNode = rvsdg::TryGetOwnerNode<rvsdg::Node>(user);
+    if (otherNode && isIdentical(*otherNode))
+      return static_cast<rvsdg::SimpleNode *>(otherNode);
+  }
+
+  return nullptr;
+}
+
+/**
+ * Eliminates common nodes after the changes recorded in a change log, assuming that no two live
+ * outputs were congruent before the changes. Simple nodes are merged with identical nodes in
+ * their region, i.e., nodes with the same operation and the same origins, and the users of merged
+ * nodes are processed in turn. Structural nodes are marked in isolation, considering the origins
+ * of their inputs as distinct.
+ */
+class IncrementalElimination final
+{
+public:
+  /**
+   * Processes all nodes that were created, and the users of all inputs that changed.
+   */
+  void
+  run(const rvsdg::ChangeLog & changeLog)
+  {
+    // The sets of the change log are copied, as the elimination itself changes the module
+    const std::vector<const rvsdg::Node *> createdNodes(
+        changeLog.createdNodes().begin(),
+        changeLog.createdNodes().end());
+    const std::vector<const rvsdg::Input *> changedInputs(
+        changeLog.changedInputs().begin(),
+        changeLog.changedInputs().end());
+
+    for (const auto node : createdNodes)
+      enqueueNode(const_cast<rvsdg::Node &>(*node));
+    for (const auto input : changedInputs)
+      enqueueUser(const_cast<rvsdg::Input &>(*input));
+
+    while (!simpleNodes_.empty() || !structuralNodes_.IsEmpty())
+    {
+      while (!simpleNodes_.empty())
+      {
+        const auto node = simpleNodes_.back();
+        simpleNodes_.pop_back();
+        queuedSimpleNodes_.Remove(node);
+        processSimpleNode(*node);
+      }
+
+      processStructuralNodes();
+    }
+  }
+
+  [[nodiscard]] size_t
+  numReprocessedNodes() const noexcept
+  {
+    return numReprocessedNodes_;
+  }
+
+private:
+  void
+  enqueueNode(rvsdg::Node & node)
+  {
+    if (const auto simpleNode = dynamic_cast<rvsdg::SimpleNode *>(&node))
+    {
+      if (queuedSimpleNodes_.insert(simpleNode))
+        simpleNodes_.push_back(simpleNode);
+    }
+    else
+    {
+      structuralNodes_.insert(util::assertedCast<rvsdg::StructuralNode>(&node));
+    }
+  }
+
+  /**
+   * Enqueues the node whose congruence depends on the origin of \p input. This is the owner of the
+   * input, or the gamma or theta node whose result \p input is. The results of other structural
+   * nodes do not affect the congruence of their outputs.
+   */
+  void
+  enqueueUser(rvsdg::Input & input)
+  {
+    if (const auto node = rvsdg::TryGetOwnerNode<rvsdg::Node>(input))
+    {
+      enqueueNode(*node);
+      return;
+    }
+
+    const auto structuralNode = input.region()->node();
+    if (dynamic_cast<rvsdg::GammaNode *>(structuralNode)
+        || dynamic_cast<rvsdg::ThetaNode *>(structuralNode))
+    {
+      enqueueNode(*structuralNode);
+    }
+  }
+
+  /**
+   * Diverts the users of \p output to \p leader and enqueues them.
+   */
+  void
+  divertOutputUsers(rvsdg::Output & output, rvsdg::Output & leader)
+  {
+    if (&output == &leader)
+      return;
+
+    std::vector<rvsdg::Input *> users;
+    for (auto & user : output.Users())
+      users.push_back(&user);
+
+    output.divert_users(&leader);
+    for (const auto user : users)
+      enqueueUser(*user);
+  }
+
+  void
+  processSimpleNode(rvsdg::SimpleNode & node)
+  {
+    if (node.noutputs() == 0 || node.IsDead() || isInDeltaNode(*node.region()))
+      return;
+
+    numReprocessedNodes_++;
+    const auto identicalNode = tryFindIdenticalNode(node);
+    if (identicalNode == nullptr)
+      return;
+
+    for (auto & output : node.Outputs())
+      divertOutputUsers(output, *identicalNode->output(output.index()));
+  }
+
+  /**
+   * Marks the enqueued structural nodes in isolation and diverts the users of their outputs that
+   * are congruent with other outputs. Structural nodes nested in other enqueued structural nodes
+   * are covered by the marking of the outermost node.
+   */
+  void
+  processStructuralNodes()
+  {
+    const auto isNestedInEnqueuedNode = [&](const rvsdg::StructuralNode & node)
+    {
+      for (auto parent = node.region()->node(); parent; parent = parent->region()->node())
+      {
+        if (structuralNodes_.Contains(util::assertedCast<rvsdg::StructuralNode>(parent)))
+          return true;
+      }
+      return false;
+    };
+
+    std::vector<rvsdg::StructuralNode *> nodes;
+    for (const auto node : structuralNodes_.Items())
+    {
+      if (!dynamic_cast<rvsdg::DeltaNode *>(node) && !isNestedInEnqueuedNode(*node)
+          && !isInDeltaNode(*node->region()))
+        nodes.push_back(node);
+    }
+    structuralNodes_.Clear();
+
+    for (const auto node : nodes)
+      processStructuralNode(*node);
+  }
+
+  void
+  processStructuralNode(rvsdg::StructuralNode & node)
+  {
+    numReprocessedNodes_++;
+
+    // The origins of the inputs are considered distinct, as they are not congruent with any other
+    // output in their region
+    CommonNodeElimination::Context context;
+    for (auto & input : node.Inputs())
+      context.getOrCreateSetForLeader(*input.origin());
+
+    markStructuralNode(node, context);
+    divertInStructuralNode(node, context);
+
+    for (auto & output : node.Outputs())
+    {
+      auto & leader = context.getLeader(context.getSetFor(output));
+      divertOutputUsers(output, const_cast<rvsdg::Output &>(leader));
+    }
+  }
+
+  std::vector<rvsdg::SimpleNode *> simpleNodes_{};
+  util::HashSet<rvsdg::SimpleNode *> queuedSimpleNodes_{};
+  util::HashSet<rvsdg::StructuralNode *> structuralNodes_{};
+  size_t numReprocessedNodes_ = 0;
+};
+
 CommonNodeElimination::~CommonNodeElimination() noexcept = default;
 
 void
@@ -1207,19 +1573,74 @@ CommonNodeElimination::Run(
 {
   const auto & rvsdg = module.Rvsdg();
   auto & rootRegion = rvsdg.GetRootRegion();
+  auto statistics = Statistics::Create(module.SourceFilePath().value());
+
+  if (EnableIncrementalElimination_ && PreviousModule_ == &module && ChangeLog_)
+  {
+    statistics->startIncrementalStatistics();
+    IncrementalElimination incrementalElimination;
+    incrementalElimination.run(*ChangeLog_);
+    ChangeLog_->clear();
+    statistics->endIncrementalStatistics(incrementalElimination.numReprocessedNodes());
+
+    statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+    return;
+  }
 
   Context context;
-  auto statistics = Statistics::Create(module.SourceFilePath().value());
+  std::vector<const rvsdg::LambdaNode *> lambdas;
+  if (numThreads_ > 1)
+    context.deferLambdaSubregions(lambdas);
 
-  statistics->startMarkStatistics(rvsdg);
+  statistics->startMarkStatistics(rvsdg, numThreads_);
   markGraphImports(rootRegion, context);
   markRegion(rootRegion, context);
+  auto lambdaContexts = markLambdaSubregions(lambdas, context, numThreads_);
   statistics->endMarkStatistics();
 
   statistics->startDivertStatistics();
   divertInRegion(rootRegion, context);
+  for (size_t n = 0; n < lambdas.size(); n++)
+  {
+    auto & lambdaContext = lambdaContexts.contexts[lambdaContexts.contextIndices[n]];
+    divertInRegion(*lambdas[n]->subregion(), lambdaContext);
+  }
   statistics->endDivertStatistics(rvsdg);
 
+  if (EnableIncrementalElimination_)
+  {
+    PreviousModule_ = &module;
+    // The incremental elimination only needs the created nodes and changed inputs
+    ChangeLog_ = std::make_unique<rvsdg::ChangeLog>(rootRegion, false);
+  }
+
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
+
+void
+CommonNodeElimination::RunOnLambda(rvsdg::LambdaNode & lambdaNode)
+{
+  auto & subregion = *lambdaNode.subregion();
+
+  // The origins of the context variables are outside the lambda node and must not be inspected.
+  // Every argument therefore becomes the leader of its own congruence set.
+  Context context;
+  markGraphImports(subregion, context);
+  markRegion(subregion, context);
+
+  divertInRegion(subregion, context);
+}
+
+void
+CommonNodeElimination::EnableIncrementalElimination(bool enable)
+{
+  EnableIncrementalElimination_ = enable;
+
+  if (!enable)
+  {
+    PreviousModule_ = nullptr;
+    ChangeLog_.reset();
+  }
+}
+
 }
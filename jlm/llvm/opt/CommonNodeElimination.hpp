@@ -6,7 +6,9 @@
 #ifndef JLM_LLVM_OPT_COMMONNODEELIMINATION_HPP
 #define JLM_LLVM_OPT_COMMONNODEELIMINATION_HPP
 
+#include <jlm/rvsdg/ChangeLog.hpp>
 #include <jlm/rvsdg/Transformation.hpp>
+#include <jlm/util/common.hpp>
 
 namespace jlm::llvm
 {
@@ -16,6 +18,9 @@ namespace jlm::llvm
  * Discovers simple nodes, region arguments and structural node outputs that are guaranteed to
  * always produce the same value, and redirects all their users to the same output.
  * This renders common nodes and common structural arguments / results dead.
+ *
+ * \see EnableIncrementalElimination()
+ * \see setNumThreads()
  */
 class CommonNodeElimination final : public rvsdg::Transformation
 {
@@ -31,6 +36,82 @@ public:
 
   void
   Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  IsLambdaLocal() const noexcept override
+  {
+    return true;
+  }
+
+  [[nodiscard]] bool
+  IsIdempotent() const noexcept override
+  {
+    return true;
+  }
+
+  /**
+   * Performs common node elimination in the subregion of \p lambdaNode. In contrast to Run(), the
+   * context variables of the lambda node are all considered distinct.
+   *
+   * @param lambdaNode The lambda node whose subregion is transformed.
+   */
+  void
+  RunOnLambda(rvsdg::LambdaNode & lambdaNode) override;
+
+  /**
+   * Enables or disables incremental elimination. When enabled, the pass keeps an rvsdg::ChangeLog
+   * recording all changes made to the module after it was last run on it. Running the pass on the
+   * same module again then only reprocesses the simple nodes that were created or whose operands
+   * changed, and propagates to the users of every node it eliminates. Structural nodes that were
+   * created, or whose inputs or gamma and theta results changed, are marked again in isolation.
+   *
+   * The first run on a module always processes the entire module. Afterwards, no two live outputs
+   * are known to be congruent, which permits comparing origins by identity in later runs. An
+   * incremental run is sound, but can be less precise than a run on the entire module, as the
+   * origins of the inputs of reprocessed structural nodes are considered distinct.
+   *
+   * Incremental elimination only applies to Run(). RunOnLambda() always processes the entire
+   * subregion of a lambda node.
+   *
+   * @param enable true to keep observing a module between runs, false to drop the kept state
+   */
+  void
+  EnableIncrementalElimination(bool enable);
+
+  [[nodiscard]] bool
+  IsIncrementalEliminationEnabled() const noexcept
+  {
+    return EnableIncrementalElimination_;
+  }
+
+  /**
+   * Sets the maximum number of threads used by Run() for marking congruent outputs. With more
+   * than one thread, the subregion of every lambda node is marked on its own after the regions
+   * around the lambda nodes, as nodes in distinct lambda nodes can only be congruent through
+   * their context variables. The diversion of outputs is always sequential. The default is 1.
+   *
+   * @param numThreads the maximum number of threads. Must be at least 1.
+   */
+  void
+  setNumThreads(size_t numThreads) noexcept
+  {
+    JLM_ASSERT(numThreads > 0);
+    numThreads_ = numThreads;
+  }
+
+  [[nodiscard]] size_t
+  getNumThreads() const noexcept
+  {
+    return numThreads_;
+  }
+
+private:
+  size_t numThreads_ = 1;
+  bool EnableIncrementalElimination_ = false;
+
+  // The state kept between runs when incremental elimination is enabled
+  const rvsdg::RvsdgModule * PreviousModule_ = nullptr;
+  std::unique_ptr<rvsdg::ChangeLog> ChangeLog_ = {};
 };
 
 }
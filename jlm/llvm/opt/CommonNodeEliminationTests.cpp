@@ -638,6 +638,59 @@ TEST(CommonNodeEliminationTests, test_phi)
       jlm::rvsdg::AssertGetOwnerNode<jlm::rvsdg::LambdaNode>(*f2).input(0)->origin());
 }
 
+TEST(CommonNodeEliminationTests, ParallelMarking)
+{
+  // Arrange
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  auto valueType = TestType::createValueType();
+  auto functionType = FunctionType::Create({ valueType }, { valueType });
+
+  LlvmRvsdgModule rm(jlm::util::FilePath(""), "", "");
+  auto & graph = rm.Rvsdg();
+
+  auto & x = GraphImport::Create(graph, valueType, "x");
+
+  auto lambda1 = LambdaNode::Create(
+      graph.GetRootRegion(),
+      LlvmLambdaOperation::Create(functionType, "f1", Linkage::externalLinkage));
+  auto cv1 = lambda1->AddContextVar(x).inner;
+  auto cv2 = lambda1->AddContextVar(x).inner;
+  auto node1 = TestOperation::createNode(lambda1->subregion(), { cv1 }, { valueType });
+  auto node2 = TestOperation::createNode(lambda1->subregion(), { cv2 }, { valueType });
+  auto node3 = TestOperation::createNode(
+      lambda1->subregion(),
+      { node1->output(0), node2->output(0) },
+      { valueType });
+  GraphExport::Create(*lambda1->finalize({ node3->output(0) }), "f1");
+
+  PhiBuilder phiBuilder;
+  phiBuilder.begin(&graph.GetRootRegion());
+  auto d1 = phiBuilder.AddContextVar(x);
+  auto d2 = phiBuilder.AddContextVar(x);
+  auto r1 = phiBuilder.AddFixVar(functionType);
+
+  auto lambda2 = LambdaNode::Create(
+      *phiBuilder.subregion(),
+      LlvmLambdaOperation::Create(functionType, "f2", Linkage::externalLinkage));
+  auto cv3 = lambda2->AddContextVar(*d1.inner).inner;
+  auto cv4 = lambda2->AddContextVar(*d2.inner).inner;
+  auto node4 = TestOperation::createNode(lambda2->subregion(), { cv3, cv4 }, { valueType });
+  r1.result->divert_to(lambda2->finalize({ node4->output(0) }));
+  GraphExport::Create(*phiBuilder.end()->output(0), "f2");
+
+  // Act
+  CommonNodeElimination cne;
+  cne.setNumThreads(4);
+  cne.Run(rm, statisticsCollector);
+
+  // Assert
+  // The context variables are congruent, as their origins in the outer regions are congruent
+  EXPECT_EQ(node3->input(0)->origin(), node3->input(1)->origin());
+  EXPECT_EQ(node4->input(0)->origin(), node4->input(1)->origin());
+}
+
 TEST(CommonNodeEliminationTests, EmptyTheta)
 {
   using namespace jlm::llvm;
@@ -926,3 +979,88 @@ TEST(CommonNodeEliminationTests, InvariantLoopOutputs)
   EXPECT_EQ(exportY.origin(), &zero);
   EXPECT_EQ(exportZ.origin(), &zero);
 }
+
+TEST(CommonNodeEliminationTests, IncrementalSimpleNodes)
+{
+  // Arrange
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+  using namespace jlm::util;
+
+  auto valueType = TestType::createValueType();
+
+  LlvmRvsdgModule rm(FilePath(""), "", "");
+  auto & rootRegion = rm.Rvsdg().GetRootRegion();
+
+  auto & x = GraphImport::Create(rm.Rvsdg(), valueType, "x");
+  auto a1 = TestOperation::createNode(&rootRegion, { &x }, { valueType })->output(0);
+  auto b1 = TestOperation::createNode(&rootRegion, { a1 }, { valueType })->output(0);
+  GraphExport::Create(*b1, "b1");
+
+  CommonNodeElimination cne;
+  cne.EnableIncrementalElimination(true);
+  cne.Run(rm, statisticsCollector);
+
+  // Act
+  auto a2 = TestOperation::createNode(&rootRegion, { &x }, { valueType })->output(0);
+  auto b2 = TestOperation::createNode(&rootRegion, { a2 }, { valueType })->output(0);
+  auto & exportB2 = GraphExport::Create(*b2, "b2");
+
+  StatisticsCollector collector(
+      StatisticsCollectorSettings({ Statistics::Id::CommonNodeElimination }));
+  cne.Run(rm, collector);
+
+  // Assert
+  // The merge of a2 with a1 renders b2 identical to b1
+  EXPECT_EQ(exportB2.origin(), b1);
+
+  auto & statistics = *collector.CollectedStatistics().begin();
+  EXPECT_LE(statistics.GetMeasurementValue<uint64_t>("#ReprocessedNodes"), 3u);
+}
+
+TEST(CommonNodeEliminationTests, IncrementalGamma)
+{
+  // Arrange
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  auto valueType = TestType::createValueType();
+  auto controlType = ControlType::Create(2);
+
+  LlvmRvsdgModule rm(jlm::util::FilePath(""), "", "");
+  auto & graph = rm.Rvsdg();
+
+  auto & c = GraphImport::Create(graph, controlType, "c");
+  auto & x = GraphImport::Create(graph, valueType, "x");
+
+  auto gamma = GammaNode::create(&c, 2);
+  auto entryVar1 = gamma->AddEntryVar(&x);
+  auto exitVar1 = gamma->AddExitVar(entryVar1.branchArgument);
+  auto & export1 = GraphExport::Create(*exitVar1.output, "x1");
+
+  CommonNodeElimination cne;
+  cne.EnableIncrementalElimination(true);
+  cne.Run(rm, statisticsCollector);
+  EXPECT_EQ(export1.origin(), &x);
+
+  // Act
+  auto entryVar2 = gamma->AddEntryVar(&x);
+  auto node1 = TestOperation::createNode(
+      gamma->subregion(0),
+      { entryVar1.branchArgument[0] },
+      { valueType });
+  auto node2 = TestOperation::createNode(
+      gamma->subregion(0),
+      { entryVar2.branchArgument[0] },
+      { valueType });
+  auto exitVar2 = gamma->AddExitVar({ node1->output(0), entryVar1.branchArgument[1] });
+  auto exitVar3 = gamma->AddExitVar({ node2->output(0), entryVar2.branchArgument[1] });
+  auto & export2 = GraphExport::Create(*exitVar2.output, "x2");
+  auto & export3 = GraphExport::Create(*exitVar3.output, "x3");
+
+  cne.Run(rm, statisticsCollector);
+
+  // Assert
+  // The entry variables have the same origin, which renders the exit variables congruent
+  EXPECT_EQ(export2.origin(), export3.origin());
+}
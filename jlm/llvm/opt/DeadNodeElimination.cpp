@@ -9,6 +9,7 @@
 #include <jlm/rvsdg/delta.hpp>
 #include <jlm/rvsdg/gamma.hpp>
 #include <jlm/rvsdg/MatchType.hpp>
+#include <jlm/rvsdg/NodeMap.hpp>
 #include <jlm/rvsdg/theta.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 #include <jlm/util/Statistics.hpp>
@@ -35,6 +36,8 @@ namespace jlm::llvm
  * to mark o2 alive in the future, we can immediately stop marking instead of reiterating through i1
  * ... iN again. Thus, by marking the entire simple node instead of just its outputs, we reduce the
  * runtime for marking Node2 from O(oN x iN) to O(oN + iN).
+ *
+ * Both sets are bitmaps indexed by the graph index of the nodes and outputs.
  */
 class DeadNodeElimination::Context final
 {
@@ -46,7 +49,7 @@ public:
   bool
   markAlive(const rvsdg::Output & output)
   {
-    return Outputs_.insert(&output);
+    return Outputs_.insert(output);
   }
 
   /**
@@ -56,19 +59,19 @@ public:
   bool
   markAlive(const rvsdg::SimpleNode & simpleNode)
   {
-    return SimpleNodes_.insert(&simpleNode);
+    return SimpleNodes_.insert(simpleNode);
   }
 
   bool
   isAlive(const rvsdg::Output & output) const noexcept
   {
-    return Outputs_.Contains(&output);
+    return Outputs_.contains(output);
   }
 
   bool
   isAlive(const rvsdg::SimpleNode & simpleNode) const noexcept
   {
-    return SimpleNodes_.Contains(&simpleNode);
+    return SimpleNodes_.contains(simpleNode);
   }
 
   static std::unique_ptr<Context>
@@ -78,8 +81,8 @@ public:
   }
 
 private:
-  util::HashSet<const rvsdg::SimpleNode *> SimpleNodes_{};
-  util::HashSet<const rvsdg::Output *> Outputs_{};
+  rvsdg::NodeBitSet SimpleNodes_{};
+  rvsdg::OutputBitSet Outputs_{};
 };
 
 /** \brief Dead Node Elimination statistics class
@@ -173,6 +176,25 @@ DeadNodeElimination::Run(
   Context_.reset();
 }
 
+void
+DeadNodeElimination::RunOnLambda(rvsdg::LambdaNode & lambdaNode)
+{
+  // This method might be invoked concurrently for distinct lambda nodes. Use a separate instance
+  // to avoid sharing the context.
+  DeadNodeElimination deadNodeElimination;
+  deadNodeElimination.Context_ = Context::create();
+
+  // The origins of the context variables are outside the lambda node and must not be traversed.
+  // Marking the context variable arguments upfront stops the mark phase at the lambda boundary.
+  for (const auto & ctxVar : lambdaNode.GetContextVars())
+  {
+    deadNodeElimination.Context_->markAlive(*ctxVar.inner);
+  }
+
+  deadNodeElimination.markRegion(*lambdaNode.subregion());
+  deadNodeElimination.sweepRegion(*lambdaNode.subregion());
+}
+
 static bool
 isLoadNonVolatileMemoryStateOutput(const rvsdg::Output & output)
 {
@@ -66,6 +66,27 @@ public:
   void
   Run(rvsdg::RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
 
+  [[nodiscard]] bool
+  IsLambdaLocal() const noexcept override
+  {
+    return true;
+  }
+
+  [[nodiscard]] bool
+  IsIdempotent() const noexcept override
+  {
+    return true;
+  }
+
+  /**
+   * Removes all dead nodes in the subregion of \p lambdaNode. In contrast to Run(), the context
+   * variables of the lambda node are considered alive and are not removed.
+   *
+   * @param lambdaNode The lambda node whose subregion is swept.
+   */
+  void
+  RunOnLambda(rvsdg::LambdaNode & lambdaNode) override;
+
 private:
   void
   markRegion(const rvsdg::Region & region);
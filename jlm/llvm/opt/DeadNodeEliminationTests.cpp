@@ -305,6 +305,50 @@ TEST(DeadNodeEliminationTests, Lambda)
   EXPECT_EQ(graph.GetRootRegion().narguments(), 1u);
 }
 
+TEST(DeadNodeEliminationTests, RunOnLambda)
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto valueType = jlm::rvsdg::TestType::createValueType();
+
+  jlm::llvm::LlvmRvsdgModule rvsdgModule(jlm::util::FilePath(""), "", "");
+  auto & graph = rvsdgModule.Rvsdg();
+  auto x = &jlm::rvsdg::GraphImport::Create(graph, valueType, "x");
+  auto y = &jlm::rvsdg::GraphImport::Create(graph, valueType, "y");
+
+  auto lambda = jlm::rvsdg::LambdaNode::Create(
+      graph.GetRootRegion(),
+      LlvmLambdaOperation::Create(
+          jlm::rvsdg::FunctionType::Create({ valueType }, { valueType, valueType }),
+          "f",
+          Linkage::externalLinkage));
+
+  auto cv1 = lambda->AddContextVar(*x).inner;
+  auto cv2 = lambda->AddContextVar(*y).inner;
+  TestOperation::createNode(
+      lambda->subregion(),
+      { lambda->GetFunctionArguments()[0], cv1 },
+      { valueType });
+
+  auto output = lambda->finalize({ lambda->GetFunctionArguments()[0], cv2 });
+
+  jlm::rvsdg::GraphExport::Create(*output, "f");
+  jlm::rvsdg::view(graph, stdout);
+
+  // Act
+  DeadNodeElimination deadNodeElimination;
+  deadNodeElimination.RunOnLambda(*lambda);
+  jlm::rvsdg::view(graph, stdout);
+
+  // Assert
+  // The dead node is removed, but the context variables and imports are left untouched
+  EXPECT_EQ(lambda->subregion()->numNodes(), 0u);
+  EXPECT_EQ(lambda->GetContextVars().size(), 2u);
+  EXPECT_EQ(graph.GetRootRegion().narguments(), 2u);
+}
+
 TEST(DeadNodeEliminationTests, Phi)
 {
   using namespace jlm::llvm;
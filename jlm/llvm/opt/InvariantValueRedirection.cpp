@@ -12,6 +12,7 @@
 #include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
 #include <jlm/llvm/opt/InvariantValueRedirection.hpp>
 #include <jlm/llvm/opt/PredicateCorrelation.hpp>
+#include <jlm/rvsdg/AnalysisManager.hpp>
 #include <jlm/rvsdg/gamma.hpp>
 #include <jlm/rvsdg/MatchType.hpp>
 #include <jlm/rvsdg/theta.hpp>
@@ -216,12 +217,13 @@ InvariantValueRedirection::redirectThetaOutputs(rvsdg::ThetaNode & thetaNode)
 void
 InvariantValueRedirection::redirectThetaGammaOutputs(rvsdg::ThetaNode & thetaNode)
 {
-  auto correlationOpt = computeThetaGammaPredicateCorrelation(thetaNode);
-  if (!correlationOpt.has_value())
+  const auto correlation =
+      rvsdg::AnalysisManager::getResultOrCompute<ThetaGammaPredicateCorrelationAnalysis>(
+          *thetaNode.subregion());
+  if (!correlation)
   {
     return;
   }
-  auto & correlation = correlationOpt.value();
 
   auto subregionRolesOpt = determineGammaSubregionRoles(*correlation);
   if (!subregionRolesOpt.has_value())
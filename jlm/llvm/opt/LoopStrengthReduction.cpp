@@ -138,8 +138,11 @@ LoopStrengthReduction::Run(
 
   Context_ = Context::Create();
 
-  ChrecMap_ = scalarEvolution.GetChrecMap();
-  SCEVMap_ = scalarEvolution.GetSCEVMap();
+  // The recurrences and SCEV trees are shared with the analysis, such that only the maps are copied
+  const auto & chrecMap = scalarEvolution.GetChrecMap();
+  const auto & scevMap = scalarEvolution.GetSCEVMap();
+  ChrecMap_ = { chrecMap.begin(), chrecMap.end() };
+  SCEVMap_ = { scevMap.begin(), scevMap.end() };
 
   ProcessRegion(rvsdgModule.Rvsdg().GetRootRegion());
 
@@ -92,8 +92,8 @@ private:
       rvsdg::ThetaNode & thetaNode,
       size_t numBits);
 
-  std::unordered_map<const rvsdg::Output *, std::unique_ptr<SCEVChainRecurrence>> ChrecMap_;
-  std::unordered_map<const rvsdg::Output *, std::unique_ptr<SCEV>> SCEVMap_;
+  std::unordered_map<const rvsdg::Output *, std::shared_ptr<const SCEVChainRecurrence>> ChrecMap_;
+  std::unordered_map<const rvsdg::Output *, std::shared_ptr<const SCEV>> SCEVMap_;
   std::unordered_map<const rvsdg::Output *, bool> DependsOnIVMemo_;
   std::unordered_map<const rvsdg::Output *, bool> ContainsMulMemo_;
 
@@ -6,6 +6,7 @@
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/LoopUnswitching.hpp>
 #include <jlm/llvm/opt/PredicateCorrelation.hpp>
+#include <jlm/rvsdg/AnalysisManager.hpp>
 #include <jlm/llvm/opt/pull.hpp>
 #include <jlm/rvsdg/gamma.hpp>
 #include <jlm/rvsdg/node.hpp>
@@ -215,9 +216,10 @@ LoopUnswitching::UnswitchLoop(rvsdg::ThetaNode & oldThetaNode)
 
   // FIXME: We should get this correlation from the IsUnswitchable() method, if it is possible
   // to perform the transformation.
-  const auto correlationOpt = computeThetaGammaPredicateCorrelation(oldThetaNode);
-  JLM_ASSERT(correlationOpt.has_value());
-  auto & correlation = correlationOpt.value();
+  const auto correlation =
+      rvsdg::AnalysisManager::getResultOrCompute<ThetaGammaPredicateCorrelationAnalysis>(
+          *oldThetaNode.subregion());
+  JLM_ASSERT(correlation);
 
   if (!heuristic_->shouldUnswitchLoop(*correlation))
     return false;
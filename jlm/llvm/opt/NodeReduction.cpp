@@ -15,6 +15,7 @@
 #include <jlm/llvm/opt/NodeReduction.hpp>
 #include <jlm/rvsdg/binary.hpp>
 #include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/lambda.hpp>
 #include <jlm/rvsdg/MatchType.hpp>
 #include <jlm/rvsdg/NodeNormalization.hpp>
 #include <jlm/rvsdg/RvsdgModule.hpp>
@@ -310,6 +311,16 @@ NodeReduction::Run(
   statisticsCollector.CollectDemandedStatistics(std::move(Statistics_));
 }
 
+void
+NodeReduction::RunOnLambda(rvsdg::LambdaNode & lambdaNode)
+{
+  // This method might be invoked concurrently for distinct lambda nodes. Use a separate instance
+  // to avoid sharing the statistics.
+  NodeReduction nodeReduction;
+  nodeReduction.Statistics_ = Statistics::Create(util::FilePath(""));
+  nodeReduction.ReduceNodesInRegion(*lambdaNode.subregion());
+}
+
 void
 NodeReduction::ReduceNodesInRegion(rvsdg::Region & region)
 {
@@ -16,6 +16,7 @@ namespace jlm::rvsdg
 {
 class GammaNode;
 class Graph;
+class LambdaNode;
 class Node;
 class Region;
 class Output;
@@ -52,6 +53,15 @@ public:
   void
   Run(rvsdg::RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector) override;
 
+  [[nodiscard]] bool
+  IsLambdaLocal() const noexcept override
+  {
+    return true;
+  }
+
+  void
+  RunOnLambda(rvsdg::LambdaNode & lambdaNode) override;
+
 private:
   void
   ReduceNodesInRegion(rvsdg::Region & region);
@@ -5,6 +5,7 @@
 
 #include <jlm/llvm/ir/operators/IntegerOperations.hpp>
 #include <jlm/llvm/opt/PredicateCorrelation.hpp>
+#include <jlm/rvsdg/AnalysisManager.hpp>
 #include <jlm/rvsdg/bitstring/constant.hpp>
 #include <jlm/rvsdg/delta.hpp>
 #include <jlm/rvsdg/gamma.hpp>
@@ -172,6 +173,16 @@ computeThetaGammaPredicateCorrelation(rvsdg::ThetaNode & thetaNode)
   return std::nullopt;
 }
 
+std::shared_ptr<ThetaGammaPredicateCorrelation>
+ThetaGammaPredicateCorrelationAnalysis::compute(rvsdg::Region & region)
+{
+  auto & thetaNode = *util::assertedCast<rvsdg::ThetaNode>(region.node());
+  if (auto correlationOpt = computeThetaGammaPredicateCorrelation(thetaNode))
+    return std::move(*correlationOpt);
+
+  return nullptr;
+}
+
 static std::optional<std::unique_ptr<GammaGammaPredicateCorrelation>>
 computeMatchCorrelation(rvsdg::GammaNode & gammaNode1)
 {
@@ -331,12 +342,13 @@ PredicateCorrelation::correlatePredicatesInTheta(rvsdg::ThetaNode & thetaNode)
   {
     predicateWasRedirected = false;
 
-    const auto correlationOpt = computeThetaGammaPredicateCorrelation(thetaNode);
-    if (!correlationOpt.has_value())
+    const auto correlation =
+        rvsdg::AnalysisManager::getResultOrCompute<ThetaGammaPredicateCorrelationAnalysis>(
+            *thetaNode.subregion());
+    if (!correlation)
     {
       return;
     }
-    const auto & correlation = correlationOpt.value();
 
     switch (correlation->type())
     {
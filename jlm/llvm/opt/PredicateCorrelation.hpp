@@ -243,6 +243,24 @@ private:
 std::optional<std::unique_ptr<ThetaGammaPredicateCorrelation>>
 computeThetaGammaPredicateCorrelation(rvsdg::ThetaNode & thetaNode);
 
+/**
+ * The theta-gamma predicate correlation as analysis for the rvsdg::AnalysisManager. The analysis
+ * is computed for the subregion of a theta node.
+ *
+ * @see computeThetaGammaPredicateCorrelation()
+ */
+struct ThetaGammaPredicateCorrelationAnalysis
+{
+  using Result = ThetaGammaPredicateCorrelation;
+
+  /**
+   * @param region The subregion of a theta node.
+   * @return The theta-gamma predicate correlation of the theta node if any, otherwise nullptr.
+   */
+  static std::shared_ptr<Result>
+  compute(rvsdg::Region & region);
+};
+
 typedef struct
 {
   rvsdg::Region * repetitionSubregion;
@@ -13,15 +13,111 @@
 #include <jlm/rvsdg/RvsdgModule.hpp>
 #include <jlm/rvsdg/theta.hpp>
 #include <jlm/rvsdg/Transformation.hpp>
+#include <jlm/util/Hash.hpp>
 #include <jlm/util/Statistics.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <queue>
 
 namespace jlm::llvm
 {
 
+SCEVUniquer::~SCEVUniquer() noexcept = default;
+
+SCEVUniquer::SCEVUniquer()
+{
+  // Uniquers are numbered such that uniqued expressions can outlive their uniquer without being
+  // mistaken for expressions of a later uniquer
+  static std::atomic<uint64_t> NextId{ 1 };
+  Id_ = NextId++;
+}
+
+std::size_t
+SCEVUniquer::KeyHash::operator()(const Key & key) const noexcept
+{
+  auto hash = util::CombineHashes(
+      std::hash<std::type_index>()(key.Type),
+      std::hash<int64_t>()(key.Value),
+      std::hash<const void *>()(key.Loop),
+      std::hash<const void *>()(key.Output));
+  for (const auto operand : key.Operands)
+    util::combineHashesWithSeed(hash, std::hash<const SCEV *>()(operand));
+
+  return hash;
+}
+
+std::shared_ptr<const SCEV>
+SCEVUniquer::Unique(const SCEV & scev)
+{
+  return UniqueOperand(&scev);
+}
+
+std::shared_ptr<SCEV>
+SCEVUniquer::UniqueOperand(const SCEV * operand)
+{
+  if (operand == nullptr)
+    return nullptr;
+
+  if (IsUniqued(*operand))
+    return std::const_pointer_cast<SCEV>(operand->shared_from_this());
+
+  // The operands are uniqued first, such that the expression can be looked up by the identity of
+  // its operands
+  Key key{ typeid(*operand), 0, nullptr, nullptr, {} };
+  std::vector<std::shared_ptr<SCEV>> operands;
+  if (const auto constant = dynamic_cast<const SCEVConstant *>(operand))
+  {
+    key.Value = constant->GetValue();
+  }
+  else if (const auto init = dynamic_cast<const SCEVInit *>(operand))
+  {
+    key.Output = &init->GetPrePointer();
+  }
+  else if (const auto placeholder = dynamic_cast<const SCEVPlaceholder *>(operand))
+  {
+    key.Output = &placeholder->GetPrePointer();
+  }
+  else if (const auto binaryExpr = dynamic_cast<const SCEVBinaryExpr *>(operand))
+  {
+    operands.push_back(UniqueOperand(binaryExpr->GetLeftOperand()));
+    operands.push_back(UniqueOperand(binaryExpr->GetRightOperand()));
+  }
+  else if (const auto nAryExpr = dynamic_cast<const SCEVNAryExpr *>(operand))
+  {
+    if (const auto chrec = dynamic_cast<const SCEVChainRecurrence *>(nAryExpr))
+    {
+      key.Loop = &chrec->GetLoop();
+      key.Output = &chrec->GetOutput();
+    }
+
+    for (const auto nAryOperand : nAryExpr->GetOperands())
+      operands.push_back(UniqueOperand(nAryOperand));
+  }
+
+  for (const auto & uniquedOperand : operands)
+    key.Operands.push_back(uniquedOperand.get());
+
+  if (const auto it = UniquedSCEVs_.find(key); it != UniquedSCEVs_.end())
+    return it->second;
+
+  std::shared_ptr<SCEV> uniqued = operand->Clone();
+  if (const auto binaryExpr = dynamic_cast<SCEVBinaryExpr *>(uniqued.get()))
+  {
+    binaryExpr->LeftOperand_ = std::move(operands[0]);
+    binaryExpr->RightOperand_ = std::move(operands[1]);
+  }
+  else if (const auto nAryExpr = dynamic_cast<SCEVNAryExpr *>(uniqued.get()))
+  {
+    nAryExpr->Operands_ = std::move(operands);
+  }
+  uniqued->UniquerId_ = Id_;
+
+  UniquedSCEVs_.emplace(std::move(key), uniqued);
+  return uniqued;
+}
+
 class ScalarEvolution::Context final
 {
 public:
@@ -80,21 +176,55 @@ public:
   void
   InsertChrec(rvsdg::Output & output, const std::unique_ptr<SCEVChainRecurrence> & chrec)
   {
-    ChrecMap_.insert_or_assign(&output, SCEV::CloneAs<SCEVChainRecurrence>(*chrec));
+    ChrecMap_.insert_or_assign(
+        &output,
+        std::static_pointer_cast<const SCEVChainRecurrence>(Uniquer_.Unique(*chrec)));
   }
 
-  const std::unordered_map<rvsdg::Output *, std::unique_ptr<SCEVChainRecurrence>> &
+  const ChrecMap &
   GetChrecMap() const noexcept
   {
     return ChrecMap_;
   }
 
-  const std::unordered_map<rvsdg::Output *, std::unique_ptr<SCEV>> &
+  const SCEVMap &
   GetSCEVMap() const noexcept
   {
     return SCEVMap_;
   }
 
+  SCEVUniquer &
+  GetUniquer() noexcept
+  {
+    return Uniquer_;
+  }
+
+  /**
+   * Returns the memoized result of folding the uniqued operands \p lhs and \p rhs of the
+   * operation \p operation with output \p output, or nullptr if the folding is not memoized.
+   */
+  const SCEV *
+  TryGetFolding(
+      const DependencyOp operation,
+      const SCEV * lhs,
+      const SCEV * rhs,
+      const rvsdg::Output & output) const
+  {
+    const auto it = Foldings_.find({ operation, lhs, rhs, &output });
+    return it != Foldings_.end() ? it->second.get() : nullptr;
+  }
+
+  void
+  InsertFolding(
+      const DependencyOp operation,
+      const SCEV * lhs,
+      const SCEV * rhs,
+      const rvsdg::Output & output,
+      const SCEV & folding)
+  {
+    Foldings_.insert_or_assign({ operation, lhs, rhs, &output }, Uniquer_.Unique(folding));
+  }
+
   int
   GetNumInductionVariablesWithOrder(const size_t n) const
   {
@@ -132,7 +262,7 @@ public:
   void
   InsertSCEV(rvsdg::Output & output, const std::unique_ptr<SCEV> & scev)
   {
-    SCEVMap_.insert_or_assign(&output, scev->Clone());
+    SCEVMap_.insert_or_assign(&output, Uniquer_.Unique(*scev));
   }
 
   void
@@ -166,8 +296,38 @@ public:
   }
 
 private:
-  std::unordered_map<rvsdg::Output *, std::unique_ptr<SCEVChainRecurrence>> ChrecMap_;
-  std::unordered_map<rvsdg::Output *, std::unique_ptr<SCEV>> SCEVMap_;
+  struct FoldingKey
+  {
+    DependencyOp Operation;
+    const SCEV * Lhs;
+    const SCEV * Rhs;
+    const rvsdg::Output * Output;
+
+    bool
+    operator==(const FoldingKey & other) const noexcept
+    {
+      return Operation == other.Operation && Lhs == other.Lhs && Rhs == other.Rhs
+          && Output == other.Output;
+    }
+  };
+
+  struct FoldingKeyHash
+  {
+    std::size_t
+    operator()(const FoldingKey & key) const noexcept
+    {
+      return util::CombineHashes(
+          std::hash<DependencyOp>()(key.Operation),
+          std::hash<const SCEV *>()(key.Lhs),
+          std::hash<const SCEV *>()(key.Rhs),
+          std::hash<const rvsdg::Output *>()(key.Output));
+    }
+  };
+
+  SCEVUniquer Uniquer_;
+  ChrecMap ChrecMap_;
+  SCEVMap SCEVMap_;
+  std::unordered_map<FoldingKey, std::shared_ptr<const SCEV>, FoldingKeyHash> Foldings_;
   std::unordered_map<const rvsdg::ThetaNode *, size_t> TripCountMap_;
   std::unordered_set<const rvsdg::Output *> LoopVars_;
 
@@ -239,26 +399,16 @@ ScalarEvolution::ScalarEvolution()
 
 ScalarEvolution::~ScalarEvolution() noexcept = default;
 
-std::unordered_map<const rvsdg::Output *, std::unique_ptr<SCEVChainRecurrence>>
-ScalarEvolution::GetChrecMap() const
+const ScalarEvolution::ChrecMap &
+ScalarEvolution::GetChrecMap() const noexcept
 {
-  std::unordered_map<const rvsdg::Output *, std::unique_ptr<SCEVChainRecurrence>> mapCopy{};
-  for (auto & [output, chrec] : Context_->GetChrecMap())
-  {
-    mapCopy.emplace(output, SCEV::CloneAs<SCEVChainRecurrence>(*chrec));
-  }
-  return mapCopy;
+  return Context_->GetChrecMap();
 }
 
-std::unordered_map<const rvsdg::Output *, std::unique_ptr<SCEV>>
-ScalarEvolution::GetSCEVMap() const
+const ScalarEvolution::SCEVMap &
+ScalarEvolution::GetSCEVMap() const noexcept
 {
-  std::unordered_map<const rvsdg::Output *, std::unique_ptr<SCEV>> mapCopy{};
-  for (auto & [output, scev] : Context_->GetSCEVMap())
-  {
-    mapCopy.emplace(output, scev->Clone());
-  }
-  return mapCopy;
+  return Context_->GetSCEVMap();
 }
 
 std::unordered_map<const rvsdg::ThetaNode *, size_t>
@@ -1339,7 +1489,28 @@ ScalarEvolution::FoldNAryExpression(SCEVNAryExpr & expression, rvsdg::Output & o
 }
 
 std::unique_ptr<SCEV>
-ScalarEvolution::ApplyAddFolding(SCEV * lhsOperand, SCEV * rhsOperand, rvsdg::Output & output)
+ScalarEvolution::ApplyAddFolding(
+    const SCEV * lhsOperand,
+    const SCEV * rhsOperand,
+    rvsdg::Output & output)
+{
+  auto & uniquer = Context_->GetUniquer();
+  const auto lhs = lhsOperand ? uniquer.Unique(*lhsOperand) : nullptr;
+  const auto rhs = rhsOperand ? uniquer.Unique(*rhsOperand) : nullptr;
+  if (const auto folding = Context_->TryGetFolding(DependencyOp::Add, lhs.get(), rhs.get(), output))
+    return folding->Clone();
+
+  // The folding is computed on the uniqued operands, such that the result shares their operands
+  auto folding = ComputeAddFolding(lhs.get(), rhs.get(), output);
+  Context_->InsertFolding(DependencyOp::Add, lhs.get(), rhs.get(), output, *folding);
+  return folding;
+}
+
+std::unique_ptr<SCEV>
+ScalarEvolution::ComputeAddFolding(
+    const SCEV * lhsOperand,
+    const SCEV * rhsOperand,
+    rvsdg::Output & output)
 {
   // We have the following folding rules from the CR algebra:
   // G + {e,+,f}         =>       {G + e,+,f}         (1)
@@ -1369,8 +1540,8 @@ ScalarEvolution::ApplyAddFolding(SCEV * lhsOperand, SCEV * rhsOperand, rvsdg::Ou
     return SCEVUnknown::Create();
   }
 
-  auto lhsChrec = dynamic_cast<SCEVChainRecurrence *>(lhsOperand);
-  auto rhsChrec = dynamic_cast<SCEVChainRecurrence *>(rhsOperand);
+  auto lhsChrec = dynamic_cast<const SCEVChainRecurrence *>(lhsOperand);
+  auto rhsChrec = dynamic_cast<const SCEVChainRecurrence *>(rhsOperand);
   if (lhsChrec && rhsChrec)
   {
     if (&lhsChrec->GetLoop() != &rhsChrec->GetLoop())
@@ -1386,8 +1557,8 @@ ScalarEvolution::ApplyAddFolding(SCEV * lhsOperand, SCEV * rhsOperand, rvsdg::Ou
     const auto rhsSize = rhsChrec->NumOperands();
     for (size_t i = 0; i < std::max(lhsSize, rhsSize); ++i)
     {
-      SCEV * lhs{};
-      SCEV * rhs{};
+      const SCEV * lhs{};
+      const SCEV * rhs{};
       if (i < lhsSize)
         lhs = lhsChrec->GetOperand(i);
 
@@ -1465,8 +1636,8 @@ ScalarEvolution::ApplyAddFolding(SCEV * lhsOperand, SCEV * rhsOperand, rvsdg::Ou
     return SCEVNAryAddExpr::Create(mulExpr->Clone(), init->Clone());
   }
 
-  const auto lhsConstant = dynamic_cast<SCEVConstant *>(lhsOperand);
-  const auto rhsConstant = dynamic_cast<SCEVConstant *>(rhsOperand);
+  const auto lhsConstant = dynamic_cast<const SCEVConstant *>(lhsOperand);
+  const auto rhsConstant = dynamic_cast<const SCEVConstant *>(rhsOperand);
   if ((lhsNAryMulExpr && SCEVConstant::IsNonZero(rhsConstant))
       || (rhsNAryMulExpr && SCEVConstant::IsNonZero(lhsConstant)))
   {
@@ -1583,8 +1754,8 @@ ScalarEvolution::ApplyAddFolding(SCEV * lhsOperand, SCEV * rhsOperand, rvsdg::Ou
 
 std::unique_ptr<SCEVChainRecurrence>
 ScalarEvolution::ComputeProductOfChrecs(
-    SCEVChainRecurrence * lhsChrec,
-    SCEVChainRecurrence * rhsChrec,
+    const SCEVChainRecurrence * lhsChrec,
+    const SCEVChainRecurrence * rhsChrec,
     rvsdg::Output & output)
 {
   const auto lhsSize = lhsChrec->NumOperands();
@@ -1696,7 +1867,28 @@ ScalarEvolution::ComputeProductOfChrecs(
 }
 
 std::unique_ptr<SCEV>
-ScalarEvolution::ApplyMulFolding(SCEV * lhsOperand, SCEV * rhsOperand, rvsdg::Output & output)
+ScalarEvolution::ApplyMulFolding(
+    const SCEV * lhsOperand,
+    const SCEV * rhsOperand,
+    rvsdg::Output & output)
+{
+  auto & uniquer = Context_->GetUniquer();
+  const auto lhs = lhsOperand ? uniquer.Unique(*lhsOperand) : nullptr;
+  const auto rhs = rhsOperand ? uniquer.Unique(*rhsOperand) : nullptr;
+  if (const auto folding = Context_->TryGetFolding(DependencyOp::Mul, lhs.get(), rhs.get(), output))
+    return folding->Clone();
+
+  // The folding is computed on the uniqued operands, such that the result shares their operands
+  auto folding = ComputeMulFolding(lhs.get(), rhs.get(), output);
+  Context_->InsertFolding(DependencyOp::Mul, lhs.get(), rhs.get(), output, *folding);
+  return folding;
+}
+
+std::unique_ptr<SCEV>
+ScalarEvolution::ComputeMulFolding(
+    const SCEV * lhsOperand,
+    const SCEV * rhsOperand,
+    rvsdg::Output & output)
 {
   // We have the following folding rules from the CR algebra:
   // G * {e,+,f}         =>       {G * e,+,G * f}
@@ -1712,8 +1904,8 @@ ScalarEvolution::ApplyMulFolding(SCEV * lhsOperand, SCEV * rhsOperand, rvsdg::Ou
     return SCEVUnknown::Create();
   }
 
-  auto lhsChrec = dynamic_cast<SCEVChainRecurrence *>(lhsOperand);
-  auto rhsChrec = dynamic_cast<SCEVChainRecurrence *>(rhsOperand);
+  auto lhsChrec = dynamic_cast<const SCEVChainRecurrence *>(lhsOperand);
+  auto rhsChrec = dynamic_cast<const SCEVChainRecurrence *>(rhsOperand);
   if (lhsChrec && rhsChrec)
   {
     if (&lhsChrec->GetLoop() != &rhsChrec->GetLoop())
@@ -1797,8 +1989,8 @@ ScalarEvolution::ApplyMulFolding(SCEV * lhsOperand, SCEV * rhsOperand, rvsdg::Ou
     return newNAryMulExpr->Clone();
   }
 
-  auto lhsConstant = dynamic_cast<SCEVConstant *>(lhsOperand);
-  auto rhsConstant = dynamic_cast<SCEVConstant *>(rhsOperand);
+  auto lhsConstant = dynamic_cast<const SCEVConstant *>(lhsOperand);
+  auto rhsConstant = dynamic_cast<const SCEVConstant *>(rhsOperand);
   if ((lhsInit && rhsConstant && rhsConstant->GetValue() != 1)
       || (rhsInit && lhsConstant && lhsConstant->GetValue() != 1))
   {
@@ -2006,6 +2198,12 @@ ScalarEvolution::IsUnknown(const SCEV & scev)
 bool
 ScalarEvolution::StructurallyEqual(const SCEV & a, const SCEV & b)
 {
+  if (&a == &b)
+    return true;
+
+  if (a.UniquerId_ != 0 && a.UniquerId_ == b.UniquerId_)
+    return false;
+
   if (typeid(a) != typeid(b))
     return false;
 
@@ -2024,6 +2222,12 @@ ScalarEvolution::StructurallyEqual(const SCEV & a, const SCEV & b)
     return &initA->GetPrePointer() == &initB->GetPrePointer();
   }
 
+  if (auto * placeholderA = dynamic_cast<const SCEVPlaceholder *>(&a))
+  {
+    auto * placeholderB = dynamic_cast<const SCEVPlaceholder *>(&b);
+    return &placeholderA->GetPrePointer() == &placeholderB->GetPrePointer();
+  }
+
   if (auto * binaryExprA = dynamic_cast<const SCEVBinaryExpr *>(&a))
   {
     auto * binaryExprB = dynamic_cast<const SCEVBinaryExpr *>(&b);
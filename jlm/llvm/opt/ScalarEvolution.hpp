@@ -9,11 +9,21 @@
 #include <jlm/rvsdg/theta.hpp>
 #include <jlm/rvsdg/Transformation.hpp>
 
+#include <typeindex>
+
 namespace jlm::llvm
 {
-class SCEV
+/**
+ * A scalar evolution expression.
+ *
+ * Expressions own their operands through shared pointers. An operand must not be modified once it
+ * is attached to an expression, such that operands can be shared between expressions and their
+ * clones. This permits expressions to form a DAG, which is exploited by \ref SCEVUniquer.
+ */
+class SCEV : public std::enable_shared_from_this<SCEV>
 {
   friend class ScalarEvolution;
+  friend class SCEVUniquer;
 
 public:
   virtual ~SCEV() noexcept = default;
@@ -21,6 +31,9 @@ public:
   virtual std::string
   DebugString() const = 0;
 
+  /**
+   * Creates a copy of the expression. The operands of the expression are shared with the copy.
+   */
   virtual std::unique_ptr<SCEV>
   Clone() const = 0;
 
@@ -33,6 +46,10 @@ public:
     JLM_ASSERT(ptr);
     return std::unique_ptr<T>(ptr);
   }
+
+private:
+  // The identifier of the uniquer that uniqued this expression, or zero if it is not uniqued
+  uint64_t UniquerId_ = 0;
 };
 
 class SCEVUnknown final : public SCEV
@@ -177,13 +194,15 @@ private:
 
 class SCEVBinaryExpr : public SCEV
 {
+  friend class SCEVUniquer;
+
 public:
   SCEVBinaryExpr()
       : LeftOperand_{},
         RightOperand_{}
   {}
 
-  SCEVBinaryExpr(std::unique_ptr<SCEV> left, std::unique_ptr<SCEV> right)
+  SCEVBinaryExpr(std::shared_ptr<SCEV> left, std::shared_ptr<SCEV> right)
       : LeftOperand_{ std::move(left) },
         RightOperand_{ std::move(right) }
   {}
@@ -201,26 +220,26 @@ public:
   }
 
   void
-  SetLeftOperand(std::unique_ptr<SCEV> op)
+  SetLeftOperand(std::shared_ptr<SCEV> op)
   {
     LeftOperand_ = std::move(op);
   }
 
   void
-  SetRightOperand(std::unique_ptr<SCEV> op)
+  SetRightOperand(std::shared_ptr<SCEV> op)
   {
     RightOperand_ = std::move(op);
   }
 
 protected:
-  std::unique_ptr<SCEV> LeftOperand_;
-  std::unique_ptr<SCEV> RightOperand_;
+  std::shared_ptr<SCEV> LeftOperand_;
+  std::shared_ptr<SCEV> RightOperand_;
 };
 
 class SCEVAddExpr final : public SCEVBinaryExpr
 {
 public:
-  SCEVAddExpr(std::unique_ptr<SCEV> left, std::unique_ptr<SCEV> right)
+  SCEVAddExpr(std::shared_ptr<SCEV> left, std::shared_ptr<SCEV> right)
       : SCEVBinaryExpr(std::move(left), std::move(right))
   {}
 
@@ -237,13 +256,11 @@ public:
   std::unique_ptr<SCEV>
   Clone() const override
   {
-    std::unique_ptr<SCEV> leftClone = LeftOperand_ ? LeftOperand_->Clone() : nullptr;
-    std::unique_ptr<SCEV> rightClone = RightOperand_ ? RightOperand_->Clone() : nullptr;
-    return std::make_unique<SCEVAddExpr>(std::move(leftClone), std::move(rightClone));
+    return std::make_unique<SCEVAddExpr>(LeftOperand_, RightOperand_);
   }
 
   static std::unique_ptr<SCEVAddExpr>
-  Create(std::unique_ptr<SCEV> left, std::unique_ptr<SCEV> right)
+  Create(std::shared_ptr<SCEV> left, std::shared_ptr<SCEV> right)
   {
     return std::make_unique<SCEVAddExpr>(std::move(left), std::move(right));
   }
@@ -252,7 +269,7 @@ public:
 class SCEVMulExpr final : public SCEVBinaryExpr
 {
 public:
-  SCEVMulExpr(std::unique_ptr<SCEV> left, std::unique_ptr<SCEV> right)
+  SCEVMulExpr(std::shared_ptr<SCEV> left, std::shared_ptr<SCEV> right)
       : SCEVBinaryExpr(std::move(left), std::move(right))
   {}
 
@@ -269,13 +286,11 @@ public:
   std::unique_ptr<SCEV>
   Clone() const override
   {
-    std::unique_ptr<SCEV> leftClone = LeftOperand_ ? LeftOperand_->Clone() : nullptr;
-    std::unique_ptr<SCEV> rightClone = RightOperand_ ? RightOperand_->Clone() : nullptr;
-    return std::make_unique<SCEVMulExpr>(std::move(leftClone), std::move(rightClone));
+    return std::make_unique<SCEVMulExpr>(LeftOperand_, RightOperand_);
   }
 
   static std::unique_ptr<SCEVMulExpr>
-  Create(std::unique_ptr<SCEV> left, std::unique_ptr<SCEV> right)
+  Create(std::shared_ptr<SCEV> left, std::shared_ptr<SCEV> right)
   {
     return std::make_unique<SCEVMulExpr>(std::move(left), std::move(right));
   }
@@ -283,6 +298,8 @@ public:
 
 class SCEVNAryExpr : public SCEV
 {
+  friend class SCEVUniquer;
+
 public:
   explicit SCEVNAryExpr()
       : Operands_{}
@@ -303,7 +320,7 @@ public:
   }
 
   void
-  AddOperand(std::unique_ptr<SCEV> scev)
+  AddOperand(std::shared_ptr<SCEV> scev)
   {
     Operands_.push_back(std::move(scev));
   }
@@ -347,7 +364,7 @@ public:
   }
 
 protected:
-  std::vector<std::unique_ptr<SCEV>> Operands_;
+  std::vector<std::shared_ptr<SCEV>> Operands_;
 };
 
 class SCEVChainRecurrence final : public SCEVNAryExpr
@@ -421,7 +438,7 @@ public:
     auto newRec = SCEVChainRecurrence::Create(*Loop_, *Output_);
     for (auto & operand : util::IteratorRange(std::next(Operands_.begin()), Operands_.end()))
     {
-      newRec->AddOperand(operand->Clone());
+      newRec->AddOperand(operand);
     }
     return newRec;
   }
@@ -453,7 +470,7 @@ public:
     auto copy = std::make_unique<SCEVChainRecurrence>(*Loop_, *Output_);
     for (const auto & op : Operands_)
     {
-      copy->AddOperand(op->Clone());
+      copy->AddOperand(op);
     }
     return copy;
   }
@@ -511,7 +528,7 @@ public:
     auto copy = std::make_unique<SCEVNAryAddExpr>();
     for (const auto & op : Operands_)
     {
-      copy->AddOperand(op->Clone());
+      copy->AddOperand(op);
     }
     return copy;
   }
@@ -559,7 +576,7 @@ public:
     auto copy = std::make_unique<SCEVNAryMulExpr>();
     for (const auto & op : Operands_)
     {
-      copy->AddOperand(op->Clone());
+      copy->AddOperand(op);
     }
     return copy;
   }
@@ -572,6 +589,86 @@ public:
   }
 };
 
+/**
+ * Uniques SCEV expressions, such that all structurally equal expressions are represented by the
+ * same object.
+ *
+ * The uniqued expressions are owned by the uniquer and share their uniqued operands, i.e., they
+ * form a DAG. Two uniqued expressions of the same uniquer are structurally equal if and only if
+ * they are the same object. The uniqued expressions must not be modified.
+ */
+class SCEVUniquer final
+{
+public:
+  ~SCEVUniquer() noexcept;
+
+  SCEVUniquer();
+
+  SCEVUniquer(const SCEVUniquer &) = delete;
+
+  SCEVUniquer(SCEVUniquer &&) = delete;
+
+  SCEVUniquer &
+  operator=(const SCEVUniquer &) = delete;
+
+  SCEVUniquer &
+  operator=(SCEVUniquer &&) = delete;
+
+  /**
+   * Returns the uniqued expression that is structurally equal to \p scev. The uniqued expression
+   * is created if it does not exist yet.
+   *
+   * @param scev The expression to unique.
+   * @return The uniqued expression.
+   */
+  std::shared_ptr<const SCEV>
+  Unique(const SCEV & scev);
+
+  /**
+   * @return True if \p scev is uniqued by this uniquer, otherwise false.
+   */
+  [[nodiscard]] bool
+  IsUniqued(const SCEV & scev) const noexcept
+  {
+    return scev.UniquerId_ == Id_;
+  }
+
+  [[nodiscard]] size_t
+  NumUniquedSCEVs() const noexcept
+  {
+    return UniquedSCEVs_.size();
+  }
+
+private:
+  struct Key
+  {
+    std::type_index Type;
+    int64_t Value;
+    const void * Loop;
+    const void * Output;
+    std::vector<const SCEV *> Operands;
+
+    bool
+    operator==(const Key & other) const noexcept
+    {
+      return Type == other.Type && Value == other.Value && Loop == other.Loop
+          && Output == other.Output && Operands == other.Operands;
+    }
+  };
+
+  struct KeyHash
+  {
+    std::size_t
+    operator()(const Key & key) const noexcept;
+  };
+
+  std::shared_ptr<SCEV>
+  UniqueOperand(const SCEV * operand);
+
+  uint64_t Id_;
+  std::unordered_map<Key, std::shared_ptr<SCEV>, KeyHash> UniquedSCEVs_;
+};
+
 class ScalarEvolution final : public jlm::rvsdg::Transformation
 {
   class Context;
@@ -603,6 +700,11 @@ public:
 
   typedef std::unordered_map<rvsdg::Output *, DependencyMap> DependencyGraph;
 
+  typedef std::unordered_map<rvsdg::Output *, std::shared_ptr<const SCEVChainRecurrence>>
+      ChrecMap;
+
+  typedef std::unordered_map<rvsdg::Output *, std::shared_ptr<const SCEV>> SCEVMap;
+
   ~ScalarEvolution() noexcept override;
 
   ScalarEvolution();
@@ -618,18 +720,18 @@ public:
   operator=(ScalarEvolution &&) = delete;
 
   /**
-   * Returns a copy of the chrec map containing the computed chain recurrences after running
-   * the analysis.
+   * Returns the chrec map containing the computed chain recurrences after running the analysis.
+   * The chain recurrences are uniqued, i.e., structurally equal recurrences are the same object.
    */
-  std::unordered_map<const rvsdg::Output *, std::unique_ptr<SCEVChainRecurrence>>
-  GetChrecMap() const;
+  const ChrecMap &
+  GetChrecMap() const noexcept;
 
   /**
-   * Returns a copy of the scev map containing the computed scev trees after running
-   * the analysis.
+   * Returns the scev map containing the computed scev trees after running the analysis. The scev
+   * trees are uniqued, i.e., structurally equal trees are the same object.
    */
-  std::unordered_map<const rvsdg::Output *, std::unique_ptr<SCEV>>
-  GetSCEVMap() const;
+  const SCEVMap &
+  GetSCEVMap() const noexcept;
 
   std::unordered_map<const rvsdg::ThetaNode *, size_t>
   GetTripCountMap() const noexcept;
@@ -650,6 +752,10 @@ public:
   void
   CombineChrecsAcrossLoops();
 
+  /**
+   * Checks whether \p a and \p b are structurally equal. Expressions that are uniqued by the same
+   * uniquer are compared by identity.
+   */
   static bool
   StructurallyEqual(const SCEV & a, const SCEV & b);
 
@@ -757,29 +863,41 @@ private:
 
   /**
    * \brief Apply folding rules for addition to combine two SCEV operands into one.
+   *
+   * The folding results are memoized on the uniqued operands.
+   *
    * @param lhsOperand The left-hand side operand of the add operation
    * @param rhsOperand The right-hand side operand of the add operation
    * @param output The output of the addition operation we are folding.
    * @return A unique ptr to the new operand
    */
-  static std::unique_ptr<SCEV>
-  ApplyAddFolding(SCEV * lhsOperand, SCEV * rhsOperand, rvsdg::Output & output);
+  std::unique_ptr<SCEV>
+  ApplyAddFolding(const SCEV * lhsOperand, const SCEV * rhsOperand, rvsdg::Output & output);
 
-  static std::unique_ptr<SCEVChainRecurrence>
+  std::unique_ptr<SCEV>
+  ComputeAddFolding(const SCEV * lhsOperand, const SCEV * rhsOperand, rvsdg::Output & output);
+
+  std::unique_ptr<SCEVChainRecurrence>
   ComputeProductOfChrecs(
-      SCEVChainRecurrence * lhsChrec,
-      SCEVChainRecurrence * rhsChrec,
+      const SCEVChainRecurrence * lhsChrec,
+      const SCEVChainRecurrence * rhsChrec,
       rvsdg::Output & output);
 
   /**
    * \brief Apply folding rules for multiplication to combine two SCEV operands into one.
+   *
+   * The folding results are memoized on the uniqued operands.
+   *
    * @param lhsOperand The left-hand side operand of the mul operation
    * @param rhsOperand The right-hand side operand of the mul operation
    * @param output The output of the multiplication operation we are folding
    * @return A unique ptr to the new operand
    */
-  static std::unique_ptr<SCEV>
-  ApplyMulFolding(SCEV * lhsOperand, SCEV * rhsOperand, rvsdg::Output & output);
+  std::unique_ptr<SCEV>
+  ApplyMulFolding(const SCEV * lhsOperand, const SCEV * rhsOperand, rvsdg::Output & output);
+
+  std::unique_ptr<SCEV>
+  ComputeMulFolding(const SCEV * lhsOperand, const SCEV * rhsOperand, rvsdg::Output & output);
 
   /**
    * \brief Try to combine the constants in an n-ary expression (Add or Mul) into themselves.
@@ -787,7 +905,7 @@ private:
    * @param output The output of the operation the n-ary expression represents
    * @return The unique ptr to the expression
    */
-  static std::unique_ptr<SCEV>
+  std::unique_ptr<SCEV>
   FoldNAryExpression(SCEVNAryExpr & expression, rvsdg::Output & output);
 
   /**
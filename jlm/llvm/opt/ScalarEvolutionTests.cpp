@@ -17,7 +17,7 @@
 #include <gtest/gtest.h>
 
 static std::pair<
-    std::unordered_map<const jlm::rvsdg::Output *, std::unique_ptr<jlm::llvm::SCEVChainRecurrence>>,
+    jlm::llvm::ScalarEvolution::ChrecMap,
     std::unordered_map<const jlm::rvsdg::ThetaNode *, size_t>>
 RunScalarEvolution(jlm::rvsdg::RvsdgModule & rvsdgModule)
 {
@@ -2126,3 +2126,63 @@ TEST(ScalarEvolutionTests, TestTripCountCouldNotCompute)
   // than 2.
   EXPECT_EQ(tripCountMap.find(theta), tripCountMap.end());
 }
+
+TEST(ScalarEvolutionTests, UniquedSCEVs)
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  LlvmRvsdgModule rvsdgModule(jlm::util::FilePath(""), "", "");
+  const auto & graph = rvsdgModule.Rvsdg();
+
+  const auto & c0 = IntegerConstantOperation::Create(graph.GetRootRegion(), 32, 0);
+  const auto theta = jlm::rvsdg::ThetaNode::create(&graph.GetRootRegion());
+  const auto lv1 = theta->AddLoopVar(c0.output(0));
+  const auto lv2 = theta->AddLoopVar(c0.output(0));
+
+  // {Init(lv1),+,(2 * 3)} and a structurally equal copy
+  const auto chrec = SCEVChainRecurrence::Create(
+      *theta,
+      *lv1.pre,
+      SCEVInit::Create(*lv1.pre),
+      SCEVMulExpr::Create(SCEVConstant::Create(2), SCEVConstant::Create(3)));
+  const auto chrecCopy = SCEVChainRecurrence::Create(
+      *theta,
+      *lv1.pre,
+      SCEVInit::Create(*lv1.pre),
+      SCEVMulExpr::Create(SCEVConstant::Create(2), SCEVConstant::Create(3)));
+
+  // {Init(lv2),+,(2 * 3)} only differs in the start value
+  const auto otherChrec = SCEVChainRecurrence::Create(
+      *theta,
+      *lv1.pre,
+      SCEVInit::Create(*lv2.pre),
+      SCEVMulExpr::Create(SCEVConstant::Create(2), SCEVConstant::Create(3)));
+
+  SCEVUniquer uniquer;
+
+  // Act
+  const auto uniquedChrec = uniquer.Unique(*chrec);
+  const auto uniquedChrecCopy = uniquer.Unique(*chrecCopy);
+  const auto uniquedOtherChrec = uniquer.Unique(*otherChrec);
+
+  // Assert
+  EXPECT_FALSE(uniquer.IsUniqued(*chrec));
+  EXPECT_TRUE(uniquer.IsUniqued(*uniquedChrec));
+  EXPECT_TRUE(ScalarEvolution::StructurallyEqual(*chrec, *uniquedChrec));
+
+  // Structurally equal expressions are the same object
+  EXPECT_EQ(uniquedChrec, uniquedChrecCopy);
+  EXPECT_EQ(uniquer.Unique(*uniquedChrec), uniquedChrec);
+  EXPECT_NE(uniquedChrec, uniquedOtherChrec);
+  EXPECT_FALSE(ScalarEvolution::StructurallyEqual(*uniquedChrec, *uniquedOtherChrec));
+
+  // The uniqued expressions share their equal operands
+  const auto & uniquedRecurrence = dynamic_cast<const SCEVChainRecurrence &>(*uniquedChrec);
+  const auto & uniquedOtherRecurrence =
+      dynamic_cast<const SCEVChainRecurrence &>(*uniquedOtherChrec);
+  EXPECT_EQ(uniquedRecurrence.GetOperand(1), uniquedOtherRecurrence.GetOperand(1));
+
+  // Init(lv1), Init(lv2), 2, 3, (2 * 3), and the two recurrences
+  EXPECT_EQ(uniquer.NumUniquedSCEVs(), 7u);
+}
@@ -213,7 +213,7 @@ AgnosticModRefSummarizer::AddPointerTargetsToModRefSet(
   const auto & pointsToGraph = ModRefSummary_->GetPointsToGraph();
   JLM_ASSERT(IsPointerCompatible(output));
   const auto & addressReg = pointsToGraph.getNodeForRegister(output);
-  for (const auto target : pointsToGraph.getExplicitTargets(addressReg).Items())
+  for (const auto target : pointsToGraph.getExplicitTargets(addressReg))
   {
     modRefSet.addMemoryNode(target, modRefEffect);
   }
@@ -17,6 +17,7 @@
 #include <jlm/rvsdg/MatchType.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 #include <jlm/util/Statistics.hpp>
+#include <jlm/util/Trace.hpp>
 
 namespace jlm::llvm::aa
 {
@@ -62,11 +63,23 @@ Andersen::Configuration::ToString() const
     if (EnablePreferImplicitPointees_)
       str << "PIP_";
   }
+  else if (Solver_ == Solver::WavePropagation)
+  {
+    str << "Solver=WavePropagation_";
+    str << "Threads=" << NumSolverThreads_ << "_";
+  }
   else
   {
     JLM_UNREACHABLE("Unknown solver type");
   }
 
+  if (PointsToSetRepresentation_ != PointsToSet::Representation::HashSet)
+  {
+    str << "Sets=" << PointsToSet::RepresentationToString(PointsToSetRepresentation_) << "_";
+  }
+  if (EnableSharedPointsToSets_)
+    str << "Shared_";
+
   auto result = str.str();
   result.erase(result.size() - 1, 1); // Remove trailing '_'
   return result;
@@ -137,12 +150,21 @@ Andersen::Configuration::GetAllConfigurations()
     config.EnableOfflineConstraintNormalization(true);
     configs.push_back(config);
   };
+  auto PickSolverThreads = [&](Configuration config)
+  {
+    config.SetNumSolverThreads(1);
+    PickOfflineNormalization(config);
+    config.SetNumSolverThreads(4);
+    PickOfflineNormalization(config);
+  };
   auto PickSolver = [&](Configuration config)
   {
     config.SetSolver(Solver::Worklist);
     PickWorklistPolicy(config);
     config.SetSolver(Solver::Naive);
     PickOfflineNormalization(config);
+    config.SetSolver(Solver::WavePropagation);
+    PickSolverThreads(config);
   };
   auto PickOfflineVariableSubstitution = [&](Configuration config)
   {
@@ -152,8 +174,23 @@ Andersen::Configuration::GetAllConfigurations()
     PickSolver(config);
   };
 
+  auto PickSharedPointsToSets = [&](Configuration config)
+  {
+    config.EnableSharedPointsToSets(false);
+    PickOfflineVariableSubstitution(config);
+    config.EnableSharedPointsToSets(true);
+    PickOfflineVariableSubstitution(config);
+  };
+  auto PickPointsToSetRepresentation = [&](Configuration config)
+  {
+    config.SetPointsToSetRepresentation(PointsToSet::Representation::HashSet);
+    PickSharedPointsToSets(config);
+    config.SetPointsToSetRepresentation(PointsToSet::Representation::SparseBitVector);
+    PickSharedPointsToSets(config);
+  };
+
   // Adds one configuration for all valid combinations of features
-  PickOfflineVariableSubstitution(NaiveSolverConfiguration());
+  PickPointsToSetRepresentation(NaiveSolverConfiguration());
 
   return configs;
 }
@@ -186,6 +223,10 @@ class Andersen::Statistics final : public util::Statistics
 
   static constexpr const char * Configuration_ = "Configuration";
 
+  // ====== Warm-start seeding statistics ======
+  // The number of PointerObjects seeded with the solution of the previous analysis
+  static constexpr const char * NumSeededPointerObjects_ = "#SeededPointerObjects";
+
   // ====== Offline technique statistics ======
   static constexpr const char * NumUnificationsOvs_ = "#Unifications(OVS)";
   static constexpr const char * NumConstraintsRemovedOfflineNorm_ =
@@ -201,6 +242,12 @@ class Andersen::Statistics final : public util::Statistics
       "#WorklistSolverWorkItemsNewPointees";
   static constexpr const char * NumTopologicalWorklistSweeps_ = "#TopologicalWorklistSweeps";
 
+  static constexpr const char * NumWavePropagationSolverThreads_ =
+      "#WavePropagationSolverThreads";
+  static constexpr const char * NumWavePropagationSolverWaves_ = "#WavePropagationSolverWaves";
+  static constexpr const char * NumWavePropagationCycleUnifications_ =
+      "#WavePropagationCycleUnifications";
+
   // ====== Online technique statistics ======
   static constexpr const char * NumOnlineCyclesDetected_ = "#OnlineCyclesDetected";
   static constexpr const char * NumOnlineCycleUnifications_ = "#OnlineCycleUnifications";
@@ -221,6 +268,10 @@ class Andersen::Statistics final : public util::Statistics
   // Removal can only happen due to unification, or explicitly when using PIP
   static constexpr const char * NumExplicitPointeesRemoved_ = "#ExplicitPointeesRemoved";
 
+  // ====== Shared points-to set statistics ======
+  // How many distinct points-to sets remain after deduplicating all points-to sets
+  static constexpr const char * NumDistinctPointsToSets_ = "#DistinctPointsToSets";
+
   // ====== After solving statistics ======
   // How many disjoint sets of PointerObjects exist
   static constexpr const char * NumUnificationRoots_ = "#UnificationRoots";
@@ -266,10 +317,14 @@ class Andersen::Statistics final : public util::Statistics
 
   static constexpr const char * AnalysisTimer_ = "AnalysisTimer";
   static constexpr const char * SetAndConstraintBuildingTimer_ = "SetAndConstraintBuildingTimer";
+  static constexpr const char * SeedingTimer_ = "SeedingTimer";
   static constexpr const char * OfflineVariableSubstitutionTimer_ = "OVSTimer";
   static constexpr const char * OfflineConstraintNormalizationTimer_ = "OfflineNormTimer";
   static constexpr const char * ConstraintSolvingNaiveTimer_ = "ConstraintSolvingNaiveTimer";
   static constexpr const char * ConstraintSolvingWorklistTimer_ = "ConstraintSolvingWorklistTimer";
+  static constexpr const char * ConstraintSolvingWavePropagationTimer_ =
+      "ConstraintSolvingWavePropagationTimer";
+  static constexpr const char * PointsToSetCompactionTimer_ = "PointsToSetCompactionTimer";
   static constexpr const char * PointsToGraphConstructionTimer_ = "PointsToGraphConstructionTimer";
   static constexpr const char * PointsToGraphConstructionExternalToEscapedTimer_ =
       "PointsToGraphConstructionExternalToEscapedTimer";
@@ -346,6 +401,19 @@ public:
     AddMeasurement(NumOtherFlagConstraints_, otherFlags);
   }
 
+  void
+  StartSeedingStatistics() noexcept
+  {
+    AddTimer(SeedingTimer_).start();
+  }
+
+  void
+  StopSeedingStatistics(size_t numSeededPointerObjects) noexcept
+  {
+    GetTimer(SeedingTimer_).stop();
+    AddMeasurement(NumSeededPointerObjects_, numSeededPointerObjects);
+  }
+
   void
   StartOfflineVariableSubstitution() noexcept
   {
@@ -431,6 +499,36 @@ public:
       AddMeasurement(NumPIPExplicitPointeesRemoved_, *statistics.NumPipExplicitPointeesRemoved);
   }
 
+  void
+  StartConstraintSolvingWavePropagationStatistics() noexcept
+  {
+    AddTimer(ConstraintSolvingWavePropagationTimer_).start();
+  }
+
+  void
+  StopConstraintSolvingWavePropagationStatistics(
+      size_t numThreads,
+      const PointerObjectConstraintSet::WavePropagationStatistics & statistics) noexcept
+  {
+    GetTimer(ConstraintSolvingWavePropagationTimer_).stop();
+    AddMeasurement(NumWavePropagationSolverThreads_, numThreads);
+    AddMeasurement(NumWavePropagationSolverWaves_, statistics.NumWaves);
+    AddMeasurement(NumWavePropagationCycleUnifications_, statistics.NumCycleUnifications);
+  }
+
+  void
+  StartPointsToSetCompactionStatistics() noexcept
+  {
+    AddTimer(PointsToSetCompactionTimer_).start();
+  }
+
+  void
+  StopPointsToSetCompactionStatistics(size_t numDistinctPointsToSets) noexcept
+  {
+    GetTimer(PointsToSetCompactionTimer_).stop();
+    AddMeasurement(NumDistinctPointsToSets_, numDistinctPointsToSets);
+  }
+
   void
   AddStatisticFromConfiguration(const Configuration & config)
   {
@@ -1514,9 +1612,24 @@ Andersen::GetConfiguration() const
   return Config_;
 }
 
+void
+Andersen::EnableWarmStart(bool enable)
+{
+  EnableWarmStart_ = enable;
+
+  if (!enable)
+  {
+    PreviousModule_ = nullptr;
+    PreviousSet_.reset();
+    ChangeLog_.reset();
+  }
+}
+
 void
 Andersen::AnalyzeModule(const rvsdg::RvsdgModule & module, Statistics & statistics)
 {
+  util::TraceSpan span("Andersen::ConstraintBuilding", "phase");
+
   Set_ = std::make_unique<PointerObjectSet>();
   Constraints_ = std::make_unique<PointerObjectConstraintSet>(*Set_);
 
@@ -1531,8 +1644,16 @@ Andersen::SolveConstraints(
     const Configuration & config,
     Statistics & statistics)
 {
+  util::TraceSpan span("Andersen::ConstraintSolving", "phase");
+  if (span.isActive())
+    span.addArgument("Configuration", config.ToString());
+
   statistics.AddStatisticFromConfiguration(config);
 
+  auto & set = constraints.GetPointerObjectSet();
+  set.SetPointsToSetRepresentation(config.GetPointsToSetRepresentation());
+  set.EnablePointsToSetSharing(config.IsSharedPointsToSetsEnabled());
+
   if (config.IsOfflineVariableSubstitutionEnabled())
   {
     statistics.StartOfflineVariableSubstitution();
@@ -1567,8 +1688,24 @@ Andersen::SolveConstraints(
         config.IsPreferImplicitPointeesEnabled());
     statistics.StopConstraintSolvingWorklistStatistics(worklistStatistics);
   }
+  else if (config.GetSolver() == Configuration::Solver::WavePropagation)
+  {
+    statistics.StartConstraintSolvingWavePropagationStatistics();
+    const auto numThreads = config.GetNumSolverThreads();
+    auto wavePropagationStatistics = constraints.SolveUsingWavePropagation(numThreads);
+    statistics.StopConstraintSolvingWavePropagationStatistics(
+        numThreads,
+        wavePropagationStatistics);
+  }
   else
     JLM_UNREACHABLE("Unknown solver");
+
+  if (config.IsSharedPointsToSetsEnabled())
+  {
+    statistics.StartPointsToSetCompactionStatistics();
+    auto numDistinctPointsToSets = set.CompactPointsToSets();
+    statistics.StopPointsToSetCompactionStatistics(numDistinctPointsToSets);
+  }
 }
 
 std::unique_ptr<PointsToGraph>
@@ -1593,6 +1730,29 @@ Andersen::Analyze(
 
   AnalyzeModule(module, *statistics);
 
+  // If the module has been analyzed before, start from the solution of the previous analysis.
+  // This happens before copying, making all solvers start from the same seeded constraint set.
+  const bool isSeeded = PreviousSet_ && PreviousModule_ == &module;
+  if (isSeeded)
+  {
+    statistics->StartSeedingStatistics();
+    auto numSeeded = Set_->SeedFromPreviousSolution(*PreviousSet_, *ChangeLog_);
+    statistics->StopSeedingStatistics(numSeeded);
+  }
+  PreviousSet_.reset();
+  ChangeLog_.reset();
+
+  // Offline variable substitution assumes that all initial pointees stem from constraints
+  auto AdjustConfiguration = [&](Configuration config)
+  {
+    if (isSeeded)
+    {
+      config.EnableOfflineVariableSubstitution(false);
+      config.EnableHybridCycleDetection(false);
+    }
+    return config;
+  };
+
   // If solving multiple times, make a copy of the original constraint set
   std::pair<std::unique_ptr<PointerObjectSet>, std::unique_ptr<PointerObjectConstraintSet>> copy;
   if (testAllConfigsIterations || doubleCheck)
@@ -1608,6 +1768,7 @@ Andersen::Analyze(
     auto allConfigs = Configuration::GetAllConfigurations();
     config = allConfigs.at(*useExactConfig);
   }
+  config = AdjustConfiguration(config);
 
   SolveConstraints(*Constraints_, config, *statistics);
   statistics->AddStatisticsFromSolution(*Set_);
@@ -1649,7 +1810,7 @@ Andersen::Analyze(
         auto workingCopy = copy.second->Clone();
         // These statistics will only contain solving data
         auto solvingStats = Statistics::Create(module.SourceFilePath().value());
-        SolveConstraints(*workingCopy.second, config, *solvingStats);
+        SolveConstraints(*workingCopy.second, AdjustConfiguration(config), *solvingStats);
         solvingStats->AddStatisticsFromSolution(*workingCopy.first);
         statisticsCollector.CollectDemandedStatistics(std::move(solvingStats));
 
@@ -1667,8 +1828,14 @@ Andersen::Analyze(
     }
   }
 
-  // Cleanup
+  // Cleanup, keeping the solution if the module may be analyzed again
   Constraints_.reset();
+  if (EnableWarmStart_)
+  {
+    PreviousModule_ = &module;
+    PreviousSet_ = std::move(Set_);
+    ChangeLog_ = std::make_unique<rvsdg::ChangeLog>(module.Rvsdg().GetRootRegion());
+  }
   Set_.reset();
   return result;
 }
@@ -1685,6 +1852,8 @@ Andersen::ConstructPointsToGraphFromPointerObjectSet(
     const PointerObjectSet & set,
     Statistics & statistics)
 {
+  util::TraceSpan span("Andersen::PointsToGraphConstruction", "phase");
+
   statistics.StartPointsToGraphConstructionStatistics();
 
   auto pointsToGraph = PointsToGraph::create();
@@ -1722,6 +1891,9 @@ Andersen::ConstructPointsToGraphFromPointerObjectSet(
         pointsToGraph->addNodeForMalloc(*mallocNode, set.HasEscaped(pointerObjectIndex));
   }
 
+  // Buffer for sorting the pointees of a single node, as the PtG keeps targets sorted
+  std::vector<PointsToGraph::NodeIndex> sortedTargets;
+
   // Helper function for attaching PointsToGraph nodes to their pointees, based on the
   // PointerObject's points-to set.
   auto applyPointsToSet = [&](PointsToGraph::NodeIndex ptgNode, PointerObjectIndex index)
@@ -1739,10 +1911,16 @@ Andersen::ConstructPointsToGraphFromPointerObjectSet(
       pointsToGraph->markAsTargetsAllExternallyAvailable(ptgNode);
     }
 
-    // Add all explicit pointees. Doubled up pointees are ignored by the PtG
+    // Add all explicit pointees in increasing order. Doubled up pointees are ignored by the PtG
+    sortedTargets.clear();
     for (const auto targetIdx : set.GetPointsToSet(index).Items())
     {
-      pointsToGraph->addTarget(ptgNode, memoryNodeMapping[targetIdx]);
+      sortedTargets.push_back(memoryNodeMapping[targetIdx]);
+    }
+    std::sort(sortedTargets.begin(), sortedTargets.end());
+    for (const auto target : sortedTargets)
+    {
+      pointsToGraph->addTarget(ptgNode, target);
     }
   };
 
@@ -1771,6 +1949,8 @@ Andersen::ConstructPointsToGraphFromPointerObjectSet(
     applyPointsToSet(ptgNode, pointerObjectSetIndex);
   }
 
+  pointsToGraph->finalize();
+
   statistics.StopPointsToGraphConstructionStatistics(*pointsToGraph);
   return pointsToGraph;
 }
@@ -9,6 +9,7 @@
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/alias-analyses/PointerObjectSet.hpp>
 #include <jlm/llvm/opt/alias-analyses/PointsToAnalysis.hpp>
+#include <jlm/rvsdg/ChangeLog.hpp>
 #include <jlm/rvsdg/gamma.hpp>
 #include <jlm/rvsdg/theta.hpp>
 
@@ -63,7 +64,8 @@ public:
     enum class Solver
     {
       Naive,
-      Worklist
+      Worklist,
+      WavePropagation
     };
 
     /**
@@ -98,6 +100,23 @@ public:
       return WorklistSolverPolicy_;
     }
 
+    /**
+     * Sets the maximum number of threads used for solving.
+     * Only applies to the wave propagation solver.
+     */
+    void
+    SetNumSolverThreads(size_t numThreads) noexcept
+    {
+      JLM_ASSERT(numThreads > 0);
+      NumSolverThreads_ = numThreads;
+    }
+
+    [[nodiscard]] size_t
+    GetNumSolverThreads() const noexcept
+    {
+      return NumSolverThreads_;
+    }
+
     /**
      * Enables or disables the use of offline variable substitution to pre-process
      * the constraint set before applying the solving algorithm.
@@ -216,6 +235,41 @@ public:
       return EnablePreferImplicitPointees_;
     }
 
+    /**
+     * Sets the representation used for the points-to sets of all PointerObjects.
+     * Used by all solvers.
+     */
+    void
+    SetPointsToSetRepresentation(PointsToSet::Representation representation) noexcept
+    {
+      PointsToSetRepresentation_ = representation;
+    }
+
+    [[nodiscard]] PointsToSet::Representation
+    GetPointsToSetRepresentation() const noexcept
+    {
+      return PointsToSetRepresentation_;
+    }
+
+    /**
+     * Enables or disables sharing of identical points-to sets, in the spirit of
+     *   Barbar and Sui, 2021: "Hash Consed Points-To Sets"
+     * Unions without difference propagation are cached, and all sets are deduplicated
+     * after solving, reducing the memory used by the solution. Used by all solvers.
+     * Disabled by default, as the pooled intermediate unions can outweigh the savings.
+     */
+    void
+    EnableSharedPointsToSets(bool enable) noexcept
+    {
+      EnableSharedPointsToSets_ = enable;
+    }
+
+    [[nodiscard]] bool
+    IsSharedPointsToSetsEnabled() const noexcept
+    {
+      return EnableSharedPointsToSets_;
+    }
+
     [[nodiscard]] std::string
     ToString() const;
 
@@ -269,11 +323,14 @@ public:
     Solver Solver_ = Solver::Naive;
     PointerObjectConstraintSet::WorklistSolverPolicy WorklistSolverPolicy_ =
         PointerObjectConstraintSet::WorklistSolverPolicy::LeastRecentlyFired;
+    size_t NumSolverThreads_ = 1;
     bool EnableOnlineCycleDetection_ = false;
     bool EnableHybridCycleDetection_ = false;
     bool EnableLazyCycleDetection_ = false;
     bool EnableDifferencePropagation_ = false;
     bool EnablePreferImplicitPointees_ = false;
+    PointsToSet::Representation PointsToSetRepresentation_ = PointsToSet::Representation::HashSet;
+    bool EnableSharedPointsToSets_ = false;
   };
 
   Andersen();
@@ -303,6 +360,30 @@ public:
   [[nodiscard]] const Configuration &
   GetConfiguration() const;
 
+  /**
+   * Enables or disables warm-start seeding. When enabled, the solution of the last analyzed
+   * module is kept, together with an rvsdg::ChangeLog recording all later changes to the module.
+   * Analyzing the same module again seeds the new constraint set with the solution of every
+   * PointerObject that survived the changes, so solving starts from a mostly converged solution.
+   *
+   * This is not an incremental analysis: the constraints are always rebuilt from the entire
+   * module, and the seeded constraint set is solved as a whole. Only the propagation work that the
+   * seeded pointees make redundant is saved. A seeded solution is sound, but can be less precise
+   * than a solution from scratch. Offline variable substitution and hybrid cycle detection are not
+   * used on seeded constraints.
+   *
+   * @param enable true to keep solutions between analyses, false to drop any kept solution
+   * @see PointerObjectSet::SeedFromPreviousSolution
+   */
+  void
+  EnableWarmStart(bool enable);
+
+  [[nodiscard]] bool
+  IsWarmStartEnabled() const noexcept
+  {
+    return EnableWarmStart_;
+  }
+
   /**
    * Performs Andersen's alias analysis on the rvsdg \p module,
    * producing a PointsToGraph describing what memory objects exists,
@@ -334,7 +415,7 @@ public:
    *
    * @param set the PointerObjectSet to convert
    * @param statistics the statistics instance used to collect statistics about the process
-   * @return the newly created PointsToGraph
+   * @return the newly created PointsToGraph, already finalized
    */
   [[nodiscard]] static std::unique_ptr<PointsToGraph>
   ConstructPointsToGraphFromPointerObjectSet(const PointerObjectSet & set, Statistics & statistics);
@@ -473,6 +554,13 @@ private:
 
   std::unique_ptr<PointerObjectSet> Set_ = {};
   std::unique_ptr<PointerObjectConstraintSet> Constraints_ = {};
+
+  bool EnableWarmStart_ = false;
+
+  // The state kept between analyses when warm-start seeding is enabled
+  const rvsdg::RvsdgModule * PreviousModule_ = nullptr;
+  std::unique_ptr<PointerObjectSet> PreviousSet_ = {};
+  std::unique_ptr<rvsdg::ChangeLog> ChangeLog_ = {};
 };
 
 }
@@ -37,7 +37,7 @@ TargetsExactly(
   using namespace jlm::llvm::aa;
 
   std::unordered_set<PointsToGraph::NodeIndex> actualTargets;
-  for (const auto target : pointsToGraph.getExplicitTargets(ptgNode).Items())
+  for (const auto target : pointsToGraph.getExplicitTargets(ptgNode))
     actualTargets.insert(target);
 
   // If the node targets all externally available memory, add those nodes
@@ -894,6 +894,49 @@ TEST(AndersenTests, TestStatistics)
   EXPECT_GT(statistics.GetTimerElapsedNanoseconds("AnalysisTimer"), 0u);
 }
 
+TEST(AndersenTests, TestWarmStart)
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::llvm::StoreTest1 test;
+  jlm::util::StatisticsCollectorSettings statisticsCollectorSettings(
+      { jlm::util::Statistics::Id::AndersenAnalysis });
+  jlm::util::StatisticsCollector statisticsCollector(statisticsCollectorSettings);
+
+  Andersen andersen;
+  andersen.EnableWarmStart(true);
+
+  // Act
+  auto ptg1 = andersen.Analyze(test.module(), statisticsCollector);
+  auto ptg2 = andersen.Analyze(test.module(), statisticsCollector);
+  andersen.EnableWarmStart(false);
+  auto ptg3 = andersen.Analyze(test.module(), statisticsCollector);
+
+  // Assert
+  EXPECT_TRUE(andersen.GetConfiguration().IsOfflineVariableSubstitutionEnabled());
+  ASSERT_EQ(statisticsCollector.NumCollectedStatistics(), 3u);
+  auto statistics = statisticsCollector.CollectedStatistics().begin();
+  EXPECT_FALSE(statistics->HasMeasurement("#SeededPointerObjects"));
+  EXPECT_FALSE((++statistics)->HasMeasurement("#Unifications(OVS)"));
+  EXPECT_EQ(statistics->GetMeasurementValue<uint64_t>("#SeededPointerObjects"), 10u);
+  EXPECT_FALSE((++statistics)->HasMeasurement("#SeededPointerObjects"));
+
+  // The seeded solution is identical to the solution from scratch
+  for (auto ptg : { ptg2.get(), ptg3.get() })
+  {
+    auto alloca_a = ptg->getNodeForAlloca(*test.alloca_a);
+    auto alloca_b = ptg->getNodeForAlloca(*test.alloca_b);
+    auto palloca_a = ptg->getNodeForRegister(*test.alloca_a->output(0));
+    auto lambda = ptg->getNodeForLambda(*test.lambda);
+
+    EXPECT_EQ(ptg->numNodes(), ptg1->numNodes());
+    EXPECT_TRUE(TargetsExactly(*ptg, alloca_a, { alloca_b }));
+    EXPECT_TRUE(TargetsExactly(*ptg, palloca_a, { alloca_a }));
+    EXPECT_TRUE(EscapedIsExactly(*ptg, { lambda }));
+  }
+}
+
 TEST(AndersenTests, TestConfiguration)
 {
   using namespace jlm::llvm::aa;
@@ -941,6 +984,17 @@ TEST(AndersenTests, TestConfiguration)
   // Assert
   EXPECT_EQ(configString.find("OnlineCD"), std::string::npos);
   EXPECT_NE(configString.find("HybridCD"), std::string::npos);
+  EXPECT_EQ(configString.find("Shared"), std::string::npos);
+
+  // Arrange some more
+  config.EnableSharedPointsToSets(true);
+
+  // Act
+  configString = config.ToString();
+
+  // Assert
+  EXPECT_TRUE(config.IsSharedPointsToSetsEnabled());
+  EXPECT_NE(configString.find("Shared"), std::string::npos);
 }
 
 TEST(AndersenTests, TestConstructPointsToGraph)
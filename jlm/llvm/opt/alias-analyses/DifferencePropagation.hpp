@@ -27,7 +27,8 @@ public:
   void
   Initialize()
   {
-    NewPointees_.resize(Set_.NumPointerObjects());
+    NewPointees_.resize(Set_.NumPointerObjects(), PointsToSet(Set_.GetPointsToSetRepresentation()));
+    AddedPointees_ = PointsToSet(Set_.GetPointsToSetRepresentation());
     NewPointeesTracked_.resize(Set_.NumPointerObjects(), false);
     PointsToExternalFlagSeen_.resize(Set_.NumPointerObjects(), false);
     PointeesEscapeFlagSeen_.resize(Set_.NumPointerObjects(), false);
@@ -87,11 +88,20 @@ public:
     JLM_ASSERT(IsInitialized());
     JLM_ASSERT(Set_.IsUnificationRoot(superset));
 
-    // If pointees added to the superset are being tracked, use the tracking version
-    if (NewPointeesTracked_[superset])
-      return Set_.MakePointsToSetSuperset(superset, subset, NewPointees_[superset]);
-    else
+    if (!NewPointeesTracked_[superset])
       return Set_.MakePointsToSetSuperset(superset, subset);
+
+    auto & newPointees = NewPointees_[superset];
+    if (newPointees.GetRepresentation() != PointsToSet::Representation::SparseBitVector)
+      return Set_.MakePointsToSetSuperset(superset, subset, newPointees);
+
+    // With sparse bit vectors, the new pointees are the set difference P(subset) \ P(superset).
+    // Computing it a word at a time is cheaper than inserting each new pointee separately.
+    AddedPointees_ = Set_.GetPointsToSet(subset);
+    AddedPointees_.DifferenceWith(Set_.GetPointsToSet(superset));
+    const auto modified = Set_.MakePointsToSetSuperset(superset, subset);
+    newPointees.UnionWith(AddedPointees_);
+    return modified;
   }
 
   /**
@@ -101,7 +111,7 @@ public:
    * @param index the index of the PointerObject, must be a unification root.
    * @return a reference to either all new pointees, or all pointees of index.
    */
-  [[nodiscard]] const util::HashSet<PointerObjectIndex> &
+  [[nodiscard]] const PointsToSet &
   GetNewPointees(PointerObjectIndex index) const
   {
     JLM_ASSERT(IsInitialized());
@@ -220,10 +230,12 @@ private:
 
   // Tracks all new pointees added to a unification root i,
   // since ClearNewPointees(i) was last called.
-  std::vector<util::HashSet<PointerObjectIndex>> NewPointees_;
+  std::vector<PointsToSet> NewPointees_;
   // Becomes true for a unification root i when CleanNewPointees(i) is called for the first time.
   // Becomes false again when unification fully resets difference propagation
   std::vector<bool> NewPointeesTracked_;
+  // Scratch set for the pointees added by MakePointsToSetSuperset, reused to avoid allocations
+  PointsToSet AddedPointees_;
 
   // These are set to true after the _IsNew have returned true
   // When two PointerObjects a and b are unified, the flag only remains "seen",
@@ -35,13 +35,13 @@ TEST(DifferencePropagationTests, TestTracksDifferences)
   differencePropagation.Initialize();
 
   // Assert
-  EXPECT_EQ(differencePropagation.GetNewPointees(r0), (util::HashSet{ a0, a3 }));
+  EXPECT_EQ(differencePropagation.GetNewPointees(r0), (PointsToSet{ a0, a3 }));
 
   // Act 2 - add another pointer/pointee relation: r1 -> a1
   differencePropagation.AddToPointsToSet(r1, a1);
 
   // Assert that a1 is a new pointee of r1
-  EXPECT_EQ(differencePropagation.GetNewPointees(r1), util::HashSet{ a1 });
+  EXPECT_EQ(differencePropagation.GetNewPointees(r1), PointsToSet{ a1 });
 
   // Act 3 - clear difference tracking for r1
   differencePropagation.ClearNewPointees(r1);
@@ -58,7 +58,7 @@ TEST(DifferencePropagationTests, TestTracksDifferences)
 
   // Assert that only a0 and a2 were new
   EXPECT_TRUE(new0 && !new1 && new2);
-  EXPECT_EQ(differencePropagation.GetNewPointees(r1), util::HashSet({ a0, a2 }));
+  EXPECT_EQ(differencePropagation.GetNewPointees(r1), PointsToSet({ a0, a2 }));
 
   // Act 5 - make r0 point to a superset of r1, making r0 now point to a0, a1, a2, a3
   // First mark the existing pointees of r0 (a0 and a3) as seen
@@ -66,7 +66,7 @@ TEST(DifferencePropagationTests, TestTracksDifferences)
   differencePropagation.MakePointsToSetSuperset(r0, r1);
 
   // Assert that only a1 and a2 are new to r0, as it has already marked a0 and a3 as seen
-  EXPECT_EQ(differencePropagation.GetNewPointees(r0), util::HashSet({ a1, a2 }));
+  EXPECT_EQ(differencePropagation.GetNewPointees(r0), PointsToSet({ a1, a2 }));
 
   // Act 6 - give nodes r0 and r1 flags
   set.MarkAsPointeesEscaping(r0);
@@ -95,10 +95,53 @@ TEST(DifferencePropagationTests, TestTracksDifferences)
   // Assert that all pointees that were new to either node, are also new to the root
   // a0 and a2 were still marked as new to node r1 at the time of unification.
   // a3 is not new to r0, but r1 has never seen it, so it must be regarded as new by the union.
-  util::HashSet<PointerObjectIndex> subset{ a0, a2, a3 };
+  PointsToSet subset{ a0, a2, a3 };
   EXPECT_TRUE(subset.IsSubsetOf(differencePropagation.GetNewPointees(root)));
 
   // Neither flag has been seen by both nodes, so they are both new to the unification
   EXPECT_TRUE(differencePropagation.PointeesEscapeIsNew(root));
   EXPECT_TRUE(differencePropagation.PointsToExternalIsNew(root));
 }
+
+TEST(DifferencePropagationTests, TestTracksDifferencesOfSparseBitVectors)
+{
+  using namespace jlm;
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::llvm::NAllocaNodesTest rvsdg(4);
+  rvsdg.InitializeTest();
+
+  PointerObjectSet set;
+  set.SetPointsToSetRepresentation(PointsToSet::Representation::SparseBitVector);
+  auto r0 = set.CreateRegisterPointerObject(rvsdg.GetAllocaOutput(0));
+  auto r1 = set.CreateRegisterPointerObject(rvsdg.GetAllocaOutput(1));
+  auto a0 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(0), true);
+  auto a1 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(1), true);
+  auto a2 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(2), true);
+  auto a3 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(3), true);
+
+  set.AddToPointsToSet(r0, a0);
+  set.AddToPointsToSet(r0, a3);
+  set.AddToPointsToSet(r1, a0);
+  set.AddToPointsToSet(r1, a1);
+  set.AddToPointsToSet(r1, a2);
+
+  DifferencePropagation differencePropagation(set);
+  differencePropagation.Initialize();
+  differencePropagation.ClearNewPointees(r0);
+
+  // Act
+  const auto modified = differencePropagation.MakePointsToSetSuperset(r0, r1);
+
+  // Assert
+  EXPECT_TRUE(modified);
+  EXPECT_EQ(differencePropagation.GetNewPointees(r0), PointsToSet({ a1, a2 }));
+  EXPECT_EQ(set.GetPointsToSet(r0), PointsToSet({ a0, a1, a2, a3 }));
+
+  // Act 2 - nothing new is added by a second propagation
+  EXPECT_FALSE(differencePropagation.MakePointsToSetSuperset(r0, r1));
+
+  // Assert
+  EXPECT_EQ(differencePropagation.GetNewPointees(r0), PointsToSet({ a1, a2 }));
+}
@@ -243,6 +243,7 @@ private:
   /**
    * Memoization of "fully traceable" (escape analysis) queries.
    * It assumes that no changes are made to the underlying RVSDG between queries.
+   * It is keyed by address, as only ALLOCA outputs are memoized, possibly of several graphs.
    */
   std::unordered_map<const rvsdg::Output *, bool> IsFullyTraceable_;
 };
@@ -8,8 +8,11 @@
 #include <jlm/llvm/opt/alias-analyses/DifferencePropagation.hpp>
 #include <jlm/llvm/opt/alias-analyses/LazyCycleDetection.hpp>
 #include <jlm/llvm/opt/alias-analyses/OnlineCycleDetection.hpp>
+#include <jlm/util/Parallel.hpp>
+#include <jlm/util/TarjanScc.hpp>
 #include <jlm/util/Worklist.hpp>
 
+#include <atomic>
 #include <limits>
 #include <queue>
 #include <variant>
@@ -36,7 +39,7 @@ PointerObjectSet::AddPointerObject(PointerObjectKind kind, bool canPoint)
     PointerObjectParents_.push_back(index);
     PointerObjectRank_.push_back(0);
   }
-  PointsToSets_.emplace_back(); // Add empty points-to set
+  PointsToSets_.push_back(PointsToSetPool_.GetEmptySet()); // Add empty points-to set
   return PointerObjects_.size() - 1;
 }
 
@@ -390,19 +393,89 @@ PointerObjectSet::UnifyPointerObjects(PointerObjectIndex object1, PointerObjectI
 
   // Copy over all pointees, and clean the pointee set from the old root
   auto & oldRootPointees = PointsToSets_[oldRoot];
+  auto & newRootPointees = PointsToSets_[newRoot];
 
-  NumSetInsertionAttempts_ += oldRootPointees.Size();
-  NumExplicitPointeesRemoved_ += oldRootPointees.Size();
+  NumSetInsertionAttempts_ += oldRootPointees->Size();
+  NumExplicitPointeesRemoved_ += oldRootPointees->Size();
 
-  PointsToSets_[newRoot].UnionWithAndClear(oldRootPointees);
+  if (newRootPointees->IsEmpty())
+  {
+    newRootPointees = std::move(oldRootPointees);
+  }
+  else if (!oldRootPointees->IsEmpty())
+  {
+    if (EnablePointsToSetSharing_)
+      newRootPointees = PointsToSetPool_.Union(newRootPointees, oldRootPointees);
+    else if (oldRootPointees.use_count() == 1)
+      GetModifiablePointsToSet(newRoot).UnionWithAndClear(*oldRootPointees);
+    else
+      GetModifiablePointsToSet(newRoot).UnionWith(*oldRootPointees);
+  }
+
+  oldRootPointees = PointsToSetPool_.GetEmptySet();
 
   return newRoot;
 }
 
-const util::HashSet<PointerObjectIndex> &
+const PointsToSet &
 PointerObjectSet::GetPointsToSet(PointerObjectIndex index) const
 {
-  return PointsToSets_[GetUnificationRoot(index)];
+  return *PointsToSets_[GetUnificationRoot(index)];
+}
+
+PointsToSet &
+PointerObjectSet::GetModifiablePointsToSet(PointerObjectIndex root)
+{
+  JLM_ASSERT(IsUnificationRoot(root));
+
+  auto & pointsToSet = PointsToSets_[root];
+  if (pointsToSet.use_count() > 1)
+    pointsToSet = std::make_shared<PointsToSet>(*pointsToSet);
+  return *pointsToSet;
+}
+
+void
+PointerObjectSet::SetPointsToSetRepresentation(PointsToSet::Representation representation)
+{
+  if (representation == GetPointsToSetRepresentation())
+    return;
+
+  PointsToSetPool_ = PointsToSetPool(representation);
+
+  // Convert each distinct set only once, to keep sets that are shared, shared
+  std::unordered_map<const PointsToSet *, std::shared_ptr<PointsToSet>> convertedSets;
+  for (auto & pointsToSet : PointsToSets_)
+  {
+    auto & converted = convertedSets[pointsToSet.get()];
+    if (!converted)
+    {
+      if (pointsToSet->IsEmpty())
+      {
+        converted = PointsToSetPool_.GetEmptySet();
+      }
+      else
+      {
+        converted = std::make_shared<PointsToSet>(*pointsToSet);
+        converted->SetRepresentation(representation);
+      }
+    }
+    pointsToSet = converted;
+  }
+}
+
+size_t
+PointerObjectSet::CompactPointsToSets()
+{
+  for (PointerObjectIndex i = 0; i < NumPointerObjects(); i++)
+  {
+    if (IsUnificationRoot(i))
+      PointsToSetPool_.Intern(PointsToSets_[i]);
+    else
+      JLM_ASSERT(PointsToSets_[i]->IsEmpty());
+  }
+
+  PointsToSetPool_.Purge();
+  return PointsToSetPool_.NumSets();
 }
 
 // Makes pointee a member of P(pointer)
@@ -417,7 +490,13 @@ PointerObjectSet::AddToPointsToSet(PointerObjectIndex pointer, PointerObjectInde
   const auto pointerRoot = GetUnificationRoot(pointer);
 
   NumSetInsertionAttempts_++;
-  return PointsToSets_[pointerRoot].insert(pointee);
+
+  // Avoid copying a shared set if the pointee is already present
+  const auto & pointsToSet = PointsToSets_[pointerRoot];
+  if (pointsToSet.use_count() > 1 && pointsToSet->Contains(pointee))
+    return false;
+
+  return GetModifiablePointsToSet(pointerRoot).insert(pointee);
 }
 
 // Makes P(superset) a superset of P(subset)
@@ -434,19 +513,18 @@ PointerObjectSet::PropagateNewPointees(
   if (supersetRoot == subsetRoot)
     return false;
 
-  auto & P_super = PointsToSets_[supersetRoot];
-  auto & P_sub = PointsToSets_[subsetRoot];
+  // Keep a reference to the subset, in case the superset is copied and the subset is shared
+  const auto P_sub = PointsToSets_[subsetRoot];
 
-  NumSetInsertionAttempts_ += P_sub.Size();
+  NumSetInsertionAttempts_ += P_sub->Size();
 
   bool modified = false;
-  for (PointerObjectIndex pointee : P_sub.Items())
+  if (!P_sub->IsEmpty())
   {
-    if (P_super.insert(pointee))
-    {
-      onNewPointee(pointee);
-      modified = true;
-    }
+    // Avoid copying a shared superset if nothing is propagated
+    const auto & P_super = PointsToSets_[supersetRoot];
+    if (P_super.use_count() == 1 || !P_sub->IsSubsetOf(*P_super))
+      modified = GetModifiablePointsToSet(supersetRoot).UnionWith(*P_sub, onNewPointee);
   }
 
   // If the external node is in the subset, it must also be part of the superset
@@ -459,6 +537,31 @@ PointerObjectSet::PropagateNewPointees(
 bool
 PointerObjectSet::MakePointsToSetSuperset(PointerObjectIndex superset, PointerObjectIndex subset)
 {
+  if (EnablePointsToSetSharing_)
+  {
+    const auto supersetRoot = GetUnificationRoot(superset);
+    const auto subsetRoot = GetUnificationRoot(subset);
+
+    if (supersetRoot == subsetRoot)
+      return false;
+
+    auto & P_super = PointsToSets_[supersetRoot];
+    auto & P_sub = PointsToSets_[subsetRoot];
+
+    NumSetInsertionAttempts_ += P_sub->Size();
+
+    // Both sets are pooled by the union, so the union is new iff it is a different set
+    auto P_union = PointsToSetPool_.Union(P_super, P_sub);
+    bool modified = P_union != P_super;
+    P_super = std::move(P_union);
+
+    // If the external node is in the subset, it must also be part of the superset
+    if (IsPointingToExternal(subsetRoot))
+      modified |= MarkAsPointingToExternal(supersetRoot);
+
+    return modified;
+  }
+
   // NewPointee is a no-op
   const auto & NewPointee = [](PointerObjectIndex)
   {
@@ -470,7 +573,7 @@ bool
 PointerObjectSet::MakePointsToSetSuperset(
     PointerObjectIndex superset,
     PointerObjectIndex subset,
-    util::HashSet<PointerObjectIndex> & newPointees)
+    PointsToSet & newPointees)
 {
   const auto & NewPointee = [&](PointerObjectIndex pointee)
   {
@@ -479,12 +582,63 @@ PointerObjectSet::MakePointsToSetSuperset(
   return PropagateNewPointees(superset, subset, NewPointee);
 }
 
+bool
+PointerObjectSet::MakePointsToSetSupersetConcurrently(
+    PointerObjectIndex superset,
+    PointerObjectIndex subset)
+{
+  // Path halving writes to the parent vector, so roots must be given directly
+  JLM_ASSERT(PointerObjectParents_[superset] == superset);
+  JLM_ASSERT(PointerObjectParents_[subset] == subset);
+
+  if (superset == subset)
+    return false;
+
+  const auto & P_sub = PointsToSets_[subset];
+  auto & P_super = PointsToSets_[superset];
+
+  bool modified = false;
+  if (!P_sub->IsEmpty() && P_super != P_sub)
+  {
+    if (P_super.use_count() > 1)
+    {
+      // The set may be read by other threads through other references, so it must be copied
+      if (!P_sub->IsSubsetOf(*P_super))
+      {
+        auto P_union = std::make_shared<PointsToSet>(*P_super);
+        P_union->UnionWith(*P_sub);
+        P_super = std::move(P_union);
+        modified = true;
+      }
+    }
+    else
+    {
+      // Other threads may just have released their references, make sure they are done reading
+      std::atomic_thread_fence(std::memory_order_acquire);
+      modified = P_super->UnionWith(*P_sub);
+    }
+  }
+
+  // If the external node is in the subset, it must also be part of the superset
+  if (PointerObjects_[subset].PointsToExternal && !PointerObjects_[superset].PointsToExternal)
+  {
+    PointerObjects_[superset].PointsToExternal = true;
+    modified = true;
+  }
+
+  return modified;
+}
+
 void
 PointerObjectSet::RemoveAllPointees(PointerObjectIndex index)
 {
   auto root = GetUnificationRoot(index);
-  NumExplicitPointeesRemoved_ += PointsToSets_[root].Size();
-  PointsToSets_[root].Clear();
+  NumExplicitPointeesRemoved_ += PointsToSets_[root]->Size();
+
+  if (PointsToSets_[root].use_count() == 1)
+    PointsToSets_[root]->Clear();
+  else
+    PointsToSets_[root] = PointsToSetPool_.GetEmptySet();
 }
 
 bool
@@ -543,6 +697,108 @@ PointerObjectSet::HasIdenticalSolAs(const PointerObjectSet & other) const
   return true;
 }
 
+/**
+ * Helper for PointerObjectSet::SeedFromPreviousSolution().
+ * Maps each memory object in \p previousMap to the memory object with the same key in this set,
+ * unless the key has been destroyed.
+ */
+template<typename TMap, typename TLookup>
+static void
+MapPreviousMemoryObjects(
+    const TMap & previousMap,
+    const TLookup & lookup,
+    const rvsdg::ChangeLog & changeLog,
+    std::vector<std::optional<PointerObjectIndex>> & mapping)
+{
+  for (auto [key, previousIndex] : previousMap)
+  {
+    if (changeLog.isDestroyed(key))
+      continue;
+
+    mapping[previousIndex] = lookup(key);
+  }
+}
+
+size_t
+PointerObjectSet::SeedFromPreviousSolution(
+    const PointerObjectSet & previous,
+    const rvsdg::ChangeLog & changeLog)
+{
+  // Mapping from memory objects in the previous set to memory objects in this set
+  std::vector<std::optional<PointerObjectIndex>> mapping(previous.NumPointerObjects());
+
+  auto LookupIn = [](const auto & map)
+  {
+    return [&map](const auto key) -> std::optional<PointerObjectIndex>
+    {
+      if (const auto it = map.find(key); it != map.end())
+        return it->second;
+      return std::nullopt;
+    };
+  };
+  auto LookupFunction =
+      [&](const rvsdg::LambdaNode * lambdaNode) -> std::optional<PointerObjectIndex>
+  {
+    if (FunctionMap_.HasKey(lambdaNode))
+      return FunctionMap_.LookupKey(lambdaNode);
+    return std::nullopt;
+  };
+
+  MapPreviousMemoryObjects(previous.AllocaMap_, LookupIn(AllocaMap_), changeLog, mapping);
+  MapPreviousMemoryObjects(previous.MallocMap_, LookupIn(MallocMap_), changeLog, mapping);
+  MapPreviousMemoryObjects(previous.GlobalMap_, LookupIn(GlobalMap_), changeLog, mapping);
+  MapPreviousMemoryObjects(previous.FunctionMap_, LookupFunction, changeLog, mapping);
+  MapPreviousMemoryObjects(previous.ImportMap_, LookupIn(ImportMap_), changeLog, mapping);
+
+  // Gives index the flags and the matched pointees of previousIndex
+  auto SeedPointerObject = [&](PointerObjectIndex index, PointerObjectIndex previousIndex)
+  {
+    JLM_ASSERT(IsUnificationRoot(index));
+    JLM_ASSERT(GetPointerObjectKind(index) == previous.GetPointerObjectKind(previousIndex));
+
+    // The escaped flag belongs to each memory object, and is not shared through unification
+    if (previous.HasEscaped(previousIndex))
+      MarkAsEscaped(index);
+    if (previous.HasPointeesEscaping(previousIndex))
+      MarkAsPointeesEscaping(index);
+    if (previous.IsPointingToExternal(previousIndex))
+      MarkAsPointingToExternal(index);
+
+    for (const auto previousPointee : previous.GetPointsToSet(previousIndex).Items())
+    {
+      if (const auto pointee = mapping[previousPointee])
+        AddToPointsToSet(index, *pointee);
+    }
+  };
+
+  size_t numSeeded = 0;
+  for (PointerObjectIndex previousIndex = 0; previousIndex < previous.NumPointerObjects();
+       previousIndex++)
+  {
+    if (const auto index = mapping[previousIndex])
+    {
+      SeedPointerObject(*index, previousIndex);
+      numSeeded++;
+    }
+  }
+
+  // Several outputs can share a register PointerObject, in either set, so registers are matched
+  // per output instead of through the mapping
+  for (auto [output, previousIndex] : previous.RegisterMap_)
+  {
+    if (changeLog.isDestroyed(output))
+      continue;
+
+    if (const auto it = RegisterMap_.find(output); it != RegisterMap_.end())
+    {
+      SeedPointerObject(it->second, previousIndex);
+      numSeeded++;
+    }
+  }
+
+  return numSeeded;
+}
+
 size_t
 PointerObjectSet::GetNumSetInsertionAttempts() const noexcept
 {
@@ -1845,10 +2101,16 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
 
     // If difference propagation is enabled, this set contains only pointees that have been added
     // since the last time this work item was popped. Otherwise, it contains all pointees.
-    const auto & newPointees = EnableDifferencePropagation
-                                 ? differencePropagation.GetNewPointees(node)
-                                 : Set_.GetPointsToSet(node);
-    statistics.NumWorkItemNewPointees += newPointees.Size();
+    // Points-to sets can be shared, so newPointees must be updated if node's set is replaced.
+    const auto GetNewPointees = [&]() -> const PointsToSet &
+    {
+      if constexpr (EnableDifferencePropagation)
+        return differencePropagation.GetNewPointees(node);
+      else
+        return Set_.GetPointsToSet(node);
+    };
+    const PointsToSet * newPointees = &GetNewPointees();
+    statistics.NumWorkItemNewPointees += newPointees->Size();
 
     // If difference propagation is enabled, this bool is true if this is the first time node
     // is being visited by the worklist with the PointsToExternal flag set
@@ -1871,7 +2133,7 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
         bool anyUnification = false;
 
         // Make a copy of the set, as the node itself may be unified, invalidating newPointees
-        auto unificationMembers = newPointees;
+        auto unificationMembers = *newPointees;
         for (const auto pointee : unificationMembers.Items())
         {
           const auto pointeeRoot = Set_.GetUnificationRoot(pointee);
@@ -1922,7 +2184,7 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
       // If this is the first time node is being visited with the PointeesEscaping flag set,
       // add the escaped flag to all pointees. Otherwise, only add it to new pointees.
       const auto & newEscapingPointees =
-          newPointeesEscaping ? Set_.GetPointsToSet(node) : newPointees;
+          newPointeesEscaping ? Set_.GetPointsToSet(node) : *newPointees;
       for (const auto pointee : newEscapingPointees.Items())
       {
         const auto pointeeRoot = Set_.GetUnificationRoot(pointee);
@@ -1958,6 +2220,7 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
       *(statistics.NumPipExplicitPointeesRemoved) += Set_.GetPointsToSet(node).Size();
       // This also causes newPointees to become empty
       RemoveAllPointees(node);
+      newPointees = &GetNewPointees();
     }
 
     // Propagate P(n) along all edges n -> superset
@@ -1985,7 +2248,7 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
       ++it;
 
       bool modified = false;
-      for (const auto pointee : newPointees.Items())
+      for (const auto pointee : newPointees->Items())
         modified |= AddToPointsToSet(supersetParent, pointee);
 
       if (newPointsToExternal)
@@ -1994,7 +2257,7 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
       if (modified)
         worklist.PushWorkItem(supersetParent);
 
-      if (EnableLazyCycleDetection && !newPointees.IsEmpty() && !modified)
+      if (EnableLazyCycleDetection && !newPointees->IsEmpty() && !modified)
       {
         // If nothing was propagated along this edge, check if there is a cycle
         // If a cycle is detected, this function eliminates it by unifying, and returns the root
@@ -2012,7 +2275,7 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
     for (const auto value : storeConstraints[node].Items())
     {
       // This loop ensures *P(n) supseteq P(value)
-      for (const auto pointee : newPointees.Items())
+      for (const auto pointee : newPointees->Items())
         QueueNewSupersetEdge(pointee, value);
 
       // If P(n) contains "external", the contents of the written value escapes
@@ -2023,7 +2286,7 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
     // If node has the stored as scalar constraint, but does not make its pointees escape outright
     if (Set_.IsStoredAsScalar(node) && !Set_.HasPointeesEscaping(node))
     {
-      for (const auto pointee : newPointees.Items())
+      for (const auto pointee : newPointees->Items())
       {
         MarkAsPointsToExternal(pointee);
       }
@@ -2033,7 +2296,7 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
     for (const auto value : loadConstraints[node].Items())
     {
       // This loop ensures P(value) supseteq *P(n)
-      for (const auto pointee : newPointees.Items())
+      for (const auto pointee : newPointees->Items())
         QueueNewSupersetEdge(value, pointee);
 
       // If P(n) contains "external", the loaded value may also point to external
@@ -2044,7 +2307,7 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
     // If node has the loaded as scalar constraint, but does not make its pointees escape outright
     if (Set_.IsLoadedAsScalar(node) && !Set_.HasPointeesEscaping(node))
     {
-      for (const auto pointee : newPointees.Items())
+      for (const auto pointee : newPointees->Items())
       {
         MarkAsPointeesEscaping(pointee);
       }
@@ -2054,7 +2317,7 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
     for (const auto callNode : callConstraints[node].Items())
     {
       // Connect the inputs and outputs of the callNode to every possible function pointee
-      for (const auto pointee : newPointees.Items())
+      for (const auto pointee : newPointees->Items())
       {
         const auto kind = Set_.GetPointerObjectKind(pointee);
         if (kind == PointerObjectKind::ImportMemoryObject)
@@ -2158,6 +2421,7 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
         {
           worklist.RemoveWorkItem(node);
           HandleWorkItem(node);
+          Set_.EvictUnusedPointsToSets();
         }
       }
     }
@@ -2166,7 +2430,10 @@ PointerObjectConstraintSet::RunWorklistSolver(WorklistStatistics & statistics)
   {
     // The worklist is a normal worklist
     while (worklist.HasMoreWorkItems())
+    {
       HandleWorkItem(worklist.PopWorkItem());
+      Set_.EvictUnusedPointsToSets();
+    }
   }
 
   if constexpr (EnableOnlineCycleDetection)
@@ -2336,6 +2603,7 @@ PointerObjectConstraintSet::SolveNaively()
             modified |= constraint.ApplyDirectly(Set_);
           },
           constraint);
+      Set_.EvictUnusedPointsToSets();
     }
 
     modified |= EscapeFlagConstraint::PropagateEscapedFlagsDirectly(Set_);
@@ -2345,6 +2613,383 @@ PointerObjectConstraintSet::SolveNaively()
   return numIterations;
 }
 
+PointerObjectConstraintSet::WavePropagationStatistics
+PointerObjectConstraintSet::SolveUsingWavePropagation(size_t numThreads)
+{
+  // Levels of the topological order with fewer nodes than this are propagated on a single thread,
+  // as starting threads would cost more than the propagation itself
+  static constexpr size_t MinNodesPerParallelLevel = 64;
+
+  WavePropagationStatistics statistics;
+  const auto numPointerObjects = Set_.NumPointerObjects();
+
+  // Create the subset graph, and lookup tables for the complex constraints, like the worklist.
+  // Edges and constraints are owned by unification roots, and the sets are empty for other nodes.
+  // If supersetEdges[x] contains y, (x -> y), that means P(y) supseteq P(x)
+  std::vector<util::HashSet<PointerObjectIndex>> supersetEdges(numPointerObjects);
+  std::vector<util::HashSet<PointerObjectIndex>> storeConstraints(numPointerObjects);
+  std::vector<util::HashSet<PointerObjectIndex>> loadConstraints(numPointerObjects);
+  std::vector<util::HashSet<const rvsdg::SimpleNode *>> callConstraints(numPointerObjects);
+
+  // Adds the edge (subset -> superset) to the subset graph, returns true if the edge is new
+  const auto AddSupersetEdge = [&](PointerObjectIndex superset, PointerObjectIndex subset)
+  {
+    superset = Set_.GetUnificationRoot(superset);
+    subset = Set_.GetUnificationRoot(subset);
+    if (superset == subset)
+      return false;
+    return supersetEdges[subset].insert(superset);
+  };
+
+  for (const auto & constraint : Constraints_)
+  {
+    if (const auto * ssConstraint = std::get_if<SupersetConstraint>(&constraint))
+    {
+      AddSupersetEdge(ssConstraint->GetSuperset(), ssConstraint->GetSubset());
+    }
+    else if (const auto * storeConstraint = std::get_if<StoreConstraint>(&constraint))
+    {
+      auto pointer = Set_.GetUnificationRoot(storeConstraint->GetPointer());
+      storeConstraints[pointer].insert(storeConstraint->GetValue());
+    }
+    else if (const auto * loadConstraint = std::get_if<LoadConstraint>(&constraint))
+    {
+      auto pointer = Set_.GetUnificationRoot(loadConstraint->GetPointer());
+      loadConstraints[pointer].insert(loadConstraint->GetValue());
+    }
+    else if (const auto * callConstraint = std::get_if<FunctionCallConstraint>(&constraint))
+    {
+      auto pointer = Set_.GetUnificationRoot(callConstraint->GetPointer());
+      callConstraints[pointer].insert(&callConstraint->GetCallNode());
+    }
+  }
+
+  // Every modification of a node's points-to set or PointsToExternal flag is given a stamp.
+  // Stamps increase between each phase, which allows nodes to only pull pointees from
+  // predecessors that have changed since the last pull, and to only evaluate complex constraints
+  // that have not been evaluated since the last change. The vectors are written to concurrently,
+  // so none of them can be std::vector<bool>.
+  size_t stamp = 1;
+  std::vector<size_t> changedStamp(numPointerObjects, 0);
+  std::vector<size_t> pulledStamp(numPointerObjects, 0);
+  std::vector<size_t> evaluatedStamp(numPointerObjects, 0);
+
+  // The size of the points-to set, and the PointsToExternal flag, as of each node's last change
+  std::vector<size_t> knownSize(numPointerObjects, 0);
+  std::vector<uint8_t> knownPointsToExternal(numPointerObjects, 0);
+
+  // Gives the current stamp to all roots that have changed since their last known change.
+  // Returns true if any roots had changed.
+  const auto StampChangedRoots = [&]()
+  {
+    bool changed = false;
+    for (PointerObjectIndex i = 0; i < numPointerObjects; i++)
+    {
+      if (!Set_.IsUnificationRoot(i))
+        continue;
+
+      const auto size = Set_.GetPointsToSet(i).Size();
+      const auto pointsToExternal = Set_.IsPointingToExternal(i);
+      if (size == knownSize[i] && pointsToExternal == knownPointsToExternal[i])
+        continue;
+
+      knownSize[i] = size;
+      knownPointsToExternal[i] = pointsToExternal;
+      changedStamp[i] = stamp;
+      changed = true;
+    }
+    return changed;
+  };
+
+  // Unifies two roots in a cycle, and moves all edges and constraints to the new root.
+  const auto UnifyPointerObjects = [&](PointerObjectIndex a, PointerObjectIndex b)
+  {
+    JLM_ASSERT(Set_.IsUnificationRoot(a) && Set_.IsUnificationRoot(b) && a != b);
+    const auto root = Set_.UnifyPointerObjects(a, b);
+    const auto nonRoot = root == a ? b : a;
+
+    supersetEdges[root].UnionWithAndClear(supersetEdges[nonRoot]);
+    storeConstraints[root].UnionWithAndClear(storeConstraints[nonRoot]);
+    loadConstraints[root].UnionWithAndClear(loadConstraints[nonRoot]);
+    callConstraints[root].UnionWithAndClear(callConstraints[nonRoot]);
+
+    // The new root must pull from the predecessors of both, and evaluate all their constraints
+    changedStamp[root] = stamp;
+    pulledStamp[root] = 0;
+    evaluatedStamp[root] = 0;
+
+    statistics.NumCycleUnifications++;
+  };
+
+  const auto GetUnificationRoot = [&](PointerObjectIndex node)
+  {
+    return Set_.GetUnificationRoot(node);
+  };
+
+  const auto GetSupersetEdgeSuccessors = [&](PointerObjectIndex node)
+  {
+    JLM_ASSERT(Set_.IsUnificationRoot(node));
+    return supersetEdges[node].Items();
+  };
+
+  // The new superset edges and flags produced by evaluating the complex constraints of one node.
+  // Only the solver thread evaluating the node writes to them, and they are applied sequentially.
+  struct ComplexConstraintEffects
+  {
+    // Pairs of (superset, subset)
+    std::vector<std::pair<PointerObjectIndex, PointerObjectIndex>> SupersetEdges;
+    std::vector<PointerObjectIndex> PointeesEscaping;
+    std::vector<PointerObjectIndex> PointsToExternal;
+  };
+
+  std::vector<PointerObjectIndex> sccIndex;
+  std::vector<PointerObjectIndex> reverseTopologicalOrder;
+  std::vector<PointerObjectIndex> topologicalOrder;
+  std::vector<size_t> level(numPointerObjects, 0);
+  std::vector<size_t> levelStart;
+  std::vector<PointerObjectIndex> nodesByLevel;
+  std::vector<size_t> predecessorStart(numPointerObjects + 1, 0);
+  std::vector<PointerObjectIndex> predecessors;
+
+  stamp++;
+  StampChangedRoots();
+
+  bool modified = true;
+  while (modified)
+  {
+    statistics.NumWaves++;
+
+    // Phase 1: Eliminate all cycles in the subset graph and sort it topologically
+    stamp++;
+    util::FindStronglyConnectedComponents<PointerObjectIndex>(
+        numPointerObjects,
+        GetUnificationRoot,
+        GetSupersetEdgeSuccessors,
+        sccIndex,
+        reverseTopologicalOrder);
+
+    bool anyUnifications = false;
+    topologicalOrder.clear();
+    for (auto it = reverseTopologicalOrder.rbegin(); it != reverseTopologicalOrder.rend(); ++it)
+    {
+      // Nodes in the same SCC are neighbours in the topological order
+      const auto root = Set_.GetUnificationRoot(*it);
+      if (!topologicalOrder.empty() && sccIndex[topologicalOrder.back()] == sccIndex[*it])
+      {
+        if (topologicalOrder.back() != root)
+        {
+          UnifyPointerObjects(topologicalOrder.back(), root);
+          topologicalOrder.back() = Set_.GetUnificationRoot(root);
+          sccIndex[topologicalOrder.back()] = sccIndex[*it];
+          anyUnifications = true;
+        }
+        continue;
+      }
+
+      topologicalOrder.push_back(root);
+    }
+
+    // Unification may have turned the targets of edges into non-roots
+    if (anyUnifications)
+    {
+      for (const auto node : topologicalOrder)
+      {
+        util::HashSet<PointerObjectIndex> successors;
+        for (const auto successor : supersetEdges[node].Items())
+        {
+          const auto successorRoot = Set_.GetUnificationRoot(successor);
+          if (successorRoot != node)
+            successors.insert(successorRoot);
+        }
+        supersetEdges[node] = std::move(successors);
+      }
+      StampChangedRoots();
+    }
+
+    // Give each node a level, such that all predecessors of a node are on lower levels,
+    // and make lists of the predecessors and nodes of each level
+    size_t numLevels = 0;
+    std::fill(predecessorStart.begin(), predecessorStart.end(), 0);
+    for (const auto node : topologicalOrder)
+      level[node] = 0;
+    for (const auto node : topologicalOrder)
+    {
+      numLevels = std::max(numLevels, level[node] + 1);
+      for (const auto successor : supersetEdges[node].Items())
+      {
+        level[successor] = std::max(level[successor], level[node] + 1);
+        predecessorStart[successor + 1]++;
+      }
+    }
+    for (size_t i = 0; i < numPointerObjects; i++)
+      predecessorStart[i + 1] += predecessorStart[i];
+    predecessors.resize(predecessorStart.back());
+    {
+      auto nextPredecessor = predecessorStart;
+      for (const auto node : topologicalOrder)
+        for (const auto successor : supersetEdges[node].Items())
+          predecessors[nextPredecessor[successor]++] = node;
+    }
+
+    levelStart.assign(numLevels + 1, 0);
+    for (const auto node : topologicalOrder)
+      levelStart[level[node] + 1]++;
+    for (size_t i = 0; i < numLevels; i++)
+      levelStart[i + 1] += levelStart[i];
+    nodesByLevel.resize(topologicalOrder.size());
+    {
+      auto nextInLevel = levelStart;
+      for (const auto node : topologicalOrder)
+        nodesByLevel[nextInLevel[level[node]]++] = node;
+    }
+
+    // Phase 2: Propagate points-to sets along superset edges, one level at a time.
+    // Each node only pulls from its own predecessors, so nodes on the same level are independent.
+    stamp++;
+    for (size_t l = 0; l < numLevels; l++)
+    {
+      const auto levelSize = levelStart[l + 1] - levelStart[l];
+      const auto levelThreads = levelSize >= MinNodesPerParallelLevel ? numThreads : 1;
+      util::parallelForEach(
+          levelThreads,
+          levelSize,
+          [&](size_t, size_t index)
+          {
+            const auto node = nodesByLevel[levelStart[l] + index];
+
+            bool nodeModified = false;
+            for (auto p = predecessorStart[node]; p < predecessorStart[node + 1]; p++)
+            {
+              const auto predecessor = predecessors[p];
+              if (changedStamp[predecessor] > pulledStamp[node])
+                nodeModified |= Set_.MakePointsToSetSupersetConcurrently(node, predecessor);
+            }
+            pulledStamp[node] = stamp;
+
+            if (nodeModified)
+            {
+              knownSize[node] = Set_.GetPointsToSet(node).Size();
+              knownPointsToExternal[node] = Set_.IsPointingToExternal(node);
+              changedStamp[node] = stamp;
+            }
+          });
+    }
+
+    // Phase 3: Evaluate the complex constraints of all nodes that changed since last evaluated
+    std::vector<PointerObjectIndex> nodesToEvaluate;
+    for (const auto node : topologicalOrder)
+    {
+      if (changedStamp[node] <= evaluatedStamp[node])
+        continue;
+      evaluatedStamp[node] = stamp;
+
+      if (!storeConstraints[node].IsEmpty() || !loadConstraints[node].IsEmpty()
+          || !callConstraints[node].IsEmpty())
+        nodesToEvaluate.push_back(node);
+    }
+
+    std::vector<ComplexConstraintEffects> effects(nodesToEvaluate.size());
+    util::parallelForEach(
+        numThreads,
+        nodesToEvaluate.size(),
+        [&](size_t, size_t index)
+        {
+          const auto node = nodesToEvaluate[index];
+          auto & nodeEffects = effects[index];
+          const auto & pointees = Set_.GetPointsToSet(node);
+          const bool pointsToExternal = Set_.IsPointingToExternal(node);
+
+          const auto MakeSuperset = [&](PointerObjectIndex superset, PointerObjectIndex subset)
+          {
+            nodeEffects.SupersetEdges.emplace_back(superset, subset);
+          };
+          const auto MarkAsPointeesEscaping = [&](PointerObjectIndex pointerObject)
+          {
+            nodeEffects.PointeesEscaping.push_back(pointerObject);
+          };
+          const auto MarkAsPointsToExternal = [&](PointerObjectIndex pointerObject)
+          {
+            nodeEffects.PointsToExternal.push_back(pointerObject);
+          };
+
+          // For all x in P(node), make P(x) a superset of P(value)
+          for (const auto value : storeConstraints[node].Items())
+          {
+            for (const auto x : pointees.Items())
+              MakeSuperset(x, value);
+            if (pointsToExternal)
+              MarkAsPointeesEscaping(value);
+          }
+
+          // For all x in P(node), make P(value) a superset of P(x)
+          for (const auto value : loadConstraints[node].Items())
+          {
+            for (const auto x : pointees.Items())
+              MakeSuperset(value, x);
+            if (pointsToExternal)
+              MarkAsPointsToExternal(value);
+          }
+
+          for (const auto callNode : callConstraints[node].Items())
+          {
+            for (const auto target : pointees.Items())
+            {
+              const auto kind = Set_.GetPointerObjectKind(target);
+              if (kind == PointerObjectKind::ImportMemoryObject)
+                HandleCallingImportedFunction(
+                    Set_,
+                    *callNode,
+                    target,
+                    MarkAsPointeesEscaping,
+                    MarkAsPointsToExternal);
+              else if (kind == PointerObjectKind::FunctionMemoryObject)
+                HandleCallingLambdaFunction(Set_, *callNode, target, MakeSuperset);
+            }
+
+            if (pointsToExternal)
+              HandleCallingExternalFunction(
+                  Set_,
+                  *callNode,
+                  MarkAsPointeesEscaping,
+                  MarkAsPointsToExternal);
+          }
+        });
+
+    // Phase 4: Add the new edges and flags, and propagate escaped flags until nothing changes
+    stamp++;
+    modified = false;
+    for (const auto & nodeEffects : effects)
+    {
+      for (const auto & [superset, subset] : nodeEffects.SupersetEdges)
+      {
+        if (AddSupersetEdge(superset, subset))
+        {
+          // The superset must pull from all its predecessors, to get the pointees of the new one
+          pulledStamp[Set_.GetUnificationRoot(superset)] = 0;
+          modified = true;
+        }
+      }
+      // Changes to these flags are handled below
+      for (const auto index : nodeEffects.PointeesEscaping)
+        Set_.MarkAsPointeesEscaping(index);
+      for (const auto index : nodeEffects.PointsToExternal)
+        Set_.MarkAsPointingToExternal(index);
+    }
+
+    bool escapeFlagsModified = true;
+    while (escapeFlagsModified)
+    {
+      escapeFlagsModified = EscapeFlagConstraint::PropagateEscapedFlagsDirectly(Set_);
+      escapeFlagsModified |= EscapedFunctionConstraint::PropagateEscapedFunctionsDirectly(Set_);
+    }
+
+    // Any new PointsToExternal flags need to be propagated by the next wave
+    modified |= StampChangedRoots();
+  }
+
+  return statistics;
+}
+
 std::pair<std::unique_ptr<PointerObjectSet>, std::unique_ptr<PointerObjectConstraintSet>>
 PointerObjectConstraintSet::Clone() const
 {
@@ -10,6 +10,8 @@
 #include <jlm/llvm/ir/operators/delta.hpp>
 #include <jlm/llvm/ir/operators/lambda.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToSet.hpp>
+#include <jlm/rvsdg/ChangeLog.hpp>
 #include <jlm/util/BijectiveMap.hpp>
 #include <jlm/util/common.hpp>
 #include <jlm/util/GraphWriter.hpp>
@@ -17,6 +19,7 @@
 #include <jlm/util/Math.hpp>
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <unordered_map>
 #include <variant>
@@ -41,8 +44,6 @@ enum class PointerObjectKind : uint8_t
   COUNT
 };
 
-using PointerObjectIndex = uint32_t;
-
 /**
  * A class containing a set of PointerObjects, and their points-to-sets,
  * as well as mappings from RVSDG nodes/outputs to the PointerObjects.
@@ -161,7 +162,14 @@ class PointerObjectSet final
   // For each PointerObject, a set of the other PointerObjects it points to
   // Only unification roots may have a non-empty set,
   // other PointerObjects refer to their root's set.
-  std::vector<util::HashSet<PointerObjectIndex>> PointsToSets_;
+  // Sets may be shared between PointerObjects, and are copied before being modified if shared.
+  std::vector<std::shared_ptr<PointsToSet>> PointsToSets_;
+
+  // Pool of deduplicated points-to sets. Also determines the representation of all sets.
+  PointsToSetPool PointsToSetPool_{ PointsToSet::Representation::HashSet };
+
+  // If enabled, unions without new pointee callbacks are performed through PointsToSetPool_
+  bool EnablePointsToSetSharing_ = false;
 
   // Mapping from register to PointerObject
   // Unlike the other maps, several rvsdg::output* can share register PointerObject
@@ -201,6 +209,14 @@ class PointerObjectSet final
       PointerObjectIndex subset,
       NewPointeeFunctor & onNewPointee);
 
+  /**
+   * Internal helper function for getting a modifiable points-to set.
+   * If the points-to set of \p root is shared, it is copied first.
+   * @param root the index of the PointerObject, must be a unification root.
+   */
+  [[nodiscard]] PointsToSet &
+  GetModifiablePointsToSet(PointerObjectIndex root);
+
 public:
   PointerObjectSet() = default;
 
@@ -454,9 +470,62 @@ public:
    * If index is part of a unification, the unification root's points-to set is returned.
    * @return the PointsToSet of the PointerObject.
    */
-  [[nodiscard]] const util::HashSet<PointerObjectIndex> &
+  [[nodiscard]] const PointsToSet &
   GetPointsToSet(PointerObjectIndex index) const;
 
+  /**
+   * @return the representation used by all points-to sets in the set.
+   */
+  [[nodiscard]] PointsToSet::Representation
+  GetPointsToSetRepresentation() const noexcept
+  {
+    return PointsToSetPool_.GetRepresentation();
+  }
+
+  /**
+   * Changes the representation used by all points-to sets in the set to \p representation.
+   * Existing points-to sets are converted, and keep their pointees.
+   */
+  void
+  SetPointsToSetRepresentation(PointsToSet::Representation representation);
+
+  /**
+   * Enables or disables sharing of identical points-to sets.
+   * When enabled, MakePointsToSetSuperset() without a set of new pointees produces pooled sets,
+   * and caches the union of each pair of pooled sets, making repeated unions a table lookup.
+   */
+  void
+  EnablePointsToSetSharing(bool enable) noexcept
+  {
+    EnablePointsToSetSharing_ = enable;
+  }
+
+  [[nodiscard]] bool
+  IsPointsToSetSharingEnabled() const noexcept
+  {
+    return EnablePointsToSetSharing_;
+  }
+
+  /**
+   * Deduplicates all points-to sets, making PointerObjects with identical points-to sets share
+   * one instance. Also drops all cached unions and sets that are no longer in use.
+   * @return the number of distinct points-to sets after compaction.
+   */
+  size_t
+  CompactPointsToSets();
+
+  /**
+   * Frees pooled points-to sets that are no longer in use, if enough of them have accumulated.
+   * Solvers invoke this regularly while no references to points-to sets are held.
+   *
+   * \see PointsToSetPool::EvictUnusedSets()
+   */
+  void
+  EvictUnusedPointsToSets()
+  {
+    PointsToSetPool_.EvictUnusedSets();
+  }
+
   /**
    * Adds \p pointee to P(\p pointer)
    * @param pointer the index of the PointerObject that shall point to \p pointee
@@ -489,7 +558,19 @@ public:
   MakePointsToSetSuperset(
       PointerObjectIndex superset,
       PointerObjectIndex subset,
-      util::HashSet<PointerObjectIndex> & newPointees);
+      PointsToSet & newPointees);
+
+  /**
+   * A version of MakePointsToSetSuperset that may be called from several threads at once,
+   * as long as no two threads use the same \p superset, and no thread uses it as a \p subset.
+   * Both PointerObjects must be unification roots, as finding roots may compress paths.
+   * The union never goes through the pool of shared points-to sets,
+   * and is not counted in GetNumSetInsertionAttempts().
+   *
+   * @return true if P(\p superset) or its PointsToExternal flag was modified by this operation
+   */
+  bool
+  MakePointsToSetSupersetConcurrently(PointerObjectIndex superset, PointerObjectIndex subset);
 
   /**
    * Removes all pointees from the PointerObject with the given \p index.
@@ -525,6 +606,26 @@ public:
   [[nodiscard]] bool
   HasIdenticalSolAs(const PointerObjectSet & other) const;
 
+  /**
+   * Seeds this PointerObjectSet with the solution of a PointerObjectSet built from an earlier
+   * version of the same module. PointerObjects are matched through the rvsdg outputs and nodes
+   * they represent. Keys that have been destroyed according to \p changeLog are not matched,
+   * as their addresses may have been reused by unrelated outputs and nodes.
+   *
+   * Each matched PointerObject gets the flags and the matched explicit pointees of its previous
+   * counterpart. Seeding only ever adds pointees and flags, so solving the constraints afterwards
+   * still gives a sound solution. It may however be less precise than solving from scratch,
+   * as pointees that only stemmed from removed parts of the module are kept.
+   *
+   * Must be called before any unification or solving.
+   *
+   * @param previous the solved PointerObjectSet of the earlier version of the module
+   * @param changeLog the changes made to the module since \p previous was built
+   * @return the number of PointerObjects that were matched to a previous PointerObject
+   */
+  size_t
+  SeedFromPreviousSolution(const PointerObjectSet & previous, const rvsdg::ChangeLog & changeLog);
+
   /**
    * @return the number of pointees that have been inserted, or were attempted inserted
    * but already existed, among all points-to sets in this PointerObjectSet.
@@ -955,6 +1056,23 @@ public:
     std::optional<size_t> NumPipExplicitPointeesRemoved;
   };
 
+  /**
+   * Struct holding statistics from solving the constraint set using wave propagation.
+   */
+  struct WavePropagationStatistics
+  {
+    /**
+     * The number of rounds of cycle elimination, propagation and complex constraint handling
+     * performed before the solution converged.
+     */
+    size_t NumWaves{};
+
+    /**
+     * The number of unifications made to eliminate cycles in the subset graph.
+     */
+    size_t NumCycleUnifications{};
+  };
+
   explicit PointerObjectConstraintSet(PointerObjectSet & set)
       : Set_(set),
         Constraints_(),
@@ -971,6 +1089,15 @@ public:
   PointerObjectConstraintSet &
   operator=(PointerObjectConstraintSet && other) = delete;
 
+  /**
+   * @return the PointerObjectSet the constraints are defined over.
+   */
+  [[nodiscard]] PointerObjectSet &
+  GetPointerObjectSet() const noexcept
+  {
+    return Set_;
+  }
+
   /**
    * Some offline processing relies on knowing about all constraints that will ever be added.
    * After doing such processing, the constraint set is frozen, which prevents any new constraints
@@ -1113,6 +1240,20 @@ public:
   size_t
   SolveNaively();
 
+  /**
+   * Finds a least solution satisfying all constraints, using parallel wave propagation, based on
+   *   Pereira and Berlin, 2009: "Wave Propagation and Deep Propagation for Pointer Analysis"
+   * Each wave eliminates all cycles in the subset graph, and propagates points-to sets along
+   * superset edges in topological order. Nodes without paths between them are handled in parallel.
+   * Then the load, store and function call constraints of all changed nodes are evaluated in
+   * parallel, and the resulting new superset edges and flags are added before the next wave.
+   * The solution is the least solution, so it does not depend on the number of threads.
+   * @param numThreads the maximum number of threads to use.
+   * @return an instance of WavePropagationStatistics describing solver statistics
+   */
+  WavePropagationStatistics
+  SolveUsingWavePropagation(size_t numThreads);
+
   /**
    * Creates a clone of this constraint set, and the underlying PointerObjectSet.
    * The result is an identical copy, containing no references to the original.
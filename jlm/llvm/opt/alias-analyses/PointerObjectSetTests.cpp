@@ -5,6 +5,8 @@
 
 #include <gtest/gtest.h>
 
+#include <jlm/llvm/ir/operators/alloca.hpp>
+#include <jlm/llvm/ir/operators/IntegerOperations.hpp>
 #include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
 #include <jlm/llvm/opt/alias-analyses/PointerObjectSet.hpp>
 #include <jlm/llvm/TestRvsdgs.hpp>
@@ -318,6 +320,63 @@ TEST(PointerObjectSetTests, TestClonePointerObjectSet)
   EXPECT_FALSE(clonedSet->IsPointingToExternal(malloc0));
 }
 
+TEST(PointerObjectSetTests, TestSeedFromPreviousSolution)
+{
+  using namespace jlm::llvm;
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  NAllocaNodesTest rvsdg(2);
+  rvsdg.InitializeTest();
+  auto & lambdaRegion = *rvsdg.GetFunction().subregion();
+
+  // Create an additional dead alloca node that is removed after the first analysis
+  auto & constantOne = *IntegerConstantOperation::Create(lambdaRegion, { 32, 1 }).output(0);
+  auto extraAllocaOutputs =
+      AllocaOperation::create(jlm::rvsdg::BitType::Create(32), &constantOne, 4);
+  auto extraAllocaNode =
+      jlm::rvsdg::TryGetOwnerNode<jlm::rvsdg::SimpleNode>(*extraAllocaOutputs[0]);
+
+  PointerObjectSet previous;
+  const auto previousRegister0 = previous.CreateRegisterPointerObject(rvsdg.GetAllocaOutput(0));
+  const auto previousRegister1 = previous.CreateRegisterPointerObject(rvsdg.GetAllocaOutput(1));
+  const auto previousAlloca0 = previous.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(0), true);
+  const auto previousAlloca1 = previous.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(1), true);
+  const auto previousExtraAlloca = previous.CreateAllocaMemoryObject(*extraAllocaNode, true);
+  previous.AddToPointsToSet(previousRegister0, previousAlloca0);
+  previous.AddToPointsToSet(previousRegister0, previousExtraAlloca);
+  previous.AddToPointsToSet(previousAlloca1, previousAlloca0);
+  previous.MarkAsPointingToExternal(previousRegister1);
+  previous.MarkAsEscaped(previousAlloca0);
+
+  jlm::rvsdg::ChangeLog changeLog(rvsdg.graph().GetRootRegion());
+  lambdaRegion.removeNode(extraAllocaNode);
+  lambdaRegion.removeNode(jlm::rvsdg::TryGetOwnerNode<jlm::rvsdg::Node>(constantOne));
+
+  // The new set creates its PointerObjects in a different order
+  PointerObjectSet set;
+  const auto alloca1 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(1), true);
+  const auto alloca0 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(0), true);
+  const auto register1 = set.CreateRegisterPointerObject(rvsdg.GetAllocaOutput(1));
+  const auto register0 = set.CreateRegisterPointerObject(rvsdg.GetAllocaOutput(0));
+
+  // Act
+  const auto numSeeded = set.SeedFromPreviousSolution(previous, changeLog);
+
+  // Assert
+  EXPECT_EQ(numSeeded, 4u);
+
+  // The pointee that was removed from the module is dropped
+  EXPECT_EQ(set.GetPointsToSet(register0).Size(), 1u);
+  EXPECT_TRUE(set.GetPointsToSet(register0).Contains(alloca0));
+  EXPECT_TRUE(set.GetPointsToSet(alloca1).Contains(alloca0));
+
+  EXPECT_TRUE(set.IsPointingToExternal(register1));
+  EXPECT_TRUE(set.HasEscaped(alloca0));
+  EXPECT_FALSE(set.HasEscaped(alloca1));
+  EXPECT_FALSE(set.IsPointingToExternal(register0));
+}
+
 // Test the SupersetConstraint's Apply function
 TEST(PointerObjectSetTests, TestSupersetConstraint)
 {
@@ -806,7 +865,10 @@ TEST(PointerObjectSetTests, TestDrawSubsetGraph)
 // Tests crating a ConstraintSet with multiple different constraints and calling Solve()
 template<jlm::llvm::aa::Andersen::Configuration::Solver solver, typename... Args>
 static void
-TestPointerObjectConstraintSetSolve(Args... args)
+TestPointerObjectConstraintSetSolve(
+    jlm::llvm::aa::PointsToSet::Representation representation,
+    bool sharePointsToSets,
+    Args... args)
 {
   using namespace jlm::llvm::aa;
 
@@ -815,6 +877,8 @@ TestPointerObjectConstraintSetSolve(Args... args)
   rvsdg.InitializeTest();
 
   PointerObjectSet set;
+  set.SetPointsToSetRepresentation(representation);
+  set.EnablePointsToSetSharing(sharePointsToSets);
   PointerObjectIndex reg[11];
   for (unsigned int & i : reg)
     i = set.CreateDummyRegisterPointerObject();
@@ -881,11 +945,22 @@ TestPointerObjectConstraintSetSolve(Args... args)
     static_assert(sizeof...(args) == 0, "The naive solver takes no arguments");
     constraints.SolveNaively();
   }
+  else if constexpr (solver == Andersen::Configuration::Solver::WavePropagation)
+  {
+    constraints.SolveUsingWavePropagation(args...);
+  }
   else
   {
     JLM_UNREACHABLE("Unknown solver");
   }
 
+  if (sharePointsToSets)
+  {
+    set.CompactPointsToSets();
+    // %5 and alloca1 both only point to alloca2, and should share their points-to set
+    EXPECT_EQ(&set.GetPointsToSet(reg[5]), &set.GetPointsToSet(alloca1));
+  }
+
   // alloca1 should point to alloca2, etc
   EXPECT_LE(set.GetPointsToSet(alloca1).Size(), 1u);
   EXPECT_TRUE(set.IsPointingTo(alloca1, alloca2));
@@ -941,7 +1016,12 @@ TestPointerObjectConstraintSetSolve(Args... args)
 TEST(PointerObjectSetTests, TestPointerObjectConstraintSetSolveNaive)
 {
   using Configuration = jlm::llvm::aa::Andersen::Configuration;
-  TestPointerObjectConstraintSetSolve<Configuration::Solver::Naive>();
+  using Representation = jlm::llvm::aa::PointsToSet::Representation;
+  for (auto representation : { Representation::HashSet, Representation::SparseBitVector })
+  {
+    TestPointerObjectConstraintSetSolve<Configuration::Solver::Naive>(representation, false);
+    TestPointerObjectConstraintSetSolve<Configuration::Solver::Naive>(representation, true);
+  }
 }
 
 TEST(PointerObjectSetTests, TestPointerObjectConstraintSetSolveWorklist)
@@ -960,6 +1040,8 @@ TEST(PointerObjectSetTests, TestPointerObjectConstraintSetSolveWorklist)
       continue;
 
     TestPointerObjectConstraintSetSolve<Configuration::Solver::Worklist>(
+        config.GetPointsToSetRepresentation(),
+        config.IsSharedPointsToSetsEnabled(),
         config.GetWorklistSoliverPolicy(),
         config.IsOnlineCycleDetectionEnabled(),
         config.IsHybridCycleDetectionEnabled(),
@@ -969,6 +1051,127 @@ TEST(PointerObjectSetTests, TestPointerObjectConstraintSetSolveWorklist)
   }
 }
 
+TEST(PointerObjectSetTests, TestPointerObjectConstraintSetSolveWavePropagation)
+{
+  using Configuration = jlm::llvm::aa::Andersen::Configuration;
+  using Representation = jlm::llvm::aa::PointsToSet::Representation;
+  for (auto representation : { Representation::HashSet, Representation::SparseBitVector })
+  {
+    for (size_t numThreads : { 1, 4 })
+    {
+      TestPointerObjectConstraintSetSolve<Configuration::Solver::WavePropagation>(
+          representation,
+          false,
+          numThreads);
+      TestPointerObjectConstraintSetSolve<Configuration::Solver::WavePropagation>(
+          representation,
+          true,
+          numThreads);
+    }
+  }
+}
+
+TEST(PointerObjectSetTests, TestWavePropagationSolverCycles)
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::llvm::NAllocaNodesTest rvsdg(2);
+  rvsdg.InitializeTest();
+
+  PointerObjectSet set;
+  PointerObjectIndex reg[4];
+  for (auto & i : reg)
+    i = set.CreateDummyRegisterPointerObject();
+  const auto alloca0 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(0), true);
+  const auto alloca1 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(1), true);
+
+  PointerObjectConstraintSet constraints(set);
+  constraints.AddPointerPointeeConstraint(reg[0], alloca0);
+  constraints.AddPointerPointeeConstraint(reg[3], alloca1);
+
+  // reg[0] -> reg[1] -> reg[2] -> reg[0] is a cycle
+  constraints.AddConstraint(SupersetConstraint(reg[1], reg[0]));
+  constraints.AddConstraint(SupersetConstraint(reg[2], reg[1]));
+  constraints.AddConstraint(SupersetConstraint(reg[0], reg[2]));
+
+  // store [reg[1]], reg[3] adds the edge reg[3] -> alloca0, making alloca0 point to alloca1
+  // reg[0] = load [reg[2]] adds the edge alloca0 -> reg[0], bringing alloca1 into the cycle
+  constraints.AddConstraint(StoreConstraint(reg[1], reg[3]));
+  constraints.AddConstraint(LoadConstraint(reg[0], reg[2]));
+
+  // Act
+  auto statistics = constraints.SolveUsingWavePropagation(4);
+
+  // Assert
+  EXPECT_EQ(statistics.NumCycleUnifications, 2u);
+  EXPECT_GE(statistics.NumWaves, 2u);
+  EXPECT_EQ(set.GetUnificationRoot(reg[0]), set.GetUnificationRoot(reg[1]));
+  EXPECT_EQ(set.GetUnificationRoot(reg[0]), set.GetUnificationRoot(reg[2]));
+
+  for (auto r : { reg[0], reg[1], reg[2] })
+  {
+    EXPECT_EQ(set.GetPointsToSet(r).Size(), 2u);
+    EXPECT_TRUE(set.IsPointingTo(r, alloca0));
+    EXPECT_TRUE(set.IsPointingTo(r, alloca1));
+  }
+  EXPECT_TRUE(set.IsPointingTo(alloca0, alloca1));
+  EXPECT_FALSE(set.IsPointingTo(alloca1, alloca0));
+}
+
+TEST(PointerObjectSetTests, TestWavePropagationSolverMatchesNaive)
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  constexpr size_t numAllocas = 32;
+  constexpr size_t numRegisters = 1000;
+  jlm::llvm::NAllocaNodesTest rvsdg(numAllocas);
+  rvsdg.InitializeTest();
+
+  PointerObjectSet set;
+  std::vector<PointerObjectIndex> allocas;
+  for (size_t i = 0; i < numAllocas; i++)
+    allocas.push_back(set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(i), true));
+  std::vector<PointerObjectIndex> registers;
+  for (size_t i = 0; i < numRegisters; i++)
+    registers.push_back(set.CreateDummyRegisterPointerObject());
+
+  // Use a fixed linear congruential generator, to make the constraints the same on each run
+  uint32_t state = 1;
+  const auto Random = [&](size_t bound)
+  {
+    state = state * 1664525 + 1013904223;
+    return (state >> 8) % bound;
+  };
+
+  // Mostly wide, acyclic propagation, with some cycles and complex constraints mixed in
+  PointerObjectConstraintSet constraints(set);
+  for (size_t i = 0; i < numAllocas; i++)
+    constraints.AddPointerPointeeConstraint(registers[i], allocas[i]);
+  constraints.AddPointsToExternalConstraint(registers[numAllocas]);
+  for (size_t i = numAllocas + 1; i < numRegisters; i++)
+  {
+    constraints.AddConstraint(SupersetConstraint(registers[i], registers[Random(i)]));
+    if (Random(10) == 0)
+      constraints.AddConstraint(SupersetConstraint(registers[Random(i)], registers[i]));
+    if (Random(20) == 0)
+      constraints.AddConstraint(StoreConstraint(registers[Random(i)], registers[Random(i)]));
+    if (Random(20) == 0)
+      constraints.AddConstraint(LoadConstraint(registers[i], registers[Random(i)]));
+  }
+
+  auto [naiveSet, naiveConstraints] = constraints.Clone();
+  naiveConstraints->SolveNaively();
+
+  // Act
+  auto statistics = constraints.SolveUsingWavePropagation(8);
+
+  // Assert
+  EXPECT_GT(statistics.NumCycleUnifications, 0u);
+  EXPECT_TRUE(set.HasIdenticalSolAs(*naiveSet));
+}
+
 TEST(PointerObjectSetTests, TestClonePointerObjectConstraintSet)
 {
   using namespace jlm::llvm::aa;
@@ -26,8 +26,16 @@ PointsToAnalysisStateEncoder<TPointsToAnalysis, TModRefSummarizer>::Run(
     rvsdg::RvsdgModule & rvsdgModule,
     util::StatisticsCollector & statisticsCollector)
 {
-  TPointsToAnalysis ptaPass;
-  std::shared_ptr<PointsToGraph> pointsToGraph = ptaPass.Analyze(rvsdgModule, statisticsCollector);
+  std::shared_ptr<PointsToGraph> pointsToGraph;
+  if (PointsToAnalysis_)
+  {
+    pointsToGraph = PointsToAnalysis_->Analyze(rvsdgModule, statisticsCollector);
+  }
+  else
+  {
+    TPointsToAnalysis ptaPass;
+    pointsToGraph = ptaPass.Analyze(rvsdgModule, statisticsCollector);
+  }
 
   if (statisticsCollector.IsDemanded(util::Statistics::Id::AliasAnalysisPrecisionEvaluation))
   {
@@ -11,6 +11,7 @@
 #include <jlm/llvm/opt/alias-analyses/PointsToAnalysis.hpp>
 #include <jlm/rvsdg/Transformation.hpp>
 
+#include <memory>
 #include <type_traits>
 
 namespace jlm::llvm::aa
@@ -43,8 +44,21 @@ public:
       : Transformation("PointsToAnalysisStateEncoder")
   {}
 
+  /**
+   * Creates an encoder that uses \p pointsToAnalysis for every run, instead of a new instance per
+   * run. Several encoders can thereby share the state a points-to analysis keeps between runs.
+   * @param pointsToAnalysis the points-to analysis instance to use
+   */
+  explicit PointsToAnalysisStateEncoder(std::shared_ptr<TPointsToAnalysis> pointsToAnalysis)
+      : Transformation("PointsToAnalysisStateEncoder"),
+        PointsToAnalysis_(std::move(pointsToAnalysis))
+  {}
+
   void
   Run(rvsdg::RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector) override;
+
+private:
+  std::shared_ptr<TPointsToAnalysis> PointsToAnalysis_;
 };
 
 }
@@ -204,6 +204,7 @@ PointsToGraph::addNodeForRegisters()
 void
 PointsToGraph::mapRegisterToNode(const rvsdg::Output & output, NodeIndex nodeIndex)
 {
+  checkNotFinalized();
   if (!isRegisterNode(nodeIndex))
     throw std::logic_error("Node is not a register node");
 
@@ -215,6 +216,7 @@ PointsToGraph::mapRegisterToNode(const rvsdg::Output & output, NodeIndex nodeInd
 void
 PointsToGraph::markAsTargetsAllExternallyAvailable(NodeIndex index)
 {
+  checkNotFinalized();
   JLM_ASSERT(index < nodeData_.size());
   if (!nodeData_[index].isTargetingAllExternallyAvailable)
   {
@@ -226,6 +228,7 @@ PointsToGraph::markAsTargetsAllExternallyAvailable(NodeIndex index)
 bool
 PointsToGraph::addTarget(NodeIndex source, NodeIndex target)
 {
+  checkNotFinalized();
   JLM_ASSERT(source < nodeExplicitTargets_.size());
 
   // The external memory node should never be an explicit target
@@ -239,7 +242,43 @@ PointsToGraph::addTarget(NodeIndex source, NodeIndex target)
   // Skip adding the target if it is already being targeted implicitly
   if (isTargetingAllExternallyAvailable(source) && isExternallyAvailable(target))
     return false;
-  return nodeExplicitTargets_[source].insert(target);
+
+  // Keep the targets sorted. Targets added in increasing order are appended at the end.
+  auto & targets = nodeExplicitTargets_[source];
+  const auto it = std::lower_bound(targets.begin(), targets.end(), target);
+  if (it != targets.end() && *it == target)
+    return false;
+  targets.insert(it, target);
+  return true;
+}
+
+void
+PointsToGraph::finalize()
+{
+  if (isFinalized_)
+    return;
+
+  size_t numExplicitTargets = 0;
+  for (const auto & targets : nodeExplicitTargets_)
+    numExplicitTargets += targets.size();
+
+  explicitTargetOffsets_.reserve(nodeData_.size() + 1);
+  explicitTargets_.reserve(numExplicitTargets);
+  for (const auto & targets : nodeExplicitTargets_)
+  {
+    explicitTargetOffsets_.push_back(explicitTargets_.size());
+    explicitTargets_.insert(explicitTargets_.end(), targets.begin(), targets.end());
+  }
+  explicitTargetOffsets_.push_back(explicitTargets_.size());
+
+  // Release the memory used during construction
+  std::vector<std::vector<NodeIndex>>().swap(nodeExplicitTargets_);
+  nodeData_.shrink_to_fit();
+  nodeObjects_.shrink_to_fit();
+  registerNodes_.shrink_to_fit();
+  externallyAvailableNodes_.shrink_to_fit();
+
+  isFinalized_ = true;
 }
 
 std::pair<size_t, size_t>
@@ -251,7 +290,7 @@ PointsToGraph::numEdges() const noexcept
 
   for (NodeIndex i = 0; i < numNodes(); i++)
   {
-    for (auto target : getExplicitTargets(i).Items())
+    for (auto target : getExplicitTargets(i))
     {
       numExplicitEdges++;
       if (isTargetingAllExternallyAvailable(i) && isExternallyAvailable(target))
@@ -391,7 +430,7 @@ PointsToGraph::isSupergraphOf(const PointsToGraph & subgraph) const
       return false;
 
     // Make sure all targets of the subset node are also targets of the superset node
-    for (auto subsetTarget : subsetGraph.getExplicitTargets(subsetNode).Items())
+    for (auto subsetTarget : subsetGraph.getExplicitTargets(subsetNode))
     {
       // There must be a corresponding memory node representing the target in the superset graph
       auto correspondingTarget =
@@ -478,6 +517,7 @@ PointsToGraph::addNode(
     std::optional<size_t> memorySize,
     const void * object)
 {
+  checkNotFinalized();
   const auto index = nodeData_.size();
 
   nodeData_.emplace_back(NodeData(kind, externallyAvailable, false, isConstant, memorySize));
@@ -490,6 +530,13 @@ PointsToGraph::addNode(
   return index;
 }
 
+void
+PointsToGraph::checkNotFinalized() const
+{
+  if (isFinalized_)
+    throw std::logic_error("PointsToGraph is finalized and can not be modified.");
+}
+
 void
 PointsToGraph::dumpGraph(util::graph::Writer & graphWriter, const PointsToGraph & pointsToGraph)
 {
@@ -538,7 +585,7 @@ PointsToGraph::dumpGraph(util::graph::Writer & graphWriter, const PointsToGraph
   // Add all explicit edges
   for (NodeIndex ptgNode = 0; ptgNode < pointsToGraph.numNodes(); ptgNode++)
   {
-    for (auto target : pointsToGraph.getExplicitTargets(ptgNode).Items())
+    for (auto target : pointsToGraph.getExplicitTargets(ptgNode))
     {
       graph.CreateEdge(*nodes[ptgNode], *nodes[target], true);
     }
@@ -15,6 +15,7 @@
 #include <jlm/util/iterator_range.hpp>
 #include <jlm/util/Math.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <string>
@@ -42,6 +43,11 @@ namespace aa
  *  - explicitly: node Y is a member of node X's set of explicit targets.
  *  - implicitly: node X is flagged as targeting all externally available memory,
  *                and node Y is flagged as being externally available.
+ *
+ * The graph is built incrementally, and is then frozen by calling finalize(). Finalizing packs
+ * the explicit targets of all nodes into a single sorted array in compressed sparse row layout,
+ * and releases the per-node target vectors used during construction. A finalized graph can not
+ * be modified, but can be queried concurrently.
  */
 class PointsToGraph final
 {
@@ -66,6 +72,53 @@ public:
     COUNT
   };
 
+  /**
+   * A read-only view of the explicit targets of a single node, sorted by node index.
+   * The view is invalidated by any modification to the PointsToGraph, including finalize().
+   */
+  class TargetSpan final
+  {
+  public:
+    TargetSpan(const NodeIndex * begin, const NodeIndex * end) noexcept
+        : begin_(begin),
+          end_(end)
+    {}
+
+    [[nodiscard]] const NodeIndex *
+    begin() const noexcept
+    {
+      return begin_;
+    }
+
+    [[nodiscard]] const NodeIndex *
+    end() const noexcept
+    {
+      return end_;
+    }
+
+    [[nodiscard]] size_t
+    Size() const noexcept
+    {
+      return end_ - begin_;
+    }
+
+    [[nodiscard]] bool
+    IsEmpty() const noexcept
+    {
+      return begin_ == end_;
+    }
+
+    [[nodiscard]] bool
+    Contains(NodeIndex index) const noexcept
+    {
+      return std::binary_search(begin_, end_, index);
+    }
+
+  private:
+    const NodeIndex * begin_;
+    const NodeIndex * end_;
+  };
+
 private:
   struct NodeData
   {
@@ -271,11 +324,21 @@ public:
   size_t
   numNodes() const noexcept
   {
-    JLM_ASSERT(nodeData_.size() == nodeExplicitTargets_.size());
+    JLM_ASSERT(isFinalized_ || nodeData_.size() == nodeExplicitTargets_.size());
+    JLM_ASSERT(!isFinalized_ || nodeData_.size() + 1 == explicitTargetOffsets_.size());
     JLM_ASSERT(nodeData_.size() == nodeObjects_.size());
     return nodeData_.size();
   }
 
+  /**
+   * @return true if finalize() has been called on the PointsToGraph, otherwise false.
+   */
+  [[nodiscard]] bool
+  isFinalized() const noexcept
+  {
+    return isFinalized_;
+  }
+
   /**
    * Checks whether a PointsToGraph AllocaNode has been created for the given RVSDG SimpleNode.
    * The SimpleNode must correspond to an AllocaOperation.
@@ -531,13 +594,21 @@ public:
    * @see isExternallyAvailable
    * @see isTargetingAllExternallyAvailable
    * @param index the index of the PointsToGraph node X.
-   * @return the set of indices of PointsToGraph nodes targeted by X.
+   * @return a sorted view of the indices of PointsToGraph nodes targeted by X.
    */
-  [[nodiscard]] const util::HashSet<NodeIndex> &
+  [[nodiscard]] TargetSpan
   getExplicitTargets(NodeIndex index) const
   {
-    JLM_ASSERT(index < nodeExplicitTargets_.size());
-    return nodeExplicitTargets_[index];
+    JLM_ASSERT(index < nodeData_.size());
+    if (isFinalized_)
+    {
+      const auto targets = explicitTargets_.data();
+      return { targets + explicitTargetOffsets_[index],
+               targets + explicitTargetOffsets_[index + 1] };
+    }
+
+    const auto & targets = nodeExplicitTargets_[index];
+    return { targets.data(), targets.data() + targets.size() };
   }
 
   /**
@@ -740,6 +811,8 @@ public:
    * Neither the target nor the source can be the external node.
    * That node can only be a target / targeted via flags.
    *
+   * Targets are kept sorted, so adding the targets of a node in increasing order is cheapest.
+   *
    * @param source the source node. Can not be the external node.
    * @param target the target node. Must be a memory node, and not the external node.
    * @return true if the target was added, or any flags were changed
@@ -747,6 +820,14 @@ public:
   bool
   addTarget(NodeIndex source, NodeIndex target);
 
+  /**
+   * Freezes the PointsToGraph, converting the explicit targets of all nodes into a compressed
+   * sparse row layout. Finalizing an already finalized graph is a no-op.
+   * Any attempt at adding nodes, targets or flags afterwards throws a std::logic_error.
+   */
+  void
+  finalize();
+
   /**
    * Gets the total number of edges in the PointsToGraph.
    *
@@ -813,13 +894,25 @@ private:
       std::optional<size_t> memorySize,
       const void * object);
 
+  /**
+   * @throws std::logic_error if the PointsToGraph has been finalized.
+   */
+  void
+  checkNotFinalized() const;
+
   // Vectors containing information per node
   std::vector<NodeData> nodeData_;
-  // For each node, the set of memory nodes that it explicitly targets
-  std::vector<util::HashSet<NodeIndex>> nodeExplicitTargets_;
+  // For each node, the sorted memory nodes that it explicitly targets. Emptied by finalize().
+  std::vector<std::vector<NodeIndex>> nodeExplicitTargets_;
   // For each memory node, this vector contains a pointer to the associated RVSDG object.
   std::vector<const void *> nodeObjects_;
 
+  // The explicit targets of node i are explicitTargets_[explicitTargetOffsets_[i]] up to, but not
+  // including, explicitTargets_[explicitTargetOffsets_[i + 1]]. Only populated by finalize().
+  std::vector<size_t> explicitTargetOffsets_;
+  std::vector<NodeIndex> explicitTargets_;
+  bool isFinalized_ = false;
+
   // Mappings from RVSDG objects to their corresponding PointsToGraph NodeIndex
   AllocaNodeMap allocaMap_;
   DeltaNodeMap deltaMap_;
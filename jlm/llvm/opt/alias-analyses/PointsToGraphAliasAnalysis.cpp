@@ -78,7 +78,7 @@ PointsToGraphAliasAnalysis::Query(
     std::swap(onlyExplicitTargetsNode, otherNode);
   }
 
-  for (const auto target : pointsToGraph_->getExplicitTargets(onlyExplicitTargetsNode).Items())
+  for (const auto target : pointsToGraph_->getExplicitTargets(onlyExplicitTargetsNode))
   {
     // Skip memory locations that are too small
     const auto targetSize = pointsToGraph_->tryGetNodeSize(target);
@@ -102,7 +102,7 @@ PointsToGraphAliasAnalysis::TryGetSingleTarget(PointsToGraph::NodeIndex node, si
 
   std::optional<PointsToGraph::NodeIndex> singleTarget = std::nullopt;
 
-  for (const auto target : pointsToGraph_->getExplicitTargets(node).Items())
+  for (const auto target : pointsToGraph_->getExplicitTargets(node))
   {
     // Skip memory locations that are too small to hold size
     const auto targetSize = pointsToGraph_->tryGetNodeSize(target);
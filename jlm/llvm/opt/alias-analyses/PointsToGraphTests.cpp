@@ -285,6 +285,61 @@ TEST(PointsToGraphTests, TestIsSupergraphOf)
   EXPECT_TRUE(graph1->isSupergraphOf(*graph0));
 }
 
+TEST(PointsToGraphTests, testFinalize)
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::llvm::AllMemoryNodesTest rvsdg;
+  rvsdg.InitializeTest();
+
+  auto graph = PointsToGraph::create();
+  const auto alloca = graph->addNodeForAlloca(rvsdg.GetAllocaNode(), false);
+  const auto delta = graph->addNodeForDelta(rvsdg.GetDeltaNode(), true);
+  const auto import = graph->addNodeForImport(rvsdg.GetImportOutput(), true);
+  const auto lambda = graph->addNodeForLambda(rvsdg.GetLambdaNode(), false);
+  const auto malloc = graph->addNodeForMalloc(rvsdg.GetMallocNode(), false);
+  const auto register0 = graph->addNodeForRegisters();
+  graph->mapRegisterToNode(rvsdg.GetAllocaOutput(), register0);
+
+  // Add targets out of order, and one target twice
+  EXPECT_TRUE(graph->addTarget(register0, malloc));
+  EXPECT_TRUE(graph->addTarget(register0, alloca));
+  EXPECT_TRUE(graph->addTarget(register0, import));
+  EXPECT_FALSE(graph->addTarget(register0, alloca));
+  EXPECT_TRUE(graph->addTarget(lambda, delta));
+
+  const auto [explicitEdgesBefore, totalEdgesBefore] = graph->numEdges();
+  EXPECT_FALSE(graph->isFinalized());
+
+  // Act
+  graph->finalize();
+
+  // Assert
+  EXPECT_TRUE(graph->isFinalized());
+  EXPECT_EQ(graph->numNodes(), 7u);
+  EXPECT_EQ(graph->numEdges(), std::make_pair(explicitEdgesBefore, totalEdgesBefore));
+
+  using NodeIndex = PointsToGraph::NodeIndex;
+  const auto targets = graph->getExplicitTargets(register0);
+  const std::vector<NodeIndex> expectedTargets = { alloca, import, malloc };
+  EXPECT_EQ(std::vector<NodeIndex>(targets.begin(), targets.end()), expectedTargets);
+  EXPECT_TRUE(targets.Contains(import));
+  EXPECT_FALSE(targets.Contains(delta));
+  EXPECT_TRUE(graph->isTargeting(lambda, delta));
+  EXPECT_TRUE(graph->getExplicitTargets(delta).IsEmpty());
+  EXPECT_TRUE(graph->getExplicitTargets(graph->getExternalMemoryNode()).IsEmpty());
+
+  // The finalized graph can no longer be modified
+  EXPECT_THROW(graph->addTarget(register0, delta), std::logic_error);
+  EXPECT_THROW((void)graph->addNodeForRegisters(), std::logic_error);
+  EXPECT_THROW(graph->markAsTargetsAllExternallyAvailable(register0), std::logic_error);
+
+  // Finalizing twice is a no-op
+  graph->finalize();
+  EXPECT_EQ(graph->getExplicitTargets(register0).Size(), 3u);
+}
+
 TEST(PointsToGraphTests, testMemoryNodeSize)
 {
   using namespace jlm::llvm;
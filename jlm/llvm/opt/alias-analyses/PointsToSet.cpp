@@ -0,0 +1,117 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/opt/alias-analyses/PointsToSet.hpp>
+
+#include <algorithm>
+
+namespace jlm::llvm::aa
+{
+
+PointsToSetPool::PointsToSetPool(PointsToSet::Representation representation)
+    : EmptySet_(std::make_shared<PointsToSet>(representation))
+{
+  Intern(EmptySet_, EmptySet_->Hash());
+}
+
+void
+PointsToSetPool::Intern(std::shared_ptr<PointsToSet> & set)
+{
+  JLM_ASSERT(set->GetRepresentation() == GetRepresentation());
+
+  if (IsPooled(*set))
+    return;
+
+  Intern(set, set->Hash());
+}
+
+void
+PointsToSetPool::Intern(std::shared_ptr<PointsToSet> & set, size_t hash)
+{
+  JLM_ASSERT(hash == set->Hash());
+
+  auto [it, end] = Sets_.equal_range(hash);
+  for (; it != end; ++it)
+  {
+    if (*it->second == *set)
+    {
+      set = it->second;
+      return;
+    }
+  }
+
+  Sets_.emplace(hash, set);
+  PooledSetHashes_.emplace(set.get(), hash);
+}
+
+std::shared_ptr<PointsToSet>
+PointsToSetPool::Union(std::shared_ptr<PointsToSet> & superset, std::shared_ptr<PointsToSet> & subset)
+{
+  if (subset->IsEmpty() || superset == subset)
+    return superset;
+
+  Intern(subset);
+  if (superset->IsEmpty())
+    return subset;
+
+  Intern(superset);
+  if (superset == subset)
+    return superset;
+
+  const auto key = std::make_pair(superset.get(), subset.get());
+  if (const auto it = UnionCache_.find(key); it != UnionCache_.end())
+    return it->second;
+
+  auto result = superset;
+  if (!subset->IsSubsetOf(*superset))
+  {
+    // Derive the hash of the union from the hash of the superset, instead of rehashing all items
+    auto hash = PooledSetHashes_[superset.get()];
+    result = std::make_shared<PointsToSet>(*superset);
+    result->UnionWith(
+        *subset,
+        [&](PointerObjectIndex item)
+        {
+          hash += PointsToSet::HashItem(item);
+        });
+    Intern(result, hash);
+  }
+
+  UnionCache_.emplace(key, result);
+  return result;
+}
+
+void
+PointsToSetPool::EvictUnusedSets()
+{
+  if (Sets_.size() >= std::max<size_t>(2 * NumSetsAfterPurge_, 64))
+    Purge();
+}
+
+size_t
+PointsToSetPool::Purge()
+{
+  UnionCache_.clear();
+
+  size_t numRemoved = 0;
+  for (auto it = Sets_.begin(); it != Sets_.end();)
+  {
+    if (it->second.use_count() == 1)
+    {
+      PooledSetHashes_.erase(it->second.get());
+      it = Sets_.erase(it);
+      numRemoved++;
+    }
+    else
+    {
+      ++it;
+    }
+  }
+
+  NumSetsAfterPurge_ = Sets_.size();
+  return numRemoved;
+}
+
+}
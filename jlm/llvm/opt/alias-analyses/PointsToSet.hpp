@@ -0,0 +1,545 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_ALIAS_ANALYSES_POINTSTOSET_HPP
+#define JLM_LLVM_OPT_ALIAS_ANALYSES_POINTSTOSET_HPP
+
+#include <jlm/util/common.hpp>
+#include <jlm/util/Hash.hpp>
+#include <jlm/util/HashSet.hpp>
+#include <jlm/util/iterator_range.hpp>
+#include <jlm/util/SparseBitVector.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace jlm::llvm::aa
+{
+
+using PointerObjectIndex = uint32_t;
+
+/**
+ * A set of PointerObjectIndex, used to represent the explicit pointees of a PointerObject.
+ * The set can be stored in one of several representations, which is selected at runtime.
+ * All points-to sets belonging to the same PointerObjectSet share the same representation,
+ * and operations involving two sets require both sets to have the same representation.
+ */
+class PointsToSet final
+{
+  using HashSetType = util::HashSet<PointerObjectIndex>;
+  using SparseBitVectorType = util::SparseBitVector<PointerObjectIndex>;
+
+public:
+  enum class Representation : uint8_t
+  {
+    // A hash set of pointees. Efficient for small sets and random insertions.
+    HashSet,
+    // A sparse bit vector of pointees. Compact for large sets of densely numbered pointees,
+    // and allows unions and differences to be computed a machine word at a time.
+    SparseBitVector,
+
+    COUNT
+  };
+
+  class ItemConstIterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = PointerObjectIndex;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const PointerObjectIndex *;
+    using reference = const PointerObjectIndex &;
+
+  private:
+    friend PointsToSet;
+
+    template<typename Iterator>
+    explicit ItemConstIterator(Iterator it)
+        : It_(std::move(it))
+    {}
+
+  public:
+    PointerObjectIndex
+    operator*() const
+    {
+      return std::visit(
+          [](const auto & it) -> PointerObjectIndex
+          {
+            return *it;
+          },
+          It_);
+    }
+
+    ItemConstIterator &
+    operator++()
+    {
+      std::visit(
+          [](auto & it)
+          {
+            ++it;
+          },
+          It_);
+      return *this;
+    }
+
+    ItemConstIterator
+    operator++(int)
+    {
+      ItemConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool
+    operator==(const ItemConstIterator & other) const
+    {
+      return It_ == other.It_;
+    }
+
+    bool
+    operator!=(const ItemConstIterator & other) const
+    {
+      return !operator==(other);
+    }
+
+  private:
+    std::variant<HashSetType::ItemConstIterator, SparseBitVectorType::ItemConstIterator> It_;
+  };
+
+  using ItemRange = util::IteratorRange<ItemConstIterator>;
+
+  PointsToSet() = default;
+
+  explicit PointsToSet(Representation representation)
+  {
+    if (representation == Representation::SparseBitVector)
+      Set_.emplace<SparseBitVectorType>();
+  }
+
+  PointsToSet(std::initializer_list<PointerObjectIndex> initializerList)
+      : Set_(HashSetType(initializerList))
+  {}
+
+  /**
+   * @return the representation currently used to store the set.
+   */
+  [[nodiscard]] Representation
+  GetRepresentation() const noexcept
+  {
+    return std::holds_alternative<SparseBitVectorType>(Set_) ? Representation::SparseBitVector
+                                                             : Representation::HashSet;
+  }
+
+  /**
+   * Converts the set to the given \p representation, keeping all items.
+   * If the set already uses \p representation, this is a no-op.
+   */
+  void
+  SetRepresentation(Representation representation)
+  {
+    if (representation == GetRepresentation())
+      return;
+
+    // Insert the items in ascending order, which only appends to a sparse bit vector
+    std::vector<PointerObjectIndex> items(Items().begin(), Items().end());
+    std::sort(items.begin(), items.end());
+
+    PointsToSet converted(representation);
+    for (const auto item : items)
+      converted.insert(item);
+    *this = std::move(converted);
+  }
+
+  void
+  Clear() noexcept
+  {
+    std::visit(
+        [](auto & set)
+        {
+          set.Clear();
+        },
+        Set_);
+  }
+
+  [[nodiscard]] size_t
+  Size() const noexcept
+  {
+    return std::visit(
+        [](const auto & set)
+        {
+          return set.Size();
+        },
+        Set_);
+  }
+
+  [[nodiscard]] bool
+  IsEmpty() const noexcept
+  {
+    return std::visit(
+        [](const auto & set)
+        {
+          return set.IsEmpty();
+        },
+        Set_);
+  }
+
+  [[nodiscard]] bool
+  Contains(PointerObjectIndex item) const noexcept
+  {
+    return std::visit(
+        [&](const auto & set)
+        {
+          return set.Contains(item);
+        },
+        Set_);
+  }
+
+  /**
+   * Adds \p item to the set.
+   * @return true if \p item was not already in the set.
+   */
+  bool
+  insert(PointerObjectIndex item)
+  {
+    return std::visit(
+        [&](auto & set)
+        {
+          return set.insert(item);
+        },
+        Set_);
+  }
+
+  [[nodiscard]] ItemRange
+  Items() const noexcept
+  {
+    return std::visit(
+        [](const auto & set)
+        {
+          const auto items = set.Items();
+          return ItemRange(ItemConstIterator(items.begin()), ItemConstIterator(items.end()));
+        },
+        Set_);
+  }
+
+  /**
+   * Adds all items in \p other to this set, and invokes \p onNewItem for each item that was
+   * not already in this set.
+   *
+   * @tparam F a type supporting the function call operator: void operator(PointerObjectIndex)
+   * @return true if any item was added to this set.
+   */
+  template<typename F>
+  bool
+  UnionWith(const PointsToSet & other, const F & onNewItem)
+  {
+    JLM_ASSERT(GetRepresentation() == other.GetRepresentation());
+
+    if (auto sparseBitVector = std::get_if<SparseBitVectorType>(&Set_))
+      return sparseBitVector->UnionWith(std::get<SparseBitVectorType>(other.Set_), onNewItem);
+
+    auto & hashSet = std::get<HashSetType>(Set_);
+    bool modified = false;
+    for (const auto item : std::get<HashSetType>(other.Set_).Items())
+    {
+      if (hashSet.insert(item))
+      {
+        onNewItem(item);
+        modified = true;
+      }
+    }
+    return modified;
+  }
+
+  /**
+   * Adds all items in \p other to this set.
+   * @return true if any item was added to this set.
+   */
+  bool
+  UnionWith(const PointsToSet & other)
+  {
+    JLM_ASSERT(GetRepresentation() == other.GetRepresentation());
+
+    return std::visit(
+        [&](auto & set)
+        {
+          return set.UnionWith(std::get<std::decay_t<decltype(set)>>(other.Set_));
+        },
+        Set_);
+  }
+
+  /**
+   * Adds all items in \p other to this set, and clears \p other.
+   * @return true if any item was added to this set.
+   */
+  bool
+  UnionWithAndClear(PointsToSet & other)
+  {
+    JLM_ASSERT(GetRepresentation() == other.GetRepresentation());
+
+    return std::visit(
+        [&](auto & set)
+        {
+          return set.UnionWithAndClear(std::get<std::decay_t<decltype(set)>>(other.Set_));
+        },
+        Set_);
+  }
+
+  /**
+   * Removes all items from this set that are not in \p other.
+   */
+  void
+  IntersectWith(const PointsToSet & other)
+  {
+    JLM_ASSERT(GetRepresentation() == other.GetRepresentation());
+
+    std::visit(
+        [&](auto & set)
+        {
+          set.IntersectWith(std::get<std::decay_t<decltype(set)>>(other.Set_));
+        },
+        Set_);
+  }
+
+  /**
+   * Removes all items from this set that are in \p other.
+   */
+  void
+  DifferenceWith(const PointsToSet & other)
+  {
+    JLM_ASSERT(GetRepresentation() == other.GetRepresentation());
+
+    std::visit(
+        [&](auto & set)
+        {
+          set.DifferenceWith(std::get<std::decay_t<decltype(set)>>(other.Set_));
+        },
+        Set_);
+  }
+
+  /**
+   * @return true if all items in this set are also in \p other.
+   */
+  [[nodiscard]] bool
+  IsSubsetOf(const PointsToSet & other) const
+  {
+    if (GetRepresentation() == other.GetRepresentation())
+    {
+      return std::visit(
+          [&](const auto & set)
+          {
+            return set.IsSubsetOf(std::get<std::decay_t<decltype(set)>>(other.Set_));
+          },
+          Set_);
+    }
+
+    if (Size() > other.Size())
+      return false;
+
+    for (const auto item : Items())
+    {
+      if (!other.Contains(item))
+        return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * @return a hash of the items in the set. The hash does not depend on the representation,
+   * or on the order in which items were inserted.
+   */
+  [[nodiscard]] size_t
+  Hash() const noexcept
+  {
+    size_t hash = 0;
+    for (const auto item : Items())
+      hash += HashItem(item);
+    return hash;
+  }
+
+  /**
+   * @return the contribution of \p item to the hash of a set containing it. The hash of a set is
+   * the sum of the contributions of its items, so adding an item to a set with hash h yields a
+   * set with hash h + HashItem(item).
+   */
+  [[nodiscard]] static size_t
+  HashItem(PointerObjectIndex item) noexcept
+  {
+    // Mix each item separately, and sum them up, to make the hash order independent.
+    // Each item also counts towards the size of the set.
+    uint64_t mixed = item + 0x9e3779b97f4a7c15;
+    mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9;
+    mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111eb;
+    return 1 + (mixed ^ (mixed >> 31));
+  }
+
+  /**
+   * Compares the items of the two sets, regardless of their representations.
+   */
+  bool
+  operator==(const PointsToSet & other) const
+  {
+    return Size() == other.Size() && IsSubsetOf(other);
+  }
+
+  bool
+  operator!=(const PointsToSet & other) const
+  {
+    return !operator==(other);
+  }
+
+  /**
+   * @return a short, human readable name of the \p representation.
+   */
+  [[nodiscard]] static std::string_view
+  RepresentationToString(Representation representation)
+  {
+    switch (representation)
+    {
+    case Representation::HashSet:
+      return "HashSet";
+    case Representation::SparseBitVector:
+      return "SparseBitVector";
+    default:
+      JLM_UNREACHABLE("Unknown points-to set representation");
+    }
+  }
+
+private:
+  std::variant<HashSetType, SparseBitVectorType> Set_;
+};
+
+/**
+ * A pool of immutable points-to sets, where no two sets in the pool have the same items.
+ * Sets are shared through reference counting. A set in the pool must never be modified,
+ * so users holding a pooled set must copy it before modifying it, i.e., copy-on-write.
+ *
+ * Since pooled sets are unique, two pooled sets are equal iff they are the same object.
+ * This allows the union of two pooled sets to be cached, making repeated unions table lookups.
+ *
+ * Sets are kept alive by the pool until they are evicted by EvictUnusedSets() or Purge().
+ */
+class PointsToSetPool final
+{
+public:
+  explicit PointsToSetPool(PointsToSet::Representation representation);
+
+  /**
+   * @return the representation used by all sets in the pool.
+   */
+  [[nodiscard]] PointsToSet::Representation
+  GetRepresentation() const noexcept
+  {
+    return EmptySet_->GetRepresentation();
+  }
+
+  /**
+   * @return the pooled empty set.
+   */
+  [[nodiscard]] const std::shared_ptr<PointsToSet> &
+  GetEmptySet() const noexcept
+  {
+    return EmptySet_;
+  }
+
+  /**
+   * @return true if \p set is owned by the pool.
+   */
+  [[nodiscard]] bool
+  IsPooled(const PointsToSet & set) const noexcept
+  {
+    return PooledSetHashes_.find(&set) != PooledSetHashes_.end();
+  }
+
+  /**
+   * Replaces \p set by the pooled set containing the same items.
+   * If no such set is in the pool, \p set itself is added to the pool.
+   * After this call, \p set must no longer be modified.
+   */
+  void
+  Intern(std::shared_ptr<PointsToSet> & set);
+
+  /**
+   * Computes the union of \p superset and \p subset. Both arguments are interned first.
+   * The unions of pairs of pooled sets are cached, making repeated unions a single lookup.
+   * The hash of a new union is derived from the hash of \p superset and the added items.
+   * @return the pooled union of the two sets. Is \p superset if \p subset is a subset of it.
+   */
+  [[nodiscard]] std::shared_ptr<PointsToSet>
+  Union(std::shared_ptr<PointsToSet> & superset, std::shared_ptr<PointsToSet> & subset);
+
+  /**
+   * Performs a Purge() if the pool has doubled in size since the last purge. Invoking this
+   * regularly during solving bounds the number of pooled sets by roughly twice the number of sets
+   * in use, instead of keeping every intermediate union alive. The amortized cost per pooled set
+   * is constant.
+   *
+   * As sets that are only referenced by the pool are freed, no references to pooled sets may be
+   * held, except through shared pointers.
+   */
+  void
+  EvictUnusedSets();
+
+  /**
+   * Clears the union cache, and removes all sets that are only referenced by the pool.
+   * @return the number of sets removed from the pool.
+   */
+  size_t
+  Purge();
+
+  /**
+   * @return the number of distinct sets in the pool.
+   */
+  [[nodiscard]] size_t
+  NumSets() const noexcept
+  {
+    return Sets_.size();
+  }
+
+  /**
+   * @return the number of unions that are currently cached.
+   */
+  [[nodiscard]] size_t
+  NumCachedUnions() const noexcept
+  {
+    return UnionCache_.size();
+  }
+
+private:
+  /**
+   * Adds \p set with the given \p hash to the pool, unless an equal set is pooled already.
+   */
+  void
+  Intern(std::shared_ptr<PointsToSet> & set, size_t hash);
+
+  std::shared_ptr<PointsToSet> EmptySet_;
+
+  // All pooled sets, indexed by their hash
+  std::unordered_multimap<size_t, std::shared_ptr<PointsToSet>> Sets_;
+
+  // The addresses of all pooled sets, mapped to their hashes
+  std::unordered_map<const PointsToSet *, size_t> PooledSetHashes_;
+
+  // The number of pooled sets after the last purge
+  size_t NumSetsAfterPurge_ = 0;
+
+  // Maps a pair of pooled sets (superset, subset) to the pooled union of the two.
+  // The keys are kept alive by Sets_, which is never shrunk without also clearing the cache.
+  std::unordered_map<
+      std::pair<const PointsToSet *, const PointsToSet *>,
+      std::shared_ptr<PointsToSet>,
+      util::Hash<std::pair<const PointsToSet *, const PointsToSet *>>>
+      UnionCache_;
+};
+
+}
+
+#endif // JLM_LLVM_OPT_ALIAS_ANALYSES_POINTSTOSET_HPP
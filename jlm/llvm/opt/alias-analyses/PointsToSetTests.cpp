@@ -0,0 +1,169 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jlm/llvm/opt/alias-analyses/PointsToSet.hpp>
+
+#include <memory>
+#include <vector>
+
+TEST(PointsToSetTests, RepresentationsAgree)
+{
+  using namespace jlm::llvm::aa;
+
+  for (auto representation :
+       { PointsToSet::Representation::HashSet, PointsToSet::Representation::SparseBitVector })
+  {
+    // Arrange
+    PointsToSet set1(representation);
+    PointsToSet set2(representation);
+    set1.insert(3);
+    set1.insert(500);
+    set2.insert(3);
+    set2.insert(4);
+    set2.insert(2000);
+
+    // Act
+    std::vector<PointerObjectIndex> newItems;
+    const auto modified = set1.UnionWith(
+        set2,
+        [&](PointerObjectIndex item)
+        {
+          newItems.push_back(item);
+        });
+
+    // Assert
+    EXPECT_EQ(set1.GetRepresentation(), representation);
+    EXPECT_TRUE(modified);
+    EXPECT_EQ(newItems.size(), 2u);
+    EXPECT_EQ(set1.Size(), 4u);
+    EXPECT_TRUE(set1.Contains(2000));
+    EXPECT_FALSE(set1.Contains(5));
+    EXPECT_EQ(set1, (PointsToSet{ 3, 4, 500, 2000 }));
+    EXPECT_TRUE(set2.IsSubsetOf(set1));
+
+    PointsToSet set3(representation);
+    set3.insert(7);
+    EXPECT_TRUE(set3.UnionWithAndClear(set1));
+    EXPECT_TRUE(set1.IsEmpty());
+    EXPECT_EQ(set3, (PointsToSet{ 3, 4, 7, 500, 2000 }));
+
+    PointsToSet set4(representation);
+    set4.insert(4);
+    set4.insert(7);
+    set4.insert(9);
+    set4.IntersectWith(set3);
+    EXPECT_EQ(set4, (PointsToSet{ 4, 7 }));
+
+    set3.DifferenceWith(set4);
+    EXPECT_EQ(set3, (PointsToSet{ 3, 500, 2000 }));
+  }
+}
+
+TEST(PointsToSetTests, SetRepresentation)
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  PointsToSet set{ 1, 200, 30 };
+
+  // Act
+  set.SetRepresentation(PointsToSet::Representation::SparseBitVector);
+
+  // Assert
+  EXPECT_EQ(set.GetRepresentation(), PointsToSet::Representation::SparseBitVector);
+  EXPECT_EQ(set, (PointsToSet{ 1, 30, 200 }));
+
+  std::vector<PointerObjectIndex> items(set.Items().begin(), set.Items().end());
+  EXPECT_EQ(items, (std::vector<PointerObjectIndex>{ 1, 30, 200 }));
+}
+
+TEST(PointsToSetTests, PointsToSetPool)
+{
+  using namespace jlm::llvm::aa;
+
+  for (auto representation :
+       { PointsToSet::Representation::HashSet, PointsToSet::Representation::SparseBitVector })
+  {
+    // Arrange
+    PointsToSetPool pool(representation);
+    auto set1 = std::make_shared<PointsToSet>(representation);
+    set1->insert(1);
+    set1->insert(2);
+    auto set2 = std::make_shared<PointsToSet>(representation);
+    set2->insert(2);
+    set2->insert(1);
+    auto set3 = std::make_shared<PointsToSet>(representation);
+    set3->insert(3);
+
+    // Act
+    pool.Intern(set1);
+    pool.Intern(set2);
+
+    // Assert that identical sets are deduplicated
+    EXPECT_EQ(set1, set2);
+    EXPECT_TRUE(pool.IsPooled(*set1));
+    EXPECT_FALSE(pool.IsPooled(*set3));
+    EXPECT_EQ(pool.GetEmptySet()->GetRepresentation(), representation);
+
+    // Act
+    auto union1 = pool.Union(set1, set3);
+    auto union2 = pool.Union(set2, set3);
+
+    // Assert that the second union is a cache hit, returning the same set
+    EXPECT_TRUE(pool.IsPooled(*set3));
+    EXPECT_EQ(*union1, (PointsToSet{ 1, 2, 3 }));
+    EXPECT_EQ(union1, union2);
+    EXPECT_EQ(pool.NumCachedUnions(), 1u);
+
+    // Assert that unions that add nothing return the superset
+    EXPECT_EQ(pool.Union(union1, set3), union1);
+    auto emptySet = pool.GetEmptySet();
+    EXPECT_EQ(pool.Union(set1, emptySet), set1);
+
+    // Act
+    union1.reset();
+    union2.reset();
+    emptySet.reset();
+    const auto numRemoved = pool.Purge();
+
+    // Assert that only the union was removed, as the other sets are still in use
+    EXPECT_EQ(numRemoved, 1u);
+    EXPECT_EQ(pool.NumCachedUnions(), 0u);
+    EXPECT_EQ(pool.NumSets(), 3u);
+  }
+}
+
+TEST(PointsToSetTests, PointsToSetPoolEviction)
+{
+  using namespace jlm::llvm::aa;
+
+  for (auto representation :
+       { PointsToSet::Representation::HashSet, PointsToSet::Representation::SparseBitVector })
+  {
+    // Arrange
+    PointsToSetPool pool(representation);
+    auto accumulated = pool.GetEmptySet();
+
+    // Act by growing a set one item at a time, leaving an intermediate union behind each time
+    for (PointerObjectIndex n = 0; n < 1000; n++)
+    {
+      auto item = std::make_shared<PointsToSet>(representation);
+      item->insert(n);
+      accumulated = pool.Union(accumulated, item);
+      pool.EvictUnusedSets();
+    }
+
+    // Assert that the hashes derived for the unions match, and that unused sets were evicted
+    PointsToSet expected(representation);
+    for (PointerObjectIndex n = 0; n < 1000; n++)
+      expected.insert(n);
+    auto expectedSet = std::make_shared<PointsToSet>(expected);
+    pool.Intern(expectedSet);
+    EXPECT_EQ(expectedSet, accumulated);
+    EXPECT_LT(pool.NumSets(), 200u);
+  }
+}
@@ -23,6 +23,7 @@
 #include <jlm/rvsdg/simple-node.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 #include <jlm/util/common.hpp>
+#include <jlm/util/Parallel.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/TarjanScc.hpp>
 #include <jlm/util/Worklist.hpp>
@@ -88,6 +89,7 @@ class RegionAwareModRefSummarizer::Statistics final : public util::Statistics
   static constexpr auto NumFunctionsCallingSetjmp_ = "#FunctionsCallingSetjmp";
   static constexpr auto NumCallGraphSccsCanCallExternal_ = "#CallGraphSccsCanCallExternal";
   static constexpr auto NumReadOnlyMemoryNodesDetectedLabel_ = "#ReadOnlyMemoryNodesDetected";
+  static constexpr auto NumThreadsLabel_ = "#Threads";
 
   static constexpr auto NumModRefSetsMaterializedLabel_ = "#ModRefSetsMaterialized";
   static constexpr auto ModRefSetSizeBeforeMaterializationLabel_ =
@@ -111,7 +113,10 @@ class RegionAwareModRefSummarizer::Statistics final : public util::Statistics
 public:
   ~Statistics() override = default;
 
-  explicit Statistics(const rvsdg::RvsdgModule & rvsdgModule, const PointsToGraph & pointsToGraph)
+  Statistics(
+      const rvsdg::RvsdgModule & rvsdgModule,
+      const PointsToGraph & pointsToGraph,
+      size_t numThreads)
       : util::Statistics(Id::RegionAwareModRefSummarizer, rvsdgModule.SourceFilePath().value())
   {
     AddMeasurement(Label::NumRvsdgNodes, rvsdg::nnodes(&rvsdgModule.Rvsdg().GetRootRegion()));
@@ -119,6 +124,7 @@ public:
         NumRvsdgRegionsLabel_,
         rvsdg::Region::NumRegions(rvsdgModule.Rvsdg().GetRootRegion()));
     AddMeasurement(Label::NumPointsToGraphMemoryNodes, pointsToGraph.numMemoryNodes());
+    AddMeasurement(NumThreadsLabel_, numThreads);
   }
 
   void
@@ -225,9 +231,12 @@ public:
   }
 
   static std::unique_ptr<Statistics>
-  Create(const rvsdg::RvsdgModule & rvsdgModule, const PointsToGraph & pointsToGraph)
+  Create(
+      const rvsdg::RvsdgModule & rvsdgModule,
+      const PointsToGraph & pointsToGraph,
+      size_t numThreads)
   {
-    return std::make_unique<Statistics>(rvsdgModule, pointsToGraph);
+    return std::make_unique<Statistics>(rvsdgModule, pointsToGraph, numThreads);
   }
 };
 
@@ -773,6 +782,44 @@ private:
   std::unordered_map<const rvsdg::Node *, ModRefSetIndex> nodeMap_;
 };
 
+/**
+ * Constraints created while annotating functions. Each annotation thread has its own arena,
+ * so annotating functions concurrently needs no synchronization.
+ * The arenas are merged into the constraint graph once all functions are annotated.
+ */
+struct RegionAwareModRefSummarizer::AnnotationArena
+{
+  void
+  addSimpleConstraint(ModRefSetIndex from, ModRefSetIndex to)
+  {
+    SimpleConstraints.emplace_back(from, to);
+  }
+
+  void
+  addBlocklist(ModRefSetIndex index, const util::HashSet<PointsToGraph::NodeIndex> & blocklist)
+  {
+    Blocklists.emplace_back(index, &blocklist);
+  }
+
+  /**
+   * Simple constraints from -> to, in the order they were created.
+   */
+  std::vector<std::pair<ModRefSetIndex, ModRefSetIndex>> SimpleConstraints;
+
+  /**
+   * Blocklists for \ref ModRefSet%s, in the order they were created.
+   */
+  std::vector<std::pair<ModRefSetIndex, const util::HashSet<PointsToGraph::NodeIndex> *>>
+      Blocklists;
+
+  /**
+   * Used for blocking simple allocas from being propagated to the ModRefSet of calls
+   * where none of the call's arguments can reach the simple alloca.
+   * The sets are placed in a deque, since references to elements stay valid.
+   */
+  std::deque<util::HashSet<PointsToGraph::NodeIndex>> CallBlocklists;
+};
+
 /**
  * Struct holding temporary data used during the creation of a single mod/ref summary
  */
@@ -845,11 +892,10 @@ struct RegionAwareModRefSummarizer::Context
       NonReentrantAllocas;
 
   /**
-   * Used for blocking simple allocas from being propagated to the ModRefSet of calls
-   * where none of the call's arguments can reach the simple alloca.
-   * The sets are placed in a deque, since references to elements stay valid.
+   * The arenas used by the annotation threads. They own the call blocklists,
+   * so they must stay alive until solving is finished.
    */
-  std::deque<util::HashSet<PointsToGraph::NodeIndex>> CallBlocklists;
+  std::vector<AnnotationArena> AnnotationArenas;
 
   /**
    * Simple edges in the ModRefSet constraint graph.
@@ -918,7 +964,7 @@ RegionAwareModRefSummarizer::SummarizeModRefs(
 {
   ModRefSummary_ = RegionAwareModRefSummary::Create(pointsToGraph);
   Context_ = std::make_unique<Context>(pointsToGraph);
-  auto statistics = Statistics::Create(rvsdgModule, pointsToGraph);
+  auto statistics = Statistics::Create(rvsdgModule, pointsToGraph, numThreads_);
 
   statistics->startCallGraphStatistics();
   createCallGraph(rvsdgModule);
@@ -935,18 +981,14 @@ RegionAwareModRefSummarizer::SummarizeModRefs(
   statistics->StopCreateNonReentrantAllocaSetsStatistics(numNonReentrantAllocas);
 
   statistics->StartAnnotationStatistics();
-  // Go through and recursively annotate all functions, regions and nodes
-  for (const auto & scc : Context_->SccFunctions)
-  {
-    for (const auto lambda : scc.Items())
-    {
-      AnnotateFunction(*lambda);
-    }
-  }
+  annotateFunctions();
   statistics->StopAnnotationStatistics();
 
   statistics->StartSolvingStatistics();
-  SolveModRefSetConstraintGraph();
+  if (numThreads_ > 1)
+    solveModRefSetConstraintGraphInParallel();
+  else
+    SolveModRefSetConstraintGraph();
   statistics->StopSolvingStatistics();
 
   // Print debug output
@@ -1058,7 +1100,7 @@ RegionAwareModRefSummarizer::createCallGraph(const rvsdg::RvsdgModule & rvsdgMod
     const auto targetPtgNode = pointsToGraph.getNodeForRegister(*target);
 
     // Go through all locations the called function pointer may target
-    for (const auto calleePtgNode : pointsToGraph.getExplicitTargets(targetPtgNode).Items())
+    for (const auto calleePtgNode : pointsToGraph.getExplicitTargets(targetPtgNode))
     {
       const auto kind = pointsToGraph.getNodeKind(calleePtgNode);
       if (kind == PointsToGraph::NodeKind::LambdaNode)
@@ -1192,7 +1234,7 @@ RegionAwareModRefSummarizer::CreateSimpleAllocaSet(const PointsToGraph & pointsT
     notSimple.pop();
 
     // Any node targeted by the not-simple memory node can themselves not be simple
-    for (const auto targetPtgNode : pointsToGraph.getExplicitTargets(ptgNode).Items())
+    for (const auto targetPtgNode : pointsToGraph.getExplicitTargets(ptgNode))
     {
       // If the target is currently in the simple allocas candiate set, move it to the queue
       if (simpleAllocas.Remove(targetPtgNode))
@@ -1215,7 +1257,7 @@ RegionAwareModRefSummarizer::getReachableSimpleAllocas(std::queue<PointsToGraph:
     const auto ptgNode = nodes.front();
     nodes.pop();
 
-    for (const auto targetPtgNode : pointsToGraph.getExplicitTargets(ptgNode).Items())
+    for (const auto targetPtgNode : pointsToGraph.getExplicitTargets(ptgNode))
     {
       // We only are about following simple allocas, as simple allocas are only reachable from them.
       if (!Context_->SimpleAllocas.Contains(targetPtgNode))
@@ -1336,6 +1378,97 @@ RegionAwareModRefSummarizer::CreateNonReentrantAllocaSets()
   return numNonReentrantAllocas;
 }
 
+/**
+ * @return true if the given simple node is represented by a \ref ModRefSet, otherwise false.
+ * These are the nodes handled by RegionAwareModRefSummarizer::AnnotateSimpleNode().
+ */
+static bool
+hasModRefSet(const rvsdg::SimpleNode & simpleNode)
+{
+  const auto & operation = simpleNode.GetOperation();
+  return is<LoadOperation>(operation) || is<StoreOperation>(operation)
+      || is<AllocaOperation>(operation) || is<MallocOperation>(operation)
+      || is<FreeOperation>(operation) || is<MemCpyOperation>(operation)
+      || is<MemSetOperation>(operation) || is<MemMoveOperation>(operation)
+      || is<CallOperation>(operation);
+}
+
+void
+RegionAwareModRefSummarizer::createModRefSetsInFunction(const rvsdg::LambdaNode & lambda)
+{
+  // Creates sets in the same order as the annotation visits the nodes
+  const std::function<void(const rvsdg::StructuralNode &)> createSets =
+      [&](const rvsdg::StructuralNode & structuralNode)
+  {
+    (void)ModRefSummary_->getOrCreateSetForNode(structuralNode, lambda);
+
+    for (auto & subregion : structuralNode.Subregions())
+    {
+      for (auto & node : subregion.Nodes())
+      {
+        rvsdg::MatchTypeOrFail(
+            node,
+            [&](const rvsdg::StructuralNode & innerStructuralNode)
+            {
+              createSets(innerStructuralNode);
+            },
+            [&](const rvsdg::SimpleNode & simpleNode)
+            {
+              if (hasModRefSet(simpleNode))
+                (void)ModRefSummary_->getOrCreateSetForNode(simpleNode, lambda);
+            });
+      }
+    }
+  };
+
+  createSets(lambda);
+}
+
+void
+RegionAwareModRefSummarizer::annotateFunctions()
+{
+  std::vector<const rvsdg::LambdaNode *> functions;
+  for (const auto & scc : Context_->SccFunctions)
+  {
+    for (const auto lambda : scc.Items())
+    {
+      createModRefSetsInFunction(*lambda);
+      functions.push_back(lambda);
+    }
+  }
+
+  // Go through and recursively annotate all functions, regions and nodes.
+  // Each function only modifies its own ModRefSets, all other state goes to the thread's arena.
+  Context_->AnnotationArenas.resize(std::max<size_t>(1, std::min(numThreads_, functions.size())));
+  util::parallelForEach(
+      numThreads_,
+      functions.size(),
+      [&](size_t workerIndex, size_t functionIndex)
+      {
+        AnnotateFunction(*functions[functionIndex], Context_->AnnotationArenas[workerIndex]);
+      });
+
+  // Merge the arenas. Which thread annotated a function is not deterministic,
+  // so the constraints are sorted to make the solver independent of the number of threads.
+  std::vector<std::pair<ModRefSetIndex, ModRefSetIndex>> simpleConstraints;
+  for (auto & arena : Context_->AnnotationArenas)
+  {
+    simpleConstraints.insert(
+        simpleConstraints.end(),
+        arena.SimpleConstraints.begin(),
+        arena.SimpleConstraints.end());
+    arena.SimpleConstraints.clear();
+
+    for (auto [index, blocklist] : arena.Blocklists)
+      AddModRefSetBlocklist(index, *blocklist);
+    arena.Blocklists.clear();
+  }
+
+  std::sort(simpleConstraints.begin(), simpleConstraints.end());
+  for (auto [from, to] : simpleConstraints)
+    AddModRefSimpleConstraint(from, to);
+}
+
 void
 RegionAwareModRefSummarizer::AddModRefSimpleConstraint(ModRefSetIndex from, ModRefSetIndex to)
 {
@@ -1356,9 +1489,11 @@ RegionAwareModRefSummarizer::AddModRefSetBlocklist(
 }
 
 void
-RegionAwareModRefSummarizer::AnnotateFunction(const rvsdg::LambdaNode & lambda)
+RegionAwareModRefSummarizer::AnnotateFunction(
+    const rvsdg::LambdaNode & lambda,
+    AnnotationArena & arena)
 {
-  const auto modRefSet = AnnotateStructuralNode(lambda, lambda);
+  const auto modRefSet = AnnotateStructuralNode(lambda, lambda, arena);
 
   if (Context_->FunctionsCallingSetjmp.Contains(&lambda))
   {
@@ -1366,7 +1501,7 @@ RegionAwareModRefSummarizer::AnnotateFunction(const rvsdg::LambdaNode & lambda)
     // sequentialized with calls to external functions, in case the trigger jumps
     // TODO: This edge could in theory only propagate Mod info, and turn it into Ref info,
     // since calls to longjmp only need to be sequentialized with stores
-    AddModRefSimpleConstraint(modRefSet, ModRefSummary_->getExternModRefSet());
+    arena.addSimpleConstraint(modRefSet, ModRefSummary_->getExternModRefSet());
   }
 
   // If the function is externally available, it can be called by external functions,
@@ -1374,7 +1509,7 @@ RegionAwareModRefSummarizer::AnnotateFunction(const rvsdg::LambdaNode & lambda)
   const auto lambdaPtgNode = Context_->pointsToGraph.getNodeForLambda(lambda);
   if (Context_->pointsToGraph.isExternallyAvailable(lambdaPtgNode))
   {
-    AddModRefSimpleConstraint(modRefSet, ModRefSummary_->getExternModRefSet());
+    arena.addSimpleConstraint(modRefSet, ModRefSummary_->getExternModRefSet());
   }
 }
 
@@ -1382,7 +1517,8 @@ void
 RegionAwareModRefSummarizer::AnnotateRegion(
     const rvsdg::Region & region,
     ModRefSetIndex modRefSet,
-    const rvsdg::LambdaNode & lambda)
+    const rvsdg::LambdaNode & lambda,
+    AnnotationArena & arena)
 {
   for (auto & node : region.Nodes())
   {
@@ -1390,13 +1526,13 @@ RegionAwareModRefSummarizer::AnnotateRegion(
         node,
         [&](const rvsdg::StructuralNode & structuralNode)
         {
-          const auto nodeModRefSet = AnnotateStructuralNode(structuralNode, lambda);
-          AddModRefSimpleConstraint(nodeModRefSet, modRefSet);
+          const auto nodeModRefSet = AnnotateStructuralNode(structuralNode, lambda, arena);
+          arena.addSimpleConstraint(nodeModRefSet, modRefSet);
         },
         [&](const rvsdg::SimpleNode & simpleNode)
         {
-          if (const auto nodeModRefSet = AnnotateSimpleNode(simpleNode, lambda))
-            AddModRefSimpleConstraint(*nodeModRefSet, modRefSet);
+          if (const auto nodeModRefSet = AnnotateSimpleNode(simpleNode, lambda, arena))
+            arena.addSimpleConstraint(*nodeModRefSet, modRefSet);
         });
   }
 }
@@ -1404,21 +1540,22 @@ RegionAwareModRefSummarizer::AnnotateRegion(
 ModRefSetIndex
 RegionAwareModRefSummarizer::AnnotateStructuralNode(
     const rvsdg::StructuralNode & structuralNode,
-    const rvsdg::LambdaNode & lambda)
+    const rvsdg::LambdaNode & lambda,
+    AnnotationArena & arena)
 {
   // The ModRefSet of a structural node is the same as that of its subregion(s)
-  const auto modRefSet = ModRefSummary_->getOrCreateSetForNode(structuralNode, lambda);
+  const auto modRefSet = ModRefSummary_->getSetForNode(structuralNode);
 
   for (auto & subregion : structuralNode.Subregions())
   {
-    AnnotateRegion(subregion, modRefSet, lambda);
+    AnnotateRegion(subregion, modRefSet, lambda, arena);
   }
 
   // Check if this node has any non-reentrant allocas. If so, block them from leaving the node
   if (const auto it = Context_->NonReentrantAllocas.find(&structuralNode);
       it != Context_->NonReentrantAllocas.end() && ENABLE_NON_REENTRANT_ALLOCA_BLOCKLIST)
   {
-    AddModRefSetBlocklist(modRefSet, it->second);
+    arena.addBlocklist(modRefSet, it->second);
   }
 
   return modRefSet;
@@ -1427,7 +1564,8 @@ RegionAwareModRefSummarizer::AnnotateStructuralNode(
 std::optional<ModRefSetIndex>
 RegionAwareModRefSummarizer::AnnotateSimpleNode(
     const rvsdg::SimpleNode & simpleNode,
-    const rvsdg::LambdaNode & lambda)
+    const rvsdg::LambdaNode & lambda,
+    AnnotationArena & arena)
 {
   return MatchTypeWithDefault(
       simpleNode.GetOperation(),
@@ -1465,7 +1603,7 @@ RegionAwareModRefSummarizer::AnnotateSimpleNode(
       },
       [&](const CallOperation &) -> std::optional<ModRefSetIndex>
       {
-        return AnnotateCall(simpleNode, lambda);
+        return AnnotateCall(simpleNode, lambda, arena);
       },
       [&](const MemoryStateOperation &) -> std::optional<ModRefSetIndex>
       {
@@ -1517,7 +1655,7 @@ RegionAwareModRefSummarizer::addPointerOriginTargets(
     }
   }
 
-  for (const auto targetPtgNode : pointsToGraph.getExplicitTargets(registerPtgNode).Items())
+  for (const auto targetPtgNode : pointsToGraph.getExplicitTargets(registerPtgNode))
   {
     // Assert that the PointsToGraph contains no doubled-up pointees
     JLM_ASSERT(
@@ -1532,7 +1670,7 @@ RegionAwareModRefSummarizer::AnnotateLoad(
     const rvsdg::SimpleNode & loadNode,
     const rvsdg::LambdaNode & lambda)
 {
-  const auto nodeModRef = ModRefSummary_->getOrCreateSetForNode(loadNode, lambda);
+  const auto nodeModRef = ModRefSummary_->getSetForNode(loadNode);
   const auto origin = LoadOperation::AddressInput(loadNode).origin();
   const auto loadOperation = util::assertedCast<const LoadOperation>(&loadNode.GetOperation());
   const auto loadSize = GetTypeStoreSize(*loadOperation->GetLoadedType());
@@ -1546,7 +1684,7 @@ RegionAwareModRefSummarizer::AnnotateStore(
     const rvsdg::SimpleNode & storeNode,
     const rvsdg::LambdaNode & lambda)
 {
-  const auto nodeModRef = ModRefSummary_->getOrCreateSetForNode(storeNode, lambda);
+  const auto nodeModRef = ModRefSummary_->getSetForNode(storeNode);
   const auto origin = StoreOperation::AddressInput(storeNode).origin();
   const auto storeOperation = util::assertedCast<const StoreOperation>(&storeNode.GetOperation());
   const auto storeSize = GetTypeStoreSize(storeOperation->GetStoredType());
@@ -1560,7 +1698,7 @@ RegionAwareModRefSummarizer::AnnotateAlloca(
     const rvsdg::SimpleNode & allocaNode,
     const rvsdg::LambdaNode & lambda)
 {
-  const auto nodeModRef = ModRefSummary_->getOrCreateSetForNode(allocaNode, lambda);
+  const auto nodeModRef = ModRefSummary_->getSetForNode(allocaNode);
   const auto allocaMemoryNode = Context_->pointsToGraph.getNodeForAlloca(allocaNode);
   // The alloca itself is only considered to be a ref, since its value is indeterminite,
   // and any users of the alloca will depend on its address output
@@ -1573,7 +1711,7 @@ RegionAwareModRefSummarizer::AnnotateMalloc(
     const rvsdg::SimpleNode & mallocNode,
     const rvsdg::LambdaNode & lambda)
 {
-  const auto nodeModRef = ModRefSummary_->getOrCreateSetForNode(mallocNode, lambda);
+  const auto nodeModRef = ModRefSummary_->getSetForNode(mallocNode);
   const auto mallocMemoryNode = Context_->pointsToGraph.getNodeForMalloc(mallocNode);
   // The malloc itself is only considered to be a ref, since its value is indeterminite,
   // and any users of the malloc will depend on its address output
@@ -1588,7 +1726,7 @@ RegionAwareModRefSummarizer::AnnotateFree(
 {
   JLM_ASSERT(is<FreeOperation>(freeNode.GetOperation()));
 
-  const auto nodeModRef = ModRefSummary_->getOrCreateSetForNode(freeNode, lambda);
+  const auto nodeModRef = ModRefSummary_->getSetForNode(freeNode);
   const auto origin = FreeOperation::addressInput(freeNode).origin();
 
   // TODO: Filter so we only free MallocMemoryNodes
@@ -1603,7 +1741,7 @@ RegionAwareModRefSummarizer::AnnotateMemcpy(
 {
   JLM_ASSERT(is<MemCpyOperation>(memcpyNode.GetOperation()));
 
-  const auto nodeModRef = ModRefSummary_->getOrCreateSetForNode(memcpyNode, lambda);
+  const auto nodeModRef = ModRefSummary_->getSetForNode(memcpyNode);
   const auto dstOrigin = MemCpyOperation::destinationInput(memcpyNode).origin();
   const auto srcOrigin = MemCpyOperation::sourceInput(memcpyNode).origin();
   const auto countOrigin = MemCpyOperation::countInput(memcpyNode).origin();
@@ -1620,7 +1758,7 @@ RegionAwareModRefSummarizer::AnnotateMemmove(
 {
   JLM_ASSERT(is<MemMoveOperation>(memmoveNode.GetOperation()));
 
-  const auto nodeModRef = ModRefSummary_->getOrCreateSetForNode(memmoveNode, lambda);
+  const auto nodeModRef = ModRefSummary_->getSetForNode(memmoveNode);
   const auto dstOrigin = MemMoveOperation::destinationInput(memmoveNode).origin();
   const auto srcOrigin = MemMoveOperation::sourceInput(memmoveNode).origin();
   const auto lengthOrigin = MemMoveOperation::lengthInput(memmoveNode).origin();
@@ -1637,7 +1775,7 @@ RegionAwareModRefSummarizer::AnnotateMemset(
 {
   JLM_ASSERT(is<MemSetOperation>(memsetNode.GetOperation()));
 
-  const auto nodeModRef = ModRefSummary_->getOrCreateSetForNode(memsetNode, lambda);
+  const auto nodeModRef = ModRefSummary_->getSetForNode(memsetNode);
   const auto dstOrigin = MemSetOperation::destinationInput(memsetNode).origin();
   const auto lengthOrigin = MemSetOperation::lengthInput(memsetNode).origin();
   const auto numBytes = tryGetConstantSignedInteger(*lengthOrigin);
@@ -1649,29 +1787,29 @@ RegionAwareModRefSummarizer::AnnotateMemset(
 ModRefSetIndex
 RegionAwareModRefSummarizer::AnnotateCall(
     const rvsdg::SimpleNode & callNode,
-    const rvsdg::LambdaNode & lambda)
+    const rvsdg::LambdaNode & lambda,
+    AnnotationArena & arena)
 {
   JLM_ASSERT(is<CallOperation>(callNode.GetOperation()));
 
   const auto & pointsToGraph = Context_->pointsToGraph;
 
   // This ModRefSet represents everything the call may affect
-  const auto callModRef = ModRefSummary_->getOrCreateSetForNode(callNode, lambda);
+  const auto callModRef = ModRefSummary_->getSetForNode(callNode);
 
   // Go over all possible targets of the call and add them to the call summary
   const auto targetPtr = callNode.input(0)->origin();
   const auto targetPtgNode = Context_->pointsToGraph.getNodeForRegister(*targetPtr);
 
   // Go through all locations the called function pointer may target
-  for (const auto calleePtgNode : pointsToGraph.getExplicitTargets(targetPtgNode).Items())
+  for (const auto calleePtgNode : pointsToGraph.getExplicitTargets(targetPtgNode))
   {
     const auto kind = pointsToGraph.getNodeKind(calleePtgNode);
     if (kind == PointsToGraph::NodeKind::LambdaNode)
     {
       const auto & calleeLambda = pointsToGraph.getLambdaForNode(calleePtgNode);
-      const auto targetModRefSet =
-          ModRefSummary_->getOrCreateSetForNode(calleeLambda, calleeLambda);
-      AddModRefSimpleConstraint(targetModRefSet, callModRef);
+      const auto targetModRefSet = ModRefSummary_->getSetForNode(calleeLambda);
+      arena.addSimpleConstraint(targetModRefSet, callModRef);
     }
     else if (kind == PointsToGraph::NodeKind::ImportNode)
     {
@@ -1689,13 +1827,46 @@ RegionAwareModRefSummarizer::AnnotateCall(
     auto blocklist = Context_->SimpleAllocas;
     blocklist.DifferenceWith(reachableSimpleAllocas);
     // Move the blocklist to the deque to keep it alive during solving
-    Context_->CallBlocklists.push_back(std::move(blocklist));
-    AddModRefSetBlocklist(callModRef, Context_->CallBlocklists.back());
+    arena.CallBlocklists.push_back(std::move(blocklist));
+    arena.addBlocklist(callModRef, arena.CallBlocklists.back());
   }
 
   return callModRef;
 }
 
+bool
+RegionAwareModRefSummarizer::propagateModRefSet(ModRefSetIndex from, ModRefSetIndex to)
+{
+  const RegionAwareModRefSet & fromSet = ModRefSummary_->getModRefSet(from);
+  RegionAwareModRefSet & toSet = ModRefSummary_->getModRefSet(to);
+
+  // Propagate flags first, to enable skipping of doubled-up memory nodes
+  bool changed = toSet.propagateFlags(fromSet);
+
+  if (auto blocklist = Context_->ModRefSetBlocklists.find(to);
+      blocklist != Context_->ModRefSetBlocklists.end())
+  {
+    // The target has a blocklist, avoid propagating blocked memory nodes
+    for (auto [memoryNode, mayMod] : fromSet.getModRefNodes())
+    {
+      if (blocklist->second->Contains(memoryNode))
+        continue;
+
+      changed |= ModRefSummary_->addMemoryNodeToSet(to, memoryNode, mayMod);
+    }
+  }
+  else
+  {
+    // The target does not have a blocklist, so propagate everything
+    for (auto [memoryNode, mayMod] : fromSet.getModRefNodes())
+    {
+      changed |= ModRefSummary_->addMemoryNodeToSet(to, memoryNode, mayMod);
+    }
+  }
+
+  return changed;
+}
+
 void
 RegionAwareModRefSummarizer::SolveModRefSetConstraintGraph()
 {
@@ -1710,42 +1881,125 @@ RegionAwareModRefSummarizer::SolveModRefSetConstraintGraph()
   {
     const auto workItem = worklist.PopWorkItem();
 
-    const RegionAwareModRefSet & fromSet = ModRefSummary_->getModRefSet(workItem);
-
     // Handle all simple constraints workItem -> target
     for (auto target : Context_->ModRefSetSimpleConstraints[workItem].Items())
     {
-      RegionAwareModRefSet & targetSet = ModRefSummary_->getModRefSet(target);
+      if (propagateModRefSet(workItem, target))
+        worklist.PushWorkItem(target);
+    }
+  }
 
-      // Propagate flags first, to enable skipping of doubled-up memory nodes
-      bool changed = targetSet.propagateFlags(fromSet);
+  JLM_ASSERT(VerifyBlocklists());
+}
 
-      if (auto blocklist = Context_->ModRefSetBlocklists.find(target);
-          blocklist != Context_->ModRefSetBlocklists.end())
-      {
-        // The target has a blocklist, avoid propagating blocked memory nodes
-        for (auto [memoryNode, mayMod] : fromSet.getModRefNodes())
-        {
-          if (blocklist->second->Contains(memoryNode))
-            continue;
+void
+RegionAwareModRefSummarizer::solveModRefSetConstraintGraphInParallel()
+{
+  // Levels with fewer SCCs than this are solved on a single thread,
+  // as starting threads would cost more than solving the SCCs
+  static constexpr size_t MinSccsPerParallelLevel = 4;
 
-          changed |= ModRefSummary_->addMemoryNodeToSet(target, memoryNode, mayMod);
-        }
+  const auto numModRefSets = ModRefSummary_->NumModRefSets();
+  const auto numSccs = Context_->SccFunctions.size();
+  const auto externModRefSet = ModRefSummary_->getExternModRefSet();
+  Context_->ModRefSetSimpleConstraints.resize(numModRefSets);
+
+  // The call graph SCC of the function each ModRefSet belongs to.
+  // The set representing external functions belongs to no SCC, and gets the value numSccs.
+  std::vector<size_t> modRefSetScc(numModRefSets, numSccs);
+  std::vector<std::vector<ModRefSetIndex>> sccModRefSets(numSccs);
+  for (size_t scc = 0; scc < numSccs; scc++)
+  {
+    for (const auto lambda : Context_->SccFunctions[scc].Items())
+    {
+      for (const auto modRefSet : ModRefSummary_->getAllSetsInFunction(*lambda))
+      {
+        modRefSetScc[modRefSet] = scc;
+        sccModRefSets[scc].push_back(modRefSet);
       }
-      else
+    }
+  }
+
+  // Constraints between SCCs are handled by the SCC they point into, before it starts solving.
+  // Constraints into the set representing external functions are handled after all SCCs.
+  std::vector<std::vector<std::pair<ModRefSetIndex, ModRefSetIndex>>> incomingConstraints(
+      numSccs);
+  std::vector<ModRefSetIndex> externModRefSetSources;
+  for (ModRefSetIndex from = 0; from < numModRefSets; from++)
+  {
+    for (const auto to : Context_->ModRefSetSimpleConstraints[from].Items())
+    {
+      if (to == externModRefSet)
       {
-        // The target does not have a blocklist, so propagate everything
-        for (auto [memoryNode, mayMod] : fromSet.getModRefNodes())
-        {
-          changed |= ModRefSummary_->addMemoryNodeToSet(target, memoryNode, mayMod);
-        }
+        externModRefSetSources.push_back(from);
+        continue;
       }
 
-      if (changed)
-        worklist.PushWorkItem(target);
+      const auto fromScc = modRefSetScc[from];
+      const auto toScc = modRefSetScc[to];
+      if (fromScc == toScc)
+        continue;
+
+      // SCCs are in reverse topological order, and constraints go from callees to callers
+      JLM_ASSERT(fromScc < toScc);
+      incomingConstraints[toScc].emplace_back(from, to);
     }
   }
 
+  // Group the SCCs into levels, where each SCC only depends on SCCs in earlier levels
+  std::vector<size_t> sccLevel(numSccs, 0);
+  std::vector<std::vector<size_t>> levels;
+  for (size_t scc = 0; scc < numSccs; scc++)
+  {
+    for (const auto & [from, _] : incomingConstraints[scc])
+      sccLevel[scc] = std::max(sccLevel[scc], sccLevel[modRefSetScc[from]] + 1);
+
+    if (sccLevel[scc] >= levels.size())
+      levels.resize(sccLevel[scc] + 1);
+    levels[sccLevel[scc]].push_back(scc);
+  }
+
+  // Solves a single SCC. Only the ModRefSets of the SCC are modified,
+  // and all other ModRefSets that are read belong to SCCs that are already solved.
+  const auto solveScc = [&](size_t scc)
+  {
+    for (const auto & [from, to] : incomingConstraints[scc])
+      propagateModRefSet(from, to);
+
+    util::TwoPhaseLrfWorklist<ModRefSetIndex> worklist;
+    for (const auto modRefSet : sccModRefSets[scc])
+      worklist.PushWorkItem(modRefSet);
+
+    while (worklist.HasMoreWorkItems())
+    {
+      const auto workItem = worklist.PopWorkItem();
+      for (const auto target : Context_->ModRefSetSimpleConstraints[workItem].Items())
+      {
+        if (modRefSetScc[target] != scc)
+          continue;
+
+        if (propagateModRefSet(workItem, target))
+          worklist.PushWorkItem(target);
+      }
+    }
+  };
+
+  for (const auto & level : levels)
+  {
+    const auto levelThreads = level.size() >= MinSccsPerParallelLevel ? numThreads_ : 1;
+    util::parallelForEach(
+        levelThreads,
+        level.size(),
+        [&](size_t, size_t index)
+        {
+          solveScc(level[index]);
+        });
+  }
+
+  // The set representing external functions has no outgoing constraints, so one pass is enough
+  for (const auto from : externModRefSetSources)
+    propagateModRefSet(from, externModRefSet);
+
   JLM_ASSERT(VerifyBlocklists());
 }
 
@@ -52,6 +52,11 @@ using ModRefSetIndex = uint32_t;
  * if possible. Compression is done on a per-function basis, and is possible when a memory node's
  * effects is always a subset of the effects on the external node, across all sets in the function.
  *
+ * Steps 4 and 5 can use several threads, see setNumThreads(). Annotation creates the Mod/Ref sets
+ * of all functions up front, so the functions can then be annotated concurrently. Solving is done
+ * one call graph SCC at a time, in dependency order. SCCs whose callees are all solved are
+ * independent, and are solved concurrently. The result is identical to the sequential solver.
+ *
  * In a previous version of this class, alloca blocking was done based on SCCs in the call graph.
  * Given a function call where the caller is in a different SCC than the callee,
  * any alloca defined in the callee's SCC can be blocked from being propagated to the call.
@@ -65,6 +70,7 @@ class RegionAwareModRefSummarizer final : public ModRefSummarizer
 public:
   class Statistics;
   struct Context;
+  struct AnnotationArena;
 
   ~RegionAwareModRefSummarizer() noexcept override;
 
@@ -107,6 +113,25 @@ public:
   static std::unique_ptr<ModRefSummary>
   Create(const rvsdg::RvsdgModule & rvsdgModule, const PointsToGraph & pointsToGraph);
 
+  /**
+   * Sets the maximum number of threads used for annotating functions and solving the
+   * Mod/Ref set constraint graph. The default is 1, which uses the sequential solver.
+   *
+   * @param numThreads the maximum number of threads. Must be at least 1.
+   */
+  void
+  setNumThreads(size_t numThreads) noexcept
+  {
+    JLM_ASSERT(numThreads > 0);
+    numThreads_ = numThreads;
+  }
+
+  [[nodiscard]] size_t
+  getNumThreads() const noexcept
+  {
+    return numThreads_;
+  }
+
 private:
   /**
    * Creates a call graph including all functions in the module, and groups all functions into SCCs.
@@ -176,6 +201,22 @@ private:
   size_t
   CreateNonReentrantAllocaSets();
 
+  /**
+   * Creates the \ref ModRefSet%s of the given \p lambda, its structural nodes and all simple
+   * nodes with memory effects. All sets are created before annotation starts, so that functions
+   * can be annotated concurrently.
+   */
+  void
+  createModRefSetsInFunction(const rvsdg::LambdaNode & lambda);
+
+  /**
+   * Annotates all functions, using up to numThreads_ threads.
+   * The constraints created by each thread are collected in separate arenas,
+   * and are added to the constraint graph in a deterministic order once all threads are done.
+   */
+  void
+  annotateFunctions();
+
   /**
    * Adds the fact that everything in the ModRefSet \p from should also be included
    * in the ModRefSet \p to.
@@ -203,7 +244,7 @@ private:
    * The flow of MemoryNodes between sets is modeled by adding edges to the constraint graph.
    */
   void
-  AnnotateFunction(const rvsdg::LambdaNode & lambda);
+  AnnotateFunction(const rvsdg::LambdaNode & lambda, AnnotationArena & arena);
 
   /**
    * Recursive call used to make the given region, its nodes and its subregions all
@@ -211,20 +252,26 @@ private:
    * @param region the region whose operations should be represented by the \ref ModRefSet
    * @param modRefSet the index of the \ref ModRefSet used to represent the region
    * @param lambda the function this region belongs to
+   * @param arena the arena where created constraints are collected
    */
   void
   AnnotateRegion(
       const rvsdg::Region & region,
       ModRefSetIndex modRefSet,
-      const rvsdg::LambdaNode & lambda);
+      const rvsdg::LambdaNode & lambda,
+      AnnotationArena & arena);
 
   ModRefSetIndex
   AnnotateStructuralNode(
       const rvsdg::StructuralNode & structuralNode,
-      const rvsdg::LambdaNode & lambda);
+      const rvsdg::LambdaNode & lambda,
+      AnnotationArena & arena);
 
   std::optional<ModRefSetIndex>
-  AnnotateSimpleNode(const rvsdg::SimpleNode & simpleNode, const rvsdg::LambdaNode & lambda);
+  AnnotateSimpleNode(
+      const rvsdg::SimpleNode & simpleNode,
+      const rvsdg::LambdaNode & lambda,
+      AnnotationArena & arena);
 
   /**
    * Helper function for filling ModRefSets based on the pointer being operated on
@@ -265,7 +312,18 @@ private:
   AnnotateMemmove(const rvsdg::SimpleNode & memmoveNode, const rvsdg::LambdaNode & lambda);
 
   ModRefSetIndex
-  AnnotateCall(const rvsdg::SimpleNode & callNode, const rvsdg::LambdaNode & lambda);
+  AnnotateCall(
+      const rvsdg::SimpleNode & callNode,
+      const rvsdg::LambdaNode & lambda,
+      AnnotationArena & arena);
+
+  /**
+   * Propagates flags and memory nodes along the simple constraint \p from -> \p to,
+   * skipping memory nodes on the blocklist of \p to.
+   * @return true if the ModRefSet \p to changed, otherwise false.
+   */
+  bool
+  propagateModRefSet(ModRefSetIndex from, ModRefSetIndex to);
 
   /**
    * Uses the simple and complex constraints to propagate MemoryNodes between ModRefSets
@@ -274,6 +332,18 @@ private:
   void
   SolveModRefSetConstraintGraph();
 
+  /**
+   * Solves the constraint graph one call graph SCC at a time, using up to numThreads_ threads.
+   *
+   * Constraints between sets in different SCCs always go from the lambda of a callee to a call,
+   * or into the set representing external functions. An SCC can therefore be solved once all
+   * SCCs containing its callees are solved. SCCs are grouped into levels, where every SCC only
+   * depends on SCCs in earlier levels, and the SCCs of a level are solved concurrently.
+   * The set representing external functions has no outgoing constraints, and is solved last.
+   */
+  void
+  solveModRefSetConstraintGraphInParallel();
+
   /**
    * For all ModRefSets where a blocklist is defined,
    * checks that none of the MemoryNodes from the blocklist have been added to the ModRefSet.
@@ -335,6 +405,8 @@ private:
   std::unique_ptr<RegionAwareModRefSummary> ModRefSummary_;
 
   std::unique_ptr<Context> Context_;
+
+  size_t numThreads_ = 1;
 };
 
 }
@@ -1815,3 +1815,84 @@ TEST(RegionAwareModRefSummarizerTests, TestStatistics)
   EXPECT_TRUE(statistics.HasTimer("SolvingTimer"));
   EXPECT_TRUE(statistics.HasTimer("ModRefSetMaterializationTimer"));
 }
+
+// Collects the ModRefSets of all nodes in the region, and its subregions, that have one
+static void
+collectModRefSets(
+    const jlm::rvsdg::Region & region,
+    const jlm::llvm::aa::ModRefSummary & modRefSummary,
+    std::vector<const jlm::llvm::aa::ModRefSet *> & modRefSets)
+{
+  for (auto & node : region.Nodes())
+  {
+    if (const auto lambda = dynamic_cast<const jlm::rvsdg::LambdaNode *>(&node))
+      modRefSets.push_back(&modRefSummary.GetLambdaEntryModRef(*lambda));
+    else if (const auto gamma = dynamic_cast<const jlm::rvsdg::GammaNode *>(&node))
+      modRefSets.push_back(&modRefSummary.GetGammaEntryModRef(*gamma));
+    else if (const auto theta = dynamic_cast<const jlm::rvsdg::ThetaNode *>(&node))
+      modRefSets.push_back(&modRefSummary.GetThetaModRef(*theta));
+    else if (const auto simpleNode = dynamic_cast<const jlm::rvsdg::SimpleNode *>(&node))
+    {
+      if (jlm::rvsdg::is<jlm::llvm::LoadOperation>(simpleNode)
+          || jlm::rvsdg::is<jlm::llvm::StoreOperation>(simpleNode)
+          || jlm::rvsdg::is<jlm::llvm::CallOperation>(simpleNode)
+          || jlm::rvsdg::is<jlm::llvm::AllocaOperation>(simpleNode))
+        modRefSets.push_back(&modRefSummary.GetSimpleNodeModRef(*simpleNode));
+    }
+
+    if (const auto structuralNode = dynamic_cast<const jlm::rvsdg::StructuralNode *>(&node))
+    {
+      for (auto & subregion : structuralNode->Subregions())
+        collectModRefSets(subregion, modRefSummary, modRefSets);
+    }
+  }
+}
+
+TEST(RegionAwareModRefSummarizerTests, TestParallelSummarization)
+{
+  const auto summarizeAndCompare = [](jlm::llvm::RvsdgTest & test)
+  {
+    // Arrange
+    const auto pointsToGraph = RunAndersen(test.module());
+    const auto & rootRegion = test.graph().GetRootRegion();
+
+    jlm::llvm::aa::RegionAwareModRefSummarizer sequentialSummarizer;
+    jlm::llvm::aa::RegionAwareModRefSummarizer parallelSummarizer;
+    parallelSummarizer.setNumThreads(4);
+    jlm::util::StatisticsCollector statisticsCollector;
+
+    // Act
+    const auto sequentialSummary =
+        sequentialSummarizer.SummarizeModRefs(test.module(), *pointsToGraph, statisticsCollector);
+    const auto parallelSummary =
+        parallelSummarizer.SummarizeModRefs(test.module(), *pointsToGraph, statisticsCollector);
+
+    // Assert
+    std::vector<const jlm::llvm::aa::ModRefSet *> sequentialModRefSets;
+    std::vector<const jlm::llvm::aa::ModRefSet *> parallelModRefSets;
+    collectModRefSets(rootRegion, *sequentialSummary, sequentialModRefSets);
+    collectModRefSets(rootRegion, *parallelSummary, parallelModRefSets);
+
+    ASSERT_EQ(sequentialModRefSets.size(), parallelModRefSets.size());
+    EXPECT_FALSE(sequentialModRefSets.empty());
+    for (size_t n = 0; n < sequentialModRefSets.size(); n++)
+    {
+      EXPECT_EQ(
+          sequentialModRefSets[n]->getModRefNodes(),
+          parallelModRefSets[n]->getModRefNodes());
+    }
+  };
+
+  jlm::llvm::CallTest2 callTest;
+  summarizeAndCompare(callTest);
+  jlm::llvm::IndirectCallTest2 indirectCallTest;
+  summarizeAndCompare(indirectCallTest);
+  jlm::llvm::GammaTest2 gammaTest;
+  summarizeAndCompare(gammaTest);
+  jlm::llvm::PhiTest2 phiTest;
+  summarizeAndCompare(phiTest);
+  jlm::llvm::EscapedMemoryTest2 escapedMemoryTest;
+  summarizeAndCompare(escapedMemoryTest);
+  jlm::llvm::EscapingLocalFunctionTest escapingLocalFunctionTest;
+  summarizeAndCompare(escapingLocalFunctionTest);
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/rvsdg/AnalysisManager.hpp>
+#include <jlm/rvsdg/structural-node.hpp>
+#include <jlm/rvsdg/Transformation.hpp>
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace jlm::rvsdg
+{
+
+static thread_local AnalysisManager * CurrentAnalysisManager = nullptr;
+
+AnalysisManager::CurrentScope::CurrentScope(AnalysisManager * analysisManager) noexcept
+    : previous_(CurrentAnalysisManager)
+{
+  CurrentAnalysisManager = analysisManager;
+}
+
+AnalysisManager::CurrentScope::~CurrentScope() noexcept
+{
+  CurrentAnalysisManager = previous_;
+}
+
+AnalysisManager::~AnalysisManager() noexcept = default;
+
+AnalysisManager::AnalysisManager(const Region & rootRegion)
+    : RootRegion_(rootRegion),
+      ChangeLog_(std::make_unique<ChangeLog>(rootRegion))
+{}
+
+AnalysisManager *
+AnalysisManager::current() noexcept
+{
+  return CurrentAnalysisManager;
+}
+
+bool
+AnalysisManager::isObserving(const Region & region) const noexcept
+{
+  if (isSuspended())
+    return false;
+
+  auto currentRegion = &region;
+  while (currentRegion->node() != nullptr)
+    currentRegion = currentRegion->node()->region();
+
+  return currentRegion == &RootRegion_;
+}
+
+/**
+ * Inserts \p region and all the regions it is nested in into \p regions.
+ */
+static void
+InsertWithAncestors(const Region * region, std::unordered_set<const Region *> & regions)
+{
+  while (region != nullptr && regions.insert(region).second)
+    region = region->node() ? region->node()->region() : nullptr;
+}
+
+void
+AnalysisManager::commitChanges(const Transformation & transformation)
+{
+  JLM_ASSERT(!isSuspended());
+  discardInvalidResults(&transformation);
+}
+
+void
+AnalysisManager::suspend()
+{
+  JLM_ASSERT(!isSuspended());
+  discardInvalidResults(nullptr);
+  ChangeLog_.reset();
+
+  // The ancestors of the cached regions are recorded while they are certainly alive
+  for (auto & [region, regionResults] : Results_)
+  {
+    regionResults.ancestors.clear();
+    for (auto node = region->node(); node != nullptr; node = node->region()->node())
+      regionResults.ancestors.push_back(node->region());
+  }
+}
+
+void
+AnalysisManager::resume(
+    const Transformation & transformation,
+    const std::vector<const Region *> & modifiedRegions)
+{
+  JLM_ASSERT(isSuspended());
+
+  std::unordered_set<const Region *> changedRegions;
+  for (const auto region : modifiedRegions)
+    InsertWithAncestors(region, changedRegions);
+
+  const std::unordered_set<const Region *> modifiedRegionSet(
+      modifiedRegions.begin(),
+      modifiedRegions.end());
+  for (auto it = Results_.begin(); it != Results_.end();)
+  {
+    auto & [region, regionResults] = *it;
+    const auto isNestedInModifiedRegion = std::any_of(
+        regionResults.ancestors.begin(),
+        regionResults.ancestors.end(),
+        [&](const Region * ancestor)
+        {
+          return modifiedRegionSet.find(ancestor) != modifiedRegionSet.end();
+        });
+    regionResults.ancestors.clear();
+
+    if (isNestedInModifiedRegion)
+    {
+      it = Results_.erase(it);
+      continue;
+    }
+
+    if (changedRegions.find(region) != changedRegions.end())
+      discardUnpreservedResults(regionResults, &transformation);
+
+    if (regionResults.results.empty())
+      it = Results_.erase(it);
+    else
+      ++it;
+  }
+
+  ChangeLog_ = std::make_unique<ChangeLog>(RootRegion_);
+}
+
+void
+AnalysisManager::clear() noexcept
+{
+  Results_.clear();
+  if (ChangeLog_)
+    ChangeLog_->clear();
+}
+
+void
+AnalysisManager::discardUnpreservedResults(
+    RegionResults & regionResults,
+    const Transformation * transformation)
+{
+  auto & results = regionResults.results;
+  for (auto it = results.begin(); it != results.end();)
+  {
+    if (transformation && transformation->PreservesAnalysis(it->first))
+      ++it;
+    else
+      it = results.erase(it);
+  }
+}
+
+void
+AnalysisManager::discardInvalidResults(const Transformation * transformation)
+{
+  if (ChangeLog_->isEmpty())
+    return;
+
+  // A changed region invalidates the results of all regions it is nested in
+  std::unordered_set<const Region *> changedRegions;
+  for (const auto region : ChangeLog_->modifiedRegions())
+    InsertWithAncestors(region, changedRegions);
+
+  for (auto it = Results_.begin(); it != Results_.end();)
+  {
+    auto & [region, regionResults] = *it;
+
+    // The region is destroyed with its node, and its address might already be reused
+    if (regionResults.node && ChangeLog_->isDestroyed(regionResults.node))
+    {
+      it = Results_.erase(it);
+      continue;
+    }
+
+    if (changedRegions.find(region) != changedRegions.end())
+      discardUnpreservedResults(regionResults, transformation);
+
+    if (regionResults.results.empty())
+      it = Results_.erase(it);
+    else
+      ++it;
+  }
+
+  ChangeLog_->clear();
+}
+
+}
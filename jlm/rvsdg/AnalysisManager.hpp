@@ -0,0 +1,276 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_RVSDG_ANALYSISMANAGER_HPP
+#define JLM_RVSDG_ANALYSISMANAGER_HPP
+
+#include <jlm/rvsdg/ChangeLog.hpp>
+#include <jlm/util/common.hpp>
+
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace jlm::rvsdg
+{
+
+class Transformation;
+
+/**
+ * \brief Caches the results of RVSDG analyses and invalidates them when the RVSDG changes.
+ *
+ * An analysis is a type that provides the type of its result and a function that computes the
+ * result for a region:
+ *
+ * \code{.cpp}
+ * struct MyAnalysis
+ * {
+ *   using Result = MyAnalysisResult;
+ *
+ *   static std::shared_ptr<Result>
+ *   compute(rvsdg::Region & region);
+ * };
+ * \endcode
+ *
+ * The compute function might return nullptr if the analysis has no result for a region. A result
+ * computed for a region may only depend on the region and its subregions, while analyses of entire
+ * modules are computed for the root region.
+ *
+ * The manager observes the changes to the root region and all its subregions. Whenever a result is
+ * requested, the cached results of all changed regions and their ancestors are discarded, as well
+ * as the results of destroyed regions. The changes a transformation made are committed after the
+ * transformation with commitChanges(), which keeps the results of the analyses the transformation
+ * preserves.
+ *
+ * The manager is not thread-safe. A manager is made current for the calling thread with
+ * AnalysisManager::CurrentScope, and transformations request analyses from the current manager
+ * with getResultOrCompute(). While other threads modify the RVSDG, the manager must be suspended
+ * with suspend() and resumed with resume() afterwards.
+ *
+ * \note Subregions that are removed from structural nodes that stay alive are not observable, and
+ * their cached results are not discarded.
+ *
+ * \see ChangeLog
+ * \see Transformation::PreservesAnalysis()
+ */
+class AnalysisManager final
+{
+  struct RegionResults
+  {
+    const Node * node;
+    std::unordered_map<std::type_index, std::shared_ptr<void>> results;
+
+    // The regions the region is nested in, which are only recorded while the manager is suspended
+    std::vector<const Region *> ancestors;
+  };
+
+public:
+  /**
+   * Makes an analysis manager current for the calling thread for the lifetime of the scope. The
+   * previously current manager is restored at the end of the scope.
+   */
+  class CurrentScope final
+  {
+  public:
+    explicit CurrentScope(AnalysisManager * analysisManager) noexcept;
+
+    ~CurrentScope() noexcept;
+
+    CurrentScope(const CurrentScope &) = delete;
+
+    CurrentScope &
+    operator=(const CurrentScope &) = delete;
+
+  private:
+    AnalysisManager * previous_;
+  };
+
+  ~AnalysisManager() noexcept;
+
+  /**
+   * Starts observing the changes to \p rootRegion and all its subregions.
+   */
+  explicit AnalysisManager(const Region & rootRegion);
+
+  AnalysisManager(const AnalysisManager &) = delete;
+
+  AnalysisManager &
+  operator=(const AnalysisManager &) = delete;
+
+  /**
+   * @return The analysis manager that is current for the calling thread, or nullptr.
+   */
+  [[nodiscard]] static AnalysisManager *
+  current() noexcept;
+
+  /**
+   * @return The root region whose changes the manager observes.
+   */
+  [[nodiscard]] const Region &
+  rootRegion() const noexcept
+  {
+    return RootRegion_;
+  }
+
+  /**
+   * @return True if \p region is the root region of the manager or one of its subregions, and the
+   * manager is not suspended, otherwise false.
+   */
+  [[nodiscard]] bool
+  isObserving(const Region & region) const noexcept;
+
+  /**
+   * Returns the result of \p AnalysisType for \p region. The result is computed if it is not
+   * cached.
+   *
+   * @tparam AnalysisType The analysis.
+   * @param region The region the result is computed for.
+   * @return The result, or nullptr if the analysis has no result for \p region.
+   */
+  template<class AnalysisType>
+  std::shared_ptr<typename AnalysisType::Result>
+  getResult(Region & region)
+  {
+    JLM_ASSERT(!isSuspended());
+    discardInvalidResults(nullptr);
+
+    auto & regionResults = Results_[&region];
+    regionResults.node = region.node();
+
+    const std::type_index analysis(typeid(AnalysisType));
+    if (const auto it = regionResults.results.find(analysis); it != regionResults.results.end())
+    {
+      NumReusedResults_++;
+      return std::static_pointer_cast<typename AnalysisType::Result>(it->second);
+    }
+
+    // The analysis must not change the region, as its result would be discarded immediately
+    auto result = AnalysisType::compute(region);
+    JLM_ASSERT(ChangeLog_->isEmpty());
+
+    NumComputedResults_++;
+    Results_[&region].results[analysis] = result;
+    return result;
+  }
+
+  /**
+   * Returns the result of \p AnalysisType for \p region from the current analysis manager. If no
+   * manager is current, or the current manager does not observe \p region, then the result is
+   * computed without caching it.
+   *
+   * @see getResult()
+   */
+  template<class AnalysisType>
+  static std::shared_ptr<typename AnalysisType::Result>
+  getResultOrCompute(Region & region)
+  {
+    const auto analysisManager = current();
+    if (analysisManager && analysisManager->isObserving(region))
+      return analysisManager->template getResult<AnalysisType>(region);
+
+    return AnalysisType::compute(region);
+  }
+
+  /**
+   * @return True if a result of \p AnalysisType for \p region is cached, otherwise false.
+   */
+  template<class AnalysisType>
+  [[nodiscard]] bool
+  isCached(const Region & region)
+  {
+    if (!isSuspended())
+      discardInvalidResults(nullptr);
+
+    const auto it = Results_.find(&region);
+    return it != Results_.end()
+        && it->second.results.find(typeid(AnalysisType)) != it->second.results.end();
+  }
+
+  /**
+   * Commits the changes \p transformation made to the module since the last commit. The cached
+   * results of changed regions are discarded, except for the analyses \p transformation
+   * preserves.
+   */
+  void
+  commitChanges(const Transformation & transformation);
+
+  /**
+   * Stops observing the RVSDG until the next call to resume(). The changes since the last commit
+   * are committed without preserving any analysis.
+   */
+  void
+  suspend();
+
+  /**
+   * Resumes observing the RVSDG after \p transformation changed \p modifiedRegions while the
+   * manager was suspended. The cached results of the modified regions and their ancestors are
+   * discarded, except for the analyses \p transformation preserves. The results of all regions
+   * nested in the modified regions are discarded, as they might have been destroyed.
+   */
+  void
+  resume(
+      const Transformation & transformation,
+      const std::vector<const Region *> & modifiedRegions);
+
+  /**
+   * @return True if the manager is suspended, otherwise false.
+   */
+  [[nodiscard]] bool
+  isSuspended() const noexcept
+  {
+    return ChangeLog_ == nullptr;
+  }
+
+  /**
+   * Discards all cached results.
+   */
+  void
+  clear() noexcept;
+
+  /**
+   * @return The number of results that were computed.
+   */
+  [[nodiscard]] size_t
+  numComputedResults() const noexcept
+  {
+    return NumComputedResults_;
+  }
+
+  /**
+   * @return The number of requests that were served from the cache.
+   */
+  [[nodiscard]] size_t
+  numReusedResults() const noexcept
+  {
+    return NumReusedResults_;
+  }
+
+private:
+  /**
+   * Discards the results of all regions that were destroyed, as well as the results of all regions
+   * that changed and their ancestors since the last call. The results of the analyses that
+   * \p transformation preserves are kept for regions that are still alive.
+   */
+  void
+  discardInvalidResults(const Transformation * transformation);
+
+  /**
+   * Discards the results in \p regionResults of all analyses that \p transformation does not
+   * preserve, or all results if \p transformation is nullptr.
+   */
+  static void
+  discardUnpreservedResults(RegionResults & regionResults, const Transformation * transformation);
+
+  const Region & RootRegion_;
+  std::unique_ptr<ChangeLog> ChangeLog_;
+  std::unordered_map<const Region *, RegionResults> Results_{};
+  size_t NumComputedResults_ = 0;
+  size_t NumReusedResults_ = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,236 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jlm/rvsdg/AnalysisManager.hpp>
+#include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/TestNodes.hpp>
+#include <jlm/rvsdg/TestOperations.hpp>
+#include <jlm/rvsdg/TestType.hpp>
+#include <jlm/rvsdg/Transformation.hpp>
+
+/**
+ * Analysis that counts the nodes of a region.
+ */
+struct NumNodesAnalysis
+{
+  using Result = size_t;
+
+  static std::shared_ptr<Result>
+  compute(jlm::rvsdg::Region & region)
+  {
+    return std::make_shared<Result>(region.numNodes());
+  }
+};
+
+/**
+ * Analysis that has no result for any region.
+ */
+struct EmptyAnalysis
+{
+  using Result = int;
+
+  static std::shared_ptr<Result>
+  compute(jlm::rvsdg::Region &)
+  {
+    return nullptr;
+  }
+};
+
+/**
+ * Transformation that preserves NumNodesAnalysis, but does nothing.
+ */
+class PreservingTransformation final : public jlm::rvsdg::Transformation
+{
+public:
+  PreservingTransformation()
+      : Transformation("PreservingTransformation")
+  {}
+
+  void
+  Run(jlm::rvsdg::RvsdgModule &, jlm::util::StatisticsCollector &) override
+  {}
+
+  [[nodiscard]] bool
+  PreservesAnalysis(const std::type_index & analysis) const noexcept override
+  {
+    return analysis == typeid(NumNodesAnalysis);
+  }
+};
+
+TEST(AnalysisManagerTests, ReusesResults)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  TestOperation::createNode(&rootRegion, {}, { TestType::createValueType() });
+
+  AnalysisManager analysisManager(rootRegion);
+
+  // Act
+  const auto result1 = analysisManager.getResult<NumNodesAnalysis>(rootRegion);
+  const auto result2 = analysisManager.getResult<NumNodesAnalysis>(rootRegion);
+  const auto emptyResult1 = analysisManager.getResult<EmptyAnalysis>(rootRegion);
+  const auto emptyResult2 = analysisManager.getResult<EmptyAnalysis>(rootRegion);
+
+  // Assert
+  EXPECT_EQ(*result1, 1u);
+  EXPECT_EQ(result1, result2);
+  EXPECT_EQ(emptyResult1, nullptr);
+  EXPECT_EQ(emptyResult2, nullptr);
+  EXPECT_TRUE(analysisManager.isCached<NumNodesAnalysis>(rootRegion));
+  EXPECT_TRUE(analysisManager.isCached<EmptyAnalysis>(rootRegion));
+  EXPECT_EQ(analysisManager.numComputedResults(), 2u);
+  EXPECT_EQ(analysisManager.numReusedResults(), 2u);
+
+  analysisManager.clear();
+  EXPECT_FALSE(analysisManager.isCached<NumNodesAnalysis>(rootRegion));
+}
+
+TEST(AnalysisManagerTests, DiscardsResultsOfChangedRegionsAndTheirAncestors)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  const auto valueType = TestType::createValueType();
+
+  auto structuralNode = TestStructuralNode::create(&rootRegion, 2);
+  auto & subregion0 = *structuralNode->subregion(0);
+  auto & subregion1 = *structuralNode->subregion(1);
+
+  AnalysisManager analysisManager(rootRegion);
+  analysisManager.getResult<NumNodesAnalysis>(rootRegion);
+  analysisManager.getResult<NumNodesAnalysis>(subregion0);
+  analysisManager.getResult<NumNodesAnalysis>(subregion1);
+
+  // Act
+  TestOperation::createNode(&subregion0, {}, { valueType });
+
+  // Assert
+  EXPECT_FALSE(analysisManager.isCached<NumNodesAnalysis>(rootRegion));
+  EXPECT_FALSE(analysisManager.isCached<NumNodesAnalysis>(subregion0));
+  EXPECT_TRUE(analysisManager.isCached<NumNodesAnalysis>(subregion1));
+  EXPECT_EQ(*analysisManager.getResult<NumNodesAnalysis>(subregion0), 1u);
+  EXPECT_EQ(analysisManager.numComputedResults(), 4u);
+}
+
+TEST(AnalysisManagerTests, DiscardsResultsOfDestroyedRegions)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+
+  auto structuralNode = TestStructuralNode::create(&rootRegion, 1);
+  auto & subregion = *structuralNode->subregion(0);
+
+  AnalysisManager analysisManager(rootRegion);
+  analysisManager.getResult<NumNodesAnalysis>(subregion);
+
+  // Act
+  rootRegion.removeNode(structuralNode);
+  const auto newStructuralNode = TestStructuralNode::create(&rootRegion, 1);
+
+  // Assert
+  // The new subregion might reuse the address of the destroyed one
+  EXPECT_FALSE(analysisManager.isCached<NumNodesAnalysis>(*newStructuralNode->subregion(0)));
+}
+
+TEST(AnalysisManagerTests, KeepsPreservedResults)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  const auto valueType = TestType::createValueType();
+
+  AnalysisManager analysisManager(rootRegion);
+  analysisManager.getResult<NumNodesAnalysis>(rootRegion);
+  analysisManager.getResult<EmptyAnalysis>(rootRegion);
+
+  // Act
+  TestOperation::createNode(&rootRegion, {}, { valueType });
+  analysisManager.commitChanges(PreservingTransformation());
+
+  // Assert
+  EXPECT_TRUE(analysisManager.isCached<NumNodesAnalysis>(rootRegion));
+  EXPECT_FALSE(analysisManager.isCached<EmptyAnalysis>(rootRegion));
+}
+
+TEST(AnalysisManagerTests, SuspendAndResume)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  const auto valueType = TestType::createValueType();
+
+  auto structuralNode1 = TestStructuralNode::create(&rootRegion, 1);
+  auto structuralNode2 = TestStructuralNode::create(&rootRegion, 1);
+  auto nestedNode = TestStructuralNode::create(structuralNode1->subregion(0), 1);
+  auto & subregion1 = *structuralNode1->subregion(0);
+  auto & subregion2 = *structuralNode2->subregion(0);
+  auto & nestedSubregion = *nestedNode->subregion(0);
+
+  AnalysisManager analysisManager(rootRegion);
+  analysisManager.getResult<NumNodesAnalysis>(rootRegion);
+  analysisManager.getResult<NumNodesAnalysis>(subregion1);
+  analysisManager.getResult<NumNodesAnalysis>(subregion2);
+  analysisManager.getResult<NumNodesAnalysis>(nestedSubregion);
+  analysisManager.getResult<EmptyAnalysis>(subregion1);
+
+  // Act
+  analysisManager.suspend();
+  EXPECT_TRUE(analysisManager.isSuspended());
+  EXPECT_FALSE(analysisManager.isObserving(rootRegion));
+  TestOperation::createNode(&subregion1, {}, { valueType });
+  analysisManager.resume(PreservingTransformation(), { &subregion1 });
+
+  // Assert
+  EXPECT_FALSE(analysisManager.isSuspended());
+  EXPECT_TRUE(analysisManager.isCached<NumNodesAnalysis>(rootRegion));
+  EXPECT_TRUE(analysisManager.isCached<NumNodesAnalysis>(subregion1));
+  EXPECT_FALSE(analysisManager.isCached<EmptyAnalysis>(subregion1));
+  EXPECT_TRUE(analysisManager.isCached<NumNodesAnalysis>(subregion2));
+  EXPECT_FALSE(analysisManager.isCached<NumNodesAnalysis>(nestedSubregion));
+}
+
+TEST(AnalysisManagerTests, CurrentScope)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  Graph otherRvsdg;
+  auto & otherRootRegion = otherRvsdg.GetRootRegion();
+
+  AnalysisManager analysisManager(rootRegion);
+
+  // Act & Assert
+  EXPECT_EQ(AnalysisManager::current(), nullptr);
+  AnalysisManager::getResultOrCompute<NumNodesAnalysis>(rootRegion);
+  EXPECT_FALSE(analysisManager.isCached<NumNodesAnalysis>(rootRegion));
+  {
+    AnalysisManager::CurrentScope scope(&analysisManager);
+    EXPECT_EQ(AnalysisManager::current(), &analysisManager);
+
+    AnalysisManager::getResultOrCompute<NumNodesAnalysis>(rootRegion);
+    EXPECT_TRUE(analysisManager.isCached<NumNodesAnalysis>(rootRegion));
+
+    // Regions of other graphs are not observed by the manager
+    AnalysisManager::getResultOrCompute<NumNodesAnalysis>(otherRootRegion);
+    EXPECT_FALSE(analysisManager.isCached<NumNodesAnalysis>(otherRootRegion));
+  }
+  EXPECT_EQ(AnalysisManager::current(), nullptr);
+}
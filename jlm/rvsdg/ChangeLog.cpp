@@ -0,0 +1,365 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/rvsdg/ChangeLog.hpp>
+#include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/structural-node.hpp>
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace jlm::rvsdg
+{
+
+/**
+ * Observes a region and all its subregions, and appends their changes to a journal that is read
+ * by all change logs sharing the recorder.
+ *
+ * The journal is trimmed once it holds MaxNumChanges changes. At that point, all logs apply the
+ * journaled changes, such that a log that is rarely queried does not keep the journal growing.
+ */
+class ChangeRecorder final
+{
+  class Observer;
+
+  static constexpr size_t MaxNumChanges = 4096;
+
+public:
+  enum class ChangeKind : uint8_t
+  {
+    NodeCreate,
+    NodeDestroy,
+    OutputDestroy,
+    InputChange,
+    InputDestroy,
+    // An input or region result that is destroyed together with its node or region
+    InputRelease,
+    RegionDestroy
+  };
+
+  struct Change
+  {
+    ChangeKind kind;
+    const void * object;
+    const Region * region;
+  };
+
+  ~ChangeRecorder() noexcept;
+
+  explicit ChangeRecorder(const Region & region)
+  {
+    observe(region);
+  }
+
+  ChangeRecorder(const ChangeRecorder &) = delete;
+
+  ChangeRecorder &
+  operator=(const ChangeRecorder &) = delete;
+
+  /**
+   * @return The position in the journal after the last recorded change.
+   */
+  [[nodiscard]] size_t
+  end() const noexcept
+  {
+    return firstChange_ + changes_.size();
+  }
+
+  /**
+   * @return The change at \p position in the journal.
+   */
+  [[nodiscard]] const Change &
+  at(size_t position) const noexcept
+  {
+    JLM_ASSERT(position >= firstChange_ && position < end());
+    return changes_[position - firstChange_];
+  }
+
+  std::mutex &
+  mutex() noexcept
+  {
+    return mutex_;
+  }
+
+  void
+  addLog(const ChangeLog & changeLog)
+  {
+    logs_.insert(&changeLog);
+  }
+
+  void
+  removeLog(const ChangeLog & changeLog)
+  {
+    logs_.erase(&changeLog);
+  }
+
+private:
+  void
+  observe(const Region & region);
+
+  void
+  observeSubregions(const Node & node);
+
+  void
+  record(ChangeKind kind, const void * object, const Region & region);
+
+  void
+  recordNodeCreate(const Node & node, const Region & region);
+
+  void
+  recordNodeDestroy(const Node & node, const Region & region);
+
+  std::mutex mutex_{};
+  std::unordered_map<const Region *, std::unique_ptr<Observer>> observers_{};
+  std::unordered_set<const ChangeLog *> logs_{};
+
+  // The journal, which starts at position firstChange_
+  std::vector<Change> changes_{};
+  size_t firstChange_ = 0;
+};
+
+/**
+ * Forwards the notifications of a single region to its recorder.
+ */
+class ChangeRecorder::Observer final : public RegionObserver
+{
+public:
+  ~Observer() noexcept override = default;
+
+  Observer(const Region & region, ChangeRecorder & recorder)
+      : RegionObserver(region),
+        region_(region),
+        recorder_(recorder)
+  {}
+
+  void
+  onNodeCreate(Node * node) override
+  {
+    std::lock_guard lock(recorder_.mutex_);
+    recorder_.recordNodeCreate(*node, region_);
+  }
+
+  void
+  onNodeDestroy(Node * node) override
+  {
+    std::lock_guard lock(recorder_.mutex_);
+    recorder_.recordNodeDestroy(*node, region_);
+  }
+
+  void
+  onInputCreate(Input * input) override
+  {
+    std::lock_guard lock(recorder_.mutex_);
+    recorder_.record(ChangeKind::InputChange, input, region_);
+  }
+
+  void
+  onInputChange(Input * input, Output *, Output *) override
+  {
+    std::lock_guard lock(recorder_.mutex_);
+    recorder_.record(ChangeKind::InputChange, input, region_);
+  }
+
+  void
+  onInputDestroy(Input * input) override
+  {
+    std::lock_guard lock(recorder_.mutex_);
+    recorder_.record(ChangeKind::InputDestroy, input, region_);
+  }
+
+  void
+  onOutputDestroy(Output * output) override
+  {
+    std::lock_guard lock(recorder_.mutex_);
+    recorder_.record(ChangeKind::OutputDestroy, output, region_);
+  }
+
+private:
+  const Region & region_;
+  ChangeRecorder & recorder_;
+};
+
+ChangeRecorder::~ChangeRecorder() noexcept
+{
+  JLM_ASSERT(logs_.empty());
+}
+
+void
+ChangeRecorder::observe(const Region & region)
+{
+  observers_[&region] = std::make_unique<Observer>(region, *this);
+
+  for (auto & node : region.Nodes())
+    observeSubregions(node);
+}
+
+void
+ChangeRecorder::observeSubregions(const Node & node)
+{
+  if (const auto structuralNode = dynamic_cast<const StructuralNode *>(&node))
+  {
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+      observe(*structuralNode->subregion(n));
+  }
+}
+
+void
+ChangeRecorder::record(ChangeKind kind, const void * object, const Region & region)
+{
+  changes_.push_back({ kind, object, &region });
+  if (changes_.size() < MaxNumChanges)
+    return;
+
+  for (const auto changeLog : logs_)
+    changeLog->updateLocked();
+
+  firstChange_ = end();
+  changes_.clear();
+}
+
+void
+ChangeRecorder::recordNodeCreate(const Node & node, const Region & region)
+{
+  record(ChangeKind::NodeCreate, &node, region);
+
+  // The subregions of a structural node exist, but are still empty at this point
+  observeSubregions(node);
+}
+
+void
+ChangeRecorder::recordNodeDestroy(const Node & node, const Region & region)
+{
+  record(ChangeKind::NodeDestroy, &node, region);
+  for (auto & output : node.Outputs())
+    record(ChangeKind::OutputDestroy, &output, region);
+  for (auto & input : node.Inputs())
+    record(ChangeKind::InputRelease, &input, region);
+
+  // The subregions are destroyed together with the node. Their content is recorded here, as the
+  // notifications from the subregions would arrive after their observers are gone.
+  if (const auto structuralNode = dynamic_cast<const StructuralNode *>(&node))
+  {
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+    {
+      const auto & subregion = *structuralNode->subregion(n);
+      for (const auto argument : subregion.Arguments())
+        record(ChangeKind::OutputDestroy, argument, subregion);
+      for (const auto result : subregion.Results())
+        record(ChangeKind::InputRelease, result, subregion);
+      for (auto & innerNode : subregion.Nodes())
+        recordNodeDestroy(innerNode, subregion);
+
+      observers_.erase(&subregion);
+      record(ChangeKind::RegionDestroy, &subregion, subregion);
+    }
+  }
+}
+
+ChangeLog::~ChangeLog() noexcept
+{
+  std::lock_guard lock(recorder_->mutex());
+  recorder_->removeLog(*this);
+}
+
+ChangeLog::ChangeLog(const Region & region, bool recordDestroyedObjects)
+    : recordDestroyedObjects_(recordDestroyedObjects)
+{
+  auto & graph = *region.graph();
+  if (&region == &graph.GetRootRegion())
+  {
+    recorder_ = graph.changeRecorder_.lock();
+    if (!recorder_)
+    {
+      recorder_ = std::make_shared<ChangeRecorder>(region);
+      graph.changeRecorder_ = recorder_;
+    }
+  }
+  else
+  {
+    recorder_ = std::make_shared<ChangeRecorder>(region);
+  }
+
+  std::lock_guard lock(recorder_->mutex());
+  recorder_->addLog(*this);
+  nextChange_ = recorder_->end();
+}
+
+bool
+ChangeLog::isEmpty() const noexcept
+{
+  std::lock_guard lock(recorder_->mutex());
+  return !hasChanges_ && nextChange_ == recorder_->end();
+}
+
+void
+ChangeLog::clear() noexcept
+{
+  std::lock_guard lock(recorder_->mutex());
+  nextChange_ = recorder_->end();
+  hasChanges_ = false;
+  createdNodes_.clear();
+  destroyedNodes_.clear();
+  destroyedOutputs_.clear();
+  modifiedRegions_.clear();
+  changedInputs_.clear();
+  numInputChanges_ = 0;
+}
+
+void
+ChangeLog::update() const noexcept
+{
+  std::lock_guard lock(recorder_->mutex());
+  updateLocked();
+}
+
+void
+ChangeLog::updateLocked() const noexcept
+{
+  using ChangeKind = ChangeRecorder::ChangeKind;
+
+  const auto end = recorder_->end();
+  for (; nextChange_ < end; nextChange_++)
+  {
+    const auto & [kind, object, region] = recorder_->at(nextChange_);
+    hasChanges_ = true;
+    switch (kind)
+    {
+    case ChangeKind::NodeCreate:
+      modifiedRegions_.insert(region);
+      createdNodes_.insert(static_cast<const Node *>(object));
+      break;
+    case ChangeKind::NodeDestroy:
+      modifiedRegions_.insert(region);
+      createdNodes_.erase(static_cast<const Node *>(object));
+      if (recordDestroyedObjects_)
+        destroyedNodes_.insert(static_cast<const Node *>(object));
+      break;
+    case ChangeKind::OutputDestroy:
+      modifiedRegions_.insert(region);
+      if (recordDestroyedObjects_)
+        destroyedOutputs_.insert(static_cast<const Output *>(object));
+      break;
+    case ChangeKind::InputChange:
+      modifiedRegions_.insert(region);
+      changedInputs_.insert(static_cast<const Input *>(object));
+      numInputChanges_++;
+      break;
+    case ChangeKind::InputDestroy:
+      modifiedRegions_.insert(region);
+      changedInputs_.erase(static_cast<const Input *>(object));
+      numInputChanges_++;
+      break;
+    case ChangeKind::InputRelease:
+      changedInputs_.erase(static_cast<const Input *>(object));
+      break;
+    case ChangeKind::RegionDestroy:
+      modifiedRegions_.erase(region);
+      break;
+    }
+  }
+}
+
+}
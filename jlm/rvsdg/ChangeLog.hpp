@@ -0,0 +1,195 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_RVSDG_CHANGELOG_HPP
+#define JLM_RVSDG_CHANGELOG_HPP
+
+#include <jlm/rvsdg/region.hpp>
+
+#include <memory>
+#include <unordered_set>
+
+namespace jlm::rvsdg
+{
+
+class ChangeRecorder;
+
+/**
+ * \brief Records the changes made to a region and all its subregions.
+ *
+ * The change log observes a region and, recursively, the subregions of all structural nodes in
+ * it, including structural nodes that are created after the log. It records which nodes were
+ * created and destroyed, the outputs and region arguments that were destroyed, either together
+ * with their nodes or by removing them from nodes and regions that stay alive, and the regions
+ * that were modified. Input creations, diversions, and removals are counted, and the inputs that
+ * were created or diverted are recorded as long as they are alive.
+ *
+ * The log is intended for analyses that keep results keyed by node and output addresses between
+ * transformations. As addresses can be reused by new objects after destruction, a key is only
+ * safe to reuse if it was not destroyed since the log started recording.
+ *
+ * All change logs of the root region of a graph share a single recorder, which observes the
+ * regions of the graph and appends every change to a journal. Each log only keeps its position in
+ * the journal, and applies the changes past it to its own sets when it is queried. Creating a log
+ * for the root region is therefore cheap while other logs of the graph exist, and the regions are
+ * only observed once regardless of the number of logs. Logs of other regions use a recorder of
+ * their own.
+ *
+ * Changes may be made concurrently to distinct regions observed by the same log. The log must not
+ * be queried or cleared while changes are made. The sets returned by the queries are updated by
+ * the next query, not by the changes themselves.
+ *
+ * \see RegionObserver
+ */
+class ChangeLog final
+{
+public:
+  ~ChangeLog() noexcept;
+
+  /**
+   * Starts recording the changes to \p region and all its subregions.
+   *
+   * @param region The region whose changes are recorded.
+   * @param recordDestroyedObjects If false, the addresses of destroyed nodes and outputs are not
+   * recorded, which avoids the cost of recording them for clients that only need the created
+   * nodes and changed inputs. isDestroyed() must not be used in this case.
+   */
+  explicit ChangeLog(const Region & region, bool recordDestroyedObjects = true);
+
+  ChangeLog(const ChangeLog &) = delete;
+
+  ChangeLog &
+  operator=(const ChangeLog &) = delete;
+
+  /**
+   * @return True if no change has been recorded, otherwise false.
+   */
+  [[nodiscard]] bool
+  isEmpty() const noexcept;
+
+  /**
+   * @param node The address of a node. It is never dereferenced, and may be dangling.
+   * @return True if a node at the address \p node has been destroyed, otherwise false.
+   */
+  [[nodiscard]] bool
+  isDestroyed(const Node * node) const noexcept
+  {
+    return destroyedNodes().find(node) != destroyedNodes_.end();
+  }
+
+  /**
+   * @param output The address of an output or region argument. It is never dereferenced, and may be
+   * dangling.
+   * @return True if an output at the address \p output has been destroyed, otherwise false.
+   */
+  [[nodiscard]] bool
+  isDestroyed(const Output * output) const noexcept
+  {
+    return destroyedOutputs().find(output) != destroyedOutputs_.end();
+  }
+
+  /**
+   * @return The nodes that were created and are still alive.
+   */
+  [[nodiscard]] const std::unordered_set<const Node *> &
+  createdNodes() const noexcept
+  {
+    update();
+    return createdNodes_;
+  }
+
+  /**
+   * @return The addresses of all destroyed nodes, including the nodes of destroyed subregions.
+   */
+  [[nodiscard]] const std::unordered_set<const Node *> &
+  destroyedNodes() const noexcept
+  {
+    update();
+    return destroyedNodes_;
+  }
+
+  /**
+   * @return The addresses of all destroyed outputs and region arguments.
+   */
+  [[nodiscard]] const std::unordered_set<const Output *> &
+  destroyedOutputs() const noexcept
+  {
+    update();
+    return destroyedOutputs_;
+  }
+
+  /**
+   * @return The regions in which nodes were created or destroyed, outputs or arguments were
+   * removed, or inputs were created, diverted, or removed. Regions that were destroyed are not
+   * included, so all returned regions are alive.
+   */
+  [[nodiscard]] const std::unordered_set<const Region *> &
+  modifiedRegions() const noexcept
+  {
+    update();
+    return modifiedRegions_;
+  }
+
+  /**
+   * @return The inputs and region results that were created or diverted after the creation of
+   * their node, and are still alive. The inputs of created nodes are only included if they were
+   * diverted afterwards.
+   */
+  [[nodiscard]] const std::unordered_set<const Input *> &
+  changedInputs() const noexcept
+  {
+    update();
+    return changedInputs_;
+  }
+
+  /**
+   * @return The number of inputs that were created, diverted, or removed.
+   */
+  [[nodiscard]] size_t
+  numInputChanges() const noexcept
+  {
+    update();
+    return numInputChanges_;
+  }
+
+  /**
+   * Forgets all recorded changes. The log keeps observing the same regions.
+   */
+  void
+  clear() noexcept;
+
+private:
+  /**
+   * Applies the changes the recorder journaled since the last update.
+   */
+  void
+  update() const noexcept;
+
+  /**
+   * Same as update(), but the caller must hold the lock of the recorder.
+   */
+  void
+  updateLocked() const noexcept;
+
+  std::shared_ptr<ChangeRecorder> recorder_;
+  bool recordDestroyedObjects_;
+
+  // The position in the journal of the recorder up to which changes have been applied
+  mutable size_t nextChange_;
+
+  mutable bool hasChanges_ = false;
+  mutable std::unordered_set<const Node *> createdNodes_{};
+  mutable std::unordered_set<const Node *> destroyedNodes_{};
+  mutable std::unordered_set<const Output *> destroyedOutputs_{};
+  mutable std::unordered_set<const Region *> modifiedRegions_{};
+  mutable std::unordered_set<const Input *> changedInputs_{};
+  mutable size_t numInputChanges_ = 0;
+
+  friend class ChangeRecorder;
+};
+
+}
+
+#endif
@@ -0,0 +1,332 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jlm/rvsdg/ChangeLog.hpp>
+#include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/TestNodes.hpp>
+#include <jlm/rvsdg/TestOperations.hpp>
+#include <jlm/rvsdg/TestType.hpp>
+
+TEST(ChangeLogTests, RecordsNodeCreationAndDestruction)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  const auto valueType = TestType::createValueType();
+
+  auto & import = GraphImport::Create(rvsdg, valueType, "import");
+  auto node1 = TestOperation::createNode(&rootRegion, { &import }, { valueType });
+  auto node1Output = node1->output(0);
+
+  const ChangeLog changeLog(rootRegion);
+  EXPECT_TRUE(changeLog.isEmpty());
+
+  // Act
+  auto node2 = TestOperation::createNode(&rootRegion, { &import }, { valueType });
+  auto node3 = TestOperation::createNode(&rootRegion, { node1Output }, { valueType });
+  node3->input(0)->divert_to(node2->output(0));
+  rootRegion.removeNode(node1);
+
+  // Assert
+  EXPECT_FALSE(changeLog.isEmpty());
+  EXPECT_EQ(changeLog.createdNodes().size(), 2u);
+  EXPECT_TRUE(changeLog.createdNodes().find(node2) != changeLog.createdNodes().end());
+  EXPECT_TRUE(changeLog.createdNodes().find(node3) != changeLog.createdNodes().end());
+  EXPECT_EQ(changeLog.destroyedNodes().size(), 1u);
+  EXPECT_TRUE(changeLog.isDestroyed(node1));
+  EXPECT_TRUE(changeLog.isDestroyed(node1Output));
+  EXPECT_FALSE(changeLog.isDestroyed(node2));
+  EXPECT_FALSE(changeLog.isDestroyed(&import));
+  EXPECT_EQ(changeLog.numInputChanges(), 1u);
+}
+
+TEST(ChangeLogTests, ObservesSubregions)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  const auto valueType = TestType::createValueType();
+
+  auto & import = GraphImport::Create(rvsdg, valueType, "import");
+  auto structuralNode1 = TestStructuralNode::create(&rootRegion, 1);
+  auto inputVar1 = structuralNode1->addInputWithArguments(import);
+
+  const ChangeLog changeLog(rootRegion);
+
+  // Act
+  auto innerNode1 =
+      TestOperation::createNode(structuralNode1->subregion(0), { inputVar1.argument[0] }, {});
+
+  auto structuralNode2 = TestStructuralNode::create(&rootRegion, 2);
+  auto innerNode2 = TestOperation::createNode(structuralNode2->subregion(1), {}, { valueType });
+
+  // Assert
+  EXPECT_EQ(changeLog.createdNodes().size(), 3u);
+  EXPECT_TRUE(changeLog.createdNodes().find(innerNode1) != changeLog.createdNodes().end());
+  EXPECT_TRUE(changeLog.createdNodes().find(structuralNode2) != changeLog.createdNodes().end());
+  EXPECT_TRUE(changeLog.createdNodes().find(innerNode2) != changeLog.createdNodes().end());
+  EXPECT_TRUE(changeLog.destroyedNodes().empty());
+}
+
+TEST(ChangeLogTests, RecordsContentOfDestroyedStructuralNodes)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  const auto valueType = TestType::createValueType();
+
+  auto & import = GraphImport::Create(rvsdg, valueType, "import");
+  auto structuralNode = TestStructuralNode::create(&rootRegion, 1);
+  auto inputVar = structuralNode->addInputWithArguments(import);
+  auto innerNode =
+      TestOperation::createNode(structuralNode->subregion(0), { inputVar.argument[0] }, {});
+  auto & output = structuralNode->addOutputOnly(valueType);
+  auto argument = inputVar.argument[0];
+
+  ChangeLog changeLog(rootRegion);
+
+  // Act
+  rootRegion.removeNode(structuralNode);
+
+  // Assert
+  EXPECT_EQ(changeLog.destroyedNodes().size(), 2u);
+  EXPECT_TRUE(changeLog.isDestroyed(structuralNode));
+  EXPECT_TRUE(changeLog.isDestroyed(innerNode));
+  EXPECT_TRUE(changeLog.isDestroyed(&output));
+  EXPECT_TRUE(changeLog.isDestroyed(argument));
+  EXPECT_TRUE(changeLog.createdNodes().empty());
+
+  // Act
+  changeLog.clear();
+
+  // Assert
+  EXPECT_TRUE(changeLog.isEmpty());
+  EXPECT_FALSE(changeLog.isDestroyed(structuralNode));
+
+  // Act
+  auto node = TestOperation::createNode(&rootRegion, { &import }, {});
+
+  // Assert
+  EXPECT_EQ(changeLog.createdNodes().size(), 1u);
+  EXPECT_TRUE(changeLog.createdNodes().find(node) != changeLog.createdNodes().end());
+}
+
+TEST(ChangeLogTests, ModifiedRegions)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  const auto valueType = TestType::createValueType();
+
+  auto & import = GraphImport::Create(rvsdg, valueType, "import");
+  auto structuralNode1 = TestStructuralNode::create(&rootRegion, 2);
+  auto inputVar1 = structuralNode1->addInputWithArguments(import);
+  auto innerNode = TestOperation::createNode(
+      structuralNode1->subregion(0),
+      { inputVar1.argument[0] },
+      { valueType });
+  auto structuralNode2 = TestStructuralNode::create(&rootRegion, 1);
+  auto innerNode2 = TestOperation::createNode(structuralNode2->subregion(0), {}, { valueType });
+
+  ChangeLog changeLog(rootRegion);
+
+  // Act
+  TestOperation::createNode(structuralNode1->subregion(0), { innerNode->output(0) }, {});
+  auto structuralNode3 = TestStructuralNode::create(&rootRegion, 1);
+  TestOperation::createNode(structuralNode3->subregion(0), {}, {});
+  auto structuralNode3Subregion = structuralNode3->subregion(0);
+
+  // Assert
+  auto & modifiedRegions = changeLog.modifiedRegions();
+  EXPECT_EQ(modifiedRegions.size(), 3u);
+  EXPECT_TRUE(modifiedRegions.find(&rootRegion) != modifiedRegions.end());
+  EXPECT_TRUE(modifiedRegions.find(structuralNode1->subregion(0)) != modifiedRegions.end());
+  EXPECT_TRUE(modifiedRegions.find(structuralNode3Subregion) != modifiedRegions.end());
+  EXPECT_TRUE(modifiedRegions.find(structuralNode1->subregion(1)) == modifiedRegions.end());
+  EXPECT_TRUE(modifiedRegions.find(structuralNode2->subregion(0)) == modifiedRegions.end());
+
+  // Act
+  changeLog.clear();
+  RegionResult::Create(*structuralNode2->subregion(0), *innerNode2->output(0), nullptr, valueType);
+
+  // Assert
+  EXPECT_EQ(changeLog.modifiedRegions().size(), 1u);
+  EXPECT_TRUE(
+      changeLog.modifiedRegions().find(structuralNode2->subregion(0))
+      != changeLog.modifiedRegions().end());
+
+  // Act
+  rootRegion.removeNode(structuralNode3);
+
+  // Assert
+  // Destroyed regions are not reported
+  EXPECT_EQ(changeLog.modifiedRegions().size(), 2u);
+  EXPECT_TRUE(changeLog.modifiedRegions().find(&rootRegion) != changeLog.modifiedRegions().end());
+  EXPECT_TRUE(
+      changeLog.modifiedRegions().find(structuralNode3Subregion)
+      == changeLog.modifiedRegions().end());
+}
+
+TEST(ChangeLogTests, ChangedInputs)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  const auto valueType = TestType::createValueType();
+
+  auto & import1 = GraphImport::Create(rvsdg, valueType, "import1");
+  auto & import2 = GraphImport::Create(rvsdg, valueType, "import2");
+  auto node1 = TestOperation::createNode(&rootRegion, { &import1 }, { valueType });
+  auto node2 = TestOperation::createNode(&rootRegion, { &import1 }, { valueType });
+  auto structuralNode = TestStructuralNode::create(&rootRegion, 1);
+  auto innerNode = TestOperation::createNode(structuralNode->subregion(0), {}, { valueType });
+
+  ChangeLog changeLog(rootRegion);
+
+  // Act
+  node1->input(0)->divert_to(&import2);
+  node2->input(0)->divert_to(&import2);
+  auto & result = RegionResult::Create(
+      *structuralNode->subregion(0),
+      *innerNode->output(0),
+      nullptr,
+      valueType);
+  auto node3 = TestOperation::createNode(&rootRegion, { &import1 }, {});
+
+  // Assert
+  auto & changedInputs = changeLog.changedInputs();
+  EXPECT_EQ(changedInputs.size(), 3u);
+  EXPECT_TRUE(changedInputs.find(node1->input(0)) != changedInputs.end());
+  EXPECT_TRUE(changedInputs.find(node2->input(0)) != changedInputs.end());
+  EXPECT_TRUE(changedInputs.find(&result) != changedInputs.end());
+  EXPECT_TRUE(changedInputs.find(node3->input(0)) == changedInputs.end());
+
+  // Act
+  rootRegion.removeNode(node2);
+  rootRegion.removeNode(structuralNode);
+
+  // Assert
+  // The inputs of destroyed nodes and regions are not reported
+  EXPECT_EQ(changeLog.changedInputs().size(), 1u);
+  EXPECT_TRUE(changeLog.changedInputs().find(node1->input(0)) != changeLog.changedInputs().end());
+}
+
+TEST(ChangeLogTests, RecordsRemovedOutputsAndArguments)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  const auto valueType = TestType::createValueType();
+
+  auto & import = GraphImport::Create(rvsdg, valueType, "import");
+  auto structuralNode = TestStructuralNode::create(&rootRegion, 1);
+  auto & subregion = *structuralNode->subregion(0);
+  auto & output0 = structuralNode->addOutputOnly(valueType);
+  auto & output1 = structuralNode->addOutputOnly(valueType);
+  auto argument0 = structuralNode->addArguments(valueType).argument[0];
+  auto argument1 = structuralNode->addArguments(valueType).argument[0];
+  TestOperation::createNode(&rootRegion, { &output1 }, {});
+  TestOperation::createNode(&subregion, { argument1 }, {});
+
+  const ChangeLog changeLog(rootRegion);
+
+  // Act
+  structuralNode->RemoveOutputs({ 0, 1 });
+  subregion.RemoveArguments({ 0, 1 });
+
+  // Assert
+  // Only the dead output and argument are removed
+  EXPECT_FALSE(changeLog.isEmpty());
+  EXPECT_TRUE(changeLog.isDestroyed(&output0));
+  EXPECT_FALSE(changeLog.isDestroyed(&output1));
+  EXPECT_TRUE(changeLog.isDestroyed(argument0));
+  EXPECT_FALSE(changeLog.isDestroyed(argument1));
+  EXPECT_FALSE(changeLog.isDestroyed(&import));
+  EXPECT_EQ(changeLog.destroyedOutputs().size(), 2u);
+  EXPECT_TRUE(changeLog.destroyedNodes().empty());
+  EXPECT_EQ(changeLog.modifiedRegions().size(), 2u);
+  EXPECT_TRUE(changeLog.modifiedRegions().find(&subregion) != changeLog.modifiedRegions().end());
+}
+
+TEST(ChangeLogTests, WithoutDestroyedObjects)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  const auto valueType = TestType::createValueType();
+
+  auto & import = GraphImport::Create(rvsdg, valueType, "import");
+  auto node1 = TestOperation::createNode(&rootRegion, { &import }, { valueType });
+
+  ChangeLog changeLog(rootRegion, false);
+
+  // Act
+  rootRegion.removeNode(node1);
+
+  // Assert
+  EXPECT_FALSE(changeLog.isEmpty());
+  EXPECT_TRUE(changeLog.destroyedNodes().empty());
+  EXPECT_TRUE(changeLog.destroyedOutputs().empty());
+  EXPECT_TRUE(changeLog.modifiedRegions().find(&rootRegion) != changeLog.modifiedRegions().end());
+
+  changeLog.clear();
+  EXPECT_TRUE(changeLog.isEmpty());
+}
+
+TEST(ChangeLogTests, SharedRecorder)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  auto & rootRegion = rvsdg.GetRootRegion();
+  const auto valueType = TestType::createValueType();
+
+  auto & import = GraphImport::Create(rvsdg, valueType, "import");
+  auto node1 = TestOperation::createNode(&rootRegion, { &import }, { valueType });
+
+  const ChangeLog changeLog1(rootRegion);
+
+  // Act
+  auto node2 = TestOperation::createNode(&rootRegion, { &import }, { valueType });
+  ChangeLog changeLog2(rootRegion);
+  rootRegion.removeNode(node1);
+
+  // Assert
+  // Both logs share the journal, but only see the changes made after their creation
+  EXPECT_EQ(changeLog1.createdNodes().size(), 1u);
+  EXPECT_TRUE(changeLog1.createdNodes().find(node2) != changeLog1.createdNodes().end());
+  EXPECT_TRUE(changeLog1.isDestroyed(node1));
+  EXPECT_TRUE(changeLog2.createdNodes().empty());
+  EXPECT_TRUE(changeLog2.isDestroyed(node1));
+
+  // Act
+  changeLog2.clear();
+  for (size_t n = 0; n < 10000; n++)
+    TestOperation::createNode(&rootRegion, { &import }, {});
+
+  // Assert
+  // Trimming the journal does not lose changes of either log
+  EXPECT_EQ(changeLog1.createdNodes().size(), 10001u);
+  EXPECT_EQ(changeLog2.createdNodes().size(), 10000u);
+  EXPECT_TRUE(changeLog1.isDestroyed(node1));
+  EXPECT_FALSE(changeLog2.isDestroyed(node1));
+}
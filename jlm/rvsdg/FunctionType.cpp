@@ -65,14 +65,14 @@ FunctionType::operator==(const jlm::rvsdg::Type & other) const noexcept
     }
     for (std::size_t n = 0; n < ArgumentTypes_.size(); ++n)
     {
-      if (*ArgumentTypes_[n] != *fn->ArgumentTypes_[n])
+      if (!areTypesEqual(*ArgumentTypes_[n], *fn->ArgumentTypes_[n]))
       {
         return false;
       }
     }
     for (std::size_t n = 0; n < ResultTypes_.size(); ++n)
     {
-      if (*ResultTypes_[n] != *fn->ResultTypes_[n])
+      if (!areTypesEqual(*ResultTypes_[n], *fn->ResultTypes_[n]))
       {
         return false;
       }
@@ -116,7 +116,8 @@ FunctionType::Create(
     std::vector<std::shared_ptr<const jlm::rvsdg::Type>> argumentTypes,
     std::vector<std::shared_ptr<const jlm::rvsdg::Type>> resultTypes)
 {
-  return std::make_shared<FunctionType>(std::move(argumentTypes), std::move(resultTypes));
+  return internType<FunctionType>(
+      std::make_shared<FunctionType>(std::move(argumentTypes), std::move(resultTypes)));
 }
 
 }
@@ -126,3 +126,143 @@ TEST(GraphTests, Copy)
   EXPECT_TRUE(is<jlm::rvsdg::GraphExport>(*copiedResult));
   EXPECT_EQ(copiedResult->origin(), copiedNode->output(0));
 }
+
+TEST(GraphTests, CompactIndices)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto valueType = TestType::createValueType();
+
+  Graph graph;
+  auto & import = GraphImport::Create(graph, valueType, "import");
+  auto node1 = TestOperation::createNode(&graph.GetRootRegion(), { &import }, { valueType });
+  auto structuralNode = TestStructuralNode::create(&graph.GetRootRegion(), 1);
+  auto inputVar = structuralNode->addInputWithArguments(import);
+  auto node2 = TestOperation::createNode(
+      structuralNode->subregion(0),
+      { inputVar.argument[0] },
+      { valueType });
+  auto node3 = TestOperation::createNode(&graph.GetRootRegion(), { &import }, { valueType });
+  GraphExport::Create(*node3->output(0), "export");
+
+  EXPECT_EQ(graph.numNodeIndices(), 4u);
+  EXPECT_EQ(graph.numOutputIndices(), 5u);
+  EXPECT_NE(node1->getGraphIndex(), node2->getGraphIndex());
+
+  // Act
+  graph.GetRootRegion().removeNode(node1);
+  graph.compactIndices();
+
+  // Assert
+  EXPECT_EQ(graph.numNodeIndices(), 3u);
+  EXPECT_EQ(graph.numOutputIndices(), 4u);
+
+  std::vector<bool> nodeIndices(graph.numNodeIndices(), false);
+  const std::vector<Node *> nodes = { structuralNode, node2, node3 };
+  for (const auto node : nodes)
+  {
+    EXPECT_LT(node->getGraphIndex(), nodeIndices.size());
+    EXPECT_FALSE(nodeIndices[node->getGraphIndex()]);
+    nodeIndices[node->getGraphIndex()] = true;
+  }
+
+  std::vector<bool> outputIndices(graph.numOutputIndices(), false);
+  const std::vector<Output *> outputs = {
+    &import,
+    inputVar.argument[0],
+    node2->output(0),
+    node3->output(0),
+  };
+  for (const auto output : outputs)
+  {
+    EXPECT_LT(output->getGraphIndex(), outputIndices.size());
+    EXPECT_FALSE(outputIndices[output->getGraphIndex()]);
+    outputIndices[output->getGraphIndex()] = true;
+  }
+
+  // Act
+  auto node4 = TestOperation::createNode(&graph.GetRootRegion(), { &import }, { valueType });
+
+  // Assert
+  EXPECT_EQ(node4->getGraphIndex(), 3u);
+  EXPECT_EQ(node4->output(0)->getGraphIndex(), 4u);
+}
+
+TEST(GraphTests, EagerDeadNodeCollection)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto valueType = TestType::createValueType();
+
+  Graph graph;
+  auto & rootRegion = graph.GetRootRegion();
+  auto & import = GraphImport::Create(graph, valueType, "import");
+
+  auto structuralNode = TestStructuralNode::create(&rootRegion, 1);
+  auto inputVar = structuralNode->addInputWithArguments(import);
+  auto outputVar = structuralNode->addOutputWithResults({ inputVar.argument[0] });
+
+  auto node1 = TestOperation::createNode(&rootRegion, { &import }, { valueType });
+  auto node2 = TestOperation::createNode(
+      &rootRegion,
+      { node1->output(0), node1->output(0), outputVar.output },
+      { valueType });
+  auto & export1 = GraphExport::Create(*node2->output(0), "export1");
+
+  graph.enableEagerDeadNodeCollection(true);
+
+  // Act
+  export1.divert_to(&import);
+  const auto numRemovedNodes = graph.collectDeadNodes();
+
+  // Assert
+  // The removal of node2 renders node1 dead, while the dead structural node is left alone
+  EXPECT_EQ(numRemovedNodes, 2u);
+  EXPECT_EQ(rootRegion.numNodes(), 1u);
+  EXPECT_TRUE(region_contains_node(&rootRegion, structuralNode));
+
+  // Nothing is queued anymore, and disabling the collection leaves dead nodes in place
+  EXPECT_EQ(graph.collectDeadNodes(), 0u);
+  graph.enableEagerDeadNodeCollection(false);
+  auto node3 = TestOperation::createNode(&rootRegion, { &import }, { valueType });
+  auto & export2 = GraphExport::Create(*node3->output(0), "export2");
+  export2.divert_to(&import);
+  EXPECT_EQ(graph.collectDeadNodes(), 0u);
+  EXPECT_TRUE(region_contains_node(&rootRegion, node3));
+}
+
+TEST(GraphTests, EagerDeadNodeCollectionInDestroyedRegion)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto valueType = TestType::createValueType();
+
+  Graph graph;
+  auto & rootRegion = graph.GetRootRegion();
+  auto & import = GraphImport::Create(graph, valueType, "import");
+
+  auto structuralNode = TestStructuralNode::create(&rootRegion, 1);
+  auto inputVar = structuralNode->addInputWithArguments(import);
+  auto innerNode = TestOperation::createNode(
+      structuralNode->subregion(0),
+      { inputVar.argument[0] },
+      { valueType });
+  auto & result = RegionResult::Create(
+      *structuralNode->subregion(0),
+      *innerNode->output(0),
+      nullptr,
+      valueType);
+
+  graph.enableEagerDeadNodeCollection(true);
+  result.divert_to(inputVar.argument[0]);
+
+  // Act
+  rootRegion.removeNode(structuralNode);
+
+  // Assert
+  // The queued subregion is dropped from the queue when it is destroyed
+  EXPECT_EQ(graph.collectDeadNodes(), 0u);
+}
@@ -0,0 +1,353 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_RVSDG_NODEMAP_HPP
+#define JLM_RVSDG_NODEMAP_HPP
+
+#include <jlm/rvsdg/graph.hpp>
+#include <jlm/util/common.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace jlm::rvsdg
+{
+
+/**
+ * \brief An array indexed by graph index, split into pages that are allocated on first access.
+ *
+ * Graph indices range over the entire graph, while many side tables only hold the nodes or
+ * outputs of a single region or lambda node. The pages keep the memory of such a table
+ * proportional to the pages that are accessed, plus a page table of one pointer per page.
+ *
+ * @tparam TEntry The type of the entries. Must be default constructible.
+ * @tparam EntriesPerPage The number of entries per page.
+ */
+template<typename TEntry, size_t EntriesPerPage>
+class GraphIndexPages final
+{
+public:
+  /**
+   * @return The entry at \p index, or nullptr if its page has not been allocated.
+   */
+  [[nodiscard]] TEntry *
+  tryGet(size_t index) noexcept
+  {
+    const auto page = pageIndex(index);
+    return page < pages_.size() && pages_[page] ? &pages_[page][index % EntriesPerPage] : nullptr;
+  }
+
+  [[nodiscard]] const TEntry *
+  tryGet(size_t index) const noexcept
+  {
+    const auto page = pageIndex(index);
+    return page < pages_.size() && pages_[page] ? &pages_[page][index % EntriesPerPage] : nullptr;
+  }
+
+  /**
+   * @return The entry at \p index. Its page is allocated with default constructed entries if
+   * needed.
+   */
+  TEntry &
+  getOrCreate(size_t index)
+  {
+    const auto page = pageIndex(index);
+    if (page >= pages_.size())
+      pages_.resize(page + 1);
+    if (!pages_[page])
+      pages_[page] = std::make_unique<TEntry[]>(EntriesPerPage);
+
+    return pages_[page][index % EntriesPerPage];
+  }
+
+  /**
+   * Extends the page table up to \p numIndices, without allocating any pages.
+   */
+  void
+  reserve(size_t numIndices)
+  {
+    pages_.resize(std::max(pages_.size(), pageIndex(numIndices) + 1));
+  }
+
+  void
+  clear() noexcept
+  {
+    pages_.clear();
+  }
+
+private:
+  static constexpr size_t
+  pageIndex(size_t index) noexcept
+  {
+    return index / EntriesPerPage;
+  }
+
+  std::vector<std::unique_ptr<TEntry[]>> pages_{};
+};
+
+/**
+ * \brief A set of nodes or outputs, represented as a bitmap indexed by their graph index.
+ *
+ * In contrast to a hash set of pointers, membership tests are a single bit lookup. The bitmap
+ * is paged and grows on demand, such that nodes and outputs created after the set can be inserted
+ * as well, and a set of the nodes of a single region does not pay for the size of the graph.
+ *
+ * @tparam TKey Either Node or Output.
+ *
+ * \see Node::getGraphIndex()
+ * \see Output::getGraphIndex()
+ */
+template<typename TKey>
+class GraphIndexSet final
+{
+  using Word = uint64_t;
+  static constexpr size_t BitsPerWord = 64;
+  static constexpr size_t WordsPerPage = 64;
+
+public:
+  GraphIndexSet() = default;
+
+  /**
+   * Creates an empty set with a page table for all nodes or outputs currently in \p graph.
+   */
+  explicit GraphIndexSet(const Graph & graph)
+  {
+    words_.reserve(wordIndex(numIndices(graph)));
+  }
+
+  /**
+   * Inserts \p key into the set.
+   *
+   * @return True if \p key was not already in the set, otherwise false.
+   */
+  bool
+  insert(const TKey & key)
+  {
+    const auto index = key.getGraphIndex();
+    auto & word = words_.getOrCreate(wordIndex(index));
+    const auto mask = bitMask(index);
+    if (word & mask)
+      return false;
+
+    word |= mask;
+    size_++;
+    return true;
+  }
+
+  [[nodiscard]] bool
+  contains(const TKey & key) const noexcept
+  {
+    const auto index = key.getGraphIndex();
+    const auto word = words_.tryGet(wordIndex(index));
+    return word && (*word & bitMask(index));
+  }
+
+  /**
+   * Removes \p key from the set.
+   *
+   * @return True if \p key was in the set, otherwise false.
+   */
+  bool
+  erase(const TKey & key) noexcept
+  {
+    const auto index = key.getGraphIndex();
+    const auto word = words_.tryGet(wordIndex(index));
+    if (!word || !(*word & bitMask(index)))
+      return false;
+
+    *word &= ~bitMask(index);
+    size_--;
+    return true;
+  }
+
+  [[nodiscard]] size_t
+  size() const noexcept
+  {
+    return size_;
+  }
+
+  [[nodiscard]] bool
+  isEmpty() const noexcept
+  {
+    return size_ == 0;
+  }
+
+  void
+  clear() noexcept
+  {
+    words_.clear();
+    size_ = 0;
+  }
+
+private:
+  static size_t
+  numIndices(const Graph & graph) noexcept
+  {
+    if constexpr (std::is_base_of_v<Node, TKey>)
+      return graph.numNodeIndices();
+    else
+      return graph.numOutputIndices();
+  }
+
+  static constexpr size_t
+  wordIndex(size_t index) noexcept
+  {
+    return index / BitsPerWord;
+  }
+
+  static constexpr Word
+  bitMask(size_t index) noexcept
+  {
+    return Word(1) << (index % BitsPerWord);
+  }
+
+  GraphIndexPages<Word, WordsPerPage> words_{};
+  size_t size_ = 0;
+};
+
+/**
+ * \brief A map from nodes or outputs to values, stored in a paged array indexed by their graph
+ * index.
+ *
+ * Lookups are plain array accesses. The array grows on demand, such that nodes and outputs created
+ * after the map can be inserted as well. The map is meant for analyses and transformations that
+ * associate state with most nodes or outputs of a graph or region. For associations with a few
+ * scattered nodes or outputs, a hash map is likely the better choice.
+ *
+ * @tparam TKey Either Node or Output.
+ * @tparam TValue The type of the mapped values. Must be default constructible.
+ *
+ * \see GraphIndexSet
+ */
+template<typename TKey, typename TValue>
+class GraphIndexMap final
+{
+  static constexpr size_t ValuesPerPage = 1024;
+
+public:
+  GraphIndexMap() = default;
+
+  /**
+   * Creates an empty map with a page table for all nodes or outputs currently in \p graph.
+   */
+  explicit GraphIndexMap(const Graph & graph)
+      : keys_(graph)
+  {}
+
+  [[nodiscard]] bool
+  contains(const TKey & key) const noexcept
+  {
+    return keys_.contains(key);
+  }
+
+  /**
+   * @return The value mapped to \p key, or nullptr if \p key is not in the map.
+   */
+  [[nodiscard]] TValue *
+  tryLookup(const TKey & key) noexcept
+  {
+    return contains(key) ? values_.tryGet(key.getGraphIndex()) : nullptr;
+  }
+
+  [[nodiscard]] const TValue *
+  tryLookup(const TKey & key) const noexcept
+  {
+    return contains(key) ? values_.tryGet(key.getGraphIndex()) : nullptr;
+  }
+
+  /**
+   * @return The value mapped to \p key.
+   *
+   * \pre \p key is in the map.
+   */
+  [[nodiscard]] const TValue &
+  lookup(const TKey & key) const noexcept
+  {
+    JLM_ASSERT(contains(key));
+    return *values_.tryGet(key.getGraphIndex());
+  }
+
+  /**
+   * Maps \p key to \p value, unless \p key is already in the map.
+   *
+   * @return The value mapped to \p key, and true if \p key was inserted, otherwise false.
+   */
+  std::pair<TValue &, bool>
+  tryEmplace(const TKey & key, TValue value)
+  {
+    auto & mappedValue = values_.getOrCreate(key.getGraphIndex());
+    const auto inserted = keys_.insert(key);
+    if (inserted)
+      mappedValue = std::move(value);
+
+    return { mappedValue, inserted };
+  }
+
+  /**
+   * @return The value mapped to \p key. A default constructed value is inserted if \p key is not
+   * in the map.
+   */
+  TValue &
+  operator[](const TKey & key)
+  {
+    return tryEmplace(key, TValue()).first;
+  }
+
+  /**
+   * Removes \p key from the map.
+   *
+   * @return True if \p key was in the map, otherwise false.
+   */
+  bool
+  erase(const TKey & key)
+  {
+    if (!keys_.erase(key))
+      return false;
+
+    *values_.tryGet(key.getGraphIndex()) = TValue();
+    return true;
+  }
+
+  [[nodiscard]] size_t
+  size() const noexcept
+  {
+    return keys_.size();
+  }
+
+  [[nodiscard]] bool
+  isEmpty() const noexcept
+  {
+    return keys_.isEmpty();
+  }
+
+  void
+  clear() noexcept
+  {
+    keys_.clear();
+    values_.clear();
+  }
+
+private:
+  GraphIndexSet<TKey> keys_{};
+  GraphIndexPages<TValue, ValuesPerPage> values_{};
+};
+
+using NodeBitSet = GraphIndexSet<Node>;
+
+using OutputBitSet = GraphIndexSet<Output>;
+
+template<typename TValue>
+using NodeMap = GraphIndexMap<Node, TValue>;
+
+template<typename TValue>
+using OutputMap = GraphIndexMap<Output, TValue>;
+
+}
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/NodeMap.hpp>
+#include <jlm/rvsdg/TestOperations.hpp>
+#include <jlm/rvsdg/TestType.hpp>
+
+#include <string>
+
+TEST(NodeMapTests, NodeBitSet)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  const auto valueType = TestType::createValueType();
+
+  auto & import = GraphImport::Create(rvsdg, valueType, "import");
+  auto node1 = TestOperation::createNode(&rvsdg.GetRootRegion(), { &import }, { valueType });
+  auto node2 = TestOperation::createNode(&rvsdg.GetRootRegion(), { &import }, { valueType });
+
+  NodeBitSet nodes(rvsdg);
+
+  // Act & Assert
+  EXPECT_TRUE(nodes.isEmpty());
+  EXPECT_TRUE(nodes.insert(*node1));
+  EXPECT_FALSE(nodes.insert(*node1));
+  EXPECT_TRUE(nodes.contains(*node1));
+  EXPECT_FALSE(nodes.contains(*node2));
+  EXPECT_EQ(nodes.size(), 1u);
+
+  // Nodes created after the set can be inserted as well
+  std::vector<Node *> newNodes;
+  for (size_t n = 0; n < 100; n++)
+    newNodes.push_back(
+        TestOperation::createNode(&rvsdg.GetRootRegion(), { &import }, { valueType }));
+  EXPECT_TRUE(nodes.insert(*newNodes.back()));
+  EXPECT_TRUE(nodes.contains(*newNodes.back()));
+  EXPECT_FALSE(nodes.contains(*newNodes.front()));
+  EXPECT_EQ(nodes.size(), 2u);
+
+  EXPECT_TRUE(nodes.erase(*node1));
+  EXPECT_FALSE(nodes.erase(*node1));
+  EXPECT_FALSE(nodes.contains(*node1));
+  EXPECT_EQ(nodes.size(), 1u);
+
+  nodes.clear();
+  EXPECT_TRUE(nodes.isEmpty());
+  EXPECT_FALSE(nodes.contains(*newNodes.back()));
+}
+
+TEST(NodeMapTests, OutputMap)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph rvsdg;
+  const auto valueType = TestType::createValueType();
+
+  auto & import = GraphImport::Create(rvsdg, valueType, "import");
+  auto node = TestOperation::createNode(&rvsdg.GetRootRegion(), { &import }, { valueType });
+  auto & output = *node->output(0);
+
+  OutputMap<std::string> outputs;
+
+  // Act & Assert
+  EXPECT_EQ(outputs.tryLookup(import), nullptr);
+
+  auto [value, inserted] = outputs.tryEmplace(import, "import");
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(value, "import");
+
+  auto [existingValue, insertedAgain] = outputs.tryEmplace(import, "other");
+  EXPECT_FALSE(insertedAgain);
+  EXPECT_EQ(existingValue, "import");
+
+  outputs[output] = "output";
+  EXPECT_EQ(outputs.lookup(output), "output");
+  EXPECT_EQ(*outputs.tryLookup(import), "import");
+  EXPECT_EQ(outputs.size(), 2u);
+
+  EXPECT_TRUE(outputs.erase(import));
+  EXPECT_FALSE(outputs.contains(import));
+  EXPECT_TRUE(outputs.contains(output));
+  EXPECT_EQ(outputs.size(), 1u);
+
+  // Values of type bool are handed out as references as well
+  OutputMap<bool> flags;
+  flags[output] = true;
+  EXPECT_TRUE(flags.lookup(output));
+  EXPECT_FALSE(flags[import]);
+}
+
+TEST(NodeMapTests, GraphIndexPages)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  GraphIndexPages<size_t, 16> pages;
+
+  // Act & Assert
+  EXPECT_EQ(pages.tryGet(1000000), nullptr);
+
+  pages.getOrCreate(1000000) = 42;
+  EXPECT_EQ(*pages.tryGet(1000000), 42u);
+
+  // The other entries of the page are allocated with default values, all other pages are not
+  EXPECT_EQ(*pages.tryGet(1000001), 0u);
+  EXPECT_EQ(pages.tryGet(0), nullptr);
+  EXPECT_EQ(pages.tryGet(1000000 + 16), nullptr);
+
+  pages.clear();
+  EXPECT_EQ(pages.tryGet(1000000), nullptr);
+}
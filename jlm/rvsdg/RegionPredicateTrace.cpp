@@ -66,6 +66,10 @@ public:
   onInputDestroy(Input * input) override
   {}
 
+  void
+  onOutputDestroy(Output * output) override
+  {}
+
 private:
   RegionPredicateTrace * tracer_;
 };
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/rvsdg/simple-node.hpp>
+#include <jlm/rvsdg/SimpleNodeHashTable.hpp>
+#include <jlm/util/Hash.hpp>
+
+namespace jlm::rvsdg
+{
+
+SimpleNodeHashTable::~SimpleNodeHashTable() noexcept = default;
+
+SimpleNodeHashTable::SimpleNodeHashTable(Region & region)
+    : RegionObserver(region)
+{
+  for (auto & node : region.Nodes())
+  {
+    if (const auto simpleNode = dynamic_cast<SimpleNode *>(&node))
+      insert(*simpleNode);
+  }
+}
+
+SimpleNode *
+SimpleNodeHashTable::find(const SimpleOperation & operation, const std::vector<Output *> & operands)
+    const
+{
+  const auto hash = computeHash(operation, operands);
+  const auto [begin, end] = table_.equal_range(hash);
+  for (auto it = begin; it != end; ++it)
+  {
+    const auto node = it->second;
+    if (&node->GetOperation() != &operation && node->GetOperation() == operation
+        && rvsdg::operands(node) == operands)
+      return node;
+  }
+
+  return nullptr;
+}
+
+std::size_t
+SimpleNodeHashTable::computeHash(
+    const SimpleOperation & operation,
+    const std::vector<Output *> & operands) noexcept
+{
+  std::size_t seed = operation.ComputeHash();
+  for (const auto operand : operands)
+    util::combineHashesWithSeed(seed, std::hash<const Output *>()(operand));
+
+  return seed;
+}
+
+void
+SimpleNodeHashTable::onNodeCreate(Node * node)
+{
+  if (const auto simpleNode = dynamic_cast<SimpleNode *>(node))
+    insert(*simpleNode);
+}
+
+void
+SimpleNodeHashTable::onNodeDestroy(Node * node)
+{
+  if (const auto simpleNode = dynamic_cast<const SimpleNode *>(node))
+    remove(*simpleNode);
+}
+
+void
+SimpleNodeHashTable::onInputCreate(Input * input)
+{
+  if (const auto simpleNode = TryGetOwnerNode<SimpleNode>(*input))
+  {
+    remove(*simpleNode);
+    insert(*simpleNode);
+  }
+}
+
+void
+SimpleNodeHashTable::onInputChange(Input * input, Output *, Output *)
+{
+  if (const auto simpleNode = TryGetOwnerNode<SimpleNode>(*input))
+  {
+    remove(*simpleNode);
+    insert(*simpleNode);
+  }
+}
+
+void
+SimpleNodeHashTable::onInputDestroy(Input * input)
+{
+  // The input is still attached to the node at this point, so the node's new hash cannot be
+  // computed yet. Conservatively drop the node from the table.
+  if (const auto simpleNode = TryGetOwnerNode<SimpleNode>(*input))
+    remove(*simpleNode);
+}
+
+void
+SimpleNodeHashTable::onOutputDestroy(Output * output)
+{
+  // Nodes are only congruent with the same number of outputs
+  if (const auto simpleNode = TryGetOwnerNode<SimpleNode>(*output))
+    remove(*simpleNode);
+}
+
+void
+SimpleNodeHashTable::insert(SimpleNode & node)
+{
+  if (node.noutputs() == 0)
+    return;
+
+  const auto hash = computeHash(node.GetOperation(), rvsdg::operands(&node));
+  table_.emplace(hash, &node);
+  nodeHashes_[&node] = hash;
+}
+
+void
+SimpleNodeHashTable::remove(const SimpleNode & node)
+{
+  const auto hashIt = nodeHashes_.find(&node);
+  if (hashIt == nodeHashes_.end())
+    return;
+
+  const auto [begin, end] = table_.equal_range(hashIt->second);
+  for (auto it = begin; it != end; ++it)
+  {
+    if (it->second == &node)
+    {
+      table_.erase(it);
+      break;
+    }
+  }
+
+  nodeHashes_.erase(hashIt);
+}
+
+}
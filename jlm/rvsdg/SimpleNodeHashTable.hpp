@@ -0,0 +1,109 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_RVSDG_SIMPLENODEHASHTABLE_HPP
+#define JLM_RVSDG_SIMPLENODEHASHTABLE_HPP
+
+#include <jlm/rvsdg/region.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+namespace jlm::rvsdg
+{
+
+class SimpleNode;
+class SimpleOperation;
+
+/**
+ * \brief Structural hash table of the simple nodes in a region.
+ *
+ * The table maps the operation and operand origins of every simple node in a region to the node.
+ * It enables finding an existing node that is congruent to a node that is about to be created
+ * in constant time, i.e., a node with an equal operation and the same operands. The table observes
+ * the region and keeps itself up-to-date when nodes are created, destroyed, or have their inputs
+ * diverted.
+ *
+ * Simple nodes without outputs are never added to the table, as they can never be congruent to
+ * another node.
+ *
+ * \see Region::enableHashConsing()
+ */
+class SimpleNodeHashTable final : public RegionObserver
+{
+public:
+  ~SimpleNodeHashTable() noexcept override;
+
+  /**
+   * Creates a hash table for \p region and adds all simple nodes currently in the region.
+   *
+   * @param region The region whose simple nodes are tracked.
+   */
+  explicit SimpleNodeHashTable(Region & region);
+
+  /**
+   * Finds a simple node with an operation equal to \p operation and the operands \p operands.
+   * A node that owns \p operation itself is never returned, i.e., a node is never found to be
+   * congruent to itself.
+   *
+   * @param operation The operation of the node.
+   * @param operands The operands of the node.
+   * @return A congruent node if one exists, otherwise nullptr.
+   */
+  [[nodiscard]] SimpleNode *
+  find(const SimpleOperation & operation, const std::vector<Output *> & operands) const;
+
+  /**
+   * @return The number of nodes in the table.
+   */
+  [[nodiscard]] size_t
+  size() const noexcept
+  {
+    return nodeHashes_.size();
+  }
+
+  /**
+   * Computes the structural hash of a simple node with operation \p operation and the operands
+   * \p operands.
+   *
+   * @param operation The operation of the node.
+   * @param operands The operands of the node.
+   * @return The structural hash value.
+   */
+  [[nodiscard]] static std::size_t
+  computeHash(const SimpleOperation & operation, const std::vector<Output *> & operands) noexcept;
+
+  void
+  onNodeCreate(Node * node) override;
+
+  void
+  onNodeDestroy(Node * node) override;
+
+  void
+  onInputCreate(Input * input) override;
+
+  void
+  onInputChange(Input * input, Output * old_origin, Output * new_origin) override;
+
+  void
+  onInputDestroy(Input * input) override;
+
+  void
+  onOutputDestroy(Output * output) override;
+
+private:
+  void
+  insert(SimpleNode & node);
+
+  void
+  remove(const SimpleNode & node);
+
+  std::unordered_multimap<std::size_t, SimpleNode *> table_{};
+  std::unordered_map<const SimpleNode *, std::size_t> nodeHashes_{};
+};
+
+}
+
+#endif
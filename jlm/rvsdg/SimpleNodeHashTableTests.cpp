@@ -0,0 +1,154 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jlm/rvsdg/bitstring/constant.hpp>
+#include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/NodeNormalization.hpp>
+#include <jlm/rvsdg/simple-node.hpp>
+#include <jlm/rvsdg/SimpleNodeHashTable.hpp>
+#include <jlm/rvsdg/TestOperations.hpp>
+#include <jlm/rvsdg/TestType.hpp>
+
+TEST(SimpleNodeHashTableTests, ComputeHash)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  const auto valueType = TestType::createValueType();
+
+  TestUnaryOperation unaryOperation1(valueType, valueType);
+  TestUnaryOperation unaryOperation2(valueType, valueType);
+  BitConstantOperation constantOperation1(BitValueRepresentation(32, 5));
+  BitConstantOperation constantOperation2(BitValueRepresentation(32, 5));
+  BitConstantOperation constantOperation3(BitValueRepresentation(32, 6));
+
+  // Act & Assert
+  EXPECT_EQ(unaryOperation1.ComputeHash(), unaryOperation2.ComputeHash());
+  EXPECT_EQ(constantOperation1.ComputeHash(), constantOperation2.ComputeHash());
+  EXPECT_NE(constantOperation1.ComputeHash(), constantOperation3.ComputeHash());
+}
+
+TEST(SimpleNodeHashTableTests, HashConsing)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph graph;
+  auto & rootRegion = graph.GetRootRegion();
+  const auto valueType = TestType::createValueType();
+
+  auto x = &GraphImport::Create(graph, valueType, "x");
+  auto y = &GraphImport::Create(graph, valueType, "y");
+
+  // A node that was created before hash-consing was enabled
+  auto & unaryNode1 = CreateOpNode<TestUnaryOperation>({ x }, valueType, valueType);
+
+  rootRegion.enableHashConsing();
+
+  // Act
+  auto & unaryNode2 = CreateOpNode<TestUnaryOperation>({ x }, valueType, valueType);
+  auto & unaryNode3 = CreateOpNode<TestUnaryOperation>({ y }, valueType, valueType);
+
+  auto & binaryNode1 = CreateOpNode<TestBinaryOperation>(
+      { x, y },
+      valueType,
+      valueType,
+      BinaryOperation::flags::none);
+  auto & binaryNode2 = CreateOpNode<TestBinaryOperation>(
+      { x, y },
+      valueType,
+      valueType,
+      BinaryOperation::flags::none);
+  auto & binaryNode3 = CreateOpNode<TestBinaryOperation>(
+      { y, x },
+      valueType,
+      valueType,
+      BinaryOperation::flags::none);
+
+  auto & constant1 = BitConstantOperation::create(rootRegion, BitValueRepresentation(32, 5));
+  auto & constant2 = BitConstantOperation::create(rootRegion, BitValueRepresentation(32, 5));
+  auto & constant3 = BitConstantOperation::create(rootRegion, BitValueRepresentation(32, 6));
+
+  // Assert
+  EXPECT_EQ(&unaryNode1, &unaryNode2);
+  EXPECT_NE(&unaryNode1, &unaryNode3);
+  EXPECT_EQ(&binaryNode1, &binaryNode2);
+  EXPECT_NE(&binaryNode1, &binaryNode3);
+  EXPECT_EQ(&constant1, &constant2);
+  EXPECT_NE(&constant1, &constant3);
+
+  EXPECT_EQ(rootRegion.numNodes(), 6u);
+  EXPECT_EQ(rootRegion.getSimpleNodeHashTable()->size(), 6u);
+}
+
+TEST(SimpleNodeHashTableTests, TableTracksRegionChanges)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph graph;
+  auto & rootRegion = graph.GetRootRegion();
+  const auto valueType = TestType::createValueType();
+
+  auto x = &GraphImport::Create(graph, valueType, "x");
+  auto y = &GraphImport::Create(graph, valueType, "y");
+
+  rootRegion.enableHashConsing();
+  auto hashTable = rootRegion.getSimpleNodeHashTable();
+
+  auto & unaryNode1 = CreateOpNode<TestUnaryOperation>({ x }, valueType, valueType);
+  auto & unaryNode2 = CreateOpNode<TestUnaryOperation>({ y }, valueType, valueType);
+  const TestUnaryOperation operation(valueType, valueType);
+
+  // Act & Assert
+  unaryNode1.input(0)->divert_to(y);
+  EXPECT_EQ(hashTable->find(operation, { x }), nullptr);
+  EXPECT_NE(hashTable->find(operation, { y }), nullptr);
+
+  remove(&unaryNode1);
+  EXPECT_EQ(hashTable->find(operation, { y }), &unaryNode2);
+  EXPECT_EQ(hashTable->size(), 1u);
+
+  rootRegion.disableHashConsing();
+  EXPECT_EQ(rootRegion.getSimpleNodeHashTable(), nullptr);
+
+  auto & unaryNode3 = CreateOpNode<TestUnaryOperation>({ y }, valueType, valueType);
+  EXPECT_NE(&unaryNode2, &unaryNode3);
+}
+
+TEST(SimpleNodeHashTableTests, NormalizeSimpleOperationCne)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  Graph graph;
+  auto & rootRegion = graph.GetRootRegion();
+  const auto valueType = TestType::createValueType();
+
+  auto x = &GraphImport::Create(graph, valueType, "x");
+
+  auto & unaryNode1 = CreateOpNode<TestUnaryOperation>({ x }, valueType, valueType);
+  auto & unaryNode2 = CreateOpNode<TestUnaryOperation>({ x }, valueType, valueType);
+  auto & ex1 = GraphExport::Create(*unaryNode1.output(0), "ex1");
+  auto & ex2 = GraphExport::Create(*unaryNode2.output(0), "ex2");
+
+  rootRegion.enableHashConsing();
+
+  auto NormalizeCne = [&](const SimpleOperation & operation, const std::vector<Output *> & operands)
+  {
+    return NormalizeSimpleOperationCommonNodeElimination(rootRegion, operation, operands);
+  };
+
+  // Act
+  ReduceNode<SimpleOperation>(NormalizeCne, unaryNode2);
+  graph.PruneNodes();
+
+  // Assert
+  EXPECT_EQ(ex1.origin(), ex2.origin());
+  EXPECT_EQ(rootRegion.numNodes(), 1u);
+  EXPECT_EQ(rootRegion.getSimpleNodeHashTable()->size(), 1u);
+}
@@ -3,17 +3,33 @@
  * See COPYING for terms of redistribution.
  */
 
+#include <jlm/rvsdg/AnalysisManager.hpp>
+#include <jlm/rvsdg/ChangeLog.hpp>
 #include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/lambda.hpp>
+#include <jlm/rvsdg/MatchType.hpp>
+#include <jlm/rvsdg/Phi.hpp>
 #include <jlm/rvsdg/RvsdgModule.hpp>
 #include <jlm/rvsdg/Transformation.hpp>
+#include <jlm/util/Parallel.hpp>
+#include <jlm/util/Trace.hpp>
 
+#include <algorithm>
 #include <fstream>
+#include <optional>
 
 namespace jlm::rvsdg
 {
 
 Transformation::~Transformation() noexcept = default;
 
+void
+Transformation::RunOnLambda(LambdaNode &)
+{
+  throw std::logic_error(
+      util::strfmt("Transformation ", GetName(), " cannot be applied to individual lambda nodes."));
+}
+
 class TransformationSequence::Statistics final : public util::Statistics
 {
 public:
@@ -51,10 +67,19 @@ public:
   }
 
   void
-  EndMeasuring(const Graph & graph) noexcept
+  EndMeasuring(const Graph & graph, size_t numIterations, size_t numSkippedTransformations) noexcept
   {
     GetTimer(Label::Timer).stop();
     AddMeasurement(Label::NumRvsdgNodesAfter, nnodes(&graph.GetRootRegion()));
+    AddMeasurement("#Iterations", numIterations);
+    AddMeasurement("#SkippedTransformations", numSkippedTransformations);
+  }
+
+  void
+  AddAnalysisMeasurements(const AnalysisManager & analysisManager) noexcept
+  {
+    AddMeasurement("#ComputedAnalysisResults", analysisManager.numComputedResults());
+    AddMeasurement("#ReusedAnalysisResults", analysisManager.numReusedResults());
   }
 
   static std::unique_ptr<Statistics>
@@ -73,6 +98,154 @@ private:
   util::Timer * currentTransformationTimer_ = nullptr;
 };
 
+/**
+ * Tracks the changes the transformations of a sequence make to a module.
+ *
+ * The module has a version that is incremented whenever a transformation changed it. The tracker
+ * records the module version after the last application of each transformation, as well as the
+ * version of the last change to the subregion of each lambda node and the version after the last
+ * application of each lambda-local transformation to it. A transformation is up-to-date if none
+ * of its inputs changed since its last application.
+ */
+class TransformationSequence::ChangeTracker final
+{
+  struct LambdaState
+  {
+    size_t lastModified = 0;
+    std::unordered_map<const Transformation *, size_t> lastApplied{};
+  };
+
+public:
+  explicit ChangeTracker(const Region & rootRegion)
+      : RootRegion_(rootRegion),
+        ChangeLog_(std::make_unique<ChangeLog>(rootRegion))
+  {}
+
+  /**
+   * @return True if the module is unchanged since the last application of \p transformation.
+   */
+  [[nodiscard]] bool
+  isUpToDate(const Transformation & transformation) const noexcept
+  {
+    const auto it = LastApplied_.find(&transformation);
+    return it != LastApplied_.end() && it->second == Version_;
+  }
+
+  /**
+   * @return True if the subregion of \p lambdaNode is unchanged since the last application of the
+   * lambda-local \p transformation to it.
+   */
+  [[nodiscard]] bool
+  isUpToDate(const Transformation & transformation, const LambdaNode & lambdaNode) const noexcept
+  {
+    const auto lambdaIt = Lambdas_.find(&lambdaNode);
+    if (lambdaIt == Lambdas_.end())
+      return false;
+
+    auto & [lastModified, lastApplied] = lambdaIt->second;
+    const auto it = lastApplied.find(&transformation);
+    return it != lastApplied.end() && it->second >= lastModified;
+  }
+
+  /**
+   * Records an application of \p transformation to the entire module.
+   *
+   * @return True if the module changed since the last recorded application, otherwise false.
+   */
+  bool
+  recordApplication(const Transformation & transformation)
+  {
+    const auto isModified = commitChanges();
+    LastApplied_[&transformation] = Version_;
+    return isModified;
+  }
+
+  /**
+   * Stops observing the module until the next call to recordApplication(). Lambda-local
+   * transformations that run concurrently must track their changes with their own change logs,
+   * as a change log cannot be notified by several threads at once.
+   */
+  void
+  suspend()
+  {
+    commitChanges();
+    ChangeLog_.reset();
+  }
+
+  /**
+   * Records an application of the lambda-local \p transformation to \p lambdaNodes after the
+   * tracker was suspended.
+   *
+   * @param isModified Determines for each lambda node whether the application changed it.
+   * @return True if any of the lambda nodes changed, otherwise false.
+   */
+  bool
+  recordApplication(
+      const Transformation & transformation,
+      const std::vector<LambdaNode *> & lambdaNodes,
+      const std::vector<char> & isModified)
+  {
+    JLM_ASSERT(!ChangeLog_);
+    JLM_ASSERT(lambdaNodes.size() == isModified.size());
+
+    const auto isAnyModified =
+        std::find(isModified.begin(), isModified.end(), true) != isModified.end();
+    if (isAnyModified)
+      Version_++;
+
+    for (size_t n = 0; n < lambdaNodes.size(); n++)
+    {
+      auto & lambdaState = Lambdas_[lambdaNodes[n]];
+      if (isModified[n])
+        lambdaState.lastModified = Version_;
+      lambdaState.lastApplied[&transformation] = Version_;
+    }
+    LastApplied_[&transformation] = Version_;
+
+    ChangeLog_ = std::make_unique<ChangeLog>(RootRegion_);
+    return isAnyModified;
+  }
+
+private:
+  /**
+   * Increments the module version if the change log recorded any changes, and forgets them.
+   *
+   * @return True if the change log recorded any changes, otherwise false.
+   */
+  bool
+  commitChanges()
+  {
+    if (ChangeLog_->isEmpty())
+      return false;
+
+    Version_++;
+
+    // Node addresses can be reused, so neither destroyed nor new lambda nodes have valid states
+    for (const auto node : ChangeLog_->destroyedNodes())
+      Lambdas_.erase(node);
+    for (const auto node : ChangeLog_->createdNodes())
+      Lambdas_.erase(node);
+
+    for (const auto region : ChangeLog_->modifiedRegions())
+    {
+      for (auto node = region->node(); node != nullptr; node = node->region()->node())
+      {
+        if (dynamic_cast<const LambdaNode *>(node))
+          Lambdas_[node].lastModified = Version_;
+      }
+    }
+
+    ChangeLog_->clear();
+    return true;
+  }
+
+  const Region & RootRegion_;
+  std::unique_ptr<ChangeLog> ChangeLog_;
+  size_t Version_ = 0;
+  std::unordered_map<const Transformation *, size_t> LastApplied_{};
+  std::unordered_map<const Node *, LambdaState> Lambdas_{};
+};
+
 TransformationSequence::~TransformationSequence() noexcept = default;
 
 void
@@ -80,6 +253,9 @@ TransformationSequence::Run(
     RvsdgModule & rvsdgModule,
     util::StatisticsCollector & statisticsCollector)
 {
+  util::PerfCounterGroup::SelectionScope perfCountersScope(
+      statisticsCollector.GetSettings().GetDemandedPerfCounters());
+
   std::unique_ptr<Statistics> statistics;
   if (Statistics::IsDemandedBy(statisticsCollector))
     statistics = Statistics::Create(rvsdgModule.SourceFilePath().value());
@@ -87,6 +263,11 @@ TransformationSequence::Run(
   if (statistics)
     statistics->StartMeasuring();
 
+  std::optional<util::Tracer::CurrentScope> tracerScope;
+  if (const auto tracer = statisticsCollector.GetTracer())
+    tracerScope.emplace(tracer);
+  util::TraceSpan sequenceSpan(GetName(), "pipeline");
+
   size_t numPasses = 0;
   if (dumpRvsdgGraphs_)
   {
@@ -98,38 +279,185 @@ TransformationSequence::Run(
     numPasses++;
   }
 
-  for (const auto & transformation : Transformations_)
+  // A nested sequence shares the analysis manager of the enclosing sequence
+  auto & rootRegion = rvsdgModule.Rvsdg().GetRootRegion();
+  std::unique_ptr<AnalysisManager> ownedAnalysisManager;
+  std::optional<AnalysisManager::CurrentScope> analysisManagerScope;
+  auto analysisManager = AnalysisManager::current();
+  if (analysisManager == nullptr || &analysisManager->rootRegion() != &rootRegion)
   {
-    if (statistics)
-      statistics->StartTransformationMeasuring(
-          numPasses,
-          transformation->GetName(),
-          rvsdgModule.Rvsdg());
+    // Frees the graph indices of the nodes destroyed since the last sequence, which keeps the side
+    // tables indexed by them small. Nested sequences must not compact, as the transformations of
+    // the enclosing sequence might still hold such tables.
+    rvsdgModule.Rvsdg().compactIndices();
+    ownedAnalysisManager = std::make_unique<AnalysisManager>(rootRegion);
+    analysisManager = ownedAnalysisManager.get();
+    analysisManagerScope.emplace(analysisManager);
+  }
 
-    transformation->Run(rvsdgModule, statisticsCollector);
+  // The changes are only needed to skip idempotent transformations and to detect a fixpoint
+  std::optional<ChangeTracker> changeTracker;
+  const auto hasIdempotentTransformation = std::any_of(
+      Transformations_.begin(),
+      Transformations_.end(),
+      [](const std::shared_ptr<Transformation> & transformation)
+      {
+        return transformation->IsIdempotent();
+      });
+  if (hasIdempotentTransformation || maxIterations_ > 1)
+    changeTracker.emplace(rootRegion);
 
-    if (statistics)
-      statistics->EndTransformationMeasuring();
+  size_t numIterations = 0;
+  size_t numSkippedTransformations = 0;
+  bool isModified = true;
+  while (isModified && numIterations < maxIterations_)
+  {
+    isModified = false;
+    numIterations++;
 
-    if (dumpRvsdgGraphs_)
+    for (const auto & transformation : Transformations_)
     {
-      DumpDotGraphs(
-          rvsdgModule,
-          statisticsCollector.GetSettings().GetOrCreateOutputDirectory(),
-          "After" + std::string(transformation->GetName()),
-          numPasses);
-    }
+      if (transformation->IsIdempotent() && changeTracker->isUpToDate(*transformation))
+      {
+        numSkippedTransformations++;
+        continue;
+      }
 
-    numPasses++;
+      if (statistics)
+        statistics->StartTransformationMeasuring(
+            numPasses,
+            transformation->GetName(),
+            rvsdgModule.Rvsdg());
+
+      {
+        util::TraceSpan transformationSpan(transformation->GetName(), "pass");
+        if (transformationSpan.isActive())
+        {
+          transformationSpan.addArgument("#RvsdgNodesBefore", nnodes(&rootRegion));
+          transformationSpan.addArgument("#RvsdgRegionsBefore", Region::NumRegions(rootRegion));
+        }
+
+        if (numThreads_ > 1 && transformation->IsLambdaLocal())
+        {
+          isModified |= RunOnLambdas(
+              *transformation,
+              rvsdgModule,
+              changeTracker ? &*changeTracker : nullptr,
+              *analysisManager);
+        }
+        else
+        {
+          transformation->Run(rvsdgModule, statisticsCollector);
+          rvsdgModule.Rvsdg().collectDeadNodes();
+          if (changeTracker)
+            isModified |= changeTracker->recordApplication(*transformation);
+          analysisManager->commitChanges(*transformation);
+        }
+
+        if (transformationSpan.isActive())
+        {
+          transformationSpan.addArgument("#RvsdgNodesAfter", nnodes(&rootRegion));
+          transformationSpan.addArgument("#RvsdgRegionsAfter", Region::NumRegions(rootRegion));
+        }
+      }
+
+      if (statistics)
+        statistics->EndTransformationMeasuring();
+
+      if (dumpRvsdgGraphs_)
+      {
+        DumpDotGraphs(
+            rvsdgModule,
+            statisticsCollector.GetSettings().GetOrCreateOutputDirectory(),
+            "After" + std::string(transformation->GetName()),
+            numPasses);
+      }
+
+      numPasses++;
+    }
   }
 
   if (statistics)
   {
-    statistics->EndMeasuring(rvsdgModule.Rvsdg());
+    statistics->EndMeasuring(rvsdgModule.Rvsdg(), numIterations, numSkippedTransformations);
+    if (ownedAnalysisManager)
+      statistics->AddAnalysisMeasurements(*ownedAnalysisManager);
     statisticsCollector.CollectDemandedStatistics(std::move(statistics));
   }
 }
 
+std::vector<LambdaNode *>
+TransformationSequence::CollectLambdaNodes(Region & region)
+{
+  std::vector<LambdaNode *> lambdaNodes;
+  for (auto & node : region.Nodes())
+  {
+    MatchType(
+        node,
+        [&](LambdaNode & lambdaNode)
+        {
+          lambdaNodes.push_back(&lambdaNode);
+        },
+        [&](PhiNode & phiNode)
+        {
+          auto phiLambdaNodes = CollectLambdaNodes(*phiNode.subregion());
+          lambdaNodes.insert(lambdaNodes.end(), phiLambdaNodes.begin(), phiLambdaNodes.end());
+        });
+  }
+
+  return lambdaNodes;
+}
+
+bool
+TransformationSequence::RunOnLambdas(
+    Transformation & transformation,
+    RvsdgModule & rvsdgModule,
+    ChangeTracker * changeTracker,
+    AnalysisManager & analysisManager) const
+{
+  JLM_ASSERT(transformation.IsLambdaLocal());
+
+  const auto lambdaNodes = CollectLambdaNodes(rvsdgModule.Rvsdg().GetRootRegion());
+  std::vector<char> isModified(lambdaNodes.size(), false);
+
+  if (changeTracker)
+    changeTracker->suspend();
+  analysisManager.suspend();
+  const auto tracer = util::Tracer::current();
+  util::parallelForEach(
+      numThreads_,
+      lambdaNodes.size(),
+      [&](size_t, size_t index)
+      {
+        auto & lambdaNode = *lambdaNodes[index];
+        if (transformation.IsIdempotent() && changeTracker->isUpToDate(transformation, lambdaNode))
+          return;
+
+        util::Tracer::CurrentScope tracerScope(tracer);
+        util::TraceSpan lambdaSpan(tracer ? lambdaNode.DebugString() : "", "lambda");
+
+        const ChangeLog changeLog(*lambdaNode.subregion());
+        transformation.RunOnLambda(lambdaNode);
+        isModified[index] = !changeLog.isEmpty();
+      });
+
+  // Nodes only become dead in the modified lambda nodes, which the analysis manager is told about
+  rvsdgModule.Rvsdg().collectDeadNodes();
+
+  std::vector<const Region *> modifiedRegions;
+  for (size_t n = 0; n < lambdaNodes.size(); n++)
+  {
+    if (isModified[n])
+      modifiedRegions.push_back(lambdaNodes[n]->subregion());
+  }
+  analysisManager.resume(transformation, modifiedRegions);
+
+  if (!changeTracker)
+    return std::find(isModified.begin(), isModified.end(), true) != isModified.end();
+
+  return changeTracker->recordApplication(transformation, lambdaNodes, isModified);
+}
+
 void
 TransformationSequence::DumpDotGraphs(
     RvsdgModule & rvsdgModule,
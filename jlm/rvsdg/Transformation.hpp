@@ -9,9 +9,14 @@
 #include <jlm/rvsdg/DotWriter.hpp>
 #include <jlm/util/Statistics.hpp>
 
+#include <typeindex>
+
 namespace jlm::rvsdg
 {
 
+class AnalysisManager;
+class LambdaNode;
+class Region;
 class RvsdgModule;
 
 /**
@@ -61,15 +66,104 @@ public:
     Run(module, statisticsCollector);
   }
 
+  /**
+   * \brief Determines whether the transformation is lambda-local.
+   *
+   * A lambda-local transformation only inspects and modifies the subregions of lambda nodes, and
+   * can be applied to each lambda node in isolation through RunOnLambda(). It never touches
+   * anything outside of a lambda's subregion, including the inputs and outputs of the lambda node
+   * itself. This permits TransformationSequence to apply it to distinct lambda nodes concurrently.
+   *
+   * @return True, if the transformation is lambda-local, otherwise false.
+   */
+  [[nodiscard]] virtual bool
+  IsLambdaLocal() const noexcept
+  {
+    return false;
+  }
+
+  /**
+   * \brief Determines whether the transformation is idempotent.
+   *
+   * An idempotent transformation does not change a module it was just applied to, i.e., applying
+   * it twice in a row has the same effect as applying it once. This permits TransformationSequence
+   * to skip the transformation if the module is unchanged since the transformation was last
+   * applied. For lambda-local transformations, this holds for the subregion of each lambda node.
+   *
+   * @return True, if the transformation is idempotent, otherwise false.
+   */
+  [[nodiscard]] virtual bool
+  IsIdempotent() const noexcept
+  {
+    return false;
+  }
+
+  /**
+   * \brief Determines whether the transformation preserves the results of an analysis.
+   *
+   * The results of a preserved analysis stay valid in all regions the transformation changed, and
+   * are therefore not discarded by the AnalysisManager after the transformation.
+   *
+   * @param analysis The type of the analysis.
+   * @return True, if the transformation preserves the results of \p analysis, otherwise false.
+   *
+   * \see AnalysisManager
+   */
+  [[nodiscard]] virtual bool
+  PreservesAnalysis([[maybe_unused]] const std::type_index & analysis) const noexcept
+  {
+    return false;
+  }
+
+  /**
+   * \brief Perform RVSDG transformation on the subregion of a single lambda node
+   *
+   * \note This method is only invoked for lambda-local transformations and might be invoked
+   * concurrently for distinct lambda nodes. An implementation is therefore not permitted to keep
+   * any per-invocation state in the transformation object.
+   *
+   * @param lambdaNode The lambda node whose subregion the transformation is performed on.
+   *
+   * \see IsLambdaLocal()
+   */
+  virtual void
+  RunOnLambda(LambdaNode & lambdaNode);
+
 private:
   std::string_view Name_;
 };
 
 /**
  * Sequentially applies a list of RVSDG transformations.
+ *
+ * If the sequence is configured with more than one thread, then lambda-local transformations are
+ * applied to all lambda nodes of the module concurrently. All other transformations are applied
+ * to the entire module on the calling thread.
+ *
+ * The sequence observes the changes every transformation makes to the module. An idempotent
+ * transformation is skipped if the module is unchanged since its last application in the same
+ * run. If its lambda-local transformations are applied concurrently, then this is decided for
+ * each lambda node individually.
+ *
+ * The list of transformations can be applied repeatedly until it reaches a fixpoint, i.e., until
+ * an iteration leaves the module unchanged, or until the maximal number of iterations is reached.
+ * A sequence can be nested into another sequence to iterate only a group of its transformations.
+ *
+ * If the eager collection of dead nodes is enabled for the graph of the module, then the dead
+ * simple nodes a transformation leaves behind are removed right after it, and count as changes of
+ * the transformation.
+ *
+ * The sequence makes an AnalysisManager current while it runs, such that analysis results are
+ * reused across its transformations until a transformation invalidates them. A nested sequence
+ * shares the manager of the enclosing sequence.
+ *
+ * \see Transformation::IsLambdaLocal()
+ * \see Transformation::IsIdempotent()
+ * \see Transformation::PreservesAnalysis()
  */
 class TransformationSequence final : public Transformation
 {
+  class ChangeTracker;
   class Statistics;
 
 public:
@@ -78,13 +172,36 @@ public:
   explicit TransformationSequence(
       std::vector<std::shared_ptr<Transformation>> transformations,
       DotWriter & dotWriter,
-      const bool dumpRvsdgGraphs)
+      const bool dumpRvsdgGraphs,
+      const size_t numThreads = 1,
+      const size_t maxIterations = 1)
       : Transformation("TransformationSequence"),
         DotWriter_(dotWriter),
         dumpRvsdgGraphs_(dumpRvsdgGraphs),
+        numThreads_(numThreads),
+        maxIterations_(maxIterations),
         Transformations_(std::move(transformations))
   {}
 
+  /**
+   * @return The number of threads used for applying lambda-local transformations.
+   */
+  [[nodiscard]] size_t
+  numThreads() const noexcept
+  {
+    return numThreads_;
+  }
+
+  /**
+   * @return The maximal number of times the list of transformations is applied while the module
+   * still changes.
+   */
+  [[nodiscard]] size_t
+  maxIterations() const noexcept
+  {
+    return maxIterations_;
+  }
+
   /**
    * \brief Perform RVSDG transformations
    *
@@ -102,6 +219,9 @@ public:
    * @param transformations The transformations that are sequentially applied to \p rvsdgModule.
    * @param dotWriter The DOT writer for dumping the RVSDG graphs.
    * @param dumpRvsdgGraphs Determines whether to dump the RVSDG graphs.
+   * @param numThreads The number of threads used for applying lambda-local transformations.
+   * @param maxIterations The maximal number of times \p transformations are applied while the
+   * module still changes.
    */
   static void
   CreateAndRun(
@@ -109,16 +229,46 @@ public:
       util::StatisticsCollector & statisticsCollector,
       std::vector<std::shared_ptr<Transformation>> transformations,
       DotWriter & dotWriter,
-      const bool dumpRvsdgGraphs)
+      const bool dumpRvsdgGraphs,
+      const size_t numThreads = 1,
+      const size_t maxIterations = 1)
   {
     TransformationSequence sequentialApplication(
         std::move(transformations),
         dotWriter,
-        dumpRvsdgGraphs);
+        dumpRvsdgGraphs,
+        numThreads,
+        maxIterations);
     sequentialApplication.Run(rvsdgModule, statisticsCollector);
   }
 
+  /**
+   * Collects all lambda nodes in \p region. This includes the lambda nodes in the subregions of
+   * phi nodes.
+   *
+   * @param region The region from which to collect the lambda nodes.
+   * @return A vector of lambda nodes.
+   */
+  [[nodiscard]] static std::vector<LambdaNode *>
+  CollectLambdaNodes(Region & region);
+
 private:
+  /**
+   * Applies the lambda-local \p transformation to all lambda nodes in \p rvsdgModule using up to
+   * numThreads() threads. Lambda nodes for which \p changeTracker reports that an idempotent
+   * \p transformation is up-to-date are skipped. The \p changeTracker is nullptr if the sequence
+   * has no idempotent transformations and runs a single iteration. The \p analysisManager is suspended while the
+   * lambda nodes are transformed, and the worker threads compute analyses without caching them.
+   *
+   * @return True if the transformation changed any lambda node, otherwise false.
+   */
+  bool
+  RunOnLambdas(
+      Transformation & transformation,
+      RvsdgModule & rvsdgModule,
+      ChangeTracker * changeTracker,
+      AnalysisManager & analysisManager) const;
+
   void
   DumpDotGraphs(
       RvsdgModule & rvsdgModule,
@@ -128,6 +278,8 @@ private:
 
   DotWriter & DotWriter_;
   bool dumpRvsdgGraphs_;
+  size_t numThreads_;
+  size_t maxIterations_;
   std::vector<std::shared_ptr<Transformation>> Transformations_;
 };
 
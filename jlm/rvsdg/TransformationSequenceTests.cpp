@@ -5,9 +5,17 @@
 
 #include <gtest/gtest.h>
 
+#include <jlm/rvsdg/AnalysisManager.hpp>
+#include <jlm/rvsdg/lambda.hpp>
+#include <jlm/rvsdg/Phi.hpp>
 #include <jlm/rvsdg/RvsdgModule.hpp>
+#include <jlm/rvsdg/TestOperations.hpp>
+#include <jlm/rvsdg/TestType.hpp>
 #include <jlm/rvsdg/Transformation.hpp>
 
+#include <functional>
+#include <mutex>
+
 class TestTransformation final : public jlm::rvsdg::Transformation
 {
 public:
@@ -21,6 +29,79 @@ public:
   {}
 };
 
+class TestLambdaLocalTransformation final : public jlm::rvsdg::Transformation
+{
+public:
+  TestLambdaLocalTransformation()
+      : Transformation("TestLambdaLocalTransformation")
+  {}
+
+  void
+  Run(jlm::rvsdg::RvsdgModule & module, jlm::util::StatisticsCollector &) override
+  {
+    for (auto lambdaNode :
+         jlm::rvsdg::TransformationSequence::CollectLambdaNodes(module.Rvsdg().GetRootRegion()))
+    {
+      RunOnLambda(*lambdaNode);
+    }
+    numModuleRuns++;
+  }
+
+  [[nodiscard]] bool
+  IsLambdaLocal() const noexcept override
+  {
+    return true;
+  }
+
+  void
+  RunOnLambda(jlm::rvsdg::LambdaNode & lambdaNode) override
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    visitedLambdaNodes.push_back(&lambdaNode);
+  }
+
+  size_t numModuleRuns = 0;
+  std::vector<const jlm::rvsdg::LambdaNode *> visitedLambdaNodes{};
+
+private:
+  std::mutex mutex_{};
+};
+
+/**
+ * Transformation that invokes a callback on the module and counts its invocations.
+ */
+class CallbackTransformation final : public jlm::rvsdg::Transformation
+{
+public:
+  CallbackTransformation(
+      bool isIdempotent,
+      std::function<void(jlm::rvsdg::RvsdgModule &)> callback = nullptr)
+      : Transformation("CallbackTransformation"),
+        isIdempotent_(isIdempotent),
+        callback_(std::move(callback))
+  {}
+
+  void
+  Run(jlm::rvsdg::RvsdgModule & module, jlm::util::StatisticsCollector &) override
+  {
+    numRuns++;
+    if (callback_)
+      callback_(module);
+  }
+
+  [[nodiscard]] bool
+  IsIdempotent() const noexcept override
+  {
+    return isIdempotent_;
+  }
+
+  size_t numRuns = 0;
+
+private:
+  bool isIdempotent_;
+  std::function<void(jlm::rvsdg::RvsdgModule &)> callback_;
+};
+
 class TestDotWriter final : public jlm::rvsdg::DotWriter
 {
 protected:
@@ -73,3 +154,420 @@ TEST(ArgumentTests, RvsdgDumping)
   EXPECT_TRUE(std::filesystem::exists("/tmp/000-Pristine.json"));
   EXPECT_TRUE(std::filesystem::exists("/tmp/001-AfterTestTransformation.json"));
 }
+
+TEST(TransformationSequenceTests, LambdaLocalTransformation)
+{
+  using namespace jlm::rvsdg;
+  using namespace jlm::util;
+
+  // Arrange
+  auto valueType = TestType::createValueType();
+  auto functionType = FunctionType::Create({ valueType }, { valueType });
+
+  RvsdgModule rvsdgModule(FilePath("/tmp/mySource"));
+  auto & rvsdg = rvsdgModule.Rvsdg();
+
+  std::vector<const LambdaNode *> lambdaNodes;
+  for (size_t n = 0; n < 10; n++)
+  {
+    auto lambdaNode =
+        LambdaNode::Create(rvsdg.GetRootRegion(), std::make_unique<LambdaOperation>(functionType));
+    lambdaNode->finalize({ lambdaNode->GetFunctionArguments()[0] });
+    lambdaNodes.push_back(lambdaNode);
+  }
+
+  PhiBuilder phiBuilder;
+  phiBuilder.begin(&rvsdg.GetRootRegion());
+  auto fixVar = phiBuilder.AddFixVar(functionType);
+  auto phiLambdaNode =
+      LambdaNode::Create(*phiBuilder.subregion(), std::make_unique<LambdaOperation>(functionType));
+  auto phiLambdaOutput = phiLambdaNode->finalize({ phiLambdaNode->GetFunctionArguments()[0] });
+  fixVar.result->divert_to(phiLambdaOutput);
+  phiBuilder.end();
+  lambdaNodes.push_back(phiLambdaNode);
+
+  TestDotWriter dotWriter;
+  StatisticsCollector statisticsCollector;
+
+  // Act & Assert
+  {
+    auto transformation = std::make_shared<TestLambdaLocalTransformation>();
+    TransformationSequence::CreateAndRun(
+        rvsdgModule,
+        statisticsCollector,
+        { transformation },
+        dotWriter,
+        false,
+        4);
+
+    EXPECT_EQ(transformation->numModuleRuns, 0u);
+    EXPECT_EQ(transformation->visitedLambdaNodes.size(), lambdaNodes.size());
+    for (auto lambdaNode : lambdaNodes)
+    {
+      EXPECT_EQ(
+          std::count(
+              transformation->visitedLambdaNodes.begin(),
+              transformation->visitedLambdaNodes.end(),
+              lambdaNode),
+          1);
+    }
+  }
+
+  {
+    auto transformation = std::make_shared<TestLambdaLocalTransformation>();
+    TransformationSequence::CreateAndRun(
+        rvsdgModule,
+        statisticsCollector,
+        { transformation },
+        dotWriter,
+        false,
+        1);
+
+    EXPECT_EQ(transformation->numModuleRuns, 1u);
+    EXPECT_EQ(transformation->visitedLambdaNodes.size(), lambdaNodes.size());
+  }
+}
+
+TEST(TransformationSequenceTests, Tracing)
+{
+  using namespace jlm::rvsdg;
+  using namespace jlm::util;
+
+  // Arrange
+  auto valueType = TestType::createValueType();
+  auto functionType = FunctionType::Create({ valueType }, { valueType });
+
+  RvsdgModule rvsdgModule(FilePath("/tmp/mySource"));
+  for (size_t n = 0; n < 2; n++)
+  {
+    auto lambdaNode = LambdaNode::Create(
+        rvsdgModule.Rvsdg().GetRootRegion(),
+        std::make_unique<LambdaOperation>(functionType));
+    lambdaNode->finalize({ lambdaNode->GetFunctionArguments()[0] });
+  }
+
+  StatisticsCollectorSettings settings;
+  settings.setTracingEnabled(true);
+  StatisticsCollector statisticsCollector(std::move(settings));
+
+  TestDotWriter dotWriter;
+  auto transformation = std::make_shared<TestTransformation>();
+  auto lambdaLocalTransformation = std::make_shared<TestLambdaLocalTransformation>();
+
+  // Act
+  TransformationSequence::CreateAndRun(
+      rvsdgModule,
+      statisticsCollector,
+      { transformation, lambdaLocalTransformation },
+      dotWriter,
+      false,
+      2);
+
+  // Assert
+  auto & spans = statisticsCollector.GetTracer()->spans();
+  ASSERT_EQ(spans.size(), 5u);
+
+  auto countSpans = [&](std::string_view category)
+  {
+    return std::count_if(
+        spans.begin(),
+        spans.end(),
+        [&](const Tracer::Span & span)
+        {
+          return span.category == category;
+        });
+  };
+  EXPECT_EQ(countSpans("pipeline"), 1);
+  EXPECT_EQ(countSpans("pass"), 2);
+  EXPECT_EQ(countSpans("lambda"), 2);
+
+  auto & transformationSpan = spans[0];
+  EXPECT_EQ(transformationSpan.name, "TestTransformation");
+  EXPECT_EQ(transformationSpan.arguments[0].first, "#RvsdgNodesBefore");
+  EXPECT_EQ(std::get<uint64_t>(transformationSpan.arguments[0].second), 2u);
+  EXPECT_EQ(transformationSpan.arguments[1].first, "#RvsdgRegionsBefore");
+  EXPECT_EQ(std::get<uint64_t>(transformationSpan.arguments[1].second), 3u);
+
+  EXPECT_EQ(spans.back().name, "TransformationSequence");
+  EXPECT_EQ(Tracer::current(), nullptr);
+}
+
+TEST(TransformationSequenceTests, SkipUnchangedIdempotentTransformations)
+{
+  using namespace jlm::rvsdg;
+  using namespace jlm::util;
+
+  // Arrange
+  RvsdgModule rvsdgModule(FilePath("/tmp/mySource"));
+  auto & rootRegion = rvsdgModule.Rvsdg().GetRootRegion();
+
+  TestDotWriter dotWriter;
+  auto idempotentTransformation = std::make_shared<CallbackTransformation>(true);
+  auto transformation = std::make_shared<CallbackTransformation>(false);
+  auto modifyingTransformation = std::make_shared<CallbackTransformation>(
+      false,
+      [](RvsdgModule & module)
+      {
+        TestOperation::createNode(&module.Rvsdg().GetRootRegion(), {}, {});
+      });
+
+  StatisticsCollectorSettings settings({ Statistics::Id::RvsdgOptimization });
+  StatisticsCollector statisticsCollector(std::move(settings));
+
+  // Act
+  TransformationSequence::CreateAndRun(
+      rvsdgModule,
+      statisticsCollector,
+      { idempotentTransformation,
+        transformation,
+        idempotentTransformation,
+        transformation,
+        modifyingTransformation,
+        idempotentTransformation,
+        idempotentTransformation },
+      dotWriter,
+      false);
+
+  // Assert
+  EXPECT_EQ(idempotentTransformation->numRuns, 2u);
+  EXPECT_EQ(transformation->numRuns, 2u);
+  EXPECT_EQ(modifyingTransformation->numRuns, 1u);
+  EXPECT_EQ(rootRegion.numNodes(), 1u);
+
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  EXPECT_EQ(statistics.GetMeasurementValue<uint64_t>("#Iterations"), 1u);
+  EXPECT_EQ(statistics.GetMeasurementValue<uint64_t>("#SkippedTransformations"), 2u);
+}
+
+TEST(TransformationSequenceTests, FixpointIteration)
+{
+  using namespace jlm::rvsdg;
+  using namespace jlm::util;
+
+  // Arrange
+  RvsdgModule rvsdgModule(FilePath("/tmp/mySource"));
+  auto & rootRegion = rvsdgModule.Rvsdg().GetRootRegion();
+  for (size_t n = 0; n < 3; n++)
+    TestOperation::createNode(&rootRegion, {}, {});
+
+  TestDotWriter dotWriter;
+  StatisticsCollector statisticsCollector;
+
+  // Removes a single node per application
+  auto removeNode = [](RvsdgModule & module)
+  {
+    auto & region = module.Rvsdg().GetRootRegion();
+    if (region.numNodes() != 0)
+      region.removeNode(&*region.Nodes().begin());
+  };
+
+  // Act & Assert
+  {
+    auto transformation = std::make_shared<CallbackTransformation>(false, removeNode);
+    TransformationSequence::CreateAndRun(
+        rvsdgModule,
+        statisticsCollector,
+        { transformation },
+        dotWriter,
+        false,
+        1,
+        2);
+
+    EXPECT_EQ(transformation->numRuns, 2u);
+    EXPECT_EQ(rootRegion.numNodes(), 1u);
+  }
+
+  {
+    auto transformation = std::make_shared<CallbackTransformation>(false, removeNode);
+    TransformationSequence::CreateAndRun(
+        rvsdgModule,
+        statisticsCollector,
+        { transformation },
+        dotWriter,
+        false,
+        1,
+        10);
+
+    // The last application does not change the module anymore
+    EXPECT_EQ(transformation->numRuns, 2u);
+    EXPECT_EQ(rootRegion.numNodes(), 0u);
+  }
+}
+
+TEST(TransformationSequenceTests, EagerDeadNodeCollection)
+{
+  using namespace jlm::rvsdg;
+  using namespace jlm::util;
+
+  // Arrange
+  auto valueType = TestType::createValueType();
+
+  RvsdgModule rvsdgModule(FilePath("/tmp/mySource"));
+  auto & graph = rvsdgModule.Rvsdg();
+  auto & rootRegion = graph.GetRootRegion();
+  auto & import = GraphImport::Create(graph, valueType, "import");
+  auto node = TestOperation::createNode(&rootRegion, { &import }, { valueType });
+  auto & graphExport = GraphExport::Create(*node->output(0), "export");
+
+  graph.enableEagerDeadNodeCollection(true);
+
+  TestDotWriter dotWriter;
+  StatisticsCollector statisticsCollector;
+
+  auto divertExport = [&](RvsdgModule &)
+  {
+    graphExport.divert_to(&import);
+  };
+
+  // Act
+  auto transformation = std::make_shared<CallbackTransformation>(false, divertExport);
+  TransformationSequence::CreateAndRun(
+      rvsdgModule,
+      statisticsCollector,
+      { transformation },
+      dotWriter,
+      false);
+
+  // Assert
+  EXPECT_EQ(rootRegion.numNodes(), 0u);
+}
+
+TEST(TransformationSequenceTests, SkipUnchangedLambdaNodes)
+{
+  using namespace jlm::rvsdg;
+  using namespace jlm::util;
+
+  // Arrange
+  auto valueType = TestType::createValueType();
+  auto functionType = FunctionType::Create({ valueType }, { valueType });
+
+  RvsdgModule rvsdgModule(FilePath("/tmp/mySource"));
+  std::vector<LambdaNode *> lambdaNodes;
+  for (size_t n = 0; n < 4; n++)
+  {
+    auto lambdaNode = LambdaNode::Create(
+        rvsdgModule.Rvsdg().GetRootRegion(),
+        std::make_unique<LambdaOperation>(functionType));
+    lambdaNode->finalize({ lambdaNode->GetFunctionArguments()[0] });
+    lambdaNodes.push_back(lambdaNode);
+  }
+
+  class IdempotentLambdaLocalTransformation final : public Transformation
+  {
+  public:
+    IdempotentLambdaLocalTransformation()
+        : Transformation("IdempotentLambdaLocalTransformation")
+    {}
+
+    void
+    Run(RvsdgModule &, StatisticsCollector &) override
+    {}
+
+    [[nodiscard]] bool
+    IsLambdaLocal() const noexcept override
+    {
+      return true;
+    }
+
+    [[nodiscard]] bool
+    IsIdempotent() const noexcept override
+    {
+      return true;
+    }
+
+    void
+    RunOnLambda(LambdaNode & lambdaNode) override
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      visitedLambdaNodes.push_back(&lambdaNode);
+    }
+
+    std::vector<const LambdaNode *> visitedLambdaNodes{};
+
+  private:
+    std::mutex mutex_{};
+  };
+
+  TestDotWriter dotWriter;
+  StatisticsCollector statisticsCollector;
+  auto lambdaLocalTransformation = std::make_shared<IdempotentLambdaLocalTransformation>();
+  auto modifyingTransformation = std::make_shared<CallbackTransformation>(
+      false,
+      [&](RvsdgModule &)
+      {
+        TestOperation::createNode(lambdaNodes[1]->subregion(), {}, {});
+      });
+
+  // Act
+  TransformationSequence::CreateAndRun(
+      rvsdgModule,
+      statisticsCollector,
+      { lambdaLocalTransformation, modifyingTransformation, lambdaLocalTransformation },
+      dotWriter,
+      false,
+      2);
+
+  // Assert
+  // Only the modified lambda node is visited again
+  auto & visitedLambdaNodes = lambdaLocalTransformation->visitedLambdaNodes;
+  EXPECT_EQ(visitedLambdaNodes.size(), lambdaNodes.size() + 1);
+  EXPECT_EQ(std::count(visitedLambdaNodes.begin(), visitedLambdaNodes.end(), lambdaNodes[1]), 2);
+}
+
+TEST(TransformationSequenceTests, ReuseAnalysisResults)
+{
+  using namespace jlm::rvsdg;
+  using namespace jlm::util;
+
+  // Arrange
+  RvsdgModule rvsdgModule(FilePath("/tmp/mySource"));
+
+  struct NumNodesAnalysis
+  {
+    using Result = size_t;
+
+    static std::shared_ptr<Result>
+    compute(Region & region)
+    {
+      return std::make_shared<Result>(region.numNodes());
+    }
+  };
+
+  std::vector<size_t> numNodes;
+  auto analyzingTransformation = std::make_shared<CallbackTransformation>(
+      false,
+      [&](RvsdgModule & module)
+      {
+        auto & rootRegion = module.Rvsdg().GetRootRegion();
+        numNodes.push_back(*AnalysisManager::getResultOrCompute<NumNodesAnalysis>(rootRegion));
+      });
+  auto modifyingTransformation = std::make_shared<CallbackTransformation>(
+      false,
+      [](RvsdgModule & module)
+      {
+        TestOperation::createNode(&module.Rvsdg().GetRootRegion(), {}, {});
+      });
+
+  TestDotWriter dotWriter;
+  StatisticsCollectorSettings settings({ Statistics::Id::RvsdgOptimization });
+  StatisticsCollector statisticsCollector(std::move(settings));
+
+  // Act
+  TransformationSequence::CreateAndRun(
+      rvsdgModule,
+      statisticsCollector,
+      { analyzingTransformation,
+        analyzingTransformation,
+        modifyingTransformation,
+        analyzingTransformation },
+      dotWriter,
+      false);
+
+  // Assert
+  EXPECT_EQ(numNodes, std::vector<size_t>({ 0, 0, 1 }));
+  EXPECT_EQ(AnalysisManager::current(), nullptr);
+
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  EXPECT_EQ(statistics.GetMeasurementValue<uint64_t>("#ComputedAnalysisResults"), 2u);
+  EXPECT_EQ(statistics.GetMeasurementValue<uint64_t>("#ReusedAnalysisResults"), 1u);
+}
@@ -10,6 +10,10 @@
 #include <jlm/rvsdg/NodeNormalization.hpp>
 #include <jlm/rvsdg/view.hpp>
 
+#include <random>
+#include <string>
+#include <utility>
+
 TEST(bitstring, arithmetic_test_bitand)
 {
   using namespace jlm::rvsdg;
@@ -2160,3 +2164,426 @@ TEST(bitstring, test_value_representation)
     }
   }
 }
+
+TEST(bitstring, ValueRepresentationWideValues)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  const BitValueRepresentation allOnes = BitValueRepresentation::repeat(100, '1');
+  const BitValueRepresentation one(100, 1);
+
+  // Act & Assert
+  EXPECT_EQ(allOnes.add(one), BitValueRepresentation(100, 0));
+  EXPECT_EQ(allOnes, BitValueRepresentation(100, -1));
+  EXPECT_EQ(BitValueRepresentation(100, 0).sub(one), allOnes);
+  EXPECT_EQ(one.shl(99).ashr(99), allOnes);
+  EXPECT_EQ(one.shl(99).shr(99), one);
+  EXPECT_EQ(allOnes.slice(60, 70), BitValueRepresentation::repeat(10, '1'));
+  EXPECT_EQ(one.ult(allOnes), '1');
+  EXPECT_EQ(one.slt(allOnes), '0');
+  EXPECT_EQ(allOnes.to_int(), -1);
+  EXPECT_THROW(allOnes.to_uint(), std::range_error);
+  EXPECT_EQ(BitValueRepresentation(64, -1).umulh(BitValueRepresentation(64, -1)).to_int(), -2);
+  EXPECT_EQ(BitValueRepresentation(64, -1).smulh(BitValueRepresentation(64, -1)).to_int(), 0);
+}
+
+TEST(bitstring, ValueRepresentationUnknownBits)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  BitValueRepresentation value("01DX");
+
+  // Act & Assert
+  EXPECT_FALSE(value.is_known());
+  EXPECT_FALSE(value.is_defined());
+  EXPECT_EQ(value.land(BitValueRepresentation("1111")), std::string("01DX"));
+  EXPECT_EQ(value.land(BitValueRepresentation("0000")), std::string("0000"));
+  EXPECT_EQ(value.lor(BitValueRepresentation("1111")), std::string("1111"));
+  EXPECT_EQ(value.lxor(BitValueRepresentation("0110")), std::string("00DX"));
+  EXPECT_EQ(value.lnot(), std::string("10DX"));
+  EXPECT_EQ(value.shl(1), std::string("001D"));
+  EXPECT_EQ(value.ashr(1), std::string("1DXX"));
+
+  value[3] = '1';
+  EXPECT_EQ(value, std::string("01D1"));
+  EXPECT_TRUE(value.is_defined());
+  EXPECT_EQ(value.str(), "01D1");
+}
+
+namespace
+{
+
+/**
+ * A bit-serial model of BitValueRepresentation on strings of '0', '1', 'D', and 'X' with the
+ * least significant bit first. It evaluates every operation one bit at a time, as the original
+ * representation with one char per bit did, and serves as reference for the word-wise one.
+ */
+struct BitModel
+{
+  static char
+  lor(char a, char b)
+  {
+    if (a == '1' || b == '1')
+      return '1';
+    if (a == 'X' || b == 'X')
+      return 'X';
+    if (a == 'D' || b == 'D')
+      return 'D';
+    return '0';
+  }
+
+  static char
+  land(char a, char b)
+  {
+    if (a == '0' || b == '0')
+      return '0';
+    if (a == 'X' || b == 'X')
+      return 'X';
+    if (a == 'D' || b == 'D')
+      return 'D';
+    return '1';
+  }
+
+  static char
+  lxor(char a, char b)
+  {
+    if (a == 'X' || b == 'X')
+      return 'X';
+    if (a == 'D' || b == 'D')
+      return 'D';
+    return a == b ? '0' : '1';
+  }
+
+  static char
+  lnot(char a)
+  {
+    return lxor('1', a);
+  }
+
+  static std::string
+  land(const std::string & a, const std::string & b)
+  {
+    std::string result(a.size(), 'X');
+    for (size_t n = 0; n < a.size(); n++)
+      result[n] = land(a[n], b[n]);
+    return result;
+  }
+
+  static std::string
+  lor(const std::string & a, const std::string & b)
+  {
+    std::string result(a.size(), 'X');
+    for (size_t n = 0; n < a.size(); n++)
+      result[n] = lor(a[n], b[n]);
+    return result;
+  }
+
+  static std::string
+  lxor(const std::string & a, const std::string & b)
+  {
+    std::string result(a.size(), 'X');
+    for (size_t n = 0; n < a.size(); n++)
+      result[n] = lxor(a[n], b[n]);
+    return result;
+  }
+
+  static std::string
+  lnot(const std::string & a)
+  {
+    return lxor(a, std::string(a.size(), '1'));
+  }
+
+  static std::string
+  add(const std::string & a, const std::string & b)
+  {
+    std::string sum(a.size(), 'X');
+    char carry = '0';
+    for (size_t n = 0; n < a.size(); n++)
+    {
+      sum[n] = lxor(lxor(a[n], b[n]), carry);
+      carry = lor(lor(land(a[n], b[n]), land(a[n], carry)), land(b[n], carry));
+    }
+    return sum;
+  }
+
+  static std::string
+  neg(const std::string & a)
+  {
+    std::string one(a.size(), '0');
+    one[0] = '1';
+    return add(lnot(a), one);
+  }
+
+  static std::string
+  sub(const std::string & a, const std::string & b)
+  {
+    return add(a, neg(b));
+  }
+
+  static std::string
+  shl(const std::string & a, size_t shift)
+  {
+    if (shift >= a.size())
+      return std::string(a.size(), '0');
+    return std::string(shift, '0') + a.substr(0, a.size() - shift);
+  }
+
+  static std::string
+  shr(const std::string & a, size_t shift)
+  {
+    if (shift >= a.size())
+      return std::string(a.size(), '0');
+    return a.substr(shift) + std::string(shift, '0');
+  }
+
+  static std::string
+  ashr(const std::string & a, size_t shift)
+  {
+    if (shift >= a.size())
+      return std::string(a.size(), a.back());
+    return a.substr(shift) + std::string(shift, a.back());
+  }
+
+  static char
+  ult(const std::string & a, const std::string & b)
+  {
+    char v = land(lnot(a[0]), b[0]);
+    for (size_t n = 1; n < a.size(); n++)
+      v = land(lor(lnot(a[n]), b[n]), lor(land(lnot(a[n]), b[n]), v));
+    return v;
+  }
+
+  static char
+  ule(const std::string & a, const std::string & b)
+  {
+    char v = '1';
+    for (size_t n = 0; n < a.size(); n++)
+      v = land(land(lor(lnot(a[n]), b[n]), lor(lnot(a[n]), v)), lor(v, b[n]));
+    return v;
+  }
+
+  static std::string
+  flipSign(std::string a)
+  {
+    a.back() = lnot(a.back());
+    return a;
+  }
+
+  static char
+  slt(const std::string & a, const std::string & b)
+  {
+    return ult(flipSign(a), flipSign(b));
+  }
+
+  static char
+  sle(const std::string & a, const std::string & b)
+  {
+    return ule(flipSign(a), flipSign(b));
+  }
+
+  static char
+  ne(const std::string & a, const std::string & b)
+  {
+    char v = '0';
+    for (size_t n = 0; n < a.size(); n++)
+      v = lor(v, lxor(a[n], b[n]));
+    return v;
+  }
+
+  /**
+   * @return The product of \p a and \p b with a.size() + b.size() bits.
+   */
+  static std::string
+  product(const std::string & a, const std::string & b)
+  {
+    std::string product(a.size() + b.size(), '0');
+    for (size_t i = 0; i < a.size(); i++)
+    {
+      char carry = '0';
+      for (size_t j = 0; j < b.size(); j++)
+      {
+        const auto bit = land(a[i], b[j]);
+        const auto sum = lxor(lxor(bit, product[i + j]), carry);
+        carry = lor(lor(land(bit, product[i + j]), land(bit, carry)), land(product[i + j], carry));
+        product[i + j] = sum;
+      }
+    }
+    return product;
+  }
+
+  static std::string
+  mul(const std::string & a, const std::string & b)
+  {
+    return product(a, b).substr(0, a.size());
+  }
+
+  static std::string
+  umulh(const std::string & a, const std::string & b)
+  {
+    const std::string zeros(a.size(), '0');
+    return product(a + zeros, b + zeros).substr(a.size(), a.size());
+  }
+
+  static std::string
+  smulh(const std::string & a, const std::string & b)
+  {
+    return product(a + std::string(a.size(), a.back()), b + std::string(b.size(), b.back()))
+        .substr(a.size(), a.size());
+  }
+
+  /**
+   * @return The quotient and remainder of the unsigned division of \p a by \p b.
+   */
+  static std::pair<std::string, std::string>
+  udivmod(const std::string & a, const std::string & b)
+  {
+    std::string quotient(a.size(), '0');
+    std::string remainder(a.size(), '0');
+    for (size_t n = 0; n < a.size(); n++)
+    {
+      remainder = shl(remainder, 1);
+      remainder[0] = a[a.size() - n - 1];
+      if (lnot(ult(remainder, b)) == '1')
+      {
+        remainder = sub(remainder, b);
+        quotient[a.size() - n - 1] = '1';
+      }
+    }
+    return { quotient, remainder };
+  }
+
+  /**
+   * @return The quotient and remainder of the signed division of \p a by \p b.
+   */
+  static std::pair<std::string, std::string>
+  sdivmod(const std::string & a, const std::string & b)
+  {
+    const auto isNegative = [](const std::string & value)
+    {
+      return value.back() == '1';
+    };
+
+    auto [quotient, remainder] =
+        udivmod(isNegative(a) ? neg(a) : a, isNegative(b) ? neg(b) : b);
+    if (isNegative(a))
+      remainder = neg(remainder);
+    if (isNegative(a) != isNegative(b))
+      quotient = neg(quotient);
+    return { quotient, remainder };
+  }
+};
+
+/**
+ * Creates a random bit string of \p nbits bits. Depending on \p kind, the bits are uniformly
+ * random known bits, runs of equal known bits to provoke long carry chains, or known bits mixed
+ * with 'D' and 'X' bits.
+ */
+std::string
+CreateRandomBits(std::mt19937 & random, size_t nbits, size_t kind)
+{
+  std::string bits(nbits, '0');
+  char runBit = '0';
+  for (auto & bit : bits)
+  {
+    switch (kind)
+    {
+    case 0:
+      bit = random() % 2 ? '1' : '0';
+      break;
+    case 1:
+      if (random() % 16 == 0)
+        runBit = BitModel::lnot(runBit);
+      bit = runBit;
+      break;
+    default:
+      bit = "0101010101DX"[random() % 12];
+      break;
+    }
+  }
+  return bits;
+}
+
+}
+
+TEST(bitstring, ValueRepresentationMatchesBitSerialModel)
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  std::mt19937 random(4711);
+  const size_t bitWidths[] = { 1, 5, 63, 64, 65, 129 };
+  const size_t numPairsPerWidth = 16;
+
+  for (const auto nbits : bitWidths)
+  {
+    for (size_t n = 0; n < numPairsPerWidth; n++)
+    {
+      const auto a = CreateRandomBits(random, nbits, random() % 3);
+      const auto b = CreateRandomBits(random, nbits, random() % 3);
+      const auto shift = random() % (nbits + 2);
+      SCOPED_TRACE("a = " + a + ", b = " + b + ", shift = " + std::to_string(shift));
+
+      // Act
+      const BitValueRepresentation x(a.c_str());
+      const BitValueRepresentation y(b.c_str());
+
+      // Assert
+      EXPECT_EQ(x.str(), a);
+      EXPECT_EQ(x.is_known(), a.find_first_of("DX") == std::string::npos);
+      EXPECT_EQ(x.is_defined(), a.find('X') == std::string::npos);
+
+      EXPECT_EQ(x.land(y).str(), BitModel::land(a, b));
+      EXPECT_EQ(x.lor(y).str(), BitModel::lor(a, b));
+      EXPECT_EQ(x.lxor(y).str(), BitModel::lxor(a, b));
+      EXPECT_EQ(x.lnot().str(), BitModel::lnot(a));
+
+      EXPECT_EQ(x.add(y).str(), BitModel::add(a, b));
+      EXPECT_EQ(x.sub(y).str(), BitModel::sub(a, b));
+      EXPECT_EQ(x.neg().str(), BitModel::neg(a));
+      EXPECT_EQ(x.mul(y).str(), BitModel::mul(a, b));
+      EXPECT_EQ(x.umulh(y).str(), BitModel::umulh(a, b));
+      EXPECT_EQ(x.smulh(y).str(), BitModel::smulh(a, b));
+
+      const auto [uquotient, uremainder] = BitModel::udivmod(a, b);
+      EXPECT_EQ(x.udiv(y).str(), uquotient);
+      EXPECT_EQ(x.umod(y).str(), uremainder);
+      const auto [squotient, sremainder] = BitModel::sdivmod(a, b);
+      EXPECT_EQ(x.sdiv(y).str(), squotient);
+      EXPECT_EQ(x.smod(y).str(), sremainder);
+
+      EXPECT_EQ(x.ult(y), BitModel::ult(a, b));
+      EXPECT_EQ(x.ule(y), BitModel::ule(a, b));
+      EXPECT_EQ(x.slt(y), BitModel::slt(a, b));
+      EXPECT_EQ(x.sle(y), BitModel::sle(a, b));
+      EXPECT_EQ(x.ugt(y), BitModel::lnot(BitModel::ule(a, b)));
+      EXPECT_EQ(x.uge(y), BitModel::lnot(BitModel::ult(a, b)));
+      EXPECT_EQ(x.sgt(y), BitModel::lnot(BitModel::sle(a, b)));
+      EXPECT_EQ(x.sge(y), BitModel::lnot(BitModel::slt(a, b)));
+      EXPECT_EQ(x.ne(y), BitModel::ne(a, b));
+      EXPECT_EQ(x.eq(y), BitModel::lnot(BitModel::ne(a, b)));
+      EXPECT_EQ(x == y, a == b);
+
+      EXPECT_EQ(x.shl(shift).str(), BitModel::shl(a, shift));
+      EXPECT_EQ(x.shr(shift).str(), BitModel::shr(a, shift));
+      EXPECT_EQ(x.ashr(shift).str(), BitModel::ashr(a, shift));
+
+      EXPECT_EQ(x.concat(y).str(), a + b);
+      EXPECT_EQ(x.zext(nbits).str(), a + std::string(nbits, '0'));
+      EXPECT_EQ(x.sext(nbits).str(), a + std::string(nbits, a.back()));
+      const auto low = shift % nbits;
+      EXPECT_EQ(x.slice(low, nbits).str(), a.substr(low));
+
+      // Single bits written through operator[] must be identical to writing the string
+      auto z = y;
+      auto c = b;
+      const auto index = random() % nbits;
+      z[index] = c[index] = "01DX"[random() % 4];
+      z[nbits - 1] = x[0];
+      c[nbits - 1] = a[0];
+      EXPECT_EQ(z.str(), c);
+      EXPECT_EQ(z == BitValueRepresentation(c.c_str()), true);
+    }
+  }
+}
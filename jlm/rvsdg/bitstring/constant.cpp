@@ -5,6 +5,7 @@
  */
 
 #include <jlm/rvsdg/bitstring/constant.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::rvsdg
 {
@@ -23,6 +24,12 @@ BitConstantOperation::operator==(const Operation & other) const noexcept
   return operation && operation->value_ == value_;
 }
 
+std::size_t
+BitConstantOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(NullaryOperation::ComputeHash(), value_.ComputeHash());
+}
+
 std::string
 BitConstantOperation::debug_string() const
 {
@@ -68,7 +68,7 @@ BitType::Create(std::size_t nbits)
   }
   else
   {
-    return std::make_shared<BitType>(nbits);
+    return internType<BitType>(std::make_shared<BitType>(nbits));
   }
 }
 
@@ -5,82 +5,856 @@
  */
 
 #include <jlm/rvsdg/bitstring/value-representation.hpp>
+#include <jlm/util/Hash.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace jlm::rvsdg
 {
 
-uint64_t
-BitValueRepresentation::to_uint() const
+static bool
+isValidBit(char c) noexcept
 {
-  size_t limit = std::min(nbits(), size_t(64));
-  /* bits beyond 64 must be zero, else value is not representable as uint64_t */
-  for (size_t n = limit; n < nbits(); ++n)
+  return c == '0' || c == '1' || c == 'X' || c == 'D';
+}
+
+static uint64_t
+lowBitsMask(size_t numBits) noexcept
+{
+  return numBits >= 64 ? ~uint64_t(0) : (uint64_t(1) << numBits) - 1;
+}
+
+/**
+ * Computes the full 128-bit product of \p a and \p b.
+ */
+static void
+multiplyWide(uint64_t a, uint64_t b, uint64_t & high, uint64_t & low) noexcept
+{
+  const uint64_t aLow = a & 0xFFFFFFFF, aHigh = a >> 32;
+  const uint64_t bLow = b & 0xFFFFFFFF, bHigh = b >> 32;
+
+  const uint64_t lowLow = aLow * bLow;
+  const uint64_t highLow = aHigh * bLow;
+  const uint64_t lowHigh = aLow * bHigh;
+  const uint64_t highHigh = aHigh * bHigh;
+
+  const uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + lowHigh;
+  low = (middle << 32) | (lowLow & 0xFFFFFFFF);
+  high = highHigh + (highLow >> 32) + (middle >> 32);
+}
+
+BitValueRepresentation::BitValueRepresentation(size_t nbits)
+{
+  resize(nbits);
+}
+
+BitValueRepresentation::BitValueRepresentation(size_t nbits, int64_t value)
+{
+  if (nbits == 0)
+    throw util::Error("Number of bits is zero.");
+
+  if (nbits < 64 && (value >> nbits) != 0 && (value >> nbits != -1))
+    throw util::Error("Value cannot be represented with the given number of bits.");
+
+  resize(nbits);
+  const Word signExtension = value < 0 ? ~Word(0) : 0;
+  auto chunks = this->chunks();
+  for (size_t n = 0; n < numChunks(); n++)
   {
-    if (data_[n] != '0')
-      throw std::range_error("Bit constant value exceeds uint64 range");
+    const auto mask = chunkMask(n);
+    chunks[n].known = mask;
+    chunks[n].defined = mask;
+    chunks[n].value = (n == 0 ? static_cast<Word>(value) : signExtension) & mask;
+  }
+}
+
+BitValueRepresentation::BitValueRepresentation(const char * s)
+{
+  const auto length = strlen(s);
+  if (length == 0)
+    throw util::Error("Number of bits is zero.");
+
+  resize(length);
+  for (size_t n = 0; n < length; n++)
+    setBit(n, s[n]);
+}
+
+BitValueRepresentation::BitValueRepresentation(const char c)
+{
+  resize(1);
+  setBit(0, c);
+}
+
+BitValueRepresentation::BitValueRepresentation(const BitValueRepresentation & other)
+{
+  *this = other;
+}
+
+BitValueRepresentation::BitValueRepresentation(BitValueRepresentation && other) noexcept
+{
+  *this = std::move(other);
+}
+
+BitValueRepresentation &
+BitValueRepresentation::operator=(const BitValueRepresentation & other)
+{
+  if (this == &other)
+    return *this;
+
+  resize(other.numBits_);
+  std::copy(other.chunks(), other.chunks() + other.numChunks(), chunks());
+  return *this;
+}
+
+BitValueRepresentation &
+BitValueRepresentation::operator=(BitValueRepresentation && other) noexcept
+{
+  if (this == &other)
+    return *this;
+
+  numBits_ = other.numBits_;
+  inlineChunk_ = other.inlineChunk_;
+  heapChunks_ = std::move(other.heapChunks_);
+
+  other.numBits_ = 0;
+  other.inlineChunk_ = {};
+  return *this;
+}
+
+BitValueRepresentation
+BitValueRepresentation::repeat(size_t nbits, char bit)
+{
+  if (nbits == 0)
+    throw util::Error("Number of bits is zero.");
+  if (!isValidBit(bit))
+    throw util::Error("Not a valid bit.");
+
+  BitValueRepresentation result(nbits);
+  auto chunks = result.chunks();
+  for (size_t n = 0; n < result.numChunks(); n++)
+  {
+    const auto mask = result.chunkMask(n);
+    chunks[n].known = (bit == '0' || bit == '1') ? mask : 0;
+    chunks[n].value = bit == '1' ? mask : 0;
+    chunks[n].defined = bit != 'X' ? mask : 0;
   }
 
-  uint64_t result = 0;
-  uint64_t pos_value = 1;
-  for (size_t n = 0; n < limit; ++n)
+  return result;
+}
+
+BitValueRepresentation
+BitValueRepresentation::create(const std::vector<BitValueRepresentation> & bitValues)
+{
+  JLM_ASSERT(!bitValues.empty());
+
+  if (bitValues.size() == 1)
+    return bitValues[0];
+
+  size_t numBits = 0;
+  for (const auto & bitValue : bitValues)
+    numBits += bitValue.nbits();
+
+  BitValueRepresentation result(numBits);
+  size_t position = 0;
+  for (const auto & bitValue : bitValues)
   {
-    switch (data_[n])
-    {
-    case '0':
-    {
-      break;
-    }
-    case '1':
+    result.copyBits(position, bitValue, 0, bitValue.nbits());
+    position += bitValue.nbits();
+  }
+
+  return result;
+}
+
+char
+BitValueRepresentation::lor(char a, char b) noexcept
+{
+  switch (a)
+  {
+  case '0':
+    return b;
+  case '1':
+    return '1';
+  case 'X':
+    if (b == '1')
+      return '1';
+    return 'X';
+  case 'D':
+    if (b == '1')
+      return '1';
+    if (b == 'X')
+      return 'X';
+    return 'D';
+  default:
+    return 'X';
+  }
+}
+
+char
+BitValueRepresentation::lxor(char a, char b) noexcept
+{
+  switch (a)
+  {
+  case '0':
+    return b;
+  case '1':
+    if (b == '1')
+      return '0';
+    if (b == '0')
+      return '1';
+    return b;
+  case 'X':
+    return 'X';
+  case 'D':
+    if (b == 'X')
+      return 'X';
+    return a;
+  default:
+    return 'X';
+  }
+}
+
+char
+BitValueRepresentation::land(char a, char b) noexcept
+{
+  switch (a)
+  {
+  case '0':
+    return '0';
+  case '1':
+    return b;
+  case 'X':
+    if (b == '0')
+      return '0';
+    return 'X';
+  case 'D':
+    if (b == '0')
+      return '0';
+    if (b == 'X')
+      return 'X';
+    return 'D';
+  default:
+    return 'X';
+  }
+}
+
+void
+BitValueRepresentation::udiv(
+    const BitValueRepresentation & divisor,
+    BitValueRepresentation & quotient,
+    BitValueRepresentation & remainder) const
+{
+  JLM_ASSERT(quotient == 0);
+  JLM_ASSERT(remainder == 0);
+
+  if (divisor.nbits() != nbits())
+    throw util::Error(
+        jlm::util::strfmt("Unequal number of bits in udiv, ", divisor.nbits(), " != ", nbits()));
+
+  /*
+    FIXME: This should check whether divisor is zero, not whether nbits() is zero.
+  */
+  if (divisor.nbits() == 0)
+    throw util::Error("Division by zero.");
+
+  if (nbits() <= BitsPerWord && is_known() && divisor.is_known())
+  {
+    // A division by zero results in a quotient of all ones, and the dividend as remainder
+    const auto dividendWord = knownWord();
+    const auto divisorWord = divisor.knownWord();
+    const auto quotientWord = divisorWord == 0 ? ~Word(0) : dividendWord / divisorWord;
+    const auto remainderWord = divisorWord == 0 ? dividendWord : dividendWord % divisorWord;
+    quotient = fromKnownWord(nbits(), quotientWord);
+    remainder = fromKnownWord(nbits(), remainderWord);
+    return;
+  }
+
+  for (size_t n = 0; n < nbits(); n++)
+  {
+    remainder = remainder.shl(1);
+    remainder[0] = getBit(nbits() - n - 1);
+    if (remainder.uge(divisor) == '1')
     {
-      result |= pos_value;
-      break;
+      remainder = remainder.sub(divisor);
+      quotient[nbits() - n - 1] = '1';
     }
-    default:
+  }
+}
+
+void
+BitValueRepresentation::mul(
+    const BitValueRepresentation & factor1,
+    const BitValueRepresentation & factor2,
+    BitValueRepresentation & product)
+{
+  JLM_ASSERT(product.nbits() == factor1.nbits() + factor2.nbits());
+
+  for (size_t i = 0; i < factor1.nbits(); i++)
+  {
+    char c = '0';
+    for (size_t j = 0; j < factor2.nbits(); j++)
     {
-      throw std::range_error("Undetermined bit constant");
+      char s = land(factor1[i], factor2[j]);
+      char nc = carry(s, product[i + j], c);
+      product[i + j] = add(s, product[i + j], c);
+      c = nc;
     }
-    }
-    pos_value = pos_value << 1;
   }
+}
+
+bool
+BitValueRepresentation::operator==(const BitValueRepresentation & other) const noexcept
+{
+  return numBits_ == other.numBits_
+      && std::equal(chunks(), chunks() + numChunks(), other.chunks());
+}
+
+std::size_t
+BitValueRepresentation::ComputeHash() const noexcept
+{
+  std::size_t seed = std::hash<size_t>()(numBits_);
+  for (size_t n = 0; n < numChunks(); n++)
+  {
+    const auto & chunk = chunks()[n];
+    util::combineHashesWithSeed(
+        seed,
+        std::hash<Word>()(chunk.known),
+        std::hash<Word>()(chunk.value),
+        std::hash<Word>()(chunk.defined));
+  }
+
+  return seed;
+}
+
+bool
+BitValueRepresentation::operator==(const std::string & other) const noexcept
+{
+  if (nbits() != other.size())
+    return false;
+
+  for (size_t n = 0; n < other.size(); n++)
+  {
+    if (getBit(n) != other[n])
+      return false;
+  }
+
+  return true;
+}
+
+bool
+BitValueRepresentation::is_defined() const noexcept
+{
+  for (size_t n = 0; n < numChunks(); n++)
+  {
+    if (chunks()[n].defined != chunkMask(n))
+      return false;
+  }
+
+  return true;
+}
+
+bool
+BitValueRepresentation::is_known() const noexcept
+{
+  for (size_t n = 0; n < numChunks(); n++)
+  {
+    if (chunks()[n].known != chunkMask(n))
+      return false;
+  }
+
+  return true;
+}
+
+BitValueRepresentation
+BitValueRepresentation::concat(const BitValueRepresentation & other) const
+{
+  BitValueRepresentation result(nbits() + other.nbits());
+  result.copyBits(0, *this, 0, nbits());
+  result.copyBits(nbits(), other, 0, other.nbits());
+  return result;
+}
+
+BitValueRepresentation
+BitValueRepresentation::slice(size_t low, size_t high) const
+{
+  if (high <= low || high > nbits())
+  {
+    throw util::Error("Slice is out of bound.");
+  }
+
+  BitValueRepresentation result(high - low);
+  result.copyBits(0, *this, low, high - low);
   return result;
 }
 
+std::string
+BitValueRepresentation::str() const
+{
+  std::string result(nbits(), 'X');
+  for (size_t n = 0; n < nbits(); n++)
+    result[n] = getBit(n);
+
+  return result;
+}
+
+uint64_t
+BitValueRepresentation::to_uint() const
+{
+  /* bits beyond 64 must be zero, else value is not representable as uint64_t */
+  for (size_t n = 1; n < numChunks(); n++)
+  {
+    const auto & chunk = chunks()[n];
+    if (chunk.known != chunkMask(n) || chunk.value != 0)
+      throw std::range_error("Bit constant value exceeds uint64 range");
+  }
+
+  const auto & chunk = chunks()[0];
+  if (chunk.known != chunkMask(0))
+    throw std::range_error("Undetermined bit constant");
+
+  return chunk.value;
+}
+
 int64_t
 BitValueRepresentation::to_int() const
 {
   /* all bits from 63 on must be identical, else value is not representable as int64_t */
-  char sign_bit = data_[nbits() - 1];
-  size_t limit = std::min(nbits(), size_t(63));
-  for (size_t n = limit; n < nbits(); ++n)
+  const char signBit = sign();
+  for (size_t n = std::min(nbits(), size_t(63)); n < nbits(); ++n)
   {
-    if (data_[n] != sign_bit)
+    if (getBit(n) != signBit)
       throw std::range_error("Bit constant value exceeds int64 range");
   }
 
-  int64_t result = 0;
-  uint64_t pos_value = 1;
-  for (size_t n = 0; n < 64; ++n)
+  const auto & chunk = chunks()[0];
+  if (chunk.known != chunkMask(0))
+    throw std::range_error("Undetermined bit constant");
+
+  const auto signExtension = signBit == '1' ? ~chunkMask(0) : 0;
+  return static_cast<int64_t>(chunk.value | signExtension);
+}
+
+char
+BitValueRepresentation::ult(const BitValueRepresentation & other) const
+{
+  if (nbits() != other.nbits())
+    throw util::Error(
+        jlm::util::strfmt("Unequal number of bits in ult, ", nbits(), " != ", other.nbits()));
+
+  if (is_known() && other.is_known())
   {
-    switch (n < nbits() ? data_[n] : sign_bit)
+    for (size_t n = numChunks(); n > 0; n--)
     {
-    case '0':
+      const auto value = chunks()[n - 1].value;
+      const auto otherValue = other.chunks()[n - 1].value;
+      if (value != otherValue)
+        return value < otherValue ? '1' : '0';
+    }
+
+    return '0';
+  }
+
+  char v = land(lnot(getBit(0)), other[0]);
+  for (size_t n = 1; n < nbits(); n++)
+    v = land(lor(lnot(getBit(n)), other[n]), lor(land(lnot(getBit(n)), other[n]), v));
+
+  return v;
+}
+
+char
+BitValueRepresentation::ule(const BitValueRepresentation & other) const
+{
+  if (nbits() != other.nbits())
+    throw util::Error(
+        jlm::util::strfmt("Unequal number of bits in ule, ", nbits(), " != ", other.nbits()));
+
+  if (is_known() && other.is_known())
+  {
+    for (size_t n = numChunks(); n > 0; n--)
     {
-      break;
+      const auto value = chunks()[n - 1].value;
+      const auto otherValue = other.chunks()[n - 1].value;
+      if (value != otherValue)
+        return value < otherValue ? '1' : '0';
     }
-    case '1':
+
+    return '1';
+  }
+
+  char v = '1';
+  for (size_t n = 0; n < nbits(); n++)
+    v = land(land(lor(lnot(getBit(n)), other[n]), lor(lnot(getBit(n)), v)), lor(v, other[n]));
+
+  return v;
+}
+
+char
+BitValueRepresentation::ne(const BitValueRepresentation & other) const
+{
+  if (nbits() != other.nbits())
+    throw util::Error(
+        jlm::util::strfmt("Unequal number of bits in ne, ", nbits(), " != ", other.nbits()));
+
+  if (is_known() && other.is_known())
+    return *this == other ? '0' : '1';
+
+  char v = '0';
+  for (size_t n = 0; n < nbits(); n++)
+    v = lor(v, lxor(getBit(n), other[n]));
+  return v;
+}
+
+BitValueRepresentation
+BitValueRepresentation::add(const BitValueRepresentation & other) const
+{
+  if (nbits() != other.nbits())
+    throw util::Error(
+        jlm::util::strfmt("Unequal number of bits in add, ", nbits(), " != ", other.nbits()));
+
+  if (is_known() && other.is_known())
+  {
+    BitValueRepresentation sum(*this);
+    Word carry = 0;
+    for (size_t n = 0; n < numChunks(); n++)
     {
-      result |= pos_value;
-      break;
+      const auto value = chunks()[n].value;
+      const auto otherValue = other.chunks()[n].value;
+      const auto partialSum = value + otherValue;
+      const auto fullSum = partialSum + carry;
+      carry = (partialSum < value || fullSum < partialSum) ? 1 : 0;
+      sum.chunks()[n].value = fullSum & chunkMask(n);
     }
-    default:
+
+    return sum;
+  }
+
+  char c = '0';
+  BitValueRepresentation sum = repeat(nbits(), 'X');
+  for (size_t n = 0; n < nbits(); n++)
+  {
+    sum[n] = add(getBit(n), other[n], c);
+    c = carry(getBit(n), other[n], c);
+  }
+
+  return sum;
+}
+
+BitValueRepresentation
+BitValueRepresentation::land(const BitValueRepresentation & other) const
+{
+  if (nbits() != other.nbits())
+    throw util::Error(
+        jlm::util::strfmt("Unequal number of bits in land, ", nbits(), " != ", other.nbits()));
+
+  // A bit is '0' if either bit is '0', and '1' if both are '1'
+  BitValueRepresentation result(nbits());
+  for (size_t n = 0; n < numChunks(); n++)
+  {
+    const auto & a = chunks()[n];
+    const auto & b = other.chunks()[n];
+    const auto zero = (a.known & ~a.value) | (b.known & ~b.value);
+    const auto one = a.known & a.value & b.known & b.value;
+    auto & chunk = result.chunks()[n];
+    chunk.known = zero | one;
+    chunk.value = one;
+    chunk.defined = chunk.known | (a.defined & b.defined);
+  }
+
+  return result;
+}
+
+BitValueRepresentation
+BitValueRepresentation::lor(const BitValueRepresentation & other) const
+{
+  if (nbits() != other.nbits())
+    throw util::Error(
+        jlm::util::strfmt("Unequal number of bits in lor, ", nbits(), " != ", other.nbits()));
+
+  // A bit is '1' if either bit is '1', and '0' if both are '0'
+  BitValueRepresentation result(nbits());
+  for (size_t n = 0; n < numChunks(); n++)
+  {
+    const auto & a = chunks()[n];
+    const auto & b = other.chunks()[n];
+    const auto one = (a.known & a.value) | (b.known & b.value);
+    const auto zero = a.known & ~a.value & b.known & ~b.value;
+    auto & chunk = result.chunks()[n];
+    chunk.known = zero | one;
+    chunk.value = one;
+    chunk.defined = chunk.known | (a.defined & b.defined);
+  }
+
+  return result;
+}
+
+BitValueRepresentation
+BitValueRepresentation::lxor(const BitValueRepresentation & other) const
+{
+  if (nbits() != other.nbits())
+    throw util::Error(
+        jlm::util::strfmt("Unequal number of bits in lxor, ", nbits(), " != ", other.nbits()));
+
+  // A bit is only known if both bits are known
+  BitValueRepresentation result(nbits());
+  for (size_t n = 0; n < numChunks(); n++)
+  {
+    const auto & a = chunks()[n];
+    const auto & b = other.chunks()[n];
+    auto & chunk = result.chunks()[n];
+    chunk.known = a.known & b.known;
+    chunk.value = (a.value ^ b.value) & chunk.known;
+    chunk.defined = chunk.known | (a.defined & b.defined);
+  }
+
+  return result;
+}
+
+BitValueRepresentation
+BitValueRepresentation::lnot() const
+{
+  BitValueRepresentation result(*this);
+  for (size_t n = 0; n < numChunks(); n++)
+  {
+    auto & chunk = result.chunks()[n];
+    chunk.value = ~chunk.value & chunk.known;
+  }
+
+  return result;
+}
+
+BitValueRepresentation
+BitValueRepresentation::neg() const
+{
+  if (is_known())
+  {
+    BitValueRepresentation result(*this);
+    Word carry = 1;
+    for (size_t n = 0; n < numChunks(); n++)
     {
-      throw std::range_error("Undetermined bit constant");
+      const auto value = ~chunks()[n].value + carry;
+      carry = (carry && value == 0) ? 1 : 0;
+      result.chunks()[n].value = value & chunkMask(n);
     }
+
+    return result;
+  }
+
+  char c = '1';
+  BitValueRepresentation result = repeat(nbits(), 'X');
+  for (size_t n = 0; n < nbits(); n++)
+  {
+    char tmp = lxor(getBit(n), '1');
+    result[n] = add(tmp, '0', c);
+    c = carry(tmp, '0', c);
+  }
+
+  return result;
+}
+
+BitValueRepresentation
+BitValueRepresentation::shr(size_t shift) const
+{
+  if (shift >= nbits())
+    return repeat(nbits(), '0');
+
+  auto result = repeat(nbits(), '0');
+  result.copyBits(0, *this, shift, nbits() - shift);
+  return result;
+}
+
+BitValueRepresentation
+BitValueRepresentation::ashr(size_t shift) const
+{
+  if (shift >= nbits())
+    return repeat(nbits(), sign());
+
+  auto result = repeat(nbits(), sign());
+  result.copyBits(0, *this, shift, nbits() - shift);
+  return result;
+}
+
+BitValueRepresentation
+BitValueRepresentation::shl(size_t shift) const
+{
+  if (shift == 0)
+    return *this;
+
+  if (shift >= nbits())
+    return repeat(nbits(), '0');
+
+  auto result = repeat(nbits(), '0');
+  result.copyBits(shift, *this, 0, nbits() - shift);
+  return result;
+}
+
+BitValueRepresentation
+BitValueRepresentation::mul(const BitValueRepresentation & other) const
+{
+  if (nbits() != other.nbits())
+    throw util::Error(
+        jlm::util::strfmt("Unequal number of bits in mul, ", nbits(), " != ", other.nbits()));
+
+  if (nbits() <= BitsPerWord && is_known() && other.is_known())
+    return fromKnownWord(nbits(), knownWord() * other.knownWord());
+
+  BitValueRepresentation product(2 * nbits(), 0);
+  mul(*this, other, product);
+  return product.slice(0, nbits());
+}
+
+BitValueRepresentation
+BitValueRepresentation::umulh(const BitValueRepresentation & other) const
+{
+  if (nbits() != other.nbits())
+    throw util::Error(
+        jlm::util::strfmt("Unequal number of bits in umulh, ", nbits(), " != ", other.nbits()));
+
+  if (nbits() <= BitsPerWord && is_known() && other.is_known())
+  {
+    Word high = 0, low = 0;
+    multiplyWide(knownWord(), other.knownWord(), high, low);
+    if (nbits() == BitsPerWord)
+      return fromKnownWord(nbits(), high);
+
+    return fromKnownWord(nbits(), (low >> nbits()) | (high << (BitsPerWord - nbits())));
+  }
+
+  BitValueRepresentation product(4 * nbits(), 0);
+  BitValueRepresentation factor1 = this->zext(nbits());
+  BitValueRepresentation factor2 = other.zext(nbits());
+  mul(factor1, factor2, product);
+  return product.slice(nbits(), 2 * nbits());
+}
+
+BitValueRepresentation
+BitValueRepresentation::smulh(const BitValueRepresentation & other) const
+{
+  if (nbits() != other.nbits())
+    throw util::Error(
+        jlm::util::strfmt("Unequal number of bits in smulh, ", nbits(), " != ", other.nbits()));
+
+  if (nbits() <= BitsPerWord && is_known() && other.is_known())
+  {
+    // The signed high product is the unsigned one, corrected for each negative factor
+    auto productHigh = umulh(other).knownWord();
+    if (is_negative())
+      productHigh -= other.knownWord();
+    if (other.is_negative())
+      productHigh -= knownWord();
+    return fromKnownWord(nbits(), productHigh);
+  }
+
+  BitValueRepresentation product(4 * nbits(), 0);
+  BitValueRepresentation factor1 = this->sext(nbits());
+  BitValueRepresentation factor2 = other.sext(nbits());
+  mul(factor1, factor2, product);
+  return product.slice(nbits(), 2 * nbits());
+}
+
+void
+BitValueRepresentation::Append(const BitValueRepresentation & other)
+{
+  *this = concat(other);
+}
+
+void
+BitValueRepresentation::resize(size_t nbits)
+{
+  numBits_ = nbits;
+  inlineChunk_ = {};
+  if (nbits <= BitsPerWord)
+    heapChunks_.reset();
+  else
+    heapChunks_ = std::make_unique<Chunk[]>(numChunks());
+}
+
+void
+BitValueRepresentation::setBit(size_t n, char bit)
+{
+  if (!isValidBit(bit))
+    throw util::Error("Not a valid bit.");
+
+  auto & chunk = chunks()[n / BitsPerWord];
+  const auto mask = Word(1) << (n % BitsPerWord);
+  chunk.known &= ~mask;
+  chunk.value &= ~mask;
+  chunk.defined &= ~mask;
+
+  if (bit == '0' || bit == '1')
+    chunk.known |= mask;
+  if (bit == '1')
+    chunk.value |= mask;
+  if (bit != 'X')
+    chunk.defined |= mask;
+}
+
+BitValueRepresentation::Chunk
+BitValueRepresentation::readBits(size_t position, size_t count) const noexcept
+{
+  JLM_ASSERT(count > 0 && count <= BitsPerWord && position + count <= nbits());
+
+  const auto index = position / BitsPerWord;
+  const auto offset = position % BitsPerWord;
+  const auto spansTwoChunks = offset != 0 && offset + count > BitsPerWord;
+  const auto read = [&](Word Chunk::*mask)
+  {
+    auto bits = chunks()[index].*mask >> offset;
+    if (spansTwoChunks)
+      bits |= chunks()[index + 1].*mask << (BitsPerWord - offset);
+    return bits & lowBitsMask(count);
+  };
+
+  return { read(&Chunk::known), read(&Chunk::value), read(&Chunk::defined) };
+}
+
+void
+BitValueRepresentation::writeBits(size_t position, size_t count, const Chunk & bits) noexcept
+{
+  JLM_ASSERT(count > 0 && count <= BitsPerWord && position + count <= nbits());
+
+  const auto index = position / BitsPerWord;
+  const auto offset = position % BitsPerWord;
+  const auto spansTwoChunks = offset != 0 && offset + count > BitsPerWord;
+  const auto countMask = lowBitsMask(count);
+  const auto write = [&](Word Chunk::*mask)
+  {
+    auto & low = chunks()[index].*mask;
+    low = (low & ~(countMask << offset)) | ((bits.*mask & countMask) << offset);
+    if (spansTwoChunks)
+    {
+      auto & high = chunks()[index + 1].*mask;
+      const auto shift = BitsPerWord - offset;
+      high = (high & ~(countMask >> shift)) | ((bits.*mask & countMask) >> shift);
     }
-    pos_value = pos_value << 1;
+  };
+
+  write(&Chunk::known);
+  write(&Chunk::value);
+  write(&Chunk::defined);
+}
+
+void
+BitValueRepresentation::copyBits(
+    size_t position,
+    const BitValueRepresentation & source,
+    size_t sourcePosition,
+    size_t count) noexcept
+{
+  for (size_t n = 0; n < count; n += BitsPerWord)
+  {
+    const auto numBits = std::min(BitsPerWord, count - n);
+    writeBits(position + n, numBits, source.readBits(sourcePosition + n, numBits));
   }
+}
+
+BitValueRepresentation
+BitValueRepresentation::fromKnownWord(size_t nbits, Word value)
+{
+  JLM_ASSERT(nbits <= BitsPerWord);
+
+  BitValueRepresentation result(nbits);
+  const auto mask = lowBitsMask(nbits);
+  result.inlineChunk_ = { mask, value & mask, mask };
   return result;
 }
 
@@ -12,6 +12,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -25,62 +26,91 @@ namespace jlm::rvsdg
   - '1' : one
   - 'D' : defined, but unknown
   - 'X' : undefined and unknown
+
+ The bits are packed into 64-bit words, with one mask for the known bits, one for their values,
+ and one for the defined bits. Representations of up to 64 bits are stored inline. Operations on
+ fully known values work on entire words, while operations involving unknown bits fall back to
+ evaluating the three-valued logic bit by bit.
 */
 
 class BitValueRepresentation
 {
-  BitValueRepresentation() = default;
+  using Word = uint64_t;
+  static constexpr size_t BitsPerWord = 64;
 
-public:
-  BitValueRepresentation(size_t nbits, int64_t value)
+  /**
+   * The masks of 64 consecutive bits. Bits outside of the representation are zero in all masks.
+   */
+  struct Chunk
   {
-    if (nbits == 0)
-      throw util::Error("Number of bits is zero.");
-
-    if (nbits < 64 && (value >> nbits) != 0 && (value >> nbits != -1))
-      throw util::Error("Value cannot be represented with the given number of bits.");
+    // Bits that are either '0' or '1'
+    Word known = 0;
+    // The values of the known bits. Unknown bits are zero.
+    Word value = 0;
+    // Bits that are either '0', '1', or 'D'
+    Word defined = 0;
 
-    for (size_t n = 0; n < nbits; ++n)
+    bool
+    operator==(const Chunk & other) const noexcept
     {
-      data_.push_back('0' + (value & 1));
-      value = value >> 1;
+      return known == other.known && value == other.value && defined == other.defined;
     }
-  }
+  };
+
+  /**
+   * Creates a representation of \p nbits bits that are all 'X'.
+   */
+  explicit BitValueRepresentation(size_t nbits);
+
+  BitValueRepresentation() = default;
 
-  BitValueRepresentation(const char * s)
+  /**
+   * Allows assignments of single bits through operator[].
+   */
+  class BitReference final
   {
-    if (strlen(s) == 0)
-      throw util::Error("Number of bits is zero.");
+  public:
+    BitReference(BitValueRepresentation & representation, size_t index)
+        : representation_(representation),
+          index_(index)
+    {}
 
-    for (size_t n = 0; n < strlen(s); n++)
+    BitReference &
+    operator=(char bit)
     {
-      if (s[n] != '0' && s[n] != '1' && s[n] != 'X' && s[n] != 'D')
-        throw util::Error("Not a valid bit.");
-      data_.push_back(s[n]);
+      representation_.setBit(index_, bit);
+      return *this;
     }
-  }
 
-  explicit BitValueRepresentation(const char c)
-  {
-    if (c != '0' && c != '1' && c != 'X' && c != 'D')
-      throw util::Error("Not a valid bit.");
+    BitReference &
+    operator=(const BitReference & other)
+    {
+      return *this = static_cast<char>(other);
+    }
 
-    data_.push_back(c);
-  }
+    operator char() const noexcept
+    {
+      return representation_.getBit(index_);
+    }
+
+  private:
+    BitValueRepresentation & representation_;
+    size_t index_;
+  };
+
+public:
+  BitValueRepresentation(size_t nbits, int64_t value);
+
+  BitValueRepresentation(const char * s);
 
-  BitValueRepresentation(const BitValueRepresentation & other)
-      : data_(other.data_)
-  {}
+  explicit BitValueRepresentation(const char c);
 
-  BitValueRepresentation(BitValueRepresentation && other)
-      : data_(std::move(other.data_))
-  {}
+  BitValueRepresentation(const BitValueRepresentation & other);
+
+  BitValueRepresentation(BitValueRepresentation && other) noexcept;
 
   static BitValueRepresentation
-  repeat(size_t nbits, char bit)
-  {
-    return BitValueRepresentation(std::string(nbits, bit).c_str());
-  }
+  repeat(size_t nbits, char bit);
 
   /**
    * Creates a \ref BitValueRepresentation from a vector of \ref BitValueRepresentation%s by
@@ -93,205 +123,73 @@ public:
    * \pre The method expects at least a single element in \p bitValues.
    */
   static BitValueRepresentation
-  create(const std::vector<BitValueRepresentation> & bitValues)
-  {
-    JLM_ASSERT(!bitValues.empty());
-
-    if (bitValues.size() == 1)
-      return bitValues[0];
-
-    BitValueRepresentation result;
-    for (auto bitValue : bitValues)
-    {
-      for (auto bit : bitValue.data_)
-        result.data_.push_back(bit);
-    }
-
-    return result;
-  }
+  create(const std::vector<BitValueRepresentation> & bitValues);
 
 private:
-  inline char
-  lor(char a, char b) const noexcept
-  {
-    switch (a)
-    {
-    case '0':
-      return b;
-    case '1':
-      return '1';
-    case 'X':
-      if (b == '1')
-        return '1';
-      return 'X';
-    case 'D':
-      if (b == '1')
-        return '1';
-      if (b == 'X')
-        return 'X';
-      return 'D';
-    default:
-      return 'X';
-    }
-  }
+  static char
+  lor(char a, char b) noexcept;
 
-  inline char
-  lxor(char a, char b) const noexcept
-  {
-    switch (a)
-    {
-    case '0':
-      return b;
-    case '1':
-      if (b == '1')
-        return '0';
-      if (b == '0')
-        return '1';
-      return b;
-    case 'X':
-      return 'X';
-    case 'D':
-      if (b == 'X')
-        return 'X';
-      return a;
-    default:
-      return 'X';
-    }
-  }
+  static char
+  lxor(char a, char b) noexcept;
 
-  inline char
-  lnot(char a) const noexcept
+  static char
+  lnot(char a) noexcept
   {
     return lxor('1', a);
   }
 
-  inline char
-  land(char a, char b) const noexcept
-  {
-    switch (a)
-    {
-    case '0':
-      return '0';
-    case '1':
-      return b;
-    case 'X':
-      if (b == '0')
-        return '0';
-      return 'X';
-    case 'D':
-      if (b == '0')
-        return '0';
-      if (b == 'X')
-        return 'X';
-      return 'D';
-    default:
-      return 'X';
-    }
-  }
+  static char
+  land(char a, char b) noexcept;
 
-  inline char
-  carry(char a, char b, char c) const noexcept
+  static char
+  carry(char a, char b, char c) noexcept
   {
     return lor(lor(land(a, b), land(a, c)), land(b, c));
   }
 
-  inline char
-  add(char a, char b, char c) const noexcept
+  static char
+  add(char a, char b, char c) noexcept
   {
     return lxor(lxor(a, b), c);
   }
 
-  inline void
+  void
   udiv(
       const BitValueRepresentation & divisor,
       BitValueRepresentation & quotient,
-      BitValueRepresentation & remainder) const
-  {
-    JLM_ASSERT(quotient == 0);
-    JLM_ASSERT(remainder == 0);
-
-    if (divisor.nbits() != nbits())
-      throw util::Error(
-          jlm::util::strfmt("Unequal number of bits in udiv, ", divisor.nbits(), " != ", nbits()));
-
-    /*
-      FIXME: This should check whether divisor is zero, not whether nbits() is zero.
-    */
-    if (divisor.nbits() == 0)
-      throw util::Error("Division by zero.");
-
-    for (size_t n = 0; n < nbits(); n++)
-    {
-      remainder = remainder.shl(1);
-      remainder[0] = data_[nbits() - n - 1];
-      if (remainder.uge(divisor) == '1')
-      {
-        remainder = remainder.sub(divisor);
-        quotient[nbits() - n - 1] = '1';
-      }
-    }
-  }
+      BitValueRepresentation & remainder) const;
 
-  inline void
+  static void
   mul(const BitValueRepresentation & factor1,
       const BitValueRepresentation & factor2,
-      BitValueRepresentation & product) const
-  {
-    JLM_ASSERT(product.nbits() == factor1.nbits() + factor2.nbits());
-
-    for (size_t i = 0; i < factor1.nbits(); i++)
-    {
-      char c = '0';
-      for (size_t j = 0; j < factor2.nbits(); j++)
-      {
-        char s = land(factor1[i], factor2[j]);
-        char nc = carry(s, product[i + j], c);
-        product[i + j] = add(s, product[i + j], c);
-        c = nc;
-      }
-    }
-  }
+      BitValueRepresentation & product);
 
 public:
   /*
     FIXME: add <, <=, >, >= operator for uint64_t and int64_t
   */
   BitValueRepresentation &
-  operator=(const BitValueRepresentation & other)
-  {
-    data_ = other.data_;
-    return *this;
-  }
+  operator=(const BitValueRepresentation & other);
 
   BitValueRepresentation &
-  operator=(BitValueRepresentation && other)
-  {
-    if (this == &other)
-      return *this;
+  operator=(BitValueRepresentation && other) noexcept;
 
-    data_ = std::move(other.data_);
-    return *this;
-  }
-
-  inline char &
+  inline BitReference
   operator[](size_t n)
   {
     JLM_ASSERT(n < nbits());
-    return data_[n];
+    return BitReference(*this, n);
   }
 
-  inline const char &
+  inline char
   operator[](size_t n) const
   {
     JLM_ASSERT(n < nbits());
-    return data_[n];
+    return getBit(n);
   }
 
-  inline bool
-  operator==(const BitValueRepresentation & other) const noexcept
-  {
-    return data_ == other.data_;
-  }
+  bool
+  operator==(const BitValueRepresentation & other) const noexcept;
 
   inline bool
   operator!=(const BitValueRepresentation & other) const noexcept
@@ -299,6 +197,12 @@ public:
     return !(*this == other);
   }
 
+  /**
+   * @return A hash value of the bit values. Equal value representations have equal hash values.
+   */
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept;
+
   inline bool
   operator==(int64_t value) const
   {
@@ -311,20 +215,8 @@ public:
     return !(*this == BitValueRepresentation(nbits(), value));
   }
 
-  inline bool
-  operator==(const std::string & other) const noexcept
-  {
-    if (nbits() != other.size())
-      return false;
-
-    for (size_t n = 0; n < other.size(); n++)
-    {
-      if (data_[n] != other[n])
-        return false;
-    }
-
-    return true;
-  }
+  bool
+  operator==(const std::string & other) const noexcept;
 
   inline bool
   operator!=(const std::string & other) const noexcept
@@ -335,32 +227,14 @@ public:
   inline char
   sign() const noexcept
   {
-    return data_[nbits() - 1];
+    return getBit(nbits() - 1);
   }
 
-  inline bool
-  is_defined() const noexcept
-  {
-    for (auto bit : data_)
-    {
-      if (bit == 'X')
-        return false;
-    }
-
-    return true;
-  }
+  bool
+  is_defined() const noexcept;
 
-  inline bool
-  is_known() const noexcept
-  {
-    for (auto bit : data_)
-    {
-      if (bit == 'X' || bit == 'D')
-        return false;
-    }
-
-    return true;
-  }
+  bool
+  is_known() const noexcept;
 
   inline bool
   is_negative() const noexcept
@@ -369,23 +243,10 @@ public:
   }
 
   BitValueRepresentation
-  concat(const BitValueRepresentation & other) const
-  {
-    BitValueRepresentation result(*this);
-    result.data_.insert(result.data_.end(), other.data_.begin(), other.data_.end());
-    return result;
-  }
+  concat(const BitValueRepresentation & other) const;
 
   BitValueRepresentation
-  slice(size_t low, size_t high) const
-  {
-    if (high <= low || high > nbits())
-    {
-      throw util::Error("Slice is out of bound.");
-    }
-
-    return BitValueRepresentation(std::string(&data_[low], high - low).c_str());
-  }
+  slice(size_t low, size_t high) const;
 
   BitValueRepresentation
   zext(size_t nbits) const
@@ -414,14 +275,11 @@ public:
   inline size_t
   nbits() const noexcept
   {
-    return data_.size();
+    return numBits_;
   }
 
-  inline std::string
-  str() const
-  {
-    return std::string(data_.begin(), data_.end());
-  }
+  std::string
+  str() const;
 
   uint64_t
   to_uint() const;
@@ -429,19 +287,8 @@ public:
   int64_t
   to_int() const;
 
-  inline char
-  ult(const BitValueRepresentation & other) const
-  {
-    if (nbits() != other.nbits())
-      throw util::Error(
-          jlm::util::strfmt("Unequal number of bits in ult, ", nbits(), " != ", other.nbits()));
-
-    char v = land(lnot(data_[0]), other[0]);
-    for (size_t n = 1; n < nbits(); n++)
-      v = land(lor(lnot(data_[n]), other[n]), lor(land(lnot(data_[n]), other[n]), v));
-
-    return v;
-  }
+  char
+  ult(const BitValueRepresentation & other) const;
 
   inline char
   slt(const BitValueRepresentation & other) const
@@ -452,19 +299,8 @@ public:
     return t1.ult(t2);
   }
 
-  inline char
-  ule(const BitValueRepresentation & other) const
-  {
-    if (nbits() != other.nbits())
-      throw util::Error(
-          jlm::util::strfmt("Unequal number of bits in ule, ", nbits(), " != ", other.nbits()));
-
-    char v = '1';
-    for (size_t n = 0; n < nbits(); n++)
-      v = land(land(lor(lnot(data_[n]), other[n]), lor(lnot(data_[n]), v)), lor(v, other[n]));
-
-    return v;
-  }
+  char
+  ule(const BitValueRepresentation & other) const;
 
   inline char
   sle(const BitValueRepresentation & other) const
@@ -475,18 +311,8 @@ public:
     return t1.ule(t2);
   }
 
-  inline char
-  ne(const BitValueRepresentation & other) const
-  {
-    if (nbits() != other.nbits())
-      throw util::Error(
-          jlm::util::strfmt("Unequal number of bits in ne, ", nbits(), " != ", other.nbits()));
-
-    char v = '0';
-    for (size_t n = 0; n < nbits(); n++)
-      v = lor(v, lxor(data_[n], other[n]));
-    return v;
-  }
+  char
+  ne(const BitValueRepresentation & other) const;
 
   inline char
   eq(const BitValueRepresentation & other) const
@@ -519,85 +345,22 @@ public:
   }
 
   BitValueRepresentation
-  add(const BitValueRepresentation & other) const
-  {
-    if (nbits() != other.nbits())
-      throw util::Error(
-          jlm::util::strfmt("Unequal number of bits in add, ", nbits(), " != ", other.nbits()));
-
-    char c = '0';
-    BitValueRepresentation sum = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-    {
-      sum[n] = add(data_[n], other[n], c);
-      c = carry(data_[n], other[n], c);
-    }
-
-    return sum;
-  }
+  add(const BitValueRepresentation & other) const;
 
   BitValueRepresentation
-  land(const BitValueRepresentation & other) const
-  {
-    if (nbits() != other.nbits())
-      throw util::Error(
-          jlm::util::strfmt("Unequal number of bits in land, ", nbits(), " != ", other.nbits()));
-
-    BitValueRepresentation result = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-      result[n] = land(data_[n], other[n]);
-
-    return result;
-  }
+  land(const BitValueRepresentation & other) const;
 
   BitValueRepresentation
-  lor(const BitValueRepresentation & other) const
-  {
-    if (nbits() != other.nbits())
-      throw util::Error(
-          jlm::util::strfmt("Unequal number of bits in lor, ", nbits(), " != ", other.nbits()));
-
-    BitValueRepresentation result = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-      result[n] = lor(data_[n], other[n]);
-
-    return result;
-  }
+  lor(const BitValueRepresentation & other) const;
 
   BitValueRepresentation
-  lxor(const BitValueRepresentation & other) const
-  {
-    if (nbits() != other.nbits())
-      throw util::Error(
-          jlm::util::strfmt("Unequal number of bits in lxor, ", nbits(), " != ", other.nbits()));
-
-    BitValueRepresentation result = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-      result[n] = lxor(data_[n], other[n]);
-
-    return result;
-  }
+  lxor(const BitValueRepresentation & other) const;
 
   BitValueRepresentation
-  lnot() const
-  {
-    return lxor(repeat(nbits(), '1'));
-  }
+  lnot() const;
 
   BitValueRepresentation
-  neg() const
-  {
-    char c = '1';
-    BitValueRepresentation result = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-    {
-      char tmp = lxor(data_[n], '1');
-      result[n] = add(tmp, '0', c);
-      c = carry(tmp, '0', c);
-    }
-
-    return result;
-  }
+  neg() const;
 
   BitValueRepresentation
   sub(const BitValueRepresentation & other) const
@@ -606,36 +369,13 @@ public:
   }
 
   BitValueRepresentation
-  shr(size_t shift) const
-  {
-    if (shift >= nbits())
-      return repeat(nbits(), '0');
-
-    BitValueRepresentation result(std::string(&data_[shift], nbits() - shift).c_str());
-    return result.zext(shift);
-  }
+  shr(size_t shift) const;
 
   BitValueRepresentation
-  ashr(size_t shift) const
-  {
-    if (shift >= nbits())
-      return repeat(nbits(), sign());
-
-    BitValueRepresentation result(std::string(&data_[shift], nbits() - shift).c_str());
-    return result.sext(shift);
-  }
+  ashr(size_t shift) const;
 
   BitValueRepresentation
-  shl(size_t shift) const
-  {
-    if (shift == 0)
-      return *this;
-
-    if (shift >= nbits())
-      return repeat(nbits(), '0');
-
-    return repeat(shift, '0').concat(slice(0, nbits() - shift));
-  }
+  shl(size_t shift) const;
 
   BitValueRepresentation
   udiv(const BitValueRepresentation & other) const
@@ -702,54 +442,115 @@ public:
   }
 
   BitValueRepresentation
-  mul(const BitValueRepresentation & other) const
+  mul(const BitValueRepresentation & other) const;
+
+  BitValueRepresentation
+  umulh(const BitValueRepresentation & other) const;
+
+  BitValueRepresentation
+  smulh(const BitValueRepresentation & other) const;
+
+  void
+  Append(const BitValueRepresentation & other);
+
+private:
+  [[nodiscard]] size_t
+  numChunks() const noexcept
   {
-    if (nbits() != other.nbits())
-      throw util::Error(
-          jlm::util::strfmt("Unequal number of bits in mul, ", nbits(), " != ", other.nbits()));
+    return (numBits_ + BitsPerWord - 1) / BitsPerWord;
+  }
 
-    BitValueRepresentation product(2 * nbits(), 0);
-    mul(*this, other, product);
-    return product.slice(0, nbits());
+  [[nodiscard]] Chunk *
+  chunks() noexcept
+  {
+    return numBits_ <= BitsPerWord ? &inlineChunk_ : heapChunks_.get();
   }
 
-  BitValueRepresentation
-  umulh(const BitValueRepresentation & other) const
+  [[nodiscard]] const Chunk *
+  chunks() const noexcept
   {
-    if (nbits() != other.nbits())
-      throw util::Error(
-          jlm::util::strfmt("Unequal number of bits in umulh, ", nbits(), " != ", other.nbits()));
+    return numBits_ <= BitsPerWord ? &inlineChunk_ : heapChunks_.get();
+  }
 
-    BitValueRepresentation product(4 * nbits(), 0);
-    BitValueRepresentation factor1 = this->zext(nbits());
-    BitValueRepresentation factor2 = other.zext(nbits());
-    mul(factor1, factor2, product);
-    return product.slice(nbits(), 2 * nbits());
+  /**
+   * @return A mask of the bits of chunk \p index that belong to the representation.
+   */
+  [[nodiscard]] Word
+  chunkMask(size_t index) const noexcept
+  {
+    const auto numBits = numBits_ - index * BitsPerWord;
+    return numBits >= BitsPerWord ? ~Word(0) : (Word(1) << numBits) - 1;
   }
 
-  BitValueRepresentation
-  smulh(const BitValueRepresentation & other) const
+  /**
+   * Changes the number of bits to \p nbits. All bits are set to 'X'.
+   */
+  void
+  resize(size_t nbits);
+
+  [[nodiscard]] char
+  getBit(size_t n) const noexcept
   {
-    if (nbits() != other.nbits())
-      throw util::Error(
-          jlm::util::strfmt("Unequal number of bits in smulh, ", nbits(), " != ", other.nbits()));
+    const auto & chunk = chunks()[n / BitsPerWord];
+    const auto mask = Word(1) << (n % BitsPerWord);
+    if (chunk.known & mask)
+      return (chunk.value & mask) ? '1' : '0';
 
-    BitValueRepresentation product(4 * nbits(), 0);
-    BitValueRepresentation factor1 = this->sext(nbits());
-    BitValueRepresentation factor2 = other.sext(nbits());
-    mul(factor1, factor2, product);
-    return product.slice(nbits(), 2 * nbits());
+    return (chunk.defined & mask) ? 'D' : 'X';
   }
 
   void
-  Append(const BitValueRepresentation & other)
+  setBit(size_t n, char bit);
+
+  /**
+   * Reads \p count bits, starting at bit \p position.
+   *
+   * \pre 0 < \p count <= 64
+   */
+  [[nodiscard]] Chunk
+  readBits(size_t position, size_t count) const noexcept;
+
+  /**
+   * Overwrites \p count bits, starting at bit \p position, with the lowest bits of \p bits.
+   *
+   * \pre 0 < \p count <= 64
+   */
+  void
+  writeBits(size_t position, size_t count, const Chunk & bits) noexcept;
+
+  /**
+   * Copies \p count bits of \p source, starting at bit \p sourcePosition, to this representation,
+   * starting at bit \p position.
+   */
+  void
+  copyBits(
+      size_t position,
+      const BitValueRepresentation & source,
+      size_t sourcePosition,
+      size_t count) noexcept;
+
+  /**
+   * @return The value of a fully known representation of at most 64 bits.
+   */
+  [[nodiscard]] Word
+  knownWord() const noexcept
   {
-    data_.insert(data_.end(), other.data_.begin(), other.data_.end());
+    JLM_ASSERT(numBits_ <= BitsPerWord);
+    return inlineChunk_.value;
   }
 
-private:
+  /**
+   * @return A fully known representation of \p nbits <= 64 bits with the given \p value.
+   */
+  static BitValueRepresentation
+  fromKnownWord(size_t nbits, Word value);
+
   /* [lsb ... msb] */
-  std::vector<char> data_{};
+  size_t numBits_ = 0;
+  // Storage for representations of up to 64 bits
+  Chunk inlineChunk_{};
+  // Storage for representations of more than 64 bits
+  std::unique_ptr<Chunk[]> heapChunks_{};
 };
 
 }
@@ -70,7 +70,7 @@ ControlType::Create(std::size_t nalternatives)
   }
   else
   {
-    return std::make_shared<ControlType>(nalternatives);
+    return internType<ControlType>(std::make_shared<ControlType>(nalternatives));
   }
 }
 
@@ -96,6 +96,15 @@ ControlConstantOperation::operator==(const Operation & other) const noexcept
   return operation && operation->value_ == value_;
 }
 
+std::size_t
+ControlConstantOperation::ComputeHash() const noexcept
+{
+  return util::CombineHashes(
+      NullaryOperation::ComputeHash(),
+      std::hash<size_t>()(value_.alternative()),
+      std::hash<size_t>()(value_.nalternatives()));
+}
+
 std::string
 ControlConstantOperation::debug_string() const
 {
@@ -5,6 +5,7 @@
  */
 
 #include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/structural-node.hpp>
 #include <jlm/rvsdg/substitution.hpp>
 #include <jlm/util/strfmt.hpp>
 
@@ -72,9 +73,86 @@ Graph::~Graph() noexcept = default;
 
 Graph::Graph()
     : nextRegionId_(0),
+      nextNodeIndex_(0),
+      nextOutputIndex_(0),
       RootRegion_(new Region(this))
 {}
 
+void
+Graph::compactIndices() noexcept
+{
+  size_t nodeIndex = 0;
+  size_t outputIndex = 0;
+  compactIndices(GetRootRegion(), nodeIndex, outputIndex);
+
+  nextNodeIndex_.store(nodeIndex, std::memory_order_relaxed);
+  nextOutputIndex_.store(outputIndex, std::memory_order_relaxed);
+}
+
+void
+Graph::compactIndices(Region & region, size_t & nodeIndex, size_t & outputIndex) noexcept
+{
+  for (const auto argument : region.Arguments())
+    argument->graphIndex_ = outputIndex++;
+
+  for (auto & node : region.Nodes())
+  {
+    node.graphIndex_ = nodeIndex++;
+    for (auto & output : node.Outputs())
+      output.graphIndex_ = outputIndex++;
+
+    if (const auto structuralNode = dynamic_cast<StructuralNode *>(&node))
+    {
+      for (auto & subregion : structuralNode->Subregions())
+        compactIndices(subregion, nodeIndex, outputIndex);
+    }
+  }
+}
+
+void
+Graph::enableEagerDeadNodeCollection(bool enable)
+{
+  eagerDeadNodeCollection_ = enable;
+
+  if (!enable)
+  {
+    for (const auto region : regionsWithDeadNodes_)
+      region->hasQueuedDeadNodes_ = false;
+    regionsWithDeadNodes_.clear();
+  }
+}
+
+size_t
+Graph::collectDeadNodes()
+{
+  size_t numRemovedNodes = 0;
+  while (!regionsWithDeadNodes_.empty())
+  {
+    // The region stays queued while its nodes are removed, such that it is not queued again
+    const auto region = *regionsWithDeadNodes_.begin();
+    numRemovedNodes += region->pruneSimpleNodes();
+
+    region->hasQueuedDeadNodes_ = false;
+    regionsWithDeadNodes_.erase(region);
+  }
+
+  return numRemovedNodes;
+}
+
+void
+Graph::onRegionWithDeadNodes(Region & region)
+{
+  std::lock_guard<std::mutex> guard(regionsWithDeadNodesMutex_);
+  regionsWithDeadNodes_.insert(&region);
+}
+
+void
+Graph::onRegionWithDeadNodesDestroyed(Region & region)
+{
+  std::lock_guard<std::mutex> guard(regionsWithDeadNodesMutex_);
+  regionsWithDeadNodes_.erase(&region);
+}
+
 std::unique_ptr<Graph>
 Graph::Copy() const
 {
@@ -10,9 +10,15 @@
 #include <jlm/rvsdg/node.hpp>
 #include <jlm/rvsdg/region.hpp>
 
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+
 namespace jlm::rvsdg
 {
 
+class ChangeRecorder;
+
 /**
  * Represents an import into the RVSDG of an external entity.
  */
@@ -82,16 +88,74 @@ public:
    * @return A unique identifier for a region within this graph.
    *
    * @note This method is automatically invoked when a region is created.
-   * The identifier is only unique within this graph.
+   * The identifier is only unique within this graph. It is safe to invoke this method
+   * concurrently, which permits the creation of regions in distinct lambda nodes from
+   * different threads.
    */
   [[nodiscard]] Region::Id
   generateRegionId() noexcept
   {
-    const auto regionId = nextRegionId_;
-    nextRegionId_++;
-    return regionId;
+    return nextRegionId_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @return A graph-wide index for a node.
+   *
+   * @note This method is automatically invoked when a node is created. Node indices are dense,
+   * i.e., they range from zero to numNodeIndices(), and are not reused after a node is destroyed
+   * until the indices are compacted. It is safe to invoke this method concurrently.
+   *
+   * \see compactIndices()
+   */
+  [[nodiscard]] size_t
+  generateNodeIndex() noexcept
+  {
+    return nextNodeIndex_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @return A graph-wide index for an output or region argument.
+   *
+   * @note This method is automatically invoked when an output is created. Output indices follow
+   * the same rules as node indices.
+   *
+   * \see generateNodeIndex()
+   */
+  [[nodiscard]] size_t
+  generateOutputIndex() noexcept
+  {
+    return nextOutputIndex_.fetch_add(1, std::memory_order_relaxed);
   }
 
+  /**
+   * @return An upper bound for the graph index of all nodes in the graph.
+   */
+  [[nodiscard]] size_t
+  numNodeIndices() const noexcept
+  {
+    return nextNodeIndex_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @return An upper bound for the graph index of all outputs in the graph.
+   */
+  [[nodiscard]] size_t
+  numOutputIndices() const noexcept
+  {
+    return nextOutputIndex_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Renumbers all nodes and outputs of the graph, such that the graph indices of the nodes range
+   * from zero to the number of nodes, and likewise for the outputs. This frees up the indices of
+   * destroyed nodes and outputs.
+   *
+   * @note All NodeMap, OutputMap, and NodeBitSet instances of the graph are invalidated.
+   * This method must not be invoked concurrently with the creation of nodes or outputs.
+   */
+  void
+  compactIndices() noexcept;
+
   /**
    * @return The root region of the graph.
    */
@@ -107,6 +171,39 @@ public:
   [[nodiscard]] std::unique_ptr<Graph>
   Copy() const;
 
+  /**
+   * Enables or disables the eager collection of dead nodes. While enabled, a region is queued
+   * whenever a simple node in it loses the last user of its outputs, and collectDeadNodes()
+   * removes the dead simple nodes of all queued regions. Dead structural nodes, as well as region
+   * arguments and results without users, are left to dead node elimination.
+   *
+   * Disabling the collection drops all queued regions.
+   *
+   * @param enable true to queue the regions of simple nodes that become dead
+   */
+  void
+  enableEagerDeadNodeCollection(bool enable);
+
+  [[nodiscard]] bool
+  isEagerDeadNodeCollectionEnabled() const noexcept
+  {
+    return eagerDeadNodeCollection_;
+  }
+
+  /**
+   * Removes all dead simple nodes in the regions queued by the eager collection of dead nodes,
+   * including the simple nodes that become dead while removing them.
+   *
+   * @note This method must be invoked at a point where no pass holds on to dead nodes, and not
+   * concurrently with any changes to the graph.
+   *
+   * @return The number of removed nodes.
+   *
+   * \see enableEagerDeadNodeCollection()
+   */
+  size_t
+  collectDeadNodes();
+
   /**
    * Remove all dead nodes in the graph.
    *
@@ -131,8 +228,43 @@ public:
   ExtractTailNodes(const Graph & rvsdg);
 
 private:
-  Region::Id nextRegionId_;
+  static void
+  compactIndices(Region & region, size_t & nodeIndex, size_t & outputIndex) noexcept;
+
+  /**
+   * Queues \p region for the eager collection of dead nodes.
+   *
+   * @note This method is automatically invoked when a simple node in \p region becomes dead. It
+   * is safe to invoke this method concurrently.
+   */
+  void
+  onRegionWithDeadNodes(Region & region);
+
+  /**
+   * Removes \p region from the queue of the eager collection of dead nodes.
+   *
+   * @note This method is automatically invoked when a queued region is destroyed. It is safe to
+   * invoke this method concurrently.
+   */
+  void
+  onRegionWithDeadNodesDestroyed(Region & region);
+
+  std::atomic<Region::Id> nextRegionId_;
+  std::atomic<size_t> nextNodeIndex_;
+  std::atomic<size_t> nextOutputIndex_;
+
+  // The queued regions must outlive the root region, as its destruction might queue it
+  bool eagerDeadNodeCollection_ = false;
+  std::mutex regionsWithDeadNodesMutex_;
+  std::unordered_set<Region *> regionsWithDeadNodes_{};
+
+  // The recorder shared by all change logs of the root region, if any exist
+  std::weak_ptr<ChangeRecorder> changeRecorder_{};
+
   std::unique_ptr<Region> RootRegion_;
+
+  friend class ChangeLog;
+  friend class Region;
 };
 
 }
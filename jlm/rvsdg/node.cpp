@@ -6,6 +6,7 @@
 
 #include <jlm/rvsdg/delta.hpp>
 #include <jlm/rvsdg/gamma.hpp>
+#include <jlm/rvsdg/graph.hpp>
 #include <jlm/rvsdg/lambda.hpp>
 #include <jlm/rvsdg/MatchType.hpp>
 #include <jlm/rvsdg/Phi.hpp>
@@ -30,7 +31,7 @@ Input::CheckTypes(
   if (&region != origin.region())
     throw util::Error("Invalid operand region.");
 
-  if (*type != *origin.Type())
+  if (!areTypesEqual(*type, *origin.Type()))
     throw util::TypeError(type->debug_string(), origin.Type()->debug_string());
 }
 
@@ -66,7 +67,7 @@ Input::divert_to(jlm::rvsdg::Output * new_origin)
   if (origin() == new_origin)
     return;
 
-  if (*Type() != *new_origin->Type())
+  if (!areTypesEqual(*Type(), *new_origin->Type()))
     throw jlm::util::TypeError(Type()->debug_string(), new_origin->Type()->debug_string());
 
   if (region() != new_origin->region())
@@ -137,12 +138,14 @@ Output::~Output() noexcept
 
 Output::Output(Node & owner, std::shared_ptr<const rvsdg::Type> type)
     : index_(0),
+      graphIndex_(owner.graph()->generateOutputIndex()),
       Owner_(&owner),
       Type_(std::move(type))
 {}
 
 Output::Output(rvsdg::Region * owner, std::shared_ptr<const rvsdg::Type> type)
     : index_(0),
+      graphIndex_(owner->graph()->generateOutputIndex()),
       Owner_(owner),
       Type_(std::move(type))
 {}
@@ -255,6 +258,7 @@ NodeOutput::NodeOutput(Node * node, std::shared_ptr<const rvsdg::Type> type)
 
 Node::Node(Region * region)
     : Id_(region->generateNodeId()),
+      graphIndex_(region->graph()->generateNodeIndex()),
       region_(region)
 {
   region->onBottomNodeAdded(*this);
@@ -351,6 +355,7 @@ Node::RemoveOutputs(const util::HashSet<size_t> & indices)
     auto & output = outputs_[n];
     if (output->IsDead() && indices.Contains(output->index()))
     {
+      region()->notifyOutputDestroy(output.get());
       output.reset();
       numRemovedOutputs++;
     }
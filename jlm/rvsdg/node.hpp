@@ -245,6 +245,7 @@ is(const jlm::rvsdg::Input & input) noexcept
 class Output
 {
   friend Input;
+  friend class Graph;
   friend class Node;
   friend class Region;
 
@@ -276,6 +277,17 @@ public:
     return index_;
   }
 
+  /**
+   * @return The dense index of the output within its graph.
+   *
+   * \see Graph::generateOutputIndex()
+   */
+  [[nodiscard]] size_t
+  getGraphIndex() const noexcept
+  {
+    return graphIndex_;
+  }
+
   size_t
   nusers() const noexcept
   {
@@ -520,6 +532,7 @@ private:
   add_user(jlm::rvsdg::Input * user);
 
   size_t index_;
+  size_t graphIndex_;
   std::variant<Node *, Region *> Owner_;
   std::shared_ptr<const rvsdg::Type> Type_;
   UsersList Users_;
@@ -602,6 +615,17 @@ public:
     return Id_;
   }
 
+  /**
+   * @return The dense index of the node within its graph.
+   *
+   * \see Graph::generateNodeIndex()
+   */
+  [[nodiscard]] size_t
+  getGraphIndex() const noexcept
+  {
+    return graphIndex_;
+  }
+
   [[nodiscard]] virtual const Operation &
   GetOperation() const noexcept = 0;
 
@@ -804,11 +828,13 @@ public:
 
 private:
   Id Id_;
+  size_t graphIndex_;
   Region * region_;
   std::vector<std::unique_ptr<NodeInput>> inputs_;
   std::vector<std::unique_ptr<NodeOutput>> outputs_;
   std::size_t numSuccessors_ = 0;
 
+  friend class Graph;
   friend class Output;
 };
 
@@ -5,12 +5,21 @@
  */
 
 #include <jlm/rvsdg/graph.hpp>
+#include <jlm/util/Hash.hpp>
+
+#include <typeinfo>
 
 namespace jlm::rvsdg
 {
 
 Operation::~Operation() noexcept = default;
 
+std::size_t
+Operation::ComputeHash() const noexcept
+{
+  return typeid(*this).hash_code();
+}
+
 SimpleOperation::~SimpleOperation() noexcept = default;
 
 size_t
@@ -39,6 +48,22 @@ SimpleOperation::result(size_t index) const noexcept
   return results_[index];
 }
 
+std::size_t
+SimpleOperation::ComputeHash() const noexcept
+{
+  std::size_t seed = typeid(*this).hash_code();
+
+  util::combineHashesWithSeed(seed, operands_.size());
+  for (auto & operandType : operands_)
+    util::combineHashesWithSeed(seed, operandType->ComputeHash());
+
+  util::combineHashesWithSeed(seed, results_.size());
+  for (auto & resultType : results_)
+    util::combineHashesWithSeed(seed, resultType->ComputeHash());
+
+  return seed;
+}
+
 bool
 StructuralOperation::operator==(const Operation & other) const noexcept
 {
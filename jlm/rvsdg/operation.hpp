@@ -35,6 +35,16 @@ public:
   [[nodiscard]] virtual std::unique_ptr<Operation>
   copy() const = 0;
 
+  /**
+   * Computes a hash value for the operation. Operations that are equal according to operator==
+   * must have the same hash value. The default implementation only hashes the dynamic type of the
+   * operation.
+   *
+   * @return The hash value of the operation.
+   */
+  [[nodiscard]] virtual std::size_t
+  ComputeHash() const noexcept;
+
   inline bool
   operator!=(const Operation & other) const noexcept
   {
@@ -77,6 +87,16 @@ public:
   [[nodiscard]] const std::shared_ptr<const rvsdg::Type> &
   result(size_t index) const noexcept;
 
+  /**
+   * Combines the hash of the dynamic type of the operation with the hashes of its operand and
+   * result types. Operations with additional attributes should override this method and combine
+   * the attributes with the result of this method.
+   *
+   * @return The hash value of the operation.
+   */
+  [[nodiscard]] std::size_t
+  ComputeHash() const noexcept override;
+
 private:
   std::vector<std::shared_ptr<const rvsdg::Type>> operands_;
   std::vector<std::shared_ptr<const rvsdg::Type>> results_;
@@ -6,6 +6,7 @@
 
 #include <jlm/rvsdg/DotWriter.hpp>
 #include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/SimpleNodeHashTable.hpp>
 #include <jlm/rvsdg/structural-node.hpp>
 #include <jlm/rvsdg/substitution.hpp>
 #include <jlm/rvsdg/traverser.hpp>
@@ -38,7 +39,7 @@ RegionArgument::RegionArgument(
     if (input->node() != region->node())
       throw util::Error("Argument cannot be added to input.");
 
-    if (*input->Type() != *Type())
+    if (!areTypesEqual(*input->Type(), *Type()))
     {
       throw util::TypeError(Type()->debug_string(), input->Type()->debug_string());
     }
@@ -87,7 +88,7 @@ RegionResult::RegionResult(
     if (output->node() != region->node())
       throw util::Error("Result cannot be added to output.");
 
-    if (*Type() != *output->Type())
+    if (!areTypesEqual(*Type(), *output->Type()))
     {
       throw jlm::util::TypeError(Type()->debug_string(), output->Type()->debug_string());
     }
@@ -121,6 +122,9 @@ RegionResult::Create(
 
 Region::~Region() noexcept
 {
+  // There is no need to keep the hash table up-to-date while tearing down the region
+  simpleNodeHashTable_.reset();
+
   util::HashSet<size_t> indices;
   for (size_t n = 0; n < nresults(); n++)
     indices.insert(n);
@@ -135,6 +139,9 @@ Region::~Region() noexcept
   PruneArguments();
   JLM_ASSERT(narguments() == 0);
 
+  if (hasQueuedDeadNodes_)
+    graph_->onRegionWithDeadNodesDestroyed(*this);
+
   // Disconnect observers
   while (observers_)
   {
@@ -223,6 +230,7 @@ Region::RemoveArguments(const util::HashSet<size_t> & indices)
     auto argument = arguments_[n];
     if (argument->IsDead() && indices.Contains(argument->index()))
     {
+      notifyOutputDestroy(argument);
       delete argument;
       numRemovedArguments++;
     }
@@ -247,6 +255,7 @@ Region::PruneArguments()
     auto argument = arguments_[n];
     if (argument->IsDead())
     {
+      notifyOutputDestroy(argument);
       delete argument;
       numRemovedArguments++;
     }
@@ -313,6 +322,19 @@ Region::removeNode(Node * node)
   delete node;
 }
 
+void
+Region::enableHashConsing()
+{
+  if (!simpleNodeHashTable_)
+    simpleNodeHashTable_ = std::make_unique<SimpleNodeHashTable>(*this);
+}
+
+void
+Region::disableHashConsing() noexcept
+{
+  simpleNodeHashTable_.reset();
+}
+
 void
 Region::copy(Region * target, SubstitutionMap & smap) const
 {
@@ -341,6 +363,46 @@ Region::prune(bool recursive)
   }
 }
 
+size_t
+Region::pruneSimpleNodes()
+{
+  std::vector<Node *> worklist;
+  for (auto & node : BottomNodes())
+  {
+    if (dynamic_cast<const SimpleNode *>(&node))
+      worklist.push_back(&node);
+  }
+
+  size_t numRemovedNodes = 0;
+  std::vector<Node *> operands;
+  while (!worklist.empty())
+  {
+    const auto node = worklist.back();
+    worklist.pop_back();
+
+    operands.clear();
+    for (auto & input : node->Inputs())
+    {
+      if (const auto operand = TryGetOwnerNode<SimpleNode>(*input.origin()))
+        operands.push_back(operand);
+    }
+    std::sort(operands.begin(), operands.end());
+    operands.erase(std::unique(operands.begin(), operands.end()), operands.end());
+
+    removeNode(node);
+    numRemovedNodes++;
+
+    // An operand can only become dead by losing its last user, which happens exactly once
+    for (const auto operand : operands)
+    {
+      if (operand->IsDead())
+        worklist.push_back(operand);
+    }
+  }
+
+  return numRemovedNodes;
+}
+
 void
 Region::view() const
 {
@@ -381,6 +443,15 @@ Region::onBottomNodeAdded(Node & node)
   JLM_ASSERT(node.IsDead());
   bottomNodes_.push_back(&node);
   numBottomNodes_++;
+
+  // Nodes are not yet simple nodes while they are constructed, so only the simple nodes that lose
+  // their last user are queued
+  if (graph_->isEagerDeadNodeCollectionEnabled() && !hasQueuedDeadNodes_
+      && dynamic_cast<const SimpleNode *>(&node))
+  {
+    hasQueuedDeadNodes_ = true;
+    graph_->onRegionWithDeadNodes(*this);
+  }
 }
 
 void
@@ -452,6 +523,15 @@ Region::notifyInputDestroy(Input * input)
   }
 }
 
+void
+Region::notifyOutputDestroy(Output * output)
+{
+  for (auto observer = observers_; observer; observer = observer->next_)
+  {
+    observer->onOutputDestroy(output);
+  }
+}
+
 size_t
 Region::NumRegions(const rvsdg::Region & region) noexcept
 {
@@ -11,6 +11,8 @@
 #include <jlm/util/common.hpp>
 #include <jlm/util/iterator_range.hpp>
 
+#include <memory>
+
 namespace jlm::util
 {
 class Annotation;
@@ -22,6 +24,7 @@ namespace jlm::rvsdg
 
 class Node;
 class SimpleNode;
+class SimpleNodeHashTable;
 class SimpleOperation;
 class StructuralInput;
 class StructuralNode;
@@ -558,6 +561,15 @@ public:
   void
   prune(bool recursive);
 
+  /**
+   * Removes all dead simple nodes from the region, including simple nodes that become dead during
+   * pruning. In contrast to prune(), dead structural nodes are kept.
+   *
+   * @return The number of removed nodes.
+   */
+  size_t
+  pruneSimpleNodes();
+
   /**
    * This function is meant to be used from the debugger. You can just
    * invoke it and a xdot window should pop up with a DOT visualization of the region. This depends
@@ -575,6 +587,37 @@ public:
     return nextNodeId_;
   }
 
+  /**
+   * Enables hash-consing of simple nodes in the region. While enabled, SimpleNode::Create()
+   * returns an existing node of the region if it has an equal operation and the same operands
+   * instead of creating a new node. This does not affect the subregions of the region.
+   *
+   * Callers must therefore not assume that a node returned from SimpleNode::Create() is fresh,
+   * i.e., a newly created node might be identical to an existing node.
+   *
+   * \see SimpleNodeHashTable
+   */
+  void
+  enableHashConsing();
+
+  /**
+   * Disables hash-consing of simple nodes in the region.
+   *
+   * \see enableHashConsing()
+   */
+  void
+  disableHashConsing() noexcept;
+
+  /**
+   * @return The hash table of the region's simple nodes if hash-consing is enabled, otherwise
+   * nullptr.
+   */
+  [[nodiscard]] const SimpleNodeHashTable *
+  getSimpleNodeHashTable() const noexcept
+  {
+    return simpleNodeHashTable_.get();
+  }
+
 private:
   /**
    * \brief Adds \p node to the top nodes of the region.
@@ -661,6 +704,9 @@ private:
   void
   notifyInputDestroy(Input * input);
 
+  void
+  notifyOutputDestroy(Output * output);
+
 public:
   /**
    * Checks if an operation is contained within the given \p region. If \p checkSubregions is true,
@@ -866,6 +912,12 @@ private:
    */
   mutable RegionObserver * observers_ = nullptr;
 
+  std::unique_ptr<SimpleNodeHashTable> simpleNodeHashTable_{};
+
+  // True if the region is queued for the eager collection of dead nodes
+  bool hasQueuedDeadNodes_ = false;
+
+  friend class Graph;
   friend class Node;
   friend class RegionObserver;
   friend class SimpleNode;
@@ -935,6 +987,14 @@ public:
   virtual void
   onInputDestroy(Input * input) = 0;
 
+  /**
+   * Called right before a node output or region argument is removed.
+   * This method is not called when deleting nodes, only modifying existing nodes.
+   * @param output the output that is removed
+   */
+  virtual void
+  onOutputDestroy(Output * output) = 0;
+
 private:
   RegionObserver ** pprev_;
   RegionObserver * next_;
@@ -1014,12 +1074,25 @@ public:
     return changedInputIndices_;
   }
 
+  void
+  onOutputDestroy(Output * output) override
+  {
+    destroyedOutputIndices_.push_back(output->index());
+  }
+
+  const std::vector<size_t> &
+  destroyedOutputIndices() const noexcept
+  {
+    return destroyedOutputIndices_;
+  }
+
 private:
   std::vector<Node::Id> createNodes_{};
   std::vector<Node::Id> destroyedNodes_{};
   std::vector<size_t> createdInputIndices_{};
   std::vector<size_t> changedInputIndices_{};
   std::vector<size_t> destroyedInputIndices_{};
+  std::vector<size_t> destroyedOutputIndices_{};
 };
 
 /**
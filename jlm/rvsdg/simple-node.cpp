@@ -5,6 +5,7 @@
 
 #include <jlm/rvsdg/graph.hpp>
 #include <jlm/rvsdg/simple-node.hpp>
+#include <jlm/rvsdg/SimpleNodeHashTable.hpp>
 #include <jlm/rvsdg/substitution.hpp>
 #include <jlm/util/strfmt.hpp>
 
@@ -44,6 +45,27 @@ SimpleNode::SimpleNode(
   region.notifyNodeCreate(this);
 }
 
+SimpleNode &
+SimpleNode::Create(
+    Region & region,
+    std::unique_ptr<Operation> operation,
+    const std::vector<rvsdg::Output *> & operands)
+{
+  if (!is<SimpleOperation>(*operation))
+    throw util::Error("Expected operation derived from SimpleOperation");
+
+  std::unique_ptr<SimpleOperation> simpleOperation(
+      util::assertedCast<SimpleOperation>(operation.release()));
+
+  if (const auto hashTable = region.getSimpleNodeHashTable())
+  {
+    if (const auto node = hashTable->find(*simpleOperation, operands))
+      return *node;
+  }
+
+  return *new SimpleNode(region, std::move(simpleOperation), operands);
+}
+
 const SimpleOperation &
 SimpleNode::GetOperation() const noexcept
 {
@@ -87,6 +109,14 @@ NormalizeSimpleOperationCommonNodeElimination(
     const SimpleOperation & operation,
     const std::vector<rvsdg::Output *> & operands)
 {
+  if (const auto hashTable = region.getSimpleNodeHashTable())
+  {
+    if (const auto node = hashTable->find(operation, operands))
+      return outputs(node);
+
+    return std::nullopt;
+  }
+
   auto isCongruent = [&](const Node & node)
   {
     auto simpleNode = dynamic_cast<const SimpleNode *>(&node);
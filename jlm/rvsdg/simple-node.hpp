@@ -45,19 +45,25 @@ public:
   std::string
   DebugString() const override;
 
+  /**
+   * Creates a simple node with operation \p operation and the operands \p operands in \p region.
+   *
+   * If hash-consing is enabled for \p region, and the region already contains a node with an
+   * equal operation and the same operands, then this node is returned instead of creating a new
+   * one.
+   *
+   * @param region The region in which the node is created.
+   * @param operation The operation of the node. Must be derived from SimpleOperation.
+   * @param operands The operands of the node.
+   * @return The created node, or an existing congruent node.
+   *
+   * \see Region::enableHashConsing()
+   */
   static SimpleNode &
   Create(
       Region & region,
       std::unique_ptr<Operation> operation,
-      const std::vector<rvsdg::Output *> & operands)
-  {
-    if (!is<SimpleOperation>(*operation))
-      throw util::Error("Expected operation derived from SimpleOperation");
-
-    std::unique_ptr<SimpleOperation> simpleOperation(
-        util::assertedCast<SimpleOperation>(operation.release()));
-    return *new SimpleNode(region, std::move(simpleOperation), operands);
-  }
+      const std::vector<rvsdg::Output *> & operands);
 
 private:
   std::unique_ptr<SimpleOperation> Operation_;
@@ -7,6 +7,8 @@
 #include <jlm/rvsdg/graph.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 
+#include <algorithm>
+
 /*
   How traversers operate:
 
@@ -71,12 +73,20 @@ ForwardingObserver<Traverser>::onInputDestroy(Input * input)
   traverser_.onInputDestroy(input);
 }
 
+template<typename Traverser>
+void
+ForwardingObserver<Traverser>::onOutputDestroy(Output *)
+{
+  // Dead outputs have no users, so removing them never affects the order of the traversal
+}
+
 template<bool IsConst>
 TopDownTraverserGeneric<IsConst>::~TopDownTraverserGeneric() noexcept = default;
 
 template<bool IsConst>
 TopDownTraverserGeneric<IsConst>::TopDownTraverserGeneric(RegionType * region)
-    : observer_(*region, *this),
+    : tracker_(region->getNextNodeId()),
+      observer_(*region, *this),
       nodeIdCutoff_(region->getNextNodeId())
 {
   for (auto & node : region->TopNodes())
@@ -254,7 +264,8 @@ BottomUpTraverserGeneric<IsConst>::~BottomUpTraverserGeneric() noexcept = defaul
 
 template<bool IsConst>
 BottomUpTraverserGeneric<IsConst>::BottomUpTraverserGeneric(RegionType * region)
-    : observer_(*region, *this)
+    : tracker_(region->getNextNodeId()),
+      observer_(*region, *this)
 {
   for (auto & node : region->BottomNodes())
   {
@@ -412,24 +423,28 @@ BottomUpTraverserGeneric<IsConst>::onInputDestroy(Input * input)
   }
 }
 
+template<typename NodeType>
+TraversalTracker<NodeType>::TraversalTracker(Node::Id numNodeIds)
+    : states_(numNodeIds)
+{}
+
 template<typename NodeType>
 bool
 TraversalTracker<NodeType>::isNodeVisited(NodeType * node) const
 {
-  auto i = states_.find(node);
-  return i == states_.end() ? false : i->second.state == TraversalNodeState::behind;
+  const auto id = node->GetNodeId();
+  return id < states_.size() && states_[id].state == TraversalNodeState::behind;
 }
 
 template<typename NodeType>
 void
 TraversalTracker<NodeType>::checkNodeActivation(NodeType * node, std::size_t threshold)
 {
-  auto i = states_.emplace(node, State{ TraversalNodeState::ahead }).first;
-  if (i->second.activationCount >= threshold && i->second.state == TraversalNodeState::ahead)
+  auto & state = getState(node);
+  if (state.activationCount >= threshold && state.state == TraversalNodeState::ahead)
   {
-    frontier_.push_back(node);
-    i->second.pos = std::prev(frontier_.end());
-    i->second.state = TraversalNodeState::frontier;
+    pushFrontier(node->GetNodeId(), state);
+    state.state = TraversalNodeState::frontier;
   }
 }
 
@@ -437,12 +452,11 @@ template<typename NodeType>
 void
 TraversalTracker<NodeType>::checkNodeDeactivation(NodeType * node, std::size_t threshold)
 {
-  auto i = states_.emplace(node, State{ TraversalNodeState::ahead }).first;
-  if (i->second.activationCount < threshold && i->second.state == TraversalNodeState::frontier)
+  auto & state = getState(node);
+  if (state.activationCount < threshold && state.state == TraversalNodeState::frontier)
   {
-    frontier_.erase(i->second.pos);
-    i->second.pos = frontier_.end();
-    i->second.state = TraversalNodeState::ahead;
+    eraseFrontier(state);
+    state.state = TraversalNodeState::ahead;
   }
 }
 
@@ -450,12 +464,11 @@ template<typename NodeType>
 void
 TraversalTracker<NodeType>::checkMarkNodeVisitedIfFrontier(NodeType * node)
 {
-  auto i = states_.emplace(node, State{ TraversalNodeState::ahead }).first;
-  if (i->second.state == TraversalNodeState::frontier)
+  auto & state = getState(node);
+  if (state.state == TraversalNodeState::frontier)
   {
-    frontier_.erase(i->second.pos);
-    i->second.pos = frontier_.end();
-    i->second.state = TraversalNodeState::behind;
+    eraseFrontier(state);
+    state.state = TraversalNodeState::behind;
   }
 }
 
@@ -463,8 +476,7 @@ template<typename NodeType>
 void
 TraversalTracker<NodeType>::incActivationCount(NodeType * node, std::size_t threshold)
 {
-  auto i = states_.emplace(node, State{ TraversalNodeState::ahead }).first;
-  i->second.activationCount += 1;
+  getState(node).activationCount += 1;
   checkNodeActivation(node, threshold);
 }
 
@@ -472,8 +484,7 @@ template<typename NodeType>
 void
 TraversalTracker<NodeType>::decActivationCount(NodeType * node, std::size_t threshold)
 {
-  auto i = states_.emplace(node, State{ TraversalNodeState::ahead }).first;
-  i->second.activationCount -= 1;
+  getState(node).activationCount -= 1;
   checkNodeDeactivation(node, threshold);
 }
 
@@ -481,19 +492,65 @@ template<typename NodeType>
 void
 TraversalTracker<NodeType>::removeNode(NodeType * node)
 {
-  if (const auto it = states_.find(node); it != states_.end())
-  {
-    if (it->second.state == TraversalNodeState::frontier)
-      frontier_.erase(it->second.pos);
-    states_.erase(it);
-  }
+  const auto id = node->GetNodeId();
+  if (id >= states_.size())
+    return;
+
+  auto & state = states_[id];
+  if (state.state == TraversalNodeState::frontier)
+    eraseFrontier(state);
+  state = State();
 }
 
 template<typename NodeType>
 NodeType *
 TraversalTracker<NodeType>::peek()
 {
-  return frontier_.empty() ? nullptr : frontier_.front();
+  return frontierHead_ == NoNodeId ? nullptr : states_[frontierHead_].node;
+}
+
+template<typename NodeType>
+typename TraversalTracker<NodeType>::State &
+TraversalTracker<NodeType>::getState(NodeType * node)
+{
+  const auto id = node->GetNodeId();
+  if (id >= states_.size())
+    states_.resize(std::max<size_t>(id + 1, states_.size() * 2));
+
+  auto & state = states_[id];
+  state.node = node;
+  return state;
+}
+
+template<typename NodeType>
+void
+TraversalTracker<NodeType>::pushFrontier(Node::Id id, State & state)
+{
+  state.previous = frontierTail_;
+  state.next = NoNodeId;
+  if (frontierTail_ == NoNodeId)
+    frontierHead_ = id;
+  else
+    states_[frontierTail_].next = id;
+  frontierTail_ = id;
+}
+
+template<typename NodeType>
+void
+TraversalTracker<NodeType>::eraseFrontier(State & state)
+{
+  if (state.previous == NoNodeId)
+    frontierHead_ = state.next;
+  else
+    states_[state.previous].next = state.next;
+
+  if (state.next == NoNodeId)
+    frontierTail_ = state.previous;
+  else
+    states_[state.next].previous = state.previous;
+
+  state.previous = NoNodeId;
+  state.next = NoNodeId;
 }
 
 // Explicit instantiation of all versions
@@ -9,8 +9,8 @@
 
 #include <jlm/rvsdg/region.hpp>
 
-#include <list>
-#include <unordered_map>
+#include <limits>
+#include <vector>
 
 namespace jlm::rvsdg
 {
@@ -36,12 +36,23 @@ enum class TraversalNodeState : uint8_t
 
 /**
  * Support class for tracking the state of nodes during traversal.
+ *
+ * The state of each node is kept in an array indexed by the node's Node::Id, which is dense within
+ * a region. The frontier is a doubly linked list threaded through the same array. Thus, no memory
+ * is allocated per traversal step, and no node lookup involves hashing.
+ *
  * @tparam NodeType the type of the node being tracked
  */
 template<typename NodeType>
 class TraversalTracker final
 {
 public:
+  /**
+   * @param numNodeIds The number of node ids the tracker initially makes room for. Nodes with
+   * larger ids are supported as well, but cause the state array to grow.
+   */
+  explicit TraversalTracker(Node::Id numNodeIds);
+
   /** \brief Determines whether node has been visited already. */
   bool
   isNodeVisited(NodeType * node) const;
@@ -74,17 +85,31 @@ public:
   peek();
 
 private:
-  using FrontierList = std::list<NodeType *>;
+  static constexpr Node::Id NoNodeId = std::numeric_limits<Node::Id>::max();
 
   struct State
   {
+    NodeType * node = nullptr;
     TraversalNodeState state = TraversalNodeState::ahead;
     uint32_t activationCount = 0;
-    typename FrontierList::iterator pos = {};
+    // The neighbors of the node in the frontier list
+    Node::Id previous = NoNodeId;
+    Node::Id next = NoNodeId;
   };
 
-  std::unordered_map<NodeType *, State> states_;
-  FrontierList frontier_;
+  /** \brief Returns the state of the node, growing the state array if necessary. */
+  State &
+  getState(NodeType * node);
+
+  void
+  pushFrontier(Node::Id id, State & state);
+
+  void
+  eraseFrontier(State & state);
+
+  std::vector<State> states_;
+  Node::Id frontierHead_ = NoNodeId;
+  Node::Id frontierTail_ = NoNodeId;
 };
 
 template<typename Traverser, typename NodeType>
@@ -165,6 +190,9 @@ public:
   void
   onInputDestroy(Input * input) override;
 
+  void
+  onOutputDestroy(Output * output) override;
+
 private:
   Traverser & traverser_;
 };
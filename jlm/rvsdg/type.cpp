@@ -6,9 +6,132 @@
 
 #include <jlm/rvsdg/type.hpp>
 
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <unordered_map>
+
 namespace jlm::rvsdg
 {
 
 Type::~Type() noexcept = default;
 
+namespace
+{
+
+/**
+ * Process-wide table of canonical type instances.
+ *
+ * The table is split into shards that are selected by the hash of a type, and every shard is
+ * guarded by its own mutex, such that threads that intern different types rarely contend. In
+ * addition, every thread caches the most recently interned types in a small direct-mapped cache.
+ * Lookups that hit in this cache do not acquire any lock, which avoids contention when many
+ * threads repeatedly create the same types. The cache holds its types weakly, i.e., it keeps at
+ * most the storage of a few released types per thread alive.
+ */
+class TypeInterner final
+{
+  static constexpr size_t NumShards = 64;
+  static constexpr size_t NumCacheEntries = 64;
+
+  /**
+   * A part of the table. Entries whose types have been released are reused by types with the same
+   * hash, and are purged lazily whenever the shard has doubled in size since the last purge.
+   */
+  struct alignas(64) Shard
+  {
+    std::mutex mutex{};
+    std::unordered_multimap<std::size_t, std::weak_ptr<const Type>> types{};
+    size_t numTypesAfterPurge = 16;
+  };
+
+  struct CacheEntry
+  {
+    std::size_t hash = 0;
+    std::weak_ptr<const Type> type{};
+  };
+
+public:
+  std::shared_ptr<const Type>
+  intern(std::shared_ptr<const Type> type)
+  {
+    const auto hash = type->ComputeHash();
+
+    thread_local std::array<CacheEntry, NumCacheEntries> cache{};
+    auto & cacheEntry = cache[hash % NumCacheEntries];
+    if (cacheEntry.hash == hash)
+    {
+      if (auto canonicalType = cacheEntry.type.lock())
+      {
+        if (*canonicalType == *type)
+          return canonicalType;
+      }
+    }
+
+    auto canonicalType = internInShard(shards_[(hash / NumCacheEntries) % NumShards], hash, type);
+    cacheEntry.hash = hash;
+    cacheEntry.type = canonicalType;
+    return canonicalType;
+  }
+
+private:
+  static std::shared_ptr<const Type>
+  internInShard(Shard & shard, std::size_t hash, std::shared_ptr<const Type> & type)
+  {
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    const auto [begin, end] = shard.types.equal_range(hash);
+    std::weak_ptr<const Type> * expiredEntry = nullptr;
+    for (auto it = begin; it != end; ++it)
+    {
+      if (auto canonicalType = it->second.lock())
+      {
+        if (*canonicalType == *type)
+          return canonicalType;
+      }
+      else
+      {
+        expiredEntry = &it->second;
+      }
+    }
+
+    if (expiredEntry)
+    {
+      *expiredEntry = type;
+      return type;
+    }
+
+    shard.types.emplace(hash, type);
+    if (shard.types.size() >= 2 * shard.numTypesAfterPurge)
+      purge(shard);
+
+    return type;
+  }
+
+  static void
+  purge(Shard & shard)
+  {
+    for (auto it = shard.types.begin(); it != shard.types.end();)
+    {
+      if (it->second.expired())
+        it = shard.types.erase(it);
+      else
+        ++it;
+    }
+    shard.numTypesAfterPurge = std::max<size_t>(shard.types.size(), 16);
+  }
+
+  std::array<Shard, NumShards> shards_{};
+};
+
+}
+
+std::shared_ptr<const Type>
+internType(std::shared_ptr<const Type> type)
+{
+  // The interner is intentionally leaked such that types can be interned during static
+  // destruction.
+  static auto interner = new TypeInterner();
+  return interner->intern(std::move(type));
+}
+
 }
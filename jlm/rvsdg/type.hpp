@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
 
 namespace jlm::rvsdg
 {
@@ -96,6 +97,51 @@ is(const std::shared_ptr<const jlm::rvsdg::Type> & type) noexcept
   return dynamic_cast<const T *>(type.get()) != nullptr;
 }
 
+/**
+ * \brief Returns the canonical instance of a type.
+ *
+ * Types are uniqued process-wide: if a live type that is equal to \p type was interned before,
+ * then this instance is returned. Otherwise, \p type becomes the canonical instance. Interning
+ * types ensures that equal types are usually represented by the same object, such that type
+ * comparisons can be decided by comparing pointers before falling back to operator==. The
+ * canonical instances are held weakly, i.e., they are released once no references to them exist
+ * anymore.
+ *
+ * This function is thread-safe.
+ *
+ * @param type The type to intern.
+ * @return The canonical instance of \p type.
+ */
+[[nodiscard]] std::shared_ptr<const Type>
+internType(std::shared_ptr<const Type> type);
+
+/**
+ * \copydoc internType(std::shared_ptr<const Type>)
+ */
+template<class T>
+[[nodiscard]] std::shared_ptr<const T>
+internType(std::shared_ptr<const T> type)
+{
+  static_assert(
+      std::is_base_of<jlm::rvsdg::Type, T>::value,
+      "Template parameter T must be derived from jlm::rvsdg::Type.");
+
+  return std::static_pointer_cast<const T>(
+      internType(std::static_pointer_cast<const Type>(std::move(type))));
+}
+
+/**
+ * Checks if the types \p type1 and \p type2 are equal. The check first compares the pointers,
+ * which suffices for interned types, and only falls back to operator== if they differ.
+ *
+ * @return true if the types are equal, otherwise false.
+ */
+[[nodiscard]] inline bool
+areTypesEqual(const Type & type1, const Type & type2) noexcept
+{
+  return &type1 == &type2 || type1 == type2;
+}
+
 }
 
 #endif
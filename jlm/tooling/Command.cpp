@@ -9,6 +9,7 @@
 #include <jlm/llvm/frontend/InterProceduralGraphConversion.hpp>
 #include <jlm/llvm/frontend/LlvmModuleConversion.hpp>
 #include <jlm/llvm/ir/ipgraph-module.hpp>
+#include <jlm/llvm/ir/RvsdgBinaryFormat.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/AggregateAllocaSplitting.hpp>
 #include <jlm/llvm/opt/alias-analyses/AgnosticModRefSummarizer.hpp>
@@ -36,6 +37,7 @@
 #include <jlm/tooling/Command.hpp>
 #include <jlm/tooling/CommandPaths.hpp>
 #include <jlm/util/GraphWriter.hpp>
+#include <jlm/util/Trace.hpp>
 
 #ifdef ENABLE_MLIR
 #include <jlm/mlir/backend/JlmToMlirConverter.hpp>
@@ -48,21 +50,79 @@
 #include <llvm/Support/raw_os_ostream.h>
 #include <llvm/Support/SourceMgr.h>
 
+#include <spawn.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 
+#include <cerrno>
+#include <csignal>
 #include <fstream>
 #include <unordered_map>
 
+extern char ** environ;
+
 namespace jlm::tooling
 {
 
 Command::~Command() = default;
 
+/**
+ * Runs \p command with /bin/sh in its own process group and waits for it to finish.
+ *
+ * @return The exit status of the command, or 128 plus the signal number if it was terminated by a
+ * signal.
+ */
+static int
+RunShellCommand(const std::string & command)
+{
+  posix_spawnattr_t attributes;
+  posix_spawnattr_init(&attributes);
+  // Put the shell in its own process group, such that cancellation reaches all its descendants
+  posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETPGROUP);
+  posix_spawnattr_setpgroup(&attributes, 0);
+
+  std::string shell("sh");
+  std::string option("-c");
+  std::string commandString(command);
+  char * arguments[] = { shell.data(), option.data(), commandString.data(), nullptr };
+
+  pid_t pid = 0;
+  const auto spawnError = posix_spawn(&pid, "/bin/sh", nullptr, &attributes, arguments, environ);
+  posix_spawnattr_destroy(&attributes);
+  if (spawnError != 0)
+    throw util::Error(util::strfmt("Could not spawn subcommand: ", command));
+
+  const auto subprocessSet = SubprocessSet::current();
+  if (subprocessSet)
+    subprocessSet->insert(pid);
+
+  // Wait without reaping the subprocess first, such that its process group id cannot be reused
+  // before it is removed from the subprocess set.
+  siginfo_t info;
+  int result = 0;
+  do
+  {
+    result = waitid(P_PID, pid, &info, WEXITED | WNOWAIT);
+  } while (result < 0 && errno == EINTR);
+
+  if (subprocessSet)
+    subprocessSet->erase(pid);
+
+  int status = 0;
+  if (result < 0 || waitpid(pid, &status, 0) != pid)
+    throw util::Error(util::strfmt("Could not wait for subcommand: ", command));
+
+  if (WIFSIGNALED(status))
+    return 128 + WTERMSIG(status);
+
+  return WEXITSTATUS(status);
+}
+
 void
 Command::Run() const
 {
   const auto command = ToString();
-  const auto returnCode = system(command.c_str());
+  const auto returnCode = RunShellCommand(command);
   if (returnCode != EXIT_SUCCESS)
   {
     throw util::Error(
@@ -70,6 +130,51 @@ Command::Run() const
   }
 }
 
+static thread_local SubprocessSet * CurrentSubprocessSet = nullptr;
+
+SubprocessSet::CurrentScope::CurrentScope(SubprocessSet & subprocessSet) noexcept
+    : previous_(CurrentSubprocessSet)
+{
+  CurrentSubprocessSet = &subprocessSet;
+}
+
+SubprocessSet::CurrentScope::~CurrentScope() noexcept
+{
+  CurrentSubprocessSet = previous_;
+}
+
+void
+SubprocessSet::insert(pid_t processGroup)
+{
+  std::lock_guard lock(mutex_);
+  if (isTerminated_)
+    kill(-processGroup, SIGTERM);
+
+  processGroups_.insert(processGroup);
+}
+
+void
+SubprocessSet::erase(pid_t processGroup)
+{
+  std::lock_guard lock(mutex_);
+  processGroups_.erase(processGroup);
+}
+
+void
+SubprocessSet::terminateAll()
+{
+  std::lock_guard lock(mutex_);
+  isTerminated_ = true;
+  for (auto processGroup : processGroups_)
+    kill(-processGroup, SIGTERM);
+}
+
+SubprocessSet *
+SubprocessSet::current() noexcept
+{
+  return CurrentSubprocessSet;
+}
+
 PrintCommandsCommand::~PrintCommandsCommand() = default;
 
 std::string
@@ -245,8 +350,69 @@ ClangCommand::ReplaceAll(std::string str, const std::string & from, const std::s
   return str;
 }
 
+/**
+ * Collects whether the output of a command could be restored from the compilation cache, and
+ * the time spent on computing the cache key and restoring the output.
+ */
+class CompilationCacheStatistics final : public util::Statistics
+{
+  static inline const char * NumCacheHitsLabel_ = "#CacheHits";
+  static inline const char * NumCacheMissesLabel_ = "#CacheMisses";
+
+public:
+  ~CompilationCacheStatistics() override = default;
+
+  explicit CompilationCacheStatistics(const util::FilePath & sourceFile)
+      : Statistics(Id::CompilationCache, sourceFile)
+  {}
+
+  void
+  start()
+  {
+    AddTimer(Label::Timer).start();
+  }
+
+  void
+  stop(bool isHit)
+  {
+    GetTimer(Label::Timer).stop();
+    AddMeasurement(NumCacheHitsLabel_, static_cast<uint64_t>(isHit ? 1 : 0));
+    AddMeasurement(NumCacheMissesLabel_, static_cast<uint64_t>(isHit ? 0 : 1));
+  }
+
+  static std::unique_ptr<CompilationCacheStatistics>
+  create(const util::FilePath & sourceFile)
+  {
+    return std::make_unique<CompilationCacheStatistics>(sourceFile);
+  }
+};
+
 LlcCommand::~LlcCommand() = default;
 
+void
+LlcCommand::Run() const
+{
+  if (!CompilationCache_)
+  {
+    Command::Run();
+    return;
+  }
+
+  const auto configuration = util::strfmt(
+      "llc ",
+      CompilationCache::fileIdentity(llcpath),
+      " -",
+      ToString(OptimizationLevel_),
+      " --relocation-model=",
+      ToString(RelocationModel_));
+  const auto key = CompilationCache::computeKey({ InputFile_ }, configuration);
+  if (CompilationCache_->tryRestore(key, OutputFile_))
+    return;
+
+  Command::Run();
+  CompilationCache_->store(key, OutputFile_);
+}
+
 std::string
 LlcCommand::ToString() const
 {
@@ -334,14 +500,47 @@ JlmOptCommand::ToString() const
       "-s " + CommandLineOptions_.GetStatisticsCollectorSettings().GetOutputDirectory().to_str()
       + " ";
 
+  auto traceArgument =
+      CommandLineOptions_.GetStatisticsCollectorSettings().isTracingEnabled() ? "--trace " : "";
+
+  std::string perfCountersArgument;
+  for (auto & perfCounter :
+       CommandLineOptions_.GetStatisticsCollectorSettings().GetDemandedPerfCounters().Items())
+  {
+    perfCountersArgument += perfCountersArgument.empty() ? "--perf-counters=" : ",";
+    perfCountersArgument += util::ToString(perfCounter);
+  }
+  if (!perfCountersArgument.empty())
+    perfCountersArgument += " ";
+
+  auto numThreadsArgument = CommandLineOptions_.numThreads() > 1
+                              ? util::strfmt("-j ", CommandLineOptions_.numThreads(), " ")
+                              : "";
+
+  auto & compilationCache = CommandLineOptions_.compilationCache();
+  auto cacheArguments = compilationCache ? util::strfmt(
+                                               "--cache-dir=",
+                                               compilationCache->directory().to_str(),
+                                               " --cache-size-limit=",
+                                               compilationCache->sizeLimit() / (1024 * 1024),
+                                               " ")
+                                         : "";
+
+  auto warmStartArgument = CommandLineOptions_.andersenWarmStart() ? "--andersen-warm-start " : "";
+
   return util::strfmt(
       ProgramName_,
       " ",
       inputFormatArgument,
       outputFormatArgument,
       optimizationArguments,
+      numThreadsArgument,
+      warmStartArgument,
+      cacheArguments,
       statisticsDirArgument,
       statisticsArguments,
+      traceArgument,
+      perfCountersArgument,
       outputFileArgument,
       CommandLineOptions_.GetInputFile().to_str());
 }
@@ -351,6 +550,31 @@ JlmOptCommand::Run() const
 {
   jlm::util::StatisticsCollector statisticsCollector(
       CommandLineOptions_.GetStatisticsCollectorSettings());
+  util::Tracer::CurrentScope tracerScope(statisticsCollector.GetTracer());
+  util::PerfCounterGroup::SelectionScope perfCountersScope(
+      CommandLineOptions_.GetStatisticsCollectorSettings().GetDemandedPerfCounters());
+
+  // Outputs written to stdout and RVSDG graph dumps cannot be restored from the cache
+  auto & compilationCache = CommandLineOptions_.compilationCache();
+  auto & outputFile = CommandLineOptions_.GetOutputFile();
+  std::string cacheKey;
+  if (compilationCache && !outputFile.to_str().empty() && !CommandLineOptions_.dumpRvsdgGraphs())
+  {
+    auto statistics = CompilationCacheStatistics::create(CommandLineOptions_.GetInputFile());
+    statistics->start();
+    cacheKey = CompilationCache::computeKey(
+        { CommandLineOptions_.GetInputFile() },
+        GetCompilationCacheConfiguration());
+    const auto isHit = compilationCache->tryRestore(cacheKey, outputFile);
+    statistics->stop(isHit);
+    statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+
+    if (isHit)
+    {
+      statisticsCollector.PrintStatistics();
+      return;
+    }
+  }
 
   auto rvsdgModule = ParseInputFile(
       CommandLineOptions_.GetInputFile(),
@@ -363,7 +587,8 @@ JlmOptCommand::Run() const
       statisticsCollector,
       GetTransformations(),
       dotWriter,
-      CommandLineOptions_.dumpRvsdgGraphs());
+      CommandLineOptions_.dumpRvsdgGraphs(),
+      CommandLineOptions_.numThreads());
 
   PrintRvsdgModule(
       *rvsdgModule,
@@ -371,9 +596,35 @@ JlmOptCommand::Run() const
       CommandLineOptions_.GetOutputFormat(),
       statisticsCollector);
 
+  if (!cacheKey.empty())
+    compilationCache->store(cacheKey, outputFile);
+
   statisticsCollector.PrintStatistics();
 }
 
+std::string
+JlmOptCommand::GetCompilationCacheConfiguration() const
+{
+  std::string configuration = util::strfmt(
+      "jlm-opt ",
+      CompilationCache::buildId(),
+      " --input-format=",
+      JlmOptCommandLineOptions::ToCommandLineArgument(CommandLineOptions_.GetInputFormat()),
+      " --output-format=",
+      JlmOptCommandLineOptions::ToCommandLineArgument(CommandLineOptions_.GetOutputFormat()));
+
+  for (auto & optimization : CommandLineOptions_.GetOptimizationIds())
+    configuration += util::strfmt(
+        " --",
+        JlmOptCommandLineOptions::ToCommandLineArgument(optimization));
+
+  // A seeded points-to solution can be less precise, and thereby yield a different output
+  if (CommandLineOptions_.andersenWarmStart())
+    configuration += " --andersen-warm-start";
+
+  return configuration;
+}
+
 std::vector<std::shared_ptr<rvsdg::Transformation>>
 JlmOptCommand::GetTransformations() const
 {
@@ -382,6 +633,10 @@ JlmOptCommand::GetTransformations() const
       std::shared_ptr<rvsdg::Transformation>>
       transformations;
 
+  // All memory state encodings with Andersen share a single instance
+  auto andersen = std::make_shared<llvm::aa::Andersen>();
+  andersen->EnableWarmStart(CommandLineOptions_.andersenWarmStart());
+
   std::vector<std::shared_ptr<rvsdg::Transformation>> transformationSequence;
   for (auto optimizationId : CommandLineOptions_.GetOptimizationIds())
   {
@@ -391,7 +646,7 @@ JlmOptCommand::GetTransformations() const
     }
     else
     {
-      auto transformation = CreateTransformation(optimizationId);
+      auto transformation = CreateTransformation(optimizationId, andersen);
       transformationSequence.push_back(transformation);
       transformations[optimizationId] = transformation;
     }
@@ -401,7 +656,9 @@ JlmOptCommand::GetTransformations() const
 }
 
 std::shared_ptr<rvsdg::Transformation>
-JlmOptCommand::CreateTransformation(JlmOptCommandLineOptions::OptimizationId optimizationId) const
+JlmOptCommand::CreateTransformation(
+    JlmOptCommandLineOptions::OptimizationId optimizationId,
+    const std::shared_ptr<llvm::aa::Andersen> & andersen) const
 {
   using Andersen = llvm::aa::Andersen;
   using AgnosticMrs = llvm::aa::AgnosticModRefSummarizer;
@@ -410,13 +667,20 @@ JlmOptCommand::CreateTransformation(JlmOptCommandLineOptions::OptimizationId opt
   switch (optimizationId)
   {
   case JlmOptCommandLineOptions::OptimizationId::AAAndersenAgnostic:
-    return std::make_shared<llvm::aa::PointsToAnalysisStateEncoder<Andersen, AgnosticMrs>>();
+    return std::make_shared<llvm::aa::PointsToAnalysisStateEncoder<Andersen, AgnosticMrs>>(
+        andersen);
   case JlmOptCommandLineOptions::OptimizationId::AAAndersenRegionAware:
-    return std::make_shared<llvm::aa::PointsToAnalysisStateEncoder<Andersen, RegionAwareMrs>>();
+    return std::make_shared<llvm::aa::PointsToAnalysisStateEncoder<Andersen, RegionAwareMrs>>(
+        andersen);
   case JlmOptCommandLineOptions::OptimizationId::AggregateAllocaSplitting:
     return std::make_shared<llvm::AggregateAllocaSplitting>();
   case JlmOptCommandLineOptions::OptimizationId::CommonNodeElimination:
-    return std::make_shared<llvm::CommonNodeElimination>();
+  {
+    // Repeated runs in the same pipeline only reprocess the changes since the previous run
+    auto commonNodeElimination = std::make_shared<llvm::CommonNodeElimination>();
+    commonNodeElimination->EnableIncrementalElimination(true);
+    return commonNodeElimination;
+  }
   case JlmOptCommandLineOptions::OptimizationId::DeadNodeElimination:
     return std::make_shared<llvm::DeadNodeElimination>();
   case JlmOptCommandLineOptions::OptimizationId::FunctionInlining:
@@ -502,6 +766,8 @@ JlmOptCommand::ParseInputFile(
     const JlmOptCommandLineOptions::InputFormat & inputFormat,
     util::StatisticsCollector & statisticsCollector) const
 {
+  util::TraceSpan span("ParseInputFile", "phase");
+
   if (inputFormat == tooling::JlmOptCommandLineOptions::InputFormat::Llvm)
   {
     return ParseLlvmIrFile(inputFile, statisticsCollector);
@@ -510,6 +776,10 @@ JlmOptCommand::ParseInputFile(
   {
     return ParseMlirIrFile(inputFile, statisticsCollector);
   }
+  else if (inputFormat == tooling::JlmOptCommandLineOptions::InputFormat::Rvsdg)
+  {
+    return llvm::RvsdgBinaryReader(inputFile).readModule();
+  }
   else
   {
     JLM_UNREACHABLE("Unhandled input format.");
@@ -577,6 +847,24 @@ JlmOptCommand::PrintAsMlir(
 #endif
 }
 
+void
+JlmOptCommand::PrintAsRvsdgBinary(
+    const llvm::LlvmRvsdgModule & rvsdgModule,
+    const util::FilePath & outputFile,
+    util::StatisticsCollector &)
+{
+  if (outputFile == "")
+  {
+    const auto bytes = llvm::RvsdgBinaryWriter::writeModule(rvsdgModule);
+    std::cout.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+    std::cout.flush();
+  }
+  else
+  {
+    llvm::RvsdgBinaryWriter::writeModule(rvsdgModule, outputFile);
+  }
+}
+
 void
 JlmOptCommand::PrintAsRvsdgTree(
     const llvm::LlvmRvsdgModule & rvsdgModule,
@@ -654,6 +942,8 @@ JlmOptCommand::PrintRvsdgModule(
     const JlmOptCommandLineOptions::OutputFormat & outputFormat,
     util::StatisticsCollector & statisticsCollector)
 {
+  util::TraceSpan span("PrintRvsdgModule", "phase");
+
   if (outputFormat == tooling::JlmOptCommandLineOptions::OutputFormat::Ascii)
   {
     PrintAsAscii(rvsdgModule, outputFile, statisticsCollector);
@@ -666,6 +956,10 @@ JlmOptCommand::PrintRvsdgModule(
   {
     PrintAsMlir(rvsdgModule, outputFile, statisticsCollector);
   }
+  else if (outputFormat == tooling::JlmOptCommandLineOptions::OutputFormat::Rvsdg)
+  {
+    PrintAsRvsdgBinary(rvsdgModule, outputFile, statisticsCollector);
+  }
   else if (outputFormat == tooling::JlmOptCommandLineOptions::OutputFormat::Tree)
   {
     PrintAsRvsdgTree(rvsdgModule, outputFile, statisticsCollector);
@@ -12,13 +12,23 @@
 #include <jlm/util/GraphWriter.hpp>
 
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_set>
+
+#include <sys/types.h>
 
 namespace jlm::llvm
 {
 class LlvmRvsdgModule;
 }
 
+namespace jlm::llvm::aa
+{
+class Andersen;
+}
+
 namespace jlm::tooling
 {
 
@@ -35,10 +45,75 @@ public:
   [[nodiscard]] virtual std::string
   ToString() const = 0;
 
+  /**
+   * Executes the string returned by ToString() with the shell, and waits for it to finish.
+   *
+   * @throws util::Error if the command does not exit successfully.
+   */
   virtual void
   Run() const;
 };
 
+/**
+ * Tracks the subprocesses spawned by Command::Run() during the execution of a command graph, such
+ * that they can be terminated when the execution is cancelled.
+ *
+ * Command::Run() registers its subprocesses with the set that is current for the calling thread.
+ *
+ * \see CommandGraph::Run()
+ */
+class SubprocessSet final
+{
+public:
+  /**
+   * Makes a subprocess set current for the calling thread, and restores the previously current
+   * set on destruction.
+   */
+  class CurrentScope final
+  {
+  public:
+    explicit CurrentScope(SubprocessSet & subprocessSet) noexcept;
+
+    ~CurrentScope() noexcept;
+
+    CurrentScope(const CurrentScope &) = delete;
+
+    CurrentScope &
+    operator=(const CurrentScope &) = delete;
+
+  private:
+    SubprocessSet * previous_;
+  };
+
+  /**
+   * Adds the process group \p processGroup. It is terminated immediately if the set was already
+   * terminated.
+   */
+  void
+  insert(pid_t processGroup);
+
+  void
+  erase(pid_t processGroup);
+
+  /**
+   * Sends SIGTERM to all process groups in the set, as well as to all process groups inserted
+   * afterwards.
+   */
+  void
+  terminateAll();
+
+  /**
+   * @return The set that is current for the calling thread, or nullptr if there is none.
+   */
+  [[nodiscard]] static SubprocessSet *
+  current() noexcept;
+
+private:
+  std::mutex mutex_{};
+  bool isTerminated_ = false;
+  std::unordered_set<pid_t> processGroups_{};
+};
+
 /**
  * The PrintCommandsCommand class prints the commands of a command graph in topological order.
  */
@@ -289,16 +364,25 @@ public:
       util::FilePath inputFile,
       util::FilePath outputFile,
       const OptimizationLevel & optimizationLevel,
-      const RelocationModel & relocationModel)
+      const RelocationModel & relocationModel,
+      std::optional<CompilationCache> compilationCache = std::nullopt)
       : OptimizationLevel_(optimizationLevel),
         RelocationModel_(relocationModel),
         InputFile_(std::move(inputFile)),
-        OutputFile_(std::move(outputFile))
+        OutputFile_(std::move(outputFile)),
+        CompilationCache_(std::move(compilationCache))
   {}
 
   [[nodiscard]] std::string
   ToString() const override;
 
+  /**
+   * Runs llc, or restores the output file from the compilation cache if llc was already invoked
+   * with the same input and options.
+   */
+  void
+  Run() const override;
+
   [[nodiscard]] const util::FilePath &
   OutputFile() const noexcept
   {
@@ -311,10 +395,15 @@ public:
       const util::FilePath & inputFile,
       const util::FilePath & outputFile,
       const OptimizationLevel & optimizationLevel,
-      const RelocationModel & relocationModel)
+      const RelocationModel & relocationModel,
+      std::optional<CompilationCache> compilationCache = std::nullopt)
   {
-    std::unique_ptr<LlcCommand> command(
-        new LlcCommand(inputFile, outputFile, optimizationLevel, relocationModel));
+    std::unique_ptr<LlcCommand> command(new LlcCommand(
+        inputFile,
+        outputFile,
+        optimizationLevel,
+        relocationModel,
+        std::move(compilationCache)));
     return CommandGraph::Node::Create(commandGraph, std::move(command));
   }
 
@@ -329,6 +418,7 @@ private:
   RelocationModel RelocationModel_;
   util::FilePath InputFile_;
   util::FilePath OutputFile_;
+  std::optional<CompilationCache> CompilationCache_;
 };
 
 /**
@@ -372,6 +462,13 @@ public:
       util::StatisticsCollector & statisticsCollector);
 
 private:
+  /**
+   * @return A string describing everything besides the input file that the output of the
+   * command depends on. It is part of the key used for the compilation cache.
+   */
+  [[nodiscard]] std::string
+  GetCompilationCacheConfiguration() const;
+
   std::unique_ptr<llvm::LlvmRvsdgModule>
   ParseInputFile(
       const util::FilePath & inputFile,
@@ -404,6 +501,12 @@ private:
       const util::FilePath & outputFile,
       util::StatisticsCollector & statisticsCollector);
 
+  static void
+  PrintAsRvsdgBinary(
+      const llvm::LlvmRvsdgModule & rvsdgModule,
+      const util::FilePath & outputFile,
+      util::StatisticsCollector & statisticsCollector);
+
   static void
   PrintAsRvsdgTree(
       const llvm::LlvmRvsdgModule & rvsdgModule,
@@ -426,8 +529,17 @@ private:
   [[nodiscard]] std::vector<std::shared_ptr<rvsdg::Transformation>>
   GetTransformations() const;
 
+  /**
+   * Creates the transformation for \p optimizationId.
+   * @param optimizationId the optimization to create a transformation for
+   * @param andersen the Andersen instance shared by all transformations that encode memory states
+   * using Andersen's analysis, such that they can share a warm-started solution
+   * @return the created transformation
+   */
   [[nodiscard]] std::shared_ptr<rvsdg::Transformation>
-  CreateTransformation(JlmOptCommandLineOptions::OptimizationId optimizationId) const;
+  CreateTransformation(
+      JlmOptCommandLineOptions::OptimizationId optimizationId,
+      const std::shared_ptr<llvm::aa::Andersen> & andersen) const;
 
   std::string ProgramName_;
   JlmOptCommandLineOptions CommandLineOptions_;
@@ -5,8 +5,12 @@
 
 #include <jlm/tooling/Command.hpp>
 
+#include <condition_variable>
 #include <deque>
 #include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 namespace jlm::tooling
 {
@@ -80,10 +84,93 @@ CommandGraph::SortNodesTopological(const CommandGraph & commandGraph)
 }
 
 void
-CommandGraph::Run() const
+CommandGraph::Run(size_t numJobs) const
 {
-  for (auto & node : CommandGraph::SortNodesTopological(*this))
-    node->GetCommand().Run();
+  std::mutex mutex;
+  std::condition_variable condition;
+
+  // The following state is protected by the mutex
+  std::unordered_map<const Node *, size_t> numPendingDependencies;
+  std::deque<const Node *> readyNodes;
+  size_t numRunningNodes = 0;
+  size_t numFinishedNodes = 0;
+  std::exception_ptr failure;
+
+  for (auto & node : Nodes_)
+  {
+    numPendingDependencies[node.get()] = node->NumIncomingEdges();
+    if (node->NumIncomingEdges() == 0)
+      readyNodes.push_back(node.get());
+  }
+
+  SubprocessSet subprocessSet;
+  auto runWorker = [&]()
+  {
+    SubprocessSet::CurrentScope currentScope(subprocessSet);
+
+    std::unique_lock lock(mutex);
+    while (true)
+    {
+      condition.wait(
+          lock,
+          [&]()
+          {
+            return !readyNodes.empty() || failure || numRunningNodes == 0;
+          });
+      if (failure || readyNodes.empty())
+        break;
+
+      auto node = readyNodes.front();
+      readyNodes.pop_front();
+      numRunningNodes++;
+
+      lock.unlock();
+      std::exception_ptr error;
+      try
+      {
+        node->GetCommand().Run();
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+      lock.lock();
+
+      numRunningNodes--;
+      numFinishedNodes++;
+      if (error)
+      {
+        if (!failure)
+        {
+          failure = error;
+          subprocessSet.terminateAll();
+        }
+      }
+      else
+      {
+        for (auto & edge : node->OutgoingEdges())
+        {
+          if (--numPendingDependencies[&edge.GetSink()] == 0)
+            readyNodes.push_back(&edge.GetSink());
+        }
+      }
+      condition.notify_all();
+    }
+  };
+
+  // The calling thread is one of the workers
+  std::vector<std::thread> workers;
+  for (size_t n = 1; n < numJobs; n++)
+    workers.emplace_back(runWorker);
+  runWorker();
+  for (auto & worker : workers)
+    worker.join();
+
+  if (failure)
+    std::rethrow_exception(failure);
+
+  if (numFinishedNodes != NumNodes())
+    throw util::Error("Command graph contains a cycle.");
 }
 
 CommandGraph::Node::~Node() = default;
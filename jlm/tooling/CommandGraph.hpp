@@ -67,8 +67,21 @@ public:
     return *pointer;
   }
 
+  /**
+   * Executes the commands of the graph. A command is started as soon as all the commands it
+   * depends on have finished successfully, and up to \p numJobs commands are executed
+   * concurrently.
+   *
+   * If a command fails, then no further commands are started, the subprocesses of all running
+   * commands are terminated, and the error of the failed command is rethrown once all running
+   * commands have returned.
+   *
+   * @param numJobs The maximal number of concurrently executed commands.
+   *
+   * @throws util::Error if the graph contains a cycle.
+   */
   void
-  Run() const;
+  Run(size_t numJobs = 1) const;
 
   static std::vector<CommandGraph::Node *>
   SortNodesTopological(const CommandGraph & commandGraph);
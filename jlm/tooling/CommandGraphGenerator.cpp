@@ -108,6 +108,14 @@ JlcCommandGraphGenerator::GenerateCommandGraph(const JlcCommandLineOptions & com
 {
   auto commandGraph = CommandGraph::Create();
 
+  std::optional<CompilationCache> compilationCache;
+  if (!commandLineOptions.CacheDirectory_.to_str().empty())
+  {
+    compilationCache.emplace(
+        commandLineOptions.CacheDirectory_,
+        commandLineOptions.CacheSizeLimit_);
+  }
+
   std::vector<CommandGraph::Node *> leafNodes;
   for (auto & compilation : commandLineOptions.Compilations_)
   {
@@ -142,7 +150,9 @@ JlcCommandGraphGenerator::GenerateCommandGraph(const JlcCommandLineOptions & com
           std::move(statisticsCollectorSettings),
           jlm::llvm::RvsdgTreePrinter::Configuration({}),
           commandLineOptions.JlmOptOptimizations_,
-          false);
+          false,
+          1,
+          compilationCache);
 
       auto & jlmOptCommandNode =
           JlmOptCommand::Create(*commandGraph, "jlm-opt", std::move(jlmOptCommandLineOptions));
@@ -158,7 +168,8 @@ JlcCommandGraphGenerator::GenerateCommandGraph(const JlcCommandLineOptions & com
           jlmOptCommand->GetCommandLineOptions().GetOutputFile(),
           compilation.OutputFile(),
           ConvertOptimizationLevel(commandLineOptions.OptimizationLevel_),
-          LlcCommand::RelocationModel::Static);
+          LlcCommand::RelocationModel::Static,
+          compilationCache);
       lastNode->AddEdge(llvmLlcCommandNode);
       lastNode = &llvmLlcCommandNode;
     }
@@ -0,0 +1,276 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jlm/tooling/Command.hpp>
+#include <jlm/tooling/CommandGraph.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+
+/**
+ * Records its name in a shared log when run, and optionally fails.
+ */
+class LogCommand final : public jlm::tooling::Command
+{
+public:
+  LogCommand(std::string name, std::vector<std::string> & log, std::mutex & mutex, bool fails)
+      : Name_(std::move(name)),
+        Log_(log),
+        Mutex_(mutex),
+        Fails_(fails)
+  {}
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return Name_;
+  }
+
+  void
+  Run() const override
+  {
+    {
+      std::lock_guard lock(Mutex_);
+      Log_.push_back(Name_);
+    }
+
+    if (Fails_)
+      throw jlm::util::Error("Command failed: " + Name_);
+  }
+
+  static jlm::tooling::CommandGraph::Node &
+  Create(
+      jlm::tooling::CommandGraph & commandGraph,
+      std::string name,
+      std::vector<std::string> & log,
+      std::mutex & mutex,
+      bool fails = false)
+  {
+    auto command = std::make_unique<LogCommand>(std::move(name), log, mutex, fails);
+    return jlm::tooling::CommandGraph::Node::Create(commandGraph, std::move(command));
+  }
+
+private:
+  std::string Name_;
+  std::vector<std::string> & Log_;
+  std::mutex & Mutex_;
+  bool Fails_;
+};
+
+/**
+ * Waits until all commands of the same barrier have been started.
+ */
+class BarrierCommand final : public jlm::tooling::Command
+{
+public:
+  BarrierCommand(std::atomic<size_t> & numStarted, size_t numExpected)
+      : NumStarted_(numStarted),
+        NumExpected_(numExpected)
+  {}
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return "Barrier";
+  }
+
+  void
+  Run() const override
+  {
+    NumStarted_++;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (NumStarted_ < NumExpected_)
+    {
+      if (std::chrono::steady_clock::now() > deadline)
+        throw jlm::util::Error("Commands were not executed concurrently.");
+      std::this_thread::yield();
+    }
+  }
+
+private:
+  std::atomic<size_t> & NumStarted_;
+  size_t NumExpected_;
+};
+
+/**
+ * Runs a shell command through Command::Run().
+ */
+class ShellCommand final : public jlm::tooling::Command
+{
+public:
+  explicit ShellCommand(std::string command)
+      : Command_(std::move(command))
+  {}
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return Command_;
+  }
+
+  static jlm::tooling::CommandGraph::Node &
+  Create(jlm::tooling::CommandGraph & commandGraph, std::string command)
+  {
+    auto shellCommand = std::make_unique<ShellCommand>(std::move(command));
+    return jlm::tooling::CommandGraph::Node::Create(commandGraph, std::move(shellCommand));
+  }
+
+private:
+  std::string Command_;
+};
+
+}
+
+TEST(CommandGraphTests, DependencyOrder)
+{
+  using namespace jlm::tooling;
+
+  for (size_t numJobs : { 1, 4 })
+  {
+    // Arrange
+    std::vector<std::string> log;
+    std::mutex mutex;
+
+    CommandGraph commandGraph;
+    auto & a = LogCommand::Create(commandGraph, "a", log, mutex);
+    auto & b = LogCommand::Create(commandGraph, "b", log, mutex);
+    auto & c = LogCommand::Create(commandGraph, "c", log, mutex);
+    auto & d = LogCommand::Create(commandGraph, "d", log, mutex);
+
+    commandGraph.GetEntryNode().AddEdge(a);
+    a.AddEdge(b);
+    a.AddEdge(c);
+    b.AddEdge(d);
+    c.AddEdge(d);
+    d.AddEdge(commandGraph.GetExitNode());
+
+    // Act
+    commandGraph.Run(numJobs);
+
+    // Assert
+    ASSERT_EQ(log.size(), 4u);
+    EXPECT_EQ(log.front(), "a");
+    EXPECT_EQ(log.back(), "d");
+  }
+}
+
+TEST(CommandGraphTests, ConcurrentExecution)
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  constexpr size_t numCommands = 4;
+  std::atomic<size_t> numStarted = 0;
+
+  CommandGraph commandGraph;
+  for (size_t n = 0; n < numCommands; n++)
+  {
+    auto & node = CommandGraph::Node::Create(
+        commandGraph,
+        std::make_unique<BarrierCommand>(numStarted, numCommands));
+    commandGraph.GetEntryNode().AddEdge(node);
+    node.AddEdge(commandGraph.GetExitNode());
+  }
+
+  // Act & Assert
+  EXPECT_NO_THROW(commandGraph.Run(numCommands));
+  EXPECT_EQ(numStarted, numCommands);
+}
+
+TEST(CommandGraphTests, FailurePropagation)
+{
+  using namespace jlm::tooling;
+
+  for (size_t numJobs : { 1, 4 })
+  {
+    // Arrange
+    std::vector<std::string> log;
+    std::mutex mutex;
+
+    CommandGraph commandGraph;
+    auto & a = LogCommand::Create(commandGraph, "a", log, mutex, true);
+    auto & b = LogCommand::Create(commandGraph, "b", log, mutex);
+
+    commandGraph.GetEntryNode().AddEdge(a);
+    a.AddEdge(b);
+    b.AddEdge(commandGraph.GetExitNode());
+
+    // Act & Assert
+    EXPECT_THROW(commandGraph.Run(numJobs), jlm::util::Error);
+    EXPECT_EQ(log, std::vector<std::string>({ "a" }));
+  }
+}
+
+TEST(CommandGraphTests, FailureCancelsRunningSubprocesses)
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  CommandGraph commandGraph;
+  auto & sleep = ShellCommand::Create(commandGraph, "sleep 30");
+  auto & fail = ShellCommand::Create(commandGraph, "sleep 0.2; exit 3");
+  commandGraph.GetEntryNode().AddEdge(sleep);
+  commandGraph.GetEntryNode().AddEdge(fail);
+  sleep.AddEdge(commandGraph.GetExitNode());
+  fail.AddEdge(commandGraph.GetExitNode());
+
+  // Act
+  const auto start = std::chrono::steady_clock::now();
+  std::string message;
+  try
+  {
+    commandGraph.Run(2);
+  }
+  catch (const jlm::util::Error & error)
+  {
+    message = error.what();
+  }
+  const auto duration = std::chrono::steady_clock::now() - start;
+
+  // Assert
+  EXPECT_NE(message.find("status code 3"), std::string::npos);
+  EXPECT_LT(duration, std::chrono::seconds(10));
+}
+
+TEST(CommandGraphTests, ShellCommandStatus)
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  ShellCommand success("true");
+  ShellCommand failure("exit 7");
+
+  // Act & Assert
+  EXPECT_NO_THROW(success.Run());
+  EXPECT_THROW(failure.Run(), jlm::util::Error);
+}
+
+TEST(CommandGraphTests, Cycle)
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  std::vector<std::string> log;
+  std::mutex mutex;
+
+  CommandGraph commandGraph;
+  auto & a = LogCommand::Create(commandGraph, "a", log, mutex);
+  auto & b = LogCommand::Create(commandGraph, "b", log, mutex);
+  commandGraph.GetEntryNode().AddEdge(a);
+  a.AddEdge(b);
+  b.AddEdge(a);
+  b.AddEdge(commandGraph.GetExitNode());
+
+  // Act & Assert
+  EXPECT_THROW(commandGraph.Run(2), jlm::util::Error);
+  EXPECT_TRUE(log.empty());
+}
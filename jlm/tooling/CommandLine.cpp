@@ -63,6 +63,11 @@ JlcCommandLineOptions::Reset() noexcept
 
   Md_ = false;
 
+  NumJobs_ = 1;
+
+  CacheDirectory_ = util::FilePath("");
+  CacheSizeLimit_ = CompilationCache::DefaultSizeLimit;
+
   OptimizationLevel_ = OptimizationLevel::O0;
   LanguageStandard_ = LanguageStandard::None;
 
@@ -86,6 +91,9 @@ JlmOptCommandLineOptions::Reset() noexcept
   OutputFormat_ = OutputFormat::Llvm;
   StatisticsCollectorSettings_ = util::StatisticsCollectorSettings();
   OptimizationIds_.clear();
+  numThreads_ = 1;
+  compilationCache_ = std::nullopt;
+  andersenWarmStart_ = false;
 }
 
 const util::BijectiveMap<JlmOptCommandLineOptions::OptimizationId, std::string_view> &
@@ -178,7 +186,9 @@ std::string_view
 JlmOptCommandLineOptions::ToCommandLineArgument(InputFormat inputFormat)
 {
   static std::unordered_map<InputFormat, std::string_view> map(
-      { { InputFormat::Llvm, "llvm" }, { InputFormat::Mlir, "mlir" } });
+      { { InputFormat::Llvm, "llvm" },
+        { InputFormat::Mlir, "mlir" },
+        { InputFormat::Rvsdg, "rvsdg" } });
 
   if (map.find(inputFormat) != map.end())
     return map[inputFormat];
@@ -204,6 +214,7 @@ JlmOptCommandLineOptions::GetStatisticsIdCommandLineArguments()
     { util::Statistics::Id::AndersenAnalysis, "print-andersen-analysis" },
     { util::Statistics::Id::Annotation, "print-annotation-time" },
     { util::Statistics::Id::CommonNodeElimination, "print-cne-stat" },
+    { util::Statistics::Id::CompilationCache, "print-compilation-cache" },
     { util::Statistics::Id::ControlFlowRecovery, "print-cfr-time" },
     { util::Statistics::Id::DataNodeToDelta, "printDataNodeToDelta" },
     { util::Statistics::Id::DeadNodeElimination, "print-dne-stat" },
@@ -241,7 +252,7 @@ JlmOptCommandLineOptions::GetOutputFormatCommandLineArguments()
     { OutputFormat::Ascii, "ascii" }, { OutputFormat::Dot, "dot" },
     { OutputFormat::Json, "json" },   { OutputFormat::JsonTree, "jsonTree" },
     { OutputFormat::Llvm, "llvm" },   { OutputFormat::Mlir, "mlir" },
-    { OutputFormat::Tree, "tree" },
+    { OutputFormat::Rvsdg, "rvsdg" }, { OutputFormat::Tree, "tree" },
   };
 
   auto firstIndex = static_cast<size_t>(OutputFormat::FirstEnumValue);
@@ -259,6 +270,8 @@ JlmHlsCommandLineOptions::Reset() noexcept
   HlsFunction_ = "";
   ExtractHlsFunction_ = false;
   MemoryLatency_ = 10;
+  dumpRvsdgGraphs_ = false;
+  trace_ = false;
 }
 
 void
@@ -452,6 +465,24 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, const char * const * a
       cl::ValueDisallowed,
       cl::desc("Support POSIX threads in generated code"));
 
+  cl::opt<size_t> numJobs(
+      "j",
+      cl::Prefix,
+      cl::init(1),
+      cl::desc("Run up to <N> commands in parallel."),
+      cl::value_desc("N"));
+
+  cl::opt<std::string> cacheDirectory(
+      "cache-dir",
+      cl::desc("Cache the outputs of jlm-opt and llc in <dir>."),
+      cl::value_desc("dir"));
+
+  cl::opt<uint64_t> cacheSizeLimit(
+      "cache-size-limit",
+      cl::init(CompilationCache::DefaultSizeLimit / (1024 * 1024)),
+      cl::desc("Limit the size of the compilation cache to <N> MiB."),
+      cl::value_desc("N"));
+
   cl::opt<bool> mD(
       "MD",
       cl::ValueDisallowed,
@@ -488,6 +519,9 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, const char * const * a
           CreateStatisticsOption(
               util::Statistics::Id::CommonNodeElimination,
               "Collect common node elimination pass statistics."),
+          CreateStatisticsOption(
+              util::Statistics::Id::CompilationCache,
+              "Collect compilation cache hit/miss statistics."),
           CreateStatisticsOption(
               util::Statistics::Id::ControlFlowRecovery,
               "Collect control flow recovery pass statistics."),
@@ -619,6 +653,9 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, const char * const * a
   CommandLineOptions_.Suppress_ = suppress;
   CommandLineOptions_.UsePthreads_ = usePthreads;
   CommandLineOptions_.Md_ = mD;
+  CommandLineOptions_.NumJobs_ = std::max<size_t>(numJobs, 1);
+  CommandLineOptions_.CacheDirectory_ = util::FilePath(cacheDirectory);
+  CommandLineOptions_.CacheSizeLimit_ = cacheSizeLimit * 1024 * 1024;
 
   for (auto & inputFile : inputFiles)
   {
@@ -699,6 +736,50 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
       cl::init(false),
       cl::desc("Dump RVSDG as json graphs after each transformation in debug folder."));
 
+  cl::opt<bool> trace(
+      "trace",
+      cl::init(false),
+      cl::desc("Write a Chrome trace of the executed passes to the statistics directory."));
+
+  cl::list<util::PerfCounter> perfCounters(
+      "perf-counters",
+      cl::values(
+          ::clEnumValN(util::PerfCounter::Cycles, "Cycles", "Count processor cycles"),
+          ::clEnumValN(
+              util::PerfCounter::Instructions,
+              "Instructions",
+              "Count retired instructions"),
+          ::clEnumValN(
+              util::PerfCounter::BranchMisses,
+              "BranchMisses",
+              "Count mispredicted branches"),
+          ::clEnumValN(util::PerfCounter::CacheMisses, "CacheMisses", "Count cache misses"),
+          ::clEnumValN(util::PerfCounter::PageFaults, "PageFaults", "Count page faults")),
+      cl::CommaSeparated,
+      cl::desc("Comma separated list of hardware events counted for each statistics timer"));
+
+  cl::opt<size_t> numThreads(
+      "j",
+      cl::init(1),
+      cl::desc("Apply function-local optimizations to up to <N> functions in parallel."),
+      cl::value_desc("N"));
+
+  cl::opt<std::string> cacheDirectory(
+      "cache-dir",
+      cl::desc("Cache the output file in <dir> and reuse it for identical inputs."),
+      cl::value_desc("dir"));
+
+  cl::opt<uint64_t> cacheSizeLimit(
+      "cache-size-limit",
+      cl::init(CompilationCache::DefaultSizeLimit / (1024 * 1024)),
+      cl::desc("Limit the size of the compilation cache to <N> MiB."),
+      cl::value_desc("N"));
+
+  cl::opt<bool> andersenWarmStart(
+      "andersen-warm-start",
+      cl::init(false),
+      cl::desc("Seed each Andersen analysis with the solution of the previous one."));
+
   cl::list<util::Statistics::Id> printStatistics(
       cl::values(
           CreateStatisticsOption(
@@ -725,6 +806,9 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
           CreateStatisticsOption(
               util::Statistics::Id::CommonNodeElimination,
               "Write common node elimination statistics to file."),
+          CreateStatisticsOption(
+              util::Statistics::Id::CompilationCache,
+              "Write compilation cache hit/miss statistics to file."),
           CreateStatisticsOption(
               util::Statistics::Id::ControlFlowRecovery,
               "Write control flow recovery statistics to file."),
@@ -787,9 +871,11 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
               "Write store value forwarding statistics to file.")),
       cl::desc("Write statistics"));
 
-#ifdef ENABLE_MLIR
   auto llvmInputFormat = JlmOptCommandLineOptions::InputFormat::Llvm;
+  auto rvsdgInputFormat = JlmOptCommandLineOptions::InputFormat::Rvsdg;
+#ifdef ENABLE_MLIR
   auto mlirInputFormat = JlmOptCommandLineOptions::InputFormat::Mlir;
+#endif
 
   cl::opt<JlmOptCommandLineOptions::InputFormat> inputFormat(
       "input-format",
@@ -799,14 +885,17 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
               llvmInputFormat,
               JlmOptCommandLineOptions::ToCommandLineArgument(llvmInputFormat),
               "Input LLVM IR [default]"),
+#ifdef ENABLE_MLIR
           ::clEnumValN(
               mlirInputFormat,
               JlmOptCommandLineOptions::ToCommandLineArgument(mlirInputFormat),
-              "Input MLIR")),
-      cl::init(llvmInputFormat));
-#else
-  auto inputFormat = JlmOptCommandLineOptions::InputFormat::Llvm;
+              "Input MLIR"),
 #endif
+          ::clEnumValN(
+              rvsdgInputFormat,
+              JlmOptCommandLineOptions::ToCommandLineArgument(rvsdgInputFormat),
+              "Input binary RVSDG")),
+      cl::init(llvmInputFormat));
 
   cl::opt<JlmOptCommandLineOptions::OutputFormat> outputFormat(
       "output-format",
@@ -826,6 +915,9 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
 #ifdef ENABLE_MLIR
           CreateOutputFormatOption(JlmOptCommandLineOptions::OutputFormat::Mlir, "Output MLIR"),
 #endif
+          CreateOutputFormatOption(
+              JlmOptCommandLineOptions::OutputFormat::Rvsdg,
+              "Output binary RVSDG"),
           CreateOutputFormatOption(
               JlmOptCommandLineOptions::OutputFormat::Tree,
               "Output Rvsdg Tree")),
@@ -987,12 +1079,19 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
       std::move(demandedStatistics),
       statisticsDirectoryFilePath,
       inputFilePath.base());
+  statisticsCollectorSettings.setTracingEnabled(trace);
+  statisticsCollectorSettings.SetDemandedPerfCounters(
+      { perfCounters.begin(), perfCounters.end() });
 
   util::HashSet<llvm::RvsdgTreePrinter::Configuration::Annotation> demandedAnnotations(
       { rvsdgTreePrinterAnnotations.begin(), rvsdgTreePrinterAnnotations.end() });
 
   llvm::RvsdgTreePrinter::Configuration treePrinterConfiguration(std::move(demandedAnnotations));
 
+  std::optional<CompilationCache> compilationCache;
+  if (!cacheDirectory.empty())
+    compilationCache.emplace(util::FilePath(cacheDirectory), cacheSizeLimit * 1024 * 1024);
+
   CommandLineOptions_ = JlmOptCommandLineOptions::Create(
       std::move(inputFilePath),
       inputFormat,
@@ -1001,7 +1100,10 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, const char * const
       std::move(statisticsCollectorSettings),
       std::move(treePrinterConfiguration),
       std::move(optimizationIds),
-      dumpRvsdgGraphs);
+      dumpRvsdgGraphs,
+      std::max<size_t>(numThreads, 1),
+      std::move(compilationCache),
+      andersenWarmStart);
 
   return *CommandLineOptions_;
 }
@@ -1061,6 +1163,11 @@ JlmHlsCommandLineParser::ParseCommandLineArguments(int argc, const char * const
       cl::init(false),
       cl::desc("Dump RVSDG as json graphs after each transformation in debug folder."));
 
+  cl::opt<bool> trace(
+      "trace",
+      cl::init(false),
+      cl::desc("Write a Chrome trace of the executed passes to the temporary directory."));
+
   cl::opt<JlmHlsCommandLineOptions::OutputFormat> format(
       cl::values(
           ::clEnumValN(
@@ -1085,6 +1192,7 @@ JlmHlsCommandLineParser::ParseCommandLineArguments(int argc, const char * const
   CommandLineOptions_.ExtractHlsFunction_ = extractHlsFunction;
   CommandLineOptions_.OutputFormat_ = format;
   CommandLineOptions_.dumpRvsdgGraphs_ = dumpRvsdgGraphs;
+  CommandLineOptions_.trace_ = trace;
 
   if (latency < 1)
   {
@@ -7,10 +7,12 @@
 #define JLM_TOOLING_COMMANDLINE_HPP
 
 #include <jlm/llvm/opt/RvsdgTreePrinter.hpp>
+#include <jlm/tooling/CompilationCache.hpp>
 #include <jlm/util/BijectiveMap.hpp>
 #include <jlm/util/file.hpp>
 #include <jlm/util/Statistics.hpp>
 
+#include <optional>
 #include <vector>
 
 namespace jlm::tooling
@@ -45,6 +47,7 @@ public:
   {
     Llvm,
     Mlir,
+    Rvsdg,
   };
 
   enum class OutputFormat
@@ -57,6 +60,7 @@ public:
     JsonTree,
     Llvm,
     Mlir,
+    Rvsdg,
     Tree,
 
     LastEnumValue // must always be the last enum value, used for iteration
@@ -98,7 +102,10 @@ public:
       util::StatisticsCollectorSettings statisticsCollectorSettings,
       llvm::RvsdgTreePrinter::Configuration rvsdgTreePrinterConfiguration,
       std::vector<OptimizationId> optimizations,
-      const bool dumpRvsdgGraphs)
+      const bool dumpRvsdgGraphs,
+      const size_t numThreads = 1,
+      std::optional<CompilationCache> compilationCache = std::nullopt,
+      const bool andersenWarmStart = false)
       : InputFile_(std::move(inputFile)),
         InputFormat_(inputFormat),
         OutputFile_(std::move(outputFile)),
@@ -106,7 +113,10 @@ public:
         StatisticsCollectorSettings_(std::move(statisticsCollectorSettings)),
         OptimizationIds_(std::move(optimizations)),
         RvsdgTreePrinterConfiguration_(std::move(rvsdgTreePrinterConfiguration)),
-        dumpRvsdgGraphs_(dumpRvsdgGraphs)
+        dumpRvsdgGraphs_(dumpRvsdgGraphs),
+        numThreads_(numThreads),
+        compilationCache_(std::move(compilationCache)),
+        andersenWarmStart_(andersenWarmStart)
   {}
 
   void
@@ -160,6 +170,35 @@ public:
     return dumpRvsdgGraphs_;
   }
 
+  /**
+   * @return The number of threads used for applying lambda-local optimizations.
+   */
+  [[nodiscard]] size_t
+  numThreads() const noexcept
+  {
+    return numThreads_;
+  }
+
+  /**
+   * @return The cache used for the output file, or std::nullopt if caching is disabled.
+   */
+  [[nodiscard]] const std::optional<CompilationCache> &
+  compilationCache() const noexcept
+  {
+    return compilationCache_;
+  }
+
+  /**
+   * @return True if each Andersen analysis is seeded with the solution of the previous analysis.
+   *
+   * @see llvm::aa::Andersen::EnableWarmStart
+   */
+  [[nodiscard]] bool
+  andersenWarmStart() const noexcept
+  {
+    return andersenWarmStart_;
+  }
+
   static OptimizationId
   FromCommandLineArgumentToOptimizationId(std::string_view commandLineArgument);
 
@@ -187,7 +226,10 @@ public:
       util::StatisticsCollectorSettings statisticsCollectorSettings,
       llvm::RvsdgTreePrinter::Configuration rvsdgTreePrinterConfiguration,
       std::vector<OptimizationId> optimizations,
-      bool dumpRvsdgGraphs)
+      bool dumpRvsdgGraphs,
+      size_t numThreads = 1,
+      std::optional<CompilationCache> compilationCache = std::nullopt,
+      bool andersenWarmStart = false)
   {
     return std::make_unique<JlmOptCommandLineOptions>(
         std::move(inputFile),
@@ -197,7 +239,10 @@ public:
         std::move(statisticsCollectorSettings),
         std::move(rvsdgTreePrinterConfiguration),
         std::move(optimizations),
-        dumpRvsdgGraphs);
+        dumpRvsdgGraphs,
+        numThreads,
+        std::move(compilationCache),
+        andersenWarmStart);
   }
 
 private:
@@ -209,6 +254,9 @@ private:
   std::vector<OptimizationId> OptimizationIds_;
   llvm::RvsdgTreePrinter::Configuration RvsdgTreePrinterConfiguration_;
   bool dumpRvsdgGraphs_;
+  size_t numThreads_;
+  std::optional<CompilationCache> compilationCache_;
+  bool andersenWarmStart_;
 
   static const util::BijectiveMap<util::Statistics::Id, std::string_view> &
   GetStatisticsIdCommandLineArguments();
@@ -255,6 +303,9 @@ public:
         Suppress_(false),
         UsePthreads_(false),
         Md_(false),
+        NumJobs_(1),
+        CacheDirectory_(""),
+        CacheSizeLimit_(CompilationCache::DefaultSizeLimit),
         OptimizationLevel_(OptimizationLevel::O0),
         LanguageStandard_(LanguageStandard::None),
         OutputFile_("a.out")
@@ -278,6 +329,11 @@ public:
 
   bool Md_;
 
+  size_t NumJobs_;
+
+  util::FilePath CacheDirectory_;
+  uint64_t CacheSizeLimit_;
+
   OptimizationLevel OptimizationLevel_;
   LanguageStandard LanguageStandard_;
 
@@ -399,7 +455,8 @@ public:
         OutputFormat_(OutputFormat::Firrtl),
         ExtractHlsFunction_(false),
         MemoryLatency_(10),
-        dumpRvsdgGraphs_(false)
+        dumpRvsdgGraphs_(false),
+        trace_(false)
   {
     JLM_ASSERT(MemoryLatency_ > 0);
   }
@@ -414,6 +471,7 @@ public:
   bool ExtractHlsFunction_;
   size_t MemoryLatency_;
   bool dumpRvsdgGraphs_;
+  bool trace_;
 };
 
 /**
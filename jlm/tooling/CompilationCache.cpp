@@ -0,0 +1,214 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/tooling/CompilationCache.hpp>
+#include <jlm/util/strfmt.hpp>
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/SHA256.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace jlm::tooling
+{
+
+/**
+ * Suffix of the temporary files entries are written to before being renamed into place.
+ */
+static const char * TemporaryFileSuffix = ".tmp";
+
+std::string
+CompilationCache::computeKey(
+    const std::vector<util::FilePath> & inputFiles,
+    std::string_view configuration)
+{
+  ::llvm::SHA256 hasher;
+  hasher.update(::llvm::StringRef(configuration.data(), configuration.size()));
+
+  std::vector<char> buffer(64 * 1024);
+  for (auto & inputFile : inputFiles)
+  {
+    std::error_code errorCode;
+    const auto size = std::filesystem::file_size(inputFile.to_str(), errorCode);
+    std::ifstream stream(inputFile.to_str(), std::ios::binary);
+    if (errorCode || !stream)
+      return "";
+
+    // Prefix each input with its size, such that moving bytes between adjacent files changes the
+    // key
+    hasher.update(::llvm::StringRef(util::strfmt("\n", size, "\n")));
+    while (stream)
+    {
+      stream.read(buffer.data(), buffer.size());
+      hasher.update(::llvm::StringRef(buffer.data(), stream.gcount()));
+    }
+
+    if (stream.bad())
+      return "";
+  }
+
+  std::string digest;
+  for (auto byte : hasher.final())
+    digest.push_back(static_cast<char>(byte));
+
+  return ::llvm::toHex(digest, true);
+}
+
+bool
+CompilationCache::tryRestore(const std::string & key, const util::FilePath & outputFile) const
+{
+  if (key.empty())
+    return false;
+
+  const auto entry = entryPath(key);
+
+  std::error_code errorCode;
+  std::filesystem::copy_file(
+      entry.to_str(),
+      outputFile.to_str(),
+      std::filesystem::copy_options::overwrite_existing,
+      errorCode);
+  if (errorCode)
+    return false;
+
+  // Mark the entry as recently used
+  std::filesystem::last_write_time(
+      entry.to_str(),
+      std::filesystem::file_time_type::clock::now(),
+      errorCode);
+
+  return true;
+}
+
+void
+CompilationCache::store(const std::string & key, const util::FilePath & outputFile) const
+{
+  if (key.empty())
+    return;
+
+  std::error_code errorCode;
+  std::filesystem::create_directories(Directory_.to_str(), errorCode);
+  if (errorCode)
+    return;
+
+  const auto temporaryFile =
+      util::FilePath::createUniqueFileName(Directory_, key + "-", TemporaryFileSuffix);
+  std::filesystem::copy_file(outputFile.to_str(), temporaryFile.to_str(), errorCode);
+  if (!errorCode)
+    std::filesystem::rename(temporaryFile.to_str(), entryPath(key).to_str(), errorCode);
+
+  if (errorCode)
+  {
+    std::filesystem::remove(temporaryFile.to_str(), errorCode);
+    return;
+  }
+
+  evict();
+}
+
+const std::string &
+CompilationCache::buildId()
+{
+  static const std::string buildId = []()
+  {
+    std::error_code errorCode;
+    const auto executable = std::filesystem::read_symlink("/proc/self/exe", errorCode);
+    return errorCode ? std::string("unknown") : fileIdentity(util::FilePath(executable.string()));
+  }();
+
+  return buildId;
+}
+
+std::string
+CompilationCache::fileIdentity(const util::FilePath & file)
+{
+  std::error_code errorCode;
+  const auto size = std::filesystem::file_size(file.to_str(), errorCode);
+  if (errorCode)
+    return file.to_str();
+
+  const auto modificationTime = std::filesystem::last_write_time(file.to_str(), errorCode);
+  if (errorCode)
+    return file.to_str();
+
+  return util::strfmt(
+      file.to_str(),
+      ":",
+      size,
+      ":",
+      modificationTime.time_since_epoch().count());
+}
+
+util::FilePath
+CompilationCache::entryPath(const std::string & key) const
+{
+  return Directory_.Join(key);
+}
+
+void
+CompilationCache::evict() const
+{
+  struct Entry
+  {
+    std::filesystem::path path;
+    std::filesystem::file_time_type lastUsed;
+    uint64_t size;
+  };
+
+  std::error_code errorCode;
+  std::filesystem::directory_iterator iterator(Directory_.to_str(), errorCode);
+  if (errorCode)
+    return;
+
+  std::vector<Entry> entries;
+  uint64_t totalSize = 0;
+  for (const auto end = std::filesystem::directory_iterator(); iterator != end;
+       iterator.increment(errorCode))
+  {
+    if (errorCode)
+      return;
+
+    // Entries might concurrently be evicted by other processes, so skip over any errors
+    std::error_code entryErrorCode;
+    const auto & path = iterator->path();
+    if (!iterator->is_regular_file(entryErrorCode) || path.extension() == TemporaryFileSuffix)
+      continue;
+
+    const auto size = iterator->file_size(entryErrorCode);
+    if (entryErrorCode)
+      continue;
+
+    const auto lastUsed = iterator->last_write_time(entryErrorCode);
+    if (entryErrorCode)
+      continue;
+
+    entries.push_back({ path, lastUsed, size });
+    totalSize += size;
+  }
+
+  if (totalSize <= SizeLimit_)
+    return;
+
+  std::sort(
+      entries.begin(),
+      entries.end(),
+      [](const Entry & a, const Entry & b)
+      {
+        return a.lastUsed < b.lastUsed;
+      });
+
+  for (auto & entry : entries)
+  {
+    if (totalSize <= SizeLimit_)
+      break;
+
+    std::filesystem::remove(entry.path, errorCode);
+    totalSize -= entry.size;
+  }
+}
+
+}
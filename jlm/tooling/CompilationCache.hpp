@@ -0,0 +1,116 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_TOOLING_COMPILATIONCACHE_HPP
+#define JLM_TOOLING_COMPILATIONCACHE_HPP
+
+#include <jlm/util/file.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace jlm::tooling
+{
+
+/**
+ * \brief On-disk cache for the output files of compilation commands.
+ *
+ * Entries are content-addressed: the key of an entry is a hash of the contents of the command's
+ * input files together with a string that describes everything else the output depends on, e.g.,
+ * the command's options and the identity of the tool that produces the output. Each entry is a
+ * single file in the cache directory named after its key.
+ *
+ * The total size of all entries is bounded. Whenever an entry is stored, the least recently used
+ * entries are evicted until the cache fits within its size limit. Restoring an entry marks it as
+ * used by updating its modification time.
+ *
+ * Several processes and threads may share a cache directory. Entries are written to a temporary
+ * file first and then renamed into place, such that readers never observe partially written
+ * entries. Failures to access the cache are not errors; they are treated as cache misses.
+ */
+class CompilationCache final
+{
+public:
+  /**
+   * The default size limit of a cache in bytes.
+   */
+  static constexpr uint64_t DefaultSizeLimit = 1024 * 1024 * 1024;
+
+  CompilationCache(util::FilePath directory, uint64_t sizeLimit)
+      : Directory_(std::move(directory)),
+        SizeLimit_(sizeLimit)
+  {}
+
+  /**
+   * @return The directory in which the cache entries are stored.
+   */
+  [[nodiscard]] const util::FilePath &
+  directory() const noexcept
+  {
+    return Directory_;
+  }
+
+  /**
+   * @return The maximal total size of all cache entries in bytes.
+   */
+  [[nodiscard]] uint64_t
+  sizeLimit() const noexcept
+  {
+    return SizeLimit_;
+  }
+
+  /**
+   * Computes the key of a cache entry from the contents of \p inputFiles and \p configuration.
+   *
+   * @return The key as a hexadecimal string, or an empty string if one of the input files could
+   * not be read.
+   */
+  [[nodiscard]] static std::string
+  computeKey(const std::vector<util::FilePath> & inputFiles, std::string_view configuration);
+
+  /**
+   * Copies the cache entry with key \p key to \p outputFile.
+   *
+   * @return True if the entry exists and was copied, otherwise false.
+   */
+  [[nodiscard]] bool
+  tryRestore(const std::string & key, const util::FilePath & outputFile) const;
+
+  /**
+   * Stores a copy of \p outputFile as the cache entry with key \p key, and evicts the least
+   * recently used entries if the cache exceeds its size limit.
+   */
+  void
+  store(const std::string & key, const util::FilePath & outputFile) const;
+
+  /**
+   * @return A string identifying the build of the running executable.
+   */
+  [[nodiscard]] static const std::string &
+  buildId();
+
+  /**
+   * @return A string identifying the version of \p file, based on its path, size, and
+   * modification time.
+   */
+  [[nodiscard]] static std::string
+  fileIdentity(const util::FilePath & file);
+
+private:
+  [[nodiscard]] util::FilePath
+  entryPath(const std::string & key) const;
+
+  void
+  evict() const;
+
+  util::FilePath Directory_;
+  uint64_t SizeLimit_;
+};
+
+}
+
+#endif
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jlm/tooling/CompilationCache.hpp>
+#include <jlm/util/strfmt.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+
+class CompilationCacheTests : public ::testing::Test
+{
+protected:
+  void
+  SetUp() override
+  {
+    const auto randomString = jlm::util::CreateRandomAlphanumericString(6);
+    directory_ = jlm::util::FilePath::TempDirectoryPath().Join("jlm-cache-test-" + randomString);
+    std::filesystem::create_directories(directory_.to_str());
+  }
+
+  void
+  TearDown() override
+  {
+    std::filesystem::remove_all(directory_.to_str());
+  }
+
+  [[nodiscard]] jlm::util::FilePath
+  writeFile(const std::string & name, const std::string & content) const
+  {
+    const auto file = directory_.Join(name);
+    std::ofstream stream(file.to_str(), std::ios::binary);
+    stream << content;
+    return file;
+  }
+
+  [[nodiscard]] static std::string
+  readFile(const jlm::util::FilePath & file)
+  {
+    std::ifstream stream(file.to_str(), std::ios::binary);
+    std::stringstream buffer;
+    buffer << stream.rdbuf();
+    return buffer.str();
+  }
+
+  [[nodiscard]] jlm::util::FilePath
+  cacheDirectory() const
+  {
+    return directory_.Join("cache");
+  }
+
+private:
+  jlm::util::FilePath directory_ = jlm::util::FilePath("");
+};
+
+}
+
+TEST_F(CompilationCacheTests, StoreAndRestore)
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  CompilationCache cache(cacheDirectory(), CompilationCache::DefaultSizeLimit);
+  const auto inputFile = writeFile("input.ll", "input");
+  const auto outputFile = writeFile("output.o", "output");
+  const auto restoredFile = writeFile("restored.o", "");
+  const auto key = CompilationCache::computeKey({ inputFile }, "configuration");
+
+  // Act
+  const auto isHitBeforeStore = cache.tryRestore(key, restoredFile);
+  cache.store(key, outputFile);
+  const auto isHitAfterStore = cache.tryRestore(key, restoredFile);
+
+  // Assert
+  EXPECT_FALSE(key.empty());
+  EXPECT_FALSE(isHitBeforeStore);
+  EXPECT_TRUE(isHitAfterStore);
+  EXPECT_EQ(readFile(restoredFile), "output");
+}
+
+TEST_F(CompilationCacheTests, KeySensitivity)
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  const auto fileA = writeFile("a.ll", "abc");
+  const auto fileB = writeFile("b.ll", "abc");
+  const auto fileC = writeFile("c.ll", "abd");
+  const auto fileD = writeFile("d.ll", "abcc");
+  const auto fileE = writeFile("e.ll", "cabc");
+
+  // Act
+  const auto keyA = CompilationCache::computeKey({ fileA }, "-O1");
+  const auto keyB = CompilationCache::computeKey({ fileB }, "-O1");
+  const auto keyC = CompilationCache::computeKey({ fileC }, "-O1");
+  const auto keyConfiguration = CompilationCache::computeKey({ fileA }, "-O2");
+  const auto keyConcatenation1 = CompilationCache::computeKey({ fileA, fileE }, "-O1");
+  const auto keyConcatenation2 = CompilationCache::computeKey({ fileD, fileA }, "-O1");
+  const auto keyMissingFile =
+      CompilationCache::computeKey({ cacheDirectory().Join("missing.ll") }, "-O1");
+
+  // Assert
+  EXPECT_EQ(keyA, keyB);
+  EXPECT_NE(keyA, keyC);
+  EXPECT_NE(keyA, keyConfiguration);
+  EXPECT_NE(keyConcatenation1, keyConcatenation2);
+  EXPECT_TRUE(keyMissingFile.empty());
+}
+
+TEST_F(CompilationCacheTests, LeastRecentlyUsedEviction)
+{
+  using namespace jlm::tooling;
+  using namespace std::chrono_literals;
+
+  // Arrange
+  CompilationCache cache(cacheDirectory(), 10);
+  const auto outputFile = writeFile("output.o", "1234");
+  const auto restoredFile = writeFile("restored.o", "");
+
+  cache.store("a", outputFile);
+  cache.store("b", outputFile);
+
+  const auto now = std::filesystem::file_time_type::clock::now();
+  std::filesystem::last_write_time(cacheDirectory().Join("a").to_str(), now - 2h);
+  std::filesystem::last_write_time(cacheDirectory().Join("b").to_str(), now - 1h);
+
+  // Act
+  const auto isHitA = cache.tryRestore("a", restoredFile);
+  cache.store("c", outputFile);
+
+  // Assert
+  EXPECT_TRUE(isHitA);
+  EXPECT_TRUE(cache.tryRestore("a", restoredFile));
+  EXPECT_FALSE(cache.tryRestore("b", restoredFile));
+  EXPECT_TRUE(cache.tryRestore("c", restoredFile));
+}
+
+TEST_F(CompilationCacheTests, UnusableCacheDirectory)
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  const auto file = writeFile("file", "");
+  CompilationCache cache(file.Join("cache"), CompilationCache::DefaultSizeLimit);
+  const auto outputFile = writeFile("output.o", "output");
+
+  // Act & Assert
+  // Failures to access the cache must not be errors
+  cache.store("a", outputFile);
+  EXPECT_FALSE(cache.tryRestore("a", outputFile));
+  EXPECT_EQ(readFile(outputFile), "output");
+}
@@ -140,3 +140,36 @@ TEST(JlcCommandLineParserTests, TestJlmOptPassStatistics)
   // Assert
   EXPECT_EQ(commandLineOptions.JlmOptPassStatistics_, expectedStatistics);
 }
+
+TEST(JlcCommandLineParserTests, NumJobs)
+{
+  // Arrange & Act & Assert
+  {
+    auto & commandLineOptions = ParseCommandLineArguments({ "jlc", "foo.c" });
+    EXPECT_EQ(commandLineOptions.NumJobs_, 1u);
+  }
+
+  {
+    auto & commandLineOptions = ParseCommandLineArguments({ "jlc", "-j8", "foo.c", "bar.c" });
+    EXPECT_EQ(commandLineOptions.NumJobs_, 8u);
+  }
+}
+
+TEST(JlcCommandLineParserTests, CompilationCache)
+{
+  // Arrange & Act & Assert
+  {
+    auto & commandLineOptions = ParseCommandLineArguments({ "jlc", "foo.c" });
+    EXPECT_EQ(commandLineOptions.CacheDirectory_, "");
+    EXPECT_EQ(
+        commandLineOptions.CacheSizeLimit_,
+        jlm::tooling::CompilationCache::DefaultSizeLimit);
+  }
+
+  {
+    auto & commandLineOptions = ParseCommandLineArguments(
+        { "jlc", "--cache-dir=/tmp/jlm-cache", "--cache-size-limit=16", "foo.c" });
+    EXPECT_EQ(commandLineOptions.CacheDirectory_, "/tmp/jlm-cache");
+    EXPECT_EQ(commandLineOptions.CacheSizeLimit_, 16u * 1024 * 1024);
+  }
+}
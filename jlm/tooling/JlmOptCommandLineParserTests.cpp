@@ -111,3 +111,73 @@ TEST(JlmOptCommandLinerParserTests, OutputFormatParsing)
     testOutputFormatParsing(outputFormatString, outputFormat);
   }
 }
+
+TEST(JlmOptCommandLinerParserTests, RvsdgInputFormatParsing)
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  std::vector<std::string> commandLineArguments(
+      { "jlm-opt", "--input-format", "rvsdg", "--output-format", "rvsdg", "foo.rvsdg" });
+
+  // Act
+  auto & commandLineOptions = ParseCommandLineArguments(commandLineArguments);
+
+  // Assert
+  EXPECT_EQ(commandLineOptions.GetInputFormat(), JlmOptCommandLineOptions::InputFormat::Rvsdg);
+  EXPECT_EQ(commandLineOptions.GetOutputFormat(), JlmOptCommandLineOptions::OutputFormat::Rvsdg);
+}
+
+TEST(JlmOptCommandLinerParserTests, NumThreadsParsing)
+{
+  using namespace jlm::tooling;
+
+  // Arrange & Act & Assert
+  {
+    auto & commandLineOptions = ParseCommandLineArguments({ "jlm-opt", "foo.ll" });
+    EXPECT_EQ(commandLineOptions.numThreads(), 1u);
+  }
+
+  {
+    auto & commandLineOptions = ParseCommandLineArguments({ "jlm-opt", "-j", "8", "foo.ll" });
+    EXPECT_EQ(commandLineOptions.numThreads(), 8u);
+  }
+}
+
+TEST(JlmOptCommandLinerParserTests, AndersenWarmStartParsing)
+{
+  using namespace jlm::tooling;
+
+  // Arrange & Act & Assert
+  {
+    auto & commandLineOptions = ParseCommandLineArguments({ "jlm-opt", "foo.ll" });
+    EXPECT_FALSE(commandLineOptions.andersenWarmStart());
+  }
+
+  {
+    auto & commandLineOptions =
+        ParseCommandLineArguments({ "jlm-opt", "--andersen-warm-start", "foo.ll" });
+    EXPECT_TRUE(commandLineOptions.andersenWarmStart());
+  }
+}
+
+TEST(JlmOptCommandLinerParserTests, PerfCountersParsing)
+{
+  using namespace jlm::util;
+
+  // Arrange & Act & Assert
+  {
+    auto & commandLineOptions = ParseCommandLineArguments({ "jlm-opt", "foo.ll" });
+    auto & settings = commandLineOptions.GetStatisticsCollectorSettings();
+    EXPECT_EQ(settings.GetDemandedPerfCounters().Size(), 0u);
+  }
+
+  {
+    auto & commandLineOptions = ParseCommandLineArguments(
+        { "jlm-opt", "--perf-counters=Instructions,PageFaults", "foo.ll" });
+    auto & settings = commandLineOptions.GetStatisticsCollectorSettings();
+    EXPECT_EQ(
+        settings.GetDemandedPerfCounters(),
+        HashSet<PerfCounter>({ PerfCounter::Instructions, PerfCounter::PageFaults }));
+  }
+}
@@ -10,6 +10,7 @@
 #include <jlm/tooling/Command.hpp>
 #include <jlm/util/strfmt.hpp>
 
+#include <filesystem>
 #include <fstream>
 
 TEST(JlmOptCommandTests, TestStatistics)
@@ -112,3 +113,69 @@ TEST(JlmOptCommandTests, PrintRvsdgTreeToFile)
 
   EXPECT_EQ(buffer.str(), "RootRegion\n");
 }
+
+TEST(JlmOptCommandTests, CompilationCache)
+{
+  using namespace jlm::llvm;
+  using namespace jlm::tooling;
+  using namespace jlm::util;
+
+  // Arrange
+  const auto directory = FilePath::createUniqueFileName(FilePath::TempDirectoryPath(), "jlm-", "");
+  directory.CreateDirectory();
+  const auto inputFile = directory.Join("input.ll");
+  const auto outputFile = directory.Join("output.ll");
+  const auto cacheDirectory = directory.Join("cache");
+  {
+    std::ofstream stream(inputFile.to_str());
+    stream << "define void @f() {\n  ret void\n}\n";
+  }
+
+  JlmOptCommandLineOptions commandLineOptions(
+      inputFile,
+      JlmOptCommandLineOptions::InputFormat::Llvm,
+      outputFile,
+      JlmOptCommandLineOptions::OutputFormat::Llvm,
+      StatisticsCollectorSettings(),
+      RvsdgTreePrinter::Configuration({}),
+      { JlmOptCommandLineOptions::OptimizationId::DeadNodeElimination },
+      false,
+      1,
+      CompilationCache(cacheDirectory, CompilationCache::DefaultSizeLimit));
+
+  JlmOptCommand command("jlm-opt", commandLineOptions);
+
+  auto readFile = [](const FilePath & file)
+  {
+    std::ifstream stream(file.to_str());
+    std::stringstream buffer;
+    buffer << stream.rdbuf();
+    return buffer.str();
+  };
+
+  // Act
+  command.Run();
+  const auto compiledOutput = readFile(outputFile);
+
+  // Replace the cache entry, such that a cache hit becomes observable
+  std::vector<std::filesystem::path> cacheEntries(
+      std::filesystem::directory_iterator(cacheDirectory.to_str()),
+      std::filesystem::directory_iterator());
+  ASSERT_EQ(cacheEntries.size(), 1u);
+  {
+    std::ofstream stream(cacheEntries[0]);
+    stream << "cached";
+  }
+
+  command.Run();
+  const auto cachedOutput = readFile(outputFile);
+
+  std::filesystem::remove_all(directory.to_str());
+
+  // Assert
+  EXPECT_NE(compiledOutput.find("define void @f()"), std::string::npos);
+  EXPECT_EQ(cachedOutput, "cached");
+  const auto cacheArguments =
+      "--cache-dir=" + cacheDirectory.to_str() + " --cache-size-limit=1024 ";
+  EXPECT_NE(command.ToString().find(cacheArguments), std::string::npos);
+}
@@ -167,7 +167,7 @@ public:
       return false;
     }
 
-    for (auto & item : other.Items())
+    for (auto & item : Items())
     {
       if (!other.Contains(item))
       {
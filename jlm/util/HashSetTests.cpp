@@ -99,6 +99,11 @@ TEST(HashSetTests, TestIsSubsetOf)
   EXPECT_TRUE(set123.IsSubsetOf(set1234));
   EXPECT_FALSE(set1234.IsSubsetOf(set12));
   EXPECT_FALSE(set1234.IsSubsetOf(set123));
+
+  // Sets of equal or smaller size that are not subsets
+  jlm::util::HashSet<int> set34({ 3, 4 });
+  EXPECT_FALSE(set34.IsSubsetOf(set12));
+  EXPECT_FALSE(set34.IsSubsetOf(set123));
 }
 
 TEST(HashSetTests, TestUnionWith)
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_PARALLEL_HPP
+#define JLM_UTIL_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * Invokes \p function for every index in the range [0, \p numItems) using up to \p numThreads
+ * threads. Work items are handed out dynamically, i.e., a thread that finishes an item early picks
+ * up the next unprocessed item. This balances the load when items vary greatly in cost.
+ *
+ * The \p function is invoked as function(workerIndex, itemIndex), where workerIndex is in the
+ * range [0, numThreads) and identifies the thread processing the item. It can be used to index
+ * per-thread state without any synchronization.
+ *
+ * If \p numThreads is less than two, or there is at most one item, all items are processed
+ * on the calling thread.
+ *
+ * If any invocation of \p function throws an exception, no further items are handed out and the
+ * first exception is rethrown on the calling thread after all threads have finished.
+ *
+ * @param numThreads The maximum number of threads to use.
+ * @param numItems The number of items to process.
+ * @param function The function to invoke for every item.
+ */
+template<typename F>
+void
+parallelForEach(size_t numThreads, size_t numItems, const F & function)
+{
+  numThreads = std::min(numThreads, numItems);
+  if (numThreads <= 1)
+  {
+    for (size_t n = 0; n < numItems; n++)
+      function(static_cast<size_t>(0), n);
+    return;
+  }
+
+  std::atomic<size_t> nextItem(0);
+  std::atomic<bool> failed(false);
+  std::exception_ptr exception;
+  std::mutex exceptionMutex;
+
+  auto worker = [&](size_t workerIndex)
+  {
+    while (!failed.load(std::memory_order_relaxed))
+    {
+      const auto item = nextItem.fetch_add(1, std::memory_order_relaxed);
+      if (item >= numItems)
+        return;
+
+      try
+      {
+        function(workerIndex, item);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> guard(exceptionMutex);
+        if (!exception)
+          exception = std::current_exception();
+        failed.store(true, std::memory_order_relaxed);
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads - 1);
+  for (size_t n = 1; n < numThreads; n++)
+    threads.emplace_back(worker, n);
+
+  worker(0);
+
+  for (auto & thread : threads)
+    thread.join();
+
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+}
+
+#endif
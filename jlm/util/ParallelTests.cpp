@@ -0,0 +1,76 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jlm/util/Parallel.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+TEST(ParallelTests, ParallelForEachVisitsAllItems)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  const size_t numItems = 1000;
+  std::vector<std::atomic<size_t>> visits(numItems);
+  std::vector<size_t> workers(numItems);
+
+  // Act
+  parallelForEach(
+      4,
+      numItems,
+      [&](size_t workerIndex, size_t item)
+      {
+        visits[item]++;
+        workers[item] = workerIndex;
+      });
+
+  // Assert
+  for (size_t n = 0; n < numItems; n++)
+  {
+    EXPECT_EQ(visits[n], 1u);
+    EXPECT_LT(workers[n], 4u);
+  }
+}
+
+TEST(ParallelTests, ParallelForEachSingleThread)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  std::vector<size_t> order;
+
+  // Act
+  parallelForEach(
+      1,
+      5,
+      [&](size_t workerIndex, size_t item)
+      {
+        EXPECT_EQ(workerIndex, 0u);
+        order.push_back(item);
+      });
+
+  // Assert
+  EXPECT_EQ(order, std::vector<size_t>({ 0, 1, 2, 3, 4 }));
+}
+
+TEST(ParallelTests, ParallelForEachPropagatesException)
+{
+  using namespace jlm::util;
+
+  // Act & Assert
+  EXPECT_THROW(
+      parallelForEach(
+          4,
+          100,
+          [](size_t, size_t item)
+          {
+            if (item == 42)
+              throw std::runtime_error("failure");
+          }),
+      std::runtime_error);
+}
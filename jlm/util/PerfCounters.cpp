@@ -0,0 +1,256 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/util/common.hpp>
+#include <jlm/util/PerfCounters.hpp>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <optional>
+
+namespace jlm::util
+{
+
+static thread_local const HashSet<PerfCounter> * CurrentSelection = nullptr;
+
+std::string_view
+ToString(PerfCounter counter)
+{
+  switch (counter)
+  {
+  case PerfCounter::Cycles:
+    return "Cycles";
+  case PerfCounter::Instructions:
+    return "Instructions";
+  case PerfCounter::BranchMisses:
+    return "BranchMisses";
+  case PerfCounter::CacheMisses:
+    return "CacheMisses";
+  case PerfCounter::PageFaults:
+    return "PageFaults";
+  default:
+    JLM_UNREACHABLE("Unhandled performance counter.");
+  }
+}
+
+#if defined(__linux__)
+
+/**
+ * @return True if \p counter is counted by the performance monitoring unit of the processor, and
+ * false if it is counted by the kernel.
+ */
+static bool
+IsHardwareCounter(PerfCounter counter) noexcept
+{
+  return counter != PerfCounter::PageFaults;
+}
+
+/**
+ * Opens a disabled perf event file descriptor counting \p counter for the calling thread.
+ *
+ * @param groupFileDescriptor The file descriptor of the group leader, or -1 to open a new group.
+ * @return The file descriptor, or -1 if the event cannot be counted.
+ */
+static int
+OpenPerfEvent(PerfCounter counter, int groupFileDescriptor) noexcept
+{
+  perf_event_attr attributes{};
+  attributes.size = sizeof(attributes);
+  attributes.type = IsHardwareCounter(counter) ? PERF_TYPE_HARDWARE : PERF_TYPE_SOFTWARE;
+  switch (counter)
+  {
+  case PerfCounter::Cycles:
+    attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+    break;
+  case PerfCounter::Instructions:
+    attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+    break;
+  case PerfCounter::BranchMisses:
+    attributes.config = PERF_COUNT_HW_BRANCH_MISSES;
+    break;
+  case PerfCounter::CacheMisses:
+    attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+    break;
+  case PerfCounter::PageFaults:
+    attributes.config = PERF_COUNT_SW_PAGE_FAULTS;
+    break;
+  default:
+    return -1;
+  }
+  attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  attributes.disabled = 1;
+  attributes.inherit = 1;
+  // Counting kernel events requires privileges in the default configuration of most systems
+  attributes.exclude_kernel = 1;
+  attributes.exclude_hv = 1;
+
+  const auto fileDescriptor =
+      syscall(SYS_perf_event_open, &attributes, 0, -1, groupFileDescriptor, 0);
+  return fileDescriptor < 0 ? -1 : static_cast<int>(fileDescriptor);
+}
+
+/**
+ * Reads the count of the perf event with file descriptor \p fileDescriptor, scaled up to account
+ * for the time the event was not scheduled on the processor due to multiplexing.
+ *
+ * @return The count, or std::nullopt if the event could not be read.
+ */
+static std::optional<uint64_t>
+ReadPerfEvent(int fileDescriptor) noexcept
+{
+  struct
+  {
+    uint64_t value;
+    uint64_t timeEnabled;
+    uint64_t timeRunning;
+  } data{};
+
+  if (read(fileDescriptor, &data, sizeof(data)) != sizeof(data))
+    return std::nullopt;
+
+  if (data.timeRunning == 0)
+    return 0;
+
+  if (data.timeRunning >= data.timeEnabled)
+    return data.value;
+
+  return static_cast<uint64_t>(
+      static_cast<long double>(data.value) * data.timeEnabled / data.timeRunning);
+}
+
+#endif
+
+PerfCounterGroup::SelectionScope::SelectionScope(const HashSet<PerfCounter> & counters) noexcept
+    : previous_(CurrentSelection)
+{
+  CurrentSelection = &counters;
+}
+
+PerfCounterGroup::SelectionScope::~SelectionScope() noexcept
+{
+  CurrentSelection = previous_;
+}
+
+PerfCounterGroup::PerfCounterGroup(const HashSet<PerfCounter> & counters)
+{
+  for (auto counter : counters.Items())
+    Events_.push_back({ counter });
+
+  std::sort(
+      Events_.begin(),
+      Events_.end(),
+      [](const Event & a, const Event & b)
+      {
+        return a.counter < b.counter;
+      });
+}
+
+PerfCounterGroup::~PerfCounterGroup() noexcept
+{
+  stop();
+}
+
+const HashSet<PerfCounter> *
+PerfCounterGroup::currentSelection() noexcept
+{
+  if (CurrentSelection && CurrentSelection->Size() != 0)
+    return CurrentSelection;
+
+  return nullptr;
+}
+
+void
+PerfCounterGroup::start() noexcept
+{
+  if (IsRunning_)
+    return;
+  IsRunning_ = true;
+
+#if defined(__linux__)
+  // The hardware events are opened as a single group, such that the kernel schedules them onto
+  // the processor together and their counts cover the same intervals. The events are opened and
+  // closed on every run to avoid holding file descriptors for idle timers.
+  int groupFileDescriptor = -1;
+  for (auto & event : Events_)
+  {
+    const auto isHardwareCounter = IsHardwareCounter(event.counter);
+    event.fileDescriptor =
+        OpenPerfEvent(event.counter, isHardwareCounter ? groupFileDescriptor : -1);
+    if (isHardwareCounter && groupFileDescriptor == -1)
+      groupFileDescriptor = event.fileDescriptor;
+  }
+
+  for (auto & event : Events_)
+  {
+    if (event.fileDescriptor != -1)
+      ioctl(event.fileDescriptor, PERF_EVENT_IOC_ENABLE, 0);
+  }
+#endif
+}
+
+void
+PerfCounterGroup::stop() noexcept
+{
+  if (!IsRunning_)
+    return;
+  IsRunning_ = false;
+
+#if defined(__linux__)
+  for (auto & event : Events_)
+  {
+    if (event.fileDescriptor != -1)
+      ioctl(event.fileDescriptor, PERF_EVENT_IOC_DISABLE, 0);
+  }
+
+  // Close the group members before their leader
+  for (auto it = Events_.rbegin(); it != Events_.rend(); ++it)
+  {
+    auto & event = *it;
+    if (event.fileDescriptor == -1)
+      continue;
+
+    if (const auto count = ReadPerfEvent(event.fileDescriptor))
+    {
+      event.count += *count;
+      event.isAvailable = true;
+    }
+
+    close(event.fileDescriptor);
+    event.fileDescriptor = -1;
+  }
+#endif
+}
+
+void
+PerfCounterGroup::reset() noexcept
+{
+  stop();
+  for (auto & event : Events_)
+  {
+    event.count = 0;
+    event.isAvailable = false;
+  }
+}
+
+std::vector<std::pair<PerfCounter, uint64_t>>
+PerfCounterGroup::counts() const
+{
+  std::vector<std::pair<PerfCounter, uint64_t>> counts;
+  for (auto & event : Events_)
+  {
+    if (event.isAvailable)
+      counts.emplace_back(event.counter, event.count);
+  }
+
+  return counts;
+}
+
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_PERFCOUNTERS_HPP
+#define JLM_UTIL_PERFCOUNTERS_HPP
+
+#include <jlm/util/HashSet.hpp>
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * Hardware and software events that can be counted by a PerfCounterGroup.
+ */
+enum class PerfCounter
+{
+  FirstEnumValue, // must always be the first enum value, used for iteration
+
+  Cycles,
+  Instructions,
+  BranchMisses,
+  CacheMisses,
+  PageFaults,
+
+  LastEnumValue // must always be the last enum value, used for iteration
+};
+
+/**
+ * @return The name of \p counter, e.g., "Instructions".
+ */
+[[nodiscard]] std::string_view
+ToString(PerfCounter counter);
+
+/**
+ * \brief Counts hardware and software events with the Linux perf_event_open interface.
+ *
+ * A group counts its events while it is running, i.e., between calls to start() and stop(), and
+ * accumulates the counts over all runs. Events are counted in user space for the calling thread
+ * and all threads it creates while the group is running. Counts are scaled up if the kernel had
+ * to multiplex the hardware counters.
+ *
+ * Counting is best-effort. Events that cannot be counted, e.g., because perf_event_open is not
+ * supported by the platform or prohibited by /proc/sys/kernel/perf_event_paranoid, are silently
+ * omitted from counts().
+ */
+class PerfCounterGroup final
+{
+public:
+  /**
+   * Makes a selection of counters current for the calling thread for the lifetime of the scope.
+   * While a selection is current, Statistics attach a PerfCounterGroup counting the selected
+   * events to each of their timers. The previously current selection is restored at the end of
+   * the scope.
+   */
+  class SelectionScope final
+  {
+  public:
+    explicit SelectionScope(const HashSet<PerfCounter> & counters) noexcept;
+
+    ~SelectionScope() noexcept;
+
+    SelectionScope(const SelectionScope &) = delete;
+
+    SelectionScope &
+    operator=(const SelectionScope &) = delete;
+
+  private:
+    const HashSet<PerfCounter> * previous_;
+  };
+
+  explicit PerfCounterGroup(const HashSet<PerfCounter> & counters);
+
+  ~PerfCounterGroup() noexcept;
+
+  PerfCounterGroup(const PerfCounterGroup &) = delete;
+
+  PerfCounterGroup &
+  operator=(const PerfCounterGroup &) = delete;
+
+  /**
+   * @return The selection of counters that is current for the calling thread, or nullptr if
+   * there is none or it is empty.
+   */
+  [[nodiscard]] static const HashSet<PerfCounter> *
+  currentSelection() noexcept;
+
+  /**
+   * Starts counting, without resetting the counts of previous runs.
+   * A no-op if the group is already running.
+   */
+  void
+  start() noexcept;
+
+  /**
+   * Stops counting and adds the counts of the run to the accumulated counts.
+   * A no-op if the group is not running.
+   */
+  void
+  stop() noexcept;
+
+  /**
+   * Discards the accumulated counts. If the group is running, it stops.
+   */
+  void
+  reset() noexcept;
+
+  [[nodiscard]] bool
+  isRunning() const noexcept
+  {
+    return IsRunning_;
+  }
+
+  /**
+   * @return The accumulated count of each requested event that could be counted during all runs,
+   * ordered by event.
+   */
+  [[nodiscard]] std::vector<std::pair<PerfCounter, uint64_t>>
+  counts() const;
+
+private:
+  struct Event
+  {
+    PerfCounter counter;
+    int fileDescriptor = -1;
+    bool isAvailable = false;
+    uint64_t count = 0;
+  };
+
+  std::vector<Event> Events_;
+  bool IsRunning_ = false;
+};
+
+}
+
+#endif
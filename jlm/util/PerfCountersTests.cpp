@@ -0,0 +1,113 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jlm/util/PerfCounters.hpp>
+
+#include <memory>
+
+/**
+ * Touches a freshly allocated buffer, which causes page faults. The buffer is returned such that
+ * its pages are not reused by later allocations.
+ */
+static std::unique_ptr<volatile char[]>
+TouchMemory()
+{
+  const size_t size = 16 * 1024 * 1024;
+  auto buffer = std::make_unique<volatile char[]>(size);
+  for (size_t n = 0; n < size; n += 4096)
+    buffer[n] = 1;
+
+  return buffer;
+}
+
+TEST(PerfCountersTests, StartStop)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  PerfCounterGroup group({ PerfCounter::PageFaults, PerfCounter::Instructions });
+
+  // Act
+  group.start();
+  EXPECT_TRUE(group.isRunning());
+  auto buffer = TouchMemory();
+  group.stop();
+
+  // Assert
+  EXPECT_FALSE(group.isRunning());
+
+  // Counting is best-effort, so only check the counts of the available events
+  auto counts = group.counts();
+  EXPECT_LE(counts.size(), 2u);
+  for (size_t n = 0; n < counts.size(); n++)
+  {
+    auto [counter, count] = counts[n];
+    EXPECT_TRUE(counter == PerfCounter::Instructions || counter == PerfCounter::PageFaults);
+    EXPECT_GT(count, 0u);
+    if (n > 0)
+    {
+      EXPECT_LT(counts[n - 1].first, counter);
+    }
+  }
+
+  // Resetting discards all counts
+  group.reset();
+  EXPECT_TRUE(group.counts().empty());
+}
+
+TEST(PerfCountersTests, AccumulatesRuns)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  PerfCounterGroup group({ PerfCounter::PageFaults });
+
+  // Act
+  group.start();
+  auto firstBuffer = TouchMemory();
+  group.stop();
+  const auto firstCounts = group.counts();
+
+  group.start();
+  auto secondBuffer = TouchMemory();
+  group.stop();
+  const auto secondCounts = group.counts();
+
+  // Assert
+  ASSERT_EQ(firstCounts.size(), secondCounts.size());
+  if (!firstCounts.empty())
+  {
+    EXPECT_GT(secondCounts[0].second, firstCounts[0].second);
+  }
+}
+
+TEST(PerfCountersTests, SelectionScope)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  const HashSet<PerfCounter> outerSelection({ PerfCounter::Cycles });
+  const HashSet<PerfCounter> innerSelection({ PerfCounter::CacheMisses });
+  const HashSet<PerfCounter> emptySelection;
+
+  // Act & Assert
+  EXPECT_EQ(PerfCounterGroup::currentSelection(), nullptr);
+  {
+    PerfCounterGroup::SelectionScope outerScope(outerSelection);
+    EXPECT_EQ(PerfCounterGroup::currentSelection(), &outerSelection);
+    {
+      PerfCounterGroup::SelectionScope innerScope(innerSelection);
+      EXPECT_EQ(PerfCounterGroup::currentSelection(), &innerSelection);
+    }
+    EXPECT_EQ(PerfCounterGroup::currentSelection(), &outerSelection);
+    {
+      PerfCounterGroup::SelectionScope emptyScope(emptySelection);
+      EXPECT_EQ(PerfCounterGroup::currentSelection(), nullptr);
+    }
+  }
+  EXPECT_EQ(PerfCounterGroup::currentSelection(), nullptr);
+}
@@ -0,0 +1,571 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_SPARSEBITVECTOR_HPP
+#define JLM_UTIL_SPARSEBITVECTOR_HPP
+
+#include <jlm/util/common.hpp>
+#include <jlm/util/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * Represents a set of unsigned integers as a sparse bit vector, in the spirit of LLVM's
+ * SparseBitVector. The bits are stored in fixed-size elements of 128 bits, and only elements with
+ * at least one bit set are stored. The elements are kept sorted by their position, such that set
+ * operations can be performed by merging the elements of both operands word by word.
+ *
+ * In contrast to a HashSet, items are iterated in ascending order.
+ *
+ * @tparam ItemType The type of the items in the set. Must be an unsigned integer type.
+ */
+template<typename ItemType>
+class SparseBitVector final
+{
+  static_assert(std::is_unsigned_v<ItemType>, "ItemType must be an unsigned integer type.");
+
+  using Word = uint64_t;
+
+  static constexpr size_t BitsPerWord = 64;
+  static constexpr size_t WordsPerElement = 2;
+  static constexpr size_t BitsPerElement = BitsPerWord * WordsPerElement;
+
+  struct Element
+  {
+    explicit Element(size_t index) noexcept
+        : Index(index)
+    {}
+
+    bool
+    operator==(const Element & other) const noexcept
+    {
+      return Index == other.Index && std::equal(Words, Words + WordsPerElement, other.Words);
+    }
+
+    // The position of the element, i.e., the element contains the items
+    // [Index * BitsPerElement, (Index + 1) * BitsPerElement)
+    size_t Index;
+    Word Words[WordsPerElement] = {};
+  };
+
+  using ElementVector = std::vector<Element>;
+
+public:
+  class ItemConstIterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ItemType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const ItemType *;
+    using reference = const ItemType &;
+
+  private:
+    ItemConstIterator(
+        typename ElementVector::const_iterator element,
+        typename ElementVector::const_iterator end)
+        : Element_(element),
+          End_(end)
+    {
+      if (Element_ != End_)
+      {
+        Remaining_ = Element_->Words[0];
+        SkipEmptyWords();
+      }
+    }
+
+  public:
+    ItemType
+    operator*() const noexcept
+    {
+      JLM_ASSERT(Element_ != End_);
+      return static_cast<ItemType>(
+          Element_->Index * BitsPerElement + WordIndex_ * BitsPerWord
+          + CountTrailingZeros(Remaining_));
+    }
+
+    ItemConstIterator &
+    operator++() noexcept
+    {
+      JLM_ASSERT(Element_ != End_);
+      // Clear the lowest set bit
+      Remaining_ &= Remaining_ - 1;
+      SkipEmptyWords();
+      return *this;
+    }
+
+    ItemConstIterator
+    operator++(int) noexcept
+    {
+      ItemConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool
+    operator==(const ItemConstIterator & other) const noexcept
+    {
+      return Element_ == other.Element_ && WordIndex_ == other.WordIndex_
+          && Remaining_ == other.Remaining_;
+    }
+
+    bool
+    operator!=(const ItemConstIterator & other) const noexcept
+    {
+      return !operator==(other);
+    }
+
+  private:
+    void
+    SkipEmptyWords() noexcept
+    {
+      while (Remaining_ == 0)
+      {
+        WordIndex_++;
+        if (WordIndex_ == WordsPerElement)
+        {
+          WordIndex_ = 0;
+          ++Element_;
+          if (Element_ == End_)
+            return;
+        }
+        Remaining_ = Element_->Words[WordIndex_];
+      }
+    }
+
+    typename ElementVector::const_iterator Element_;
+    typename ElementVector::const_iterator End_;
+    size_t WordIndex_ = 0;
+    Word Remaining_ = 0;
+
+    friend SparseBitVector;
+  };
+
+  using ItemRange = IteratorRange<ItemConstIterator>;
+
+  SparseBitVector() = default;
+
+  SparseBitVector(std::initializer_list<ItemType> initializerList)
+  {
+    for (auto item : initializerList)
+      insert(item);
+  }
+
+  /**
+   * Removes all items from the set.
+   */
+  void
+  Clear() noexcept
+  {
+    Elements_.clear();
+    Size_ = 0;
+  }
+
+  /**
+   * @return The number of items in the set.
+   */
+  [[nodiscard]] size_t
+  Size() const noexcept
+  {
+    return Size_;
+  }
+
+  /**
+   * @return True if the set contains no items, otherwise false.
+   */
+  [[nodiscard]] bool
+  IsEmpty() const noexcept
+  {
+    return Size_ == 0;
+  }
+
+  /**
+   * Determines whether the set contains \p item.
+   *
+   * @param item The item to locate in the set.
+   * @return True if the set contains \p item, otherwise false.
+   */
+  [[nodiscard]] bool
+  Contains(ItemType item) const noexcept
+  {
+    const auto elementIndex = static_cast<size_t>(item) / BitsPerElement;
+    const auto it = LowerBound(elementIndex);
+    if (it == Elements_.end() || it->Index != elementIndex)
+      return false;
+
+    const auto [wordIndex, mask] = GetWordAndMask(item);
+    return (it->Words[wordIndex] & mask) != 0;
+  }
+
+  /**
+   * Adds \p item to the set.
+   *
+   * Items that belong to the last element, or to a new element after it, are added in constant
+   * time, so inserting items in ascending order is cheap. Any other item that needs a new element
+   * shifts all elements after it. Sets of unordered items should therefore be combined with
+   * UnionWith() and DifferenceWith() where possible.
+   *
+   * @param item The item to add.
+   * @return True if \p item was added, false if it was already in the set.
+   */
+  bool
+  insert(ItemType item)
+  {
+    const auto elementIndex = static_cast<size_t>(item) / BitsPerElement;
+
+    typename ElementVector::iterator it;
+    if (Elements_.empty() || Elements_.back().Index < elementIndex)
+    {
+      it = Elements_.emplace(Elements_.end(), elementIndex);
+    }
+    else if (Elements_.back().Index == elementIndex)
+    {
+      it = std::prev(Elements_.end());
+    }
+    else
+    {
+      it = LowerBound(elementIndex);
+      if (it->Index != elementIndex)
+        it = Elements_.emplace(it, elementIndex);
+    }
+
+    const auto [wordIndex, mask] = GetWordAndMask(item);
+    if (it->Words[wordIndex] & mask)
+      return false;
+
+    it->Words[wordIndex] |= mask;
+    Size_++;
+    return true;
+  }
+
+  /**
+   * @return An iterator range over all items in ascending order.
+   */
+  [[nodiscard]] ItemRange
+  Items() const noexcept
+  {
+    return { ItemConstIterator(Elements_.begin(), Elements_.end()),
+             ItemConstIterator(Elements_.end(), Elements_.end()) };
+  }
+
+  /**
+   * Adds all items of \p other to this set.
+   *
+   * @param other The set whose items are added.
+   * @return True if any item was added, otherwise false.
+   */
+  bool
+  UnionWith(const SparseBitVector & other)
+  {
+    const auto ignoreNewItem = [](ItemType)
+    {
+    };
+    return UnionWith(other, ignoreNewItem);
+  }
+
+  /**
+   * Adds all items of \p other to this set, and invokes \p onNewItem for every item that was not
+   * already contained in this set. The new items are determined with word-level set differences,
+   * i.e., items that are already contained in this set are never visited individually.
+   *
+   * @tparam F A type supporting the function call operator: void operator(ItemType)
+   * @param other The set whose items are added.
+   * @param onNewItem The function invoked for every new item.
+   * @return True if any item was added, otherwise false.
+   */
+  template<typename F>
+  bool
+  UnionWith(const SparseBitVector & other, const F & onNewItem)
+  {
+    if (&other == this || other.IsEmpty())
+      return false;
+
+    const auto sizeBefore = Size_;
+
+    // Determine whether other has any elements that are missing in this set. If not,
+    // the union can be performed in place.
+    size_t numMissingElements = 0;
+    {
+      auto it = Elements_.begin();
+      for (auto & otherElement : other.Elements_)
+      {
+        while (it != Elements_.end() && it->Index < otherElement.Index)
+          ++it;
+        if (it == Elements_.end() || it->Index != otherElement.Index)
+          numMissingElements++;
+      }
+    }
+
+    if (numMissingElements == 0)
+    {
+      auto it = Elements_.begin();
+      for (auto & otherElement : other.Elements_)
+      {
+        while (it->Index < otherElement.Index)
+          ++it;
+        MergeElement(*it, otherElement, onNewItem);
+      }
+    }
+    else
+    {
+      ElementVector merged;
+      merged.reserve(Elements_.size() + numMissingElements);
+
+      auto it = Elements_.begin();
+      for (auto & otherElement : other.Elements_)
+      {
+        while (it != Elements_.end() && it->Index < otherElement.Index)
+          merged.push_back(*it++);
+
+        if (it != Elements_.end() && it->Index == otherElement.Index)
+        {
+          merged.push_back(*it++);
+        }
+        else
+        {
+          merged.emplace_back(otherElement.Index);
+        }
+        MergeElement(merged.back(), otherElement, onNewItem);
+      }
+      merged.insert(merged.end(), it, Elements_.end());
+
+      Elements_ = std::move(merged);
+    }
+
+    return Size_ != sizeBefore;
+  }
+
+  /**
+   * Adds all items of \p other to this set, and clears \p other afterwards.
+   *
+   * @param other The set whose items are moved into this set.
+   * @return True if any item was added, otherwise false.
+   */
+  bool
+  UnionWithAndClear(SparseBitVector & other)
+  {
+    if (&other == this)
+      return false;
+
+    bool result;
+    if (IsEmpty())
+    {
+      std::swap(Elements_, other.Elements_);
+      std::swap(Size_, other.Size_);
+      result = !IsEmpty();
+    }
+    else
+    {
+      result = UnionWith(other);
+    }
+
+    other.Clear();
+    return result;
+  }
+
+  /**
+   * Removes all items from this set that are not contained in \p other.
+   *
+   * @param other The set to intersect with.
+   */
+  void
+  IntersectWith(const SparseBitVector & other) noexcept
+  {
+    if (&other == this)
+      return;
+
+    RetainWords(
+        other,
+        [](Word word, Word otherWord)
+        {
+          return word & otherWord;
+        });
+  }
+
+  /**
+   * Removes all items from this set that are contained in \p other.
+   *
+   * @param other The set whose items are removed.
+   */
+  void
+  DifferenceWith(const SparseBitVector & other) noexcept
+  {
+    if (&other == this)
+    {
+      Clear();
+      return;
+    }
+
+    RetainWords(
+        other,
+        [](Word word, Word otherWord)
+        {
+          return word & ~otherWord;
+        });
+  }
+
+  /**
+   * Checks if all items of this set are contained in \p other.
+   *
+   * @param other The set to compare against.
+   * @return True if this set is a subset of \p other, otherwise false.
+   */
+  [[nodiscard]] bool
+  IsSubsetOf(const SparseBitVector & other) const noexcept
+  {
+    if (Size_ > other.Size_)
+      return false;
+
+    auto it = other.Elements_.begin();
+    for (auto & element : Elements_)
+    {
+      while (it != other.Elements_.end() && it->Index < element.Index)
+        ++it;
+      if (it == other.Elements_.end() || it->Index != element.Index)
+        return false;
+
+      for (size_t n = 0; n < WordsPerElement; n++)
+      {
+        if ((element.Words[n] & ~it->Words[n]) != 0)
+          return false;
+      }
+    }
+
+    return true;
+  }
+
+  bool
+  operator==(const SparseBitVector & other) const noexcept
+  {
+    return Size_ == other.Size_ && Elements_ == other.Elements_;
+  }
+
+  bool
+  operator!=(const SparseBitVector & other) const noexcept
+  {
+    return !operator==(other);
+  }
+
+private:
+  [[nodiscard]] typename ElementVector::iterator
+  LowerBound(size_t elementIndex) noexcept
+  {
+    return std::lower_bound(
+        Elements_.begin(),
+        Elements_.end(),
+        elementIndex,
+        [](const Element & element, size_t index)
+        {
+          return element.Index < index;
+        });
+  }
+
+  [[nodiscard]] typename ElementVector::const_iterator
+  LowerBound(size_t elementIndex) const noexcept
+  {
+    return const_cast<SparseBitVector *>(this)->LowerBound(elementIndex);
+  }
+
+  [[nodiscard]] static std::pair<size_t, Word>
+  GetWordAndMask(ItemType item) noexcept
+  {
+    const auto bitIndex = static_cast<size_t>(item) % BitsPerElement;
+    return { bitIndex / BitsPerWord, Word(1) << (bitIndex % BitsPerWord) };
+  }
+
+  /**
+   * Replaces every word of this set by \p retain(word, otherWord), where otherWord is the word at
+   * the same position in \p other, or zero if \p other has no such element. Elements that become
+   * empty are removed.
+   *
+   * @tparam F A type supporting the function call operator: Word operator(Word, Word)
+   */
+  template<typename F>
+  void
+  RetainWords(const SparseBitVector & other, const F & retain) noexcept
+  {
+    JLM_ASSERT(&other != this);
+
+    auto otherIt = other.Elements_.begin();
+    auto kept = Elements_.begin();
+    for (auto & element : Elements_)
+    {
+      while (otherIt != other.Elements_.end() && otherIt->Index < element.Index)
+        ++otherIt;
+      const auto otherElement =
+          otherIt != other.Elements_.end() && otherIt->Index == element.Index ? &*otherIt : nullptr;
+
+      Word remaining = 0;
+      for (size_t n = 0; n < WordsPerElement; n++)
+      {
+        const auto word = retain(element.Words[n], otherElement ? otherElement->Words[n] : 0);
+        Size_ -= PopulationCount(element.Words[n] & ~word);
+        element.Words[n] = word;
+        remaining |= word;
+      }
+
+      if (remaining != 0)
+        *kept++ = element;
+    }
+
+    Elements_.erase(kept, Elements_.end());
+  }
+
+  /**
+   * Adds the bits of \p source to \p target, invoking \p onNewItem for every bit that is new.
+   */
+  template<typename F>
+  void
+  MergeElement(Element & target, const Element & source, const F & onNewItem)
+  {
+    JLM_ASSERT(target.Index == source.Index);
+
+    for (size_t n = 0; n < WordsPerElement; n++)
+    {
+      auto newBits = source.Words[n] & ~target.Words[n];
+      if (newBits == 0)
+        continue;
+
+      target.Words[n] |= newBits;
+      Size_ += PopulationCount(newBits);
+
+      const auto wordBase = target.Index * BitsPerElement + n * BitsPerWord;
+      while (newBits != 0)
+      {
+        onNewItem(static_cast<ItemType>(wordBase + CountTrailingZeros(newBits)));
+        newBits &= newBits - 1;
+      }
+    }
+  }
+
+  [[nodiscard]] static size_t
+  CountTrailingZeros(Word word) noexcept
+  {
+    JLM_ASSERT(word != 0);
+    return __builtin_ctzll(word);
+  }
+
+  [[nodiscard]] static size_t
+  PopulationCount(Word word) noexcept
+  {
+    return __builtin_popcountll(word);
+  }
+
+  ElementVector Elements_{};
+  size_t Size_ = 0;
+};
+
+}
+
+#endif // JLM_UTIL_SPARSEBITVECTOR_HPP
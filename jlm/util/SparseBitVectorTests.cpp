@@ -0,0 +1,142 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jlm/util/SparseBitVector.hpp>
+
+#include <cstdint>
+#include <vector>
+
+TEST(SparseBitVectorTests, InsertAndContains)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  SparseBitVector<uint32_t> set;
+
+  // Act & Assert
+  EXPECT_TRUE(set.IsEmpty());
+  EXPECT_TRUE(set.insert(5));
+  EXPECT_TRUE(set.insert(1000));
+  EXPECT_TRUE(set.insert(63));
+  EXPECT_TRUE(set.insert(64));
+  EXPECT_TRUE(set.insert(127));
+  EXPECT_TRUE(set.insert(128));
+  EXPECT_FALSE(set.insert(5));
+
+  EXPECT_EQ(set.Size(), 6u);
+  EXPECT_TRUE(set.Contains(5));
+  EXPECT_TRUE(set.Contains(1000));
+  EXPECT_TRUE(set.Contains(128));
+  EXPECT_FALSE(set.Contains(6));
+  EXPECT_FALSE(set.Contains(999));
+  EXPECT_FALSE(set.Contains(100000));
+
+  // Items are iterated in ascending order
+  std::vector<uint32_t> items(set.Items().begin(), set.Items().end());
+  EXPECT_EQ(items, (std::vector<uint32_t>{ 5, 63, 64, 127, 128, 1000 }));
+
+  set.Clear();
+  EXPECT_TRUE(set.IsEmpty());
+  EXPECT_EQ(set.Items().begin(), set.Items().end());
+}
+
+TEST(SparseBitVectorTests, UnionWith)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  SparseBitVector<uint32_t> set1({ 1, 2, 300 });
+  SparseBitVector<uint32_t> set2({ 2, 3, 200, 300, 5000 });
+
+  // Act
+  std::vector<uint32_t> newItems;
+  const auto modified = set1.UnionWith(
+      set2,
+      [&](uint32_t item)
+      {
+        newItems.push_back(item);
+      });
+
+  // Assert
+  EXPECT_TRUE(modified);
+  EXPECT_EQ(newItems, (std::vector<uint32_t>{ 3, 200, 5000 }));
+  EXPECT_EQ(set1, SparseBitVector<uint32_t>({ 1, 2, 3, 200, 300, 5000 }));
+  EXPECT_EQ(set1.Size(), 6u);
+  EXPECT_TRUE(set2.IsSubsetOf(set1));
+  EXPECT_FALSE(set1.IsSubsetOf(set2));
+
+  // A second union adds nothing
+  EXPECT_FALSE(set1.UnionWith(set2));
+  EXPECT_FALSE(set1.UnionWith(set1));
+}
+
+TEST(SparseBitVectorTests, UnionWithAndClear)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  SparseBitVector<uint32_t> empty;
+  SparseBitVector<uint32_t> set1({ 7, 700 });
+  SparseBitVector<uint32_t> set2({ 7, 8 });
+
+  // Act & Assert
+  EXPECT_TRUE(empty.UnionWithAndClear(set1));
+  EXPECT_TRUE(set1.IsEmpty());
+  EXPECT_EQ(empty, SparseBitVector<uint32_t>({ 7, 700 }));
+
+  EXPECT_TRUE(empty.UnionWithAndClear(set2));
+  EXPECT_TRUE(set2.IsEmpty());
+  EXPECT_EQ(empty, SparseBitVector<uint32_t>({ 7, 8, 700 }));
+  EXPECT_NE(empty, SparseBitVector<uint32_t>({ 7, 8 }));
+}
+
+TEST(SparseBitVectorTests, IntersectWith)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  SparseBitVector<uint32_t> set1({ 1, 2, 64, 200, 300, 5000 });
+  SparseBitVector<uint32_t> set2({ 2, 3, 64, 201, 300, 10000 });
+
+  // Act
+  set1.IntersectWith(set2);
+
+  // Assert
+  // The elements of 200 and 5000 become empty, and must be removed for the sets to compare equal
+  EXPECT_EQ(set1, SparseBitVector<uint32_t>({ 2, 64, 300 }));
+  EXPECT_EQ(set1.Size(), 3u);
+
+  set1.IntersectWith(set1);
+  EXPECT_EQ(set1.Size(), 3u);
+
+  set1.IntersectWith(SparseBitVector<uint32_t>());
+  EXPECT_TRUE(set1.IsEmpty());
+  EXPECT_EQ(set1, SparseBitVector<uint32_t>());
+}
+
+TEST(SparseBitVectorTests, DifferenceWith)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  SparseBitVector<uint32_t> set1({ 1, 2, 64, 200, 300, 5000 });
+  SparseBitVector<uint32_t> set2({ 2, 3, 64, 200, 10000 });
+
+  // Act
+  set1.DifferenceWith(set2);
+
+  // Assert
+  EXPECT_EQ(set1, SparseBitVector<uint32_t>({ 1, 300, 5000 }));
+  EXPECT_EQ(set1.Size(), 3u);
+
+  set1.DifferenceWith(SparseBitVector<uint32_t>());
+  EXPECT_EQ(set1.Size(), 3u);
+
+  set1.DifferenceWith(set1);
+  EXPECT_TRUE(set1.IsEmpty());
+  EXPECT_EQ(set1, SparseBitVector<uint32_t>());
+}
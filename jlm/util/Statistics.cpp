@@ -9,6 +9,7 @@
 #include <jlm/util/BijectiveMap.hpp>
 #include <jlm/util/strfmt.hpp>
 
+#include <fstream>
 #include <string_view>
 
 namespace jlm::util
@@ -25,6 +26,7 @@ GetStatisticsIdNames()
     { Statistics::Id::AndersenAnalysis, "AndersenAnalysis" },
     { Statistics::Id::Annotation, "Annotation" },
     { Statistics::Id::CommonNodeElimination, "CNE" },
+    { Statistics::Id::CompilationCache, "CompilationCache" },
     { Statistics::Id::ControlFlowRecovery, "ControlFlowRestructuring" },
     { Statistics::Id::DataNodeToDelta, "DataNodeToDeltaStatistics" },
     { Statistics::Id::DeadNodeElimination, "DeadNodeElimination" },
@@ -96,6 +98,13 @@ Statistics::Serialize(char fieldSeparator, char nameValueSeparator) const
       ss << fieldSeparator;
 
     ss << mName << "[ns]" << nameValueSeparator << timer.ns();
+
+    if (const auto perfCounters = timer.perfCounters())
+    {
+      for (const auto & [counter, count] : perfCounters->counts())
+        ss << fieldSeparator << mName << "[" << ToString(counter) << "]" << nameValueSeparator
+           << count;
+    }
   }
 
   return ss.str();
@@ -161,12 +170,21 @@ Statistics::AddTimer(std::string name)
   JLM_ASSERT(!HasTimer(name));
   Timers_.emplace_back(std::make_pair(std::move(name), util::Timer()));
   auto & timer = Timers_.back().second;
+  if (const auto perfCounters = PerfCounterGroup::currentSelection())
+    timer.attachPerfCounters(std::make_unique<PerfCounterGroup>(*perfCounters));
   return timer;
 }
 
 void
 StatisticsCollector::PrintStatistics()
 {
+  if (Tracer_ && !Tracer_->spans().empty())
+  {
+    const auto traceFile = createOutputFile("trace.json");
+    std::ofstream stream(traceFile.path().to_str());
+    Tracer_->writeChromeTrace(stream);
+  }
+
   if (NumCollectedStatistics() == 0)
     return;
 
@@ -9,8 +9,10 @@
 
 #include <jlm/util/file.hpp>
 #include <jlm/util/HashSet.hpp>
+#include <jlm/util/PerfCounters.hpp>
 #include <jlm/util/strfmt.hpp>
 #include <jlm/util/time.hpp>
+#include <jlm/util/Trace.hpp>
 
 #include <cstdint>
 #include <list>
@@ -41,6 +43,7 @@ public:
     AndersenAnalysis,
     Annotation,
     CommonNodeElimination,
+    CompilationCache,
     ControlFlowRecovery,
     DataNodeToDelta,
     DeadNodeElimination,
@@ -430,11 +433,55 @@ public:
     UniqueString_ = std::move(uniqueString);
   }
 
+  /**
+   * @return True if a trace of the executed passes should be recorded, otherwise false.
+   */
+  [[nodiscard]] bool
+  isTracingEnabled() const noexcept
+  {
+    return IsTracingEnabled_;
+  }
+
+  /**
+   * Enables or disables the recording of a trace of the executed passes. The trace is written to
+   * the output directory as a Chrome trace.
+   *
+   * @see Tracer
+   */
+  void
+  setTracingEnabled(bool isTracingEnabled) noexcept
+  {
+    IsTracingEnabled_ = isTracingEnabled;
+  }
+
+  /**
+   * @return The hardware and software events that are counted next to the time of each timer.
+   */
+  [[nodiscard]] const HashSet<PerfCounter> &
+  GetDemandedPerfCounters() const noexcept
+  {
+    return DemandedPerfCounters_;
+  }
+
+  /**
+   * Sets the events that are counted next to the time of each timer. Events that cannot be
+   * counted on the running system are omitted from the statistics.
+   *
+   * @see PerfCounterGroup
+   */
+  void
+  SetDemandedPerfCounters(HashSet<PerfCounter> demandedPerfCounters)
+  {
+    DemandedPerfCounters_ = std::move(demandedPerfCounters);
+  }
+
 private:
   HashSet<Statistics::Id> DemandedStatistics_;
+  HashSet<PerfCounter> DemandedPerfCounters_;
   std::optional<FilePath> Directory_;
   std::string ModuleName_;
   std::string UniqueString_ = CreateRandomAlphanumericString(6);
+  bool IsTracingEnabled_ = false;
 };
 
 /**
@@ -517,7 +564,10 @@ public:
 
   explicit StatisticsCollector(StatisticsCollectorSettings settings)
       : Settings_(std::move(settings))
-  {}
+  {
+    if (Settings_.isTracingEnabled())
+      Tracer_ = std::make_unique<Tracer>();
+  }
 
   const StatisticsCollectorSettings &
   GetSettings() const noexcept
@@ -525,6 +575,18 @@ public:
     return Settings_;
   }
 
+  /**
+   * @return The tracer recording the trace of the executed passes, or nullptr if tracing is not
+   * enabled.
+   *
+   * @see StatisticsCollectorSettings::isTracingEnabled()
+   */
+  [[nodiscard]] Tracer *
+  GetTracer() const noexcept
+  {
+    return Tracer_.get();
+  }
+
   StatisticsRange
   CollectedStatistics() const noexcept
   {
@@ -605,6 +667,7 @@ public:
   /**
    * \brief Print collected statistics to file.
    * If no statistics have been collected, this is a no-op.
+   * If tracing is enabled and spans have been recorded, the trace is written to its own file.
    * @throws jlm::util::error if there are statistics to print, but no output directory in settings
    */
   void
@@ -633,6 +696,7 @@ public:
 private:
   StatisticsCollectorSettings Settings_;
   std::vector<std::unique_ptr<Statistics>> CollectedStatistics_;
+  std::unique_ptr<Tracer> Tracer_;
 
   // Counter used to give unique file names to output files that share suffix
   std::unordered_map<std::string, size_t> OutputFileCounter_;
@@ -185,3 +185,35 @@ TEST(StatisticsTests, TestCreateOutputFile)
   EXPECT_EQ(nice0.path(), "/tmp/test-module-ABC-nice-0.txt");
   EXPECT_EQ(nice1.path(), "/tmp/test-module-ABC-nice-1.txt");
 }
+
+TEST(StatisticsTests, TimerPerfCounters)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  const HashSet<PerfCounter> perfCounters({ PerfCounter::PageFaults });
+  MyTestStatistics statisticsWithoutCounters(Statistics::Id::Aggregation, FilePath("file.ll"));
+  MyTestStatistics statisticsWithCounters(Statistics::Id::Aggregation, FilePath("file.ll"));
+
+  // Act
+  statisticsWithoutCounters.Start(10, 6.0);
+  statisticsWithoutCounters.Stop(-400, "poor");
+  {
+    PerfCounterGroup::SelectionScope perfCountersScope(perfCounters);
+    statisticsWithCounters.Start(10, 6.0);
+  }
+  statisticsWithCounters.Stop(-400, "poor");
+
+  // Assert
+  EXPECT_EQ(statisticsWithoutCounters.GetTimers().begin()->second.perfCounters(), nullptr);
+  auto timerPerfCounters = statisticsWithCounters.GetTimers().begin()->second.perfCounters();
+  ASSERT_NE(timerPerfCounters, nullptr);
+
+  // The count is only reported if page faults can be counted on this system
+  const auto isCounted = !timerPerfCounters->counts().empty();
+  const auto serialized = statisticsWithCounters.Serialize(' ', ':');
+  EXPECT_EQ(serialized.find("Timer[PageFaults]:") != std::string::npos, isCounted);
+  EXPECT_EQ(
+      statisticsWithoutCounters.Serialize(' ', ':').find("[PageFaults]"),
+      std::string::npos);
+}
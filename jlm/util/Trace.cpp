@@ -0,0 +1,166 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/util/Trace.hpp>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <iomanip>
+
+namespace jlm::util
+{
+
+static thread_local Tracer * CurrentTracer = nullptr;
+
+/**
+ * @return The peak resident set size of the process in KiB.
+ */
+static uint64_t
+GetPeakRss() noexcept
+{
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+
+  return usage.ru_maxrss;
+}
+
+/**
+ * Prints \p string as a quoted and escaped JSON string to \p out.
+ */
+static void
+PrintJsonString(std::ostream & out, std::string_view string)
+{
+  out << '"';
+  for (const char c : string)
+  {
+    if (c == '"')
+      out << "\\\"";
+    else if (c == '\\')
+      out << "\\\\";
+    else if (c == '\n')
+      out << "\\n";
+    else if (static_cast<unsigned char>(c) < 0x20)
+      out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+          << std::dec;
+    else
+      out << c;
+  }
+  out << '"';
+}
+
+/**
+ * Prints \p nanoseconds as microseconds, the time unit of the Chrome trace event format.
+ */
+static void
+PrintMicroseconds(std::ostream & out, uint64_t nanoseconds)
+{
+  out << nanoseconds / 1000 << '.' << std::setw(3) << std::setfill('0') << nanoseconds % 1000;
+}
+
+Tracer::CurrentScope::CurrentScope(Tracer * tracer) noexcept
+    : previous_(CurrentTracer)
+{
+  CurrentTracer = tracer;
+}
+
+Tracer::CurrentScope::~CurrentScope() noexcept
+{
+  CurrentTracer = previous_;
+}
+
+Tracer::Tracer()
+    : Epoch_(Clock::now())
+{}
+
+Tracer *
+Tracer::current() noexcept
+{
+  return CurrentTracer;
+}
+
+void
+Tracer::record(Span span)
+{
+  std::lock_guard lock(Mutex_);
+  const auto [iterator, _] =
+      ThreadIndices_.emplace(std::this_thread::get_id(), ThreadIndices_.size());
+  span.threadIndex = iterator->second;
+  Spans_.push_back(std::move(span));
+}
+
+void
+Tracer::writeChromeTrace(std::ostream & out) const
+{
+  const auto processId = getpid();
+
+  out << "{\"traceEvents\":[";
+  bool isFirstEvent = true;
+  for (auto & span : Spans_)
+  {
+    out << (isFirstEvent ? "\n" : ",\n");
+    isFirstEvent = false;
+
+    out << "{\"name\":";
+    PrintJsonString(out, span.name);
+    out << ",\"cat\":";
+    PrintJsonString(out, span.category);
+    out << ",\"ph\":\"X\",\"ts\":";
+    PrintMicroseconds(out, span.start);
+    out << ",\"dur\":";
+    PrintMicroseconds(out, span.duration);
+    out << ",\"pid\":" << processId << ",\"tid\":" << span.threadIndex << ",\"args\":{";
+
+    bool isFirstArgument = true;
+    for (auto & [name, value] : span.arguments)
+    {
+      out << (isFirstArgument ? "" : ",");
+      isFirstArgument = false;
+
+      PrintJsonString(out, name);
+      out << ':';
+      if (auto string = std::get_if<std::string>(&value))
+        PrintJsonString(out, *string);
+      else
+        std::visit(
+            [&](const auto & number)
+            {
+              out << number;
+            },
+            value);
+    }
+    out << "}}";
+  }
+  out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+TraceSpan::TraceSpan(std::string_view name, std::string_view category)
+    : Tracer_(Tracer::current())
+{
+  if (!Tracer_)
+    return;
+
+  Span_.name = name;
+  Span_.category = category;
+  StartPeakRss_ = GetPeakRss();
+  Span_.start = Tracer_->now();
+}
+
+TraceSpan::~TraceSpan() noexcept
+{
+  if (!Tracer_)
+    return;
+
+  Span_.duration = Tracer_->now() - Span_.start;
+
+  const auto peakRss = GetPeakRss();
+  Span_.arguments.emplace_back("PeakRssKiB", peakRss);
+  Span_.arguments.emplace_back("PeakRssGrowthKiB", peakRss - StartPeakRss_);
+
+  Tracer_->record(std::move(Span_));
+}
+
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_TRACE_HPP
+#define JLM_UTIL_TRACE_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * \brief Records nested, timed spans of work and exports them as a Chrome trace.
+ *
+ * Spans are recorded with TraceSpan, which records into the tracer that is current for the
+ * calling thread. A tracer is made current with Tracer::CurrentScope. If no tracer is current,
+ * spans are not recorded and cost little more than a thread-local load.
+ *
+ * Spans of the same thread nest according to their lifetimes. A tracer can be shared by several
+ * threads, and each thread gets its own track in the trace.
+ *
+ * @see TraceSpan
+ */
+class Tracer final
+{
+public:
+  using Argument = std::pair<std::string, std::variant<std::string, int64_t, uint64_t, double>>;
+
+  /**
+   * A completed span.
+   */
+  struct Span
+  {
+    std::string name;
+    std::string category;
+
+    /**
+     * Start of the span in nanoseconds since the creation of the tracer.
+     */
+    uint64_t start = 0;
+
+    /**
+     * Duration of the span in nanoseconds.
+     */
+    uint64_t duration = 0;
+
+    /**
+     * Index of the thread that recorded the span. Threads are numbered in the order they
+     * recorded their first span.
+     */
+    size_t threadIndex = 0;
+
+    std::vector<Argument> arguments;
+  };
+
+  /**
+   * Makes a tracer current for the calling thread for the lifetime of the scope. The previously
+   * current tracer is restored at the end of the scope.
+   */
+  class CurrentScope final
+  {
+  public:
+    explicit CurrentScope(Tracer * tracer) noexcept;
+
+    ~CurrentScope() noexcept;
+
+    CurrentScope(const CurrentScope &) = delete;
+
+    CurrentScope &
+    operator=(const CurrentScope &) = delete;
+
+  private:
+    Tracer * previous_;
+  };
+
+  Tracer();
+
+  Tracer(const Tracer &) = delete;
+
+  Tracer &
+  operator=(const Tracer &) = delete;
+
+  /**
+   * @return The tracer that is current for the calling thread, or nullptr if there is none.
+   */
+  [[nodiscard]] static Tracer *
+  current() noexcept;
+
+  /**
+   * @return The number of nanoseconds since the creation of the tracer.
+   */
+  [[nodiscard]] uint64_t
+  now() const noexcept
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - Epoch_).count();
+  }
+
+  /**
+   * Records \p span. The thread index of \p span is set to the index of the calling thread.
+   *
+   * This method is thread-safe.
+   */
+  void
+  record(Span span);
+
+  /**
+   * @return The recorded spans in the order they were completed.
+   *
+   * \note Must not be called while other threads are recording spans.
+   */
+  [[nodiscard]] const std::vector<Span> &
+  spans() const noexcept
+  {
+    return Spans_;
+  }
+
+  /**
+   * Writes the recorded spans to \p out in the Chrome trace event format, which can be loaded
+   * into Perfetto or chrome://tracing.
+   *
+   * \note Must not be called while other threads are recording spans.
+   */
+  void
+  writeChromeTrace(std::ostream & out) const;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  Clock::time_point Epoch_;
+
+  std::mutex Mutex_;
+  std::vector<Span> Spans_;
+  std::unordered_map<std::thread::id, size_t> ThreadIndices_;
+};
+
+/**
+ * \brief Records the lifetime of the object as a span in the current tracer.
+ *
+ * Besides its duration, a span records the peak resident set size of the process at the end of
+ * the span and by how much the span raised it. Further arguments, e.g., node counts, can be
+ * attached with addArgument().
+ *
+ * @see Tracer
+ */
+class TraceSpan final
+{
+public:
+  explicit TraceSpan(std::string_view name, std::string_view category = "jlm");
+
+  ~TraceSpan() noexcept;
+
+  TraceSpan(const TraceSpan &) = delete;
+
+  TraceSpan &
+  operator=(const TraceSpan &) = delete;
+
+  /**
+   * @return True if the span is recorded, i.e., a tracer was current when it was created.
+   *
+   * Arguments that are expensive to compute should only be computed for active spans.
+   */
+  [[nodiscard]] bool
+  isActive() const noexcept
+  {
+    return Tracer_ != nullptr;
+  }
+
+  /**
+   * Attaches the argument \p name with \p value to the span. A no-op if the span is not active.
+   */
+  template<typename T>
+  void
+  addArgument(std::string name, T value)
+  {
+    if (isActive())
+      Span_.arguments.emplace_back(std::move(name), value);
+  }
+
+private:
+  Tracer * Tracer_;
+  Tracer::Span Span_;
+  uint64_t StartPeakRss_ = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,154 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <gtest/gtest.h>
+
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/Trace.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+TEST(TraceTests, NoCurrentTracer)
+{
+  using namespace jlm::util;
+
+  // Arrange & Act
+  TraceSpan span("span");
+  span.addArgument("argument", static_cast<uint64_t>(1));
+
+  // Assert
+  EXPECT_EQ(Tracer::current(), nullptr);
+  EXPECT_FALSE(span.isActive());
+}
+
+TEST(TraceTests, NestedSpans)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  Tracer tracer;
+
+  // Act
+  {
+    Tracer::CurrentScope scope(&tracer);
+    TraceSpan outerSpan("outer", "pipeline");
+    {
+      TraceSpan innerSpan("inner");
+      innerSpan.addArgument("#Nodes", static_cast<uint64_t>(42));
+    }
+  }
+
+  // Assert
+  EXPECT_EQ(Tracer::current(), nullptr);
+
+  auto & spans = tracer.spans();
+  ASSERT_EQ(spans.size(), 2u);
+  auto & inner = spans[0];
+  auto & outer = spans[1];
+
+  EXPECT_EQ(inner.name, "inner");
+  EXPECT_EQ(inner.category, "jlm");
+  EXPECT_EQ(outer.name, "outer");
+  EXPECT_EQ(outer.category, "pipeline");
+
+  EXPECT_LE(outer.start, inner.start);
+  EXPECT_GE(outer.start + outer.duration, inner.start + inner.duration);
+
+  ASSERT_EQ(inner.arguments.size(), 3u);
+  EXPECT_EQ(inner.arguments[0].first, "#Nodes");
+  EXPECT_EQ(std::get<uint64_t>(inner.arguments[0].second), 42u);
+  EXPECT_EQ(inner.arguments[1].first, "PeakRssKiB");
+  EXPECT_GT(std::get<uint64_t>(inner.arguments[1].second), 0u);
+  EXPECT_EQ(inner.arguments[2].first, "PeakRssGrowthKiB");
+}
+
+TEST(TraceTests, MultipleThreads)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  Tracer tracer;
+  auto recordSpan = [&]()
+  {
+    Tracer::CurrentScope scope(&tracer);
+    TraceSpan span("span");
+  };
+
+  // Act
+  recordSpan();
+  std::thread thread(recordSpan);
+  thread.join();
+  recordSpan();
+
+  // Assert
+  auto & spans = tracer.spans();
+  ASSERT_EQ(spans.size(), 3u);
+  EXPECT_EQ(spans[0].threadIndex, 0u);
+  EXPECT_EQ(spans[1].threadIndex, 1u);
+  EXPECT_EQ(spans[2].threadIndex, 0u);
+}
+
+TEST(TraceTests, ChromeTraceOutput)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  Tracer tracer;
+  {
+    Tracer::CurrentScope scope(&tracer);
+    TraceSpan span("a \"quoted\"\nname", "pass");
+    span.addArgument("Configuration", std::string("x\\y"));
+    span.addArgument("Ratio", 0.5);
+  }
+
+  // Act
+  std::stringstream stream;
+  tracer.writeChromeTrace(stream);
+  const auto trace = stream.str();
+
+  // Assert
+  EXPECT_EQ(trace.find("{\"traceEvents\":["), 0u);
+  EXPECT_NE(trace.find("\"name\":\"a \\\"quoted\\\"\\nname\""), std::string::npos);
+  EXPECT_NE(trace.find("\"cat\":\"pass\",\"ph\":\"X\",\"ts\":"), std::string::npos);
+  EXPECT_NE(trace.find("\"Configuration\":\"x\\\\y\""), std::string::npos);
+  EXPECT_NE(trace.find("\"Ratio\":0.5"), std::string::npos);
+  EXPECT_NE(trace.find("\"PeakRssKiB\":"), std::string::npos);
+}
+
+TEST(TraceTests, StatisticsCollectorTraceFile)
+{
+  using namespace jlm::util;
+
+  // Arrange
+  const auto directory =
+      FilePath::TempDirectoryPath().Join("jlm-trace-test-" + CreateRandomAlphanumericString(6));
+  StatisticsCollectorSettings settings({}, directory, "module");
+  settings.setTracingEnabled(true);
+  StatisticsCollector collector(std::move(settings));
+  StatisticsCollector disabledCollector;
+
+  // Act
+  {
+    Tracer::CurrentScope scope(collector.GetTracer());
+    TraceSpan span("span");
+  }
+  collector.PrintStatistics();
+
+  // Assert
+  EXPECT_EQ(disabledCollector.GetTracer(), nullptr);
+  ASSERT_NE(collector.GetTracer(), nullptr);
+
+  std::vector<std::filesystem::path> files(
+      std::filesystem::directory_iterator(directory.to_str()),
+      std::filesystem::directory_iterator());
+  ASSERT_EQ(files.size(), 1u);
+  EXPECT_EQ(files[0].filename().string().find("module-"), 0u);
+  EXPECT_NE(files[0].filename().string().find("trace.json"), std::string::npos);
+
+  std::filesystem::remove_all(directory.to_str());
+}
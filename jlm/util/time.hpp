@@ -8,8 +8,10 @@
 #define JLM_UTIL_TIME_HPP
 
 #include <jlm/util/common.hpp>
+#include <jlm/util/PerfCounters.hpp>
 
 #include <chrono>
+#include <memory>
 
 namespace jlm::util
 {
@@ -44,6 +46,8 @@ public:
   {
     ElapsedTimeInNanoseconds_ = 0;
     IsRunning_ = false;
+    if (PerfCounters_)
+      PerfCounters_->reset();
   }
 
   /**
@@ -55,6 +59,8 @@ public:
   {
     if (IsRunning_)
       return;
+    if (PerfCounters_)
+      PerfCounters_->start();
     Start_ = std::chrono::high_resolution_clock::now();
     IsRunning_ = true;
   }
@@ -72,6 +78,8 @@ public:
     ElapsedTimeInNanoseconds_ +=
         std::chrono::duration_cast<std::chrono::nanoseconds>(end - Start_).count();
     IsRunning_ = false;
+    if (PerfCounters_)
+      PerfCounters_->stop();
   }
 
   /**
@@ -87,10 +95,32 @@ public:
     return ElapsedTimeInNanoseconds_;
   }
 
+  /**
+   * Attaches \p perfCounters to the timer, such that they count events whenever the timer is
+   * running. Requires the timer to not be running.
+   */
+  void
+  attachPerfCounters(std::unique_ptr<PerfCounterGroup> perfCounters)
+  {
+    if (IsRunning_)
+      throw std::logic_error("Timer is running");
+    PerfCounters_ = std::move(perfCounters);
+  }
+
+  /**
+   * @return The performance counters attached to the timer, or nullptr if there are none.
+   */
+  [[nodiscard]] const PerfCounterGroup *
+  perfCounters() const noexcept
+  {
+    return PerfCounters_.get();
+  }
+
 private:
   size_t ElapsedTimeInNanoseconds_;
   bool IsRunning_;
   std::chrono::time_point<std::chrono::high_resolution_clock> Start_;
+  std::unique_ptr<PerfCounterGroup> PerfCounters_;
 };
 
 }
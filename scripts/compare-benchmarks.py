@@ -0,0 +1,45 @@
+#! /usr/bin/env python3
+
+import argparse
+import json
+
+parser = argparse.ArgumentParser(description='Compares two result files of jlm-bench and prints the median execution time of each benchmark in both files, as well as their ratio.')
+
+parser.add_argument('baseline', help='the result file of the baseline')
+parser.add_argument('contender', help='the result file to be compared against the baseline')
+parser.add_argument('--threshold', type=float, default=0.05,
+        help='the relative change of the median below which benchmarks are considered unchanged (default: 0.05)')
+
+args = parser.parse_args()
+
+def load(path):
+    with open(path) as f:
+        return {benchmark['name']: benchmark for benchmark in json.load(f)['benchmarks']}
+
+baseline = load(args.baseline)
+contender = load(args.contender)
+
+print('{:<48} {:>14} {:>14} {:>8}'.format('benchmark', 'baseline [us]', 'contender [us]', 'ratio'))
+for name, benchmark in baseline.items():
+    if name not in contender:
+        print('{:<48} {:>14} {:>14} {:>8}'.format(name, benchmark['median'] // 1000, '-', '-'))
+        continue
+
+    baselineMedian = benchmark['median']
+    contenderMedian = contender[name]['median']
+    ratio = contenderMedian / baselineMedian if baselineMedian else float('inf')
+    if benchmark['parameters'] != contender[name]['parameters']:
+        marker = '(different parameters)'
+    elif ratio > 1 + args.threshold:
+        marker = 'slower'
+    elif ratio < 1 - args.threshold:
+        marker = 'faster'
+    else:
+        marker = ''
+
+    print('{:<48} {:>14} {:>14} {:>8.3f} {}'.format(
+        name, baselineMedian // 1000, contenderMedian // 1000, ratio, marker))
+
+for name, benchmark in contender.items():
+    if name not in baseline:
+        print('{:<48} {:>14} {:>14} {:>8}'.format(name, '-', benchmark['median'] // 1000, '-'))
@@ -0,0 +1,445 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/opt/alias-analyses/AgnosticModRefSummarizer.hpp>
+#include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
+#include <jlm/llvm/opt/alias-analyses/MemoryStateEncoder.hpp>
+#include <jlm/llvm/opt/alias-analyses/RegionAwareModRefSummarizer.hpp>
+#include <jlm/llvm/opt/CommonNodeElimination.hpp>
+#include <jlm/llvm/opt/DeadNodeElimination.hpp>
+#include <jlm/llvm/opt/NodeReduction.hpp>
+#include <jlm/llvm/TestRvsdgs.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/time.hpp>
+
+#include <llvm/Support/CommandLine.h>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <regex>
+
+namespace jlm
+{
+
+namespace
+{
+
+/**
+ * A parameterized generator of synthetic RVSDG modules.
+ */
+struct Generator
+{
+  std::string name;
+  std::vector<std::pair<std::string, size_t>> parameters;
+  std::function<std::unique_ptr<llvm::RvsdgTest>()> create;
+};
+
+/**
+ * An operation whose execution time is measured on the modules of a generator.
+ *
+ * The run function performs a single repetition of the operation on a freshly generated module
+ * and returns the execution time in nanoseconds. Any preparation of the module that is not part of
+ * the operation, e.g., computing a points-to graph for the memory state encoder, is excluded.
+ */
+struct Operation
+{
+  std::string name;
+  std::function<size_t(const Generator &)> run;
+};
+
+struct Result
+{
+  const Generator * generator;
+  const Operation * operation;
+  size_t numNodes;
+  std::vector<size_t> samples;
+};
+
+template<typename F>
+size_t
+Measure(F && function)
+{
+  util::Timer timer;
+  timer.start();
+  function();
+  timer.stop();
+  return timer.ns();
+}
+
+/**
+ * Visits all nodes of \p region and its subregions in top-down order.
+ *
+ * @return The number of visited nodes.
+ */
+size_t
+Traverse(rvsdg::Region & region)
+{
+  size_t numNodes = 0;
+  for (const auto node : rvsdg::TopDownTraverser(&region))
+  {
+    numNodes++;
+    if (auto structuralNode = dynamic_cast<rvsdg::StructuralNode *>(node))
+    {
+      for (auto & subregion : structuralNode->Subregions())
+        numNodes += Traverse(subregion);
+    }
+  }
+
+  return numNodes;
+}
+
+template<class TransformationType>
+Operation
+CreateTransformationOperation(std::string name)
+{
+  return { std::move(name),
+           [](const Generator & generator)
+           {
+             auto test = generator.create();
+             auto & rvsdgModule = test->module();
+             util::StatisticsCollector statisticsCollector;
+             return Measure(
+                 [&]()
+                 {
+                   TransformationType().Run(rvsdgModule, statisticsCollector);
+                 });
+           } };
+}
+
+template<class ModRefSummarizerType>
+Operation
+CreateModRefSummarizerOperation(std::string name)
+{
+  return { std::move(name),
+           [](const Generator & generator)
+           {
+             auto test = generator.create();
+             auto & rvsdgModule = test->module();
+             util::StatisticsCollector statisticsCollector;
+             auto pointsToGraph = llvm::aa::Andersen().Analyze(rvsdgModule, statisticsCollector);
+             return Measure(
+                 [&]()
+                 {
+                   ModRefSummarizerType().SummarizeModRefs(
+                       rvsdgModule,
+                       *pointsToGraph,
+                       statisticsCollector);
+                 });
+           } };
+}
+
+/**
+ * Creates an operation that analyzes the module with every configuration of
+ * Andersen::Configuration::GetAllConfigurations() that stores points-to sets in \p representation.
+ * The execution time is the sum over all configurations, which makes the sweeps of the different
+ * representations comparable.
+ */
+Operation
+CreateAndersenSweepOperation(llvm::aa::PointsToSet::Representation representation)
+{
+  auto name = "AndersenSweep"
+            + std::string(llvm::aa::PointsToSet::RepresentationToString(representation));
+  return { std::move(name),
+           [representation](const Generator & generator)
+           {
+             auto test = generator.create();
+             auto & rvsdgModule = test->module();
+             util::StatisticsCollector statisticsCollector;
+
+             size_t time = 0;
+             for (auto & config : llvm::aa::Andersen::Configuration::GetAllConfigurations())
+             {
+               if (config.GetPointsToSetRepresentation() != representation)
+                 continue;
+
+               llvm::aa::Andersen andersen;
+               andersen.SetConfiguration(config);
+               time += Measure(
+                   [&]()
+                   {
+                     andersen.Analyze(rvsdgModule, statisticsCollector);
+                   });
+             }
+             return time;
+           } };
+}
+
+std::vector<Generator>
+CreateGenerators(size_t scale)
+{
+  const size_t numWideRegionNodes = 100000 * scale;
+  const size_t nestingDepth = 20;
+  const size_t numNodesPerNestedRegion = 5000 * scale;
+  const size_t numCallGraphFunctions = 5000 * scale;
+  const size_t numCallsPerFunction = 8;
+  const size_t numPointerFunctions = 1000 * scale;
+  const size_t numAllocasPerFunction = 16;
+
+  return {
+    { "WideRegion",
+      { { "numNodes", numWideRegionNodes } },
+      [=]()
+      {
+        return std::make_unique<llvm::ScalableWideRegionTest>(numWideRegionNodes);
+      } },
+    { "Nesting",
+      { { "depth", nestingDepth }, { "numNodesPerRegion", numNodesPerNestedRegion } },
+      [=]()
+      {
+        return std::make_unique<llvm::ScalableNestingTest>(nestingDepth, numNodesPerNestedRegion);
+      } },
+    { "CallGraph",
+      { { "numFunctions", numCallGraphFunctions }, { "numCallsPerFunction", numCallsPerFunction } },
+      [=]()
+      {
+        return std::make_unique<llvm::ScalableCallGraphTest>(
+            numCallGraphFunctions,
+            numCallsPerFunction);
+      } },
+    { "Pointer",
+      { { "numFunctions", numPointerFunctions },
+        { "numAllocasPerFunction", numAllocasPerFunction } },
+      [=]()
+      {
+        return std::make_unique<llvm::ScalablePointerTest>(
+            numPointerFunctions,
+            numAllocasPerFunction);
+      } },
+  };
+}
+
+std::vector<Operation>
+CreateOperations(bool includeAndersenSweeps)
+{
+  std::vector<Operation> operations = {
+    { "Create",
+      [](const Generator & generator)
+      {
+        std::unique_ptr<llvm::RvsdgTest> test;
+        return Measure(
+            [&]()
+            {
+              test = generator.create();
+              test->InitializeTest();
+            });
+      } },
+    { "Traverse",
+      [](const Generator & generator)
+      {
+        auto test = generator.create();
+        auto & rootRegion = test->module().Rvsdg().GetRootRegion();
+        return Measure(
+            [&]()
+            {
+              Traverse(rootRegion);
+            });
+      } },
+    { "Copy",
+      [](const Generator & generator)
+      {
+        auto test = generator.create();
+        auto & rvsdgModule = test->module();
+        // Keep the copy alive such that its destruction is not measured
+        std::unique_ptr<rvsdg::RvsdgModule> copy;
+        return Measure(
+            [&]()
+            {
+              copy = rvsdgModule.copy();
+            });
+      } },
+    CreateTransformationOperation<llvm::DeadNodeElimination>("DeadNodeElimination"),
+    CreateTransformationOperation<llvm::CommonNodeElimination>("CommonNodeElimination"),
+    CreateTransformationOperation<llvm::NodeReduction>("NodeReduction"),
+    { "Andersen",
+      [](const Generator & generator)
+      {
+        auto test = generator.create();
+        auto & rvsdgModule = test->module();
+        util::StatisticsCollector statisticsCollector;
+        return Measure(
+            [&]()
+            {
+              llvm::aa::Andersen().Analyze(rvsdgModule, statisticsCollector);
+            });
+      } },
+    CreateModRefSummarizerOperation<llvm::aa::AgnosticModRefSummarizer>(
+        "AgnosticModRefSummarizer"),
+    CreateModRefSummarizerOperation<llvm::aa::RegionAwareModRefSummarizer>(
+        "RegionAwareModRefSummarizer"),
+    { "MemoryStateEncoder",
+      [](const Generator & generator)
+      {
+        auto test = generator.create();
+        auto & rvsdgModule = test->module();
+        util::StatisticsCollector statisticsCollector;
+        auto pointsToGraph = llvm::aa::Andersen().Analyze(rvsdgModule, statisticsCollector);
+        auto modRefSummary = llvm::aa::RegionAwareModRefSummarizer::Create(
+            rvsdgModule,
+            *pointsToGraph,
+            statisticsCollector);
+        return Measure(
+            [&]()
+            {
+              llvm::aa::MemoryStateEncoder().Encode(
+                  rvsdgModule,
+                  *modRefSummary,
+                  statisticsCollector);
+            });
+      } },
+  };
+
+  // Each sweep runs hundreds of analyses, so they are only included on request
+  if (includeAndersenSweeps)
+  {
+    using Representation = llvm::aa::PointsToSet::Representation;
+    operations.push_back(CreateAndersenSweepOperation(Representation::HashSet));
+    operations.push_back(CreateAndersenSweepOperation(Representation::SparseBitVector));
+  }
+
+  return operations;
+}
+
+size_t
+Median(std::vector<size_t> samples)
+{
+  std::sort(samples.begin(), samples.end());
+  return samples[samples.size() / 2];
+}
+
+void
+PrintJson(std::ostream & out, size_t scale, size_t repetitions, const std::vector<Result> & results)
+{
+  out << "{\n  \"scale\": " << scale << ",\n  \"repetitions\": " << repetitions
+      << ",\n  \"benchmarks\": [";
+
+  bool isFirstResult = true;
+  for (auto & result : results)
+  {
+    out << (isFirstResult ? "\n" : ",\n");
+    isFirstResult = false;
+
+    auto & generator = *result.generator;
+    auto & operation = *result.operation;
+    out << "    {\"name\": \"" << generator.name << '/' << operation.name << "\", \"generator\": \""
+        << generator.name << "\", \"operation\": \"" << operation.name << "\", \"parameters\": {";
+
+    bool isFirstParameter = true;
+    for (auto & [name, value] : generator.parameters)
+    {
+      out << (isFirstParameter ? "" : ", ") << '"' << name << "\": " << value;
+      isFirstParameter = false;
+    }
+
+    out << "}, \"numNodes\": " << result.numNodes << ", \"samples\": [";
+    for (size_t n = 0; n < result.samples.size(); n++)
+      out << (n == 0 ? "" : ", ") << result.samples[n];
+
+    out << "], \"min\": " << *std::min_element(result.samples.begin(), result.samples.end())
+        << ", \"median\": " << Median(result.samples) << "}";
+  }
+
+  out << "\n  ]\n}\n";
+}
+
+}
+
+}
+
+int
+main(int argc, char ** argv)
+{
+  using namespace ::llvm;
+  using namespace jlm;
+
+  cl::opt<size_t> scale(
+      "scale",
+      cl::desc("Scale factor for the size of the generated RVSDGs. Default: 1"),
+      cl::init(1));
+
+  cl::opt<size_t> repetitions(
+      "repetitions",
+      cl::desc("Number of repetitions of each benchmark. Default: 5"),
+      cl::init(5));
+
+  cl::opt<std::string> filter(
+      "filter",
+      cl::desc("Only run benchmarks whose name, i.e., <generator>/<operation>, matches the regex"),
+      cl::init(".*"));
+
+  cl::opt<std::string> outputFile(
+      "o",
+      cl::desc("Write the results as JSON to <file>"),
+      cl::value_desc("file"));
+
+  cl::opt<bool> andersenSweeps(
+      "andersen-sweeps",
+      cl::desc("Also run Andersen with all solver configurations, once for each points-to set "
+               "representation"),
+      cl::init(false));
+
+  cl::ParseCommandLineOptions(argc, argv, "Microbenchmarks of RVSDG operations and passes\n");
+
+  if (scale == 0 || repetitions == 0)
+  {
+    std::cerr << "The scale and number of repetitions must be positive.\n";
+    exit(EXIT_FAILURE);
+  }
+
+  std::regex filterRegex;
+  try
+  {
+    filterRegex = std::regex(filter.getValue());
+  }
+  catch (const std::regex_error &)
+  {
+    std::cerr << "Invalid filter: " << filter << "\n";
+    exit(EXIT_FAILURE);
+  }
+
+  const auto generators = CreateGenerators(scale);
+  const auto operations = CreateOperations(andersenSweeps);
+
+  std::vector<Result> results;
+  for (auto & generator : generators)
+  {
+    std::optional<size_t> numNodes;
+    for (auto & operation : operations)
+    {
+      const auto name = generator.name + "/" + operation.name;
+      if (!std::regex_search(name, filterRegex))
+        continue;
+
+      if (!numNodes)
+        numNodes = jlm::rvsdg::nnodes(&generator.create()->module().Rvsdg().GetRootRegion());
+
+      Result result{ &generator, &operation, *numNodes, {} };
+      for (size_t n = 0; n < repetitions; n++)
+        result.samples.push_back(operation.run(generator));
+
+      std::cout << std::left << std::setw(48) << name << std::right << std::setw(10) << *numNodes
+                << " nodes" << std::setw(14) << Median(result.samples) / 1000 << " us\n"
+                << std::flush;
+      results.push_back(std::move(result));
+    }
+  }
+
+  if (!outputFile.empty())
+  {
+    std::ofstream out(outputFile);
+    if (!out)
+    {
+      std::cerr << "Could not open " << outputFile << " for writing.\n";
+      exit(EXIT_FAILURE);
+    }
+    PrintJson(out, scale, repetitions, results);
+  }
+
+  return 0;
+}
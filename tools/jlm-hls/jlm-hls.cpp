@@ -67,6 +67,7 @@ main(int argc, char ** argv)
       {},
       jlm::util::FilePath::TempDirectoryPath(),
       moduleName);
+  settings.setTracingEnabled(commandLineOptions.trace_);
   jlm::util::StatisticsCollector collector(std::move(settings));
 
   /* LLVM to JLM pass */